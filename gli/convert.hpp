@@ -13,12 +13,35 @@
 
 namespace gli
 {
+	/// Trade-off between the encoding speed and the quality of the compressed formats
+	enum encode_preset
+	{
+		ENCODE_PRESET_FAST, ENCODE_PRESET_FIRST = ENCODE_PRESET_FAST,
+		ENCODE_PRESET_DEFAULT,
+		ENCODE_PRESET_SLOW, ENCODE_PRESET_LAST = ENCODE_PRESET_SLOW
+	};
+
+	enum
+	{
+		ENCODE_PRESET_COUNT = ENCODE_PRESET_LAST - ENCODE_PRESET_FIRST + 1
+	};
+
 	/// Convert texture data to a new format
 	///
-	/// @param Texture Source texture, the format must be uncompressed.
-	/// @param Format Destination Texture format, it must be uncompressed.
+	/// @param Texture Source texture, the format must be uncompressed or have a decoder.
+	/// @param Format Destination Texture format, it must be uncompressed or have an encoder, see has_encoder.
+	/// @param Preset Search effort of the encoder when Format is compressed. The blocks of each level are encoded in parallel.
+	template <typename texture_type>
+	texture_type convert(texture_type const& Texture, format Format, encode_preset Preset = ENCODE_PRESET_DEFAULT);
+
+	/// Copy texture data to a new format storing the same components in a different order, such as BGRA8 to RGBA8 or BGR8 to RGBA8.
+	/// The swizzles of Texture are applied so each channel keeps its meaning and the returned texture uses the default swizzles.
+	/// Components missing in the source are set to zero for color and to one for alpha.
+	///
+	/// @param Texture Source texture, the format must be uncompressed and not packed.
+	/// @param Format Destination texture format, it must have the same component type and size as the source format.
 	template <typename texture_type>
-	texture_type convert(texture_type const& Texture, format Format);
+	texture_type reorder_components(texture_type const& Texture, format Format);
 }//namespace gli
 
 #include "./core/convert.inl"
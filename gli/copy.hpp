@@ -4,6 +4,7 @@
 #pragma once
 
 #include "type.hpp"
+#include "texture.hpp"
 
 namespace gli
 {
@@ -13,6 +14,19 @@ namespace gli
 		texture_src_type const& TextureSrc, size_t LayerSrc, size_t FaceSrc, size_t LevelSrc,
 		texture_dst_type& TextureDst, size_t LayerDst, size_t FaceDst, size_t LevelDst);
 
+	/// Copy a region of a specific image of a texture into a region of a specific image of another texture.
+	/// When the formats are different, the texels are converted to the destination format.
+	///
+	/// @param OffsetSrc Texel offset of the region in the source image, aligned on blocks.
+	/// @param OffsetDst Texel offset of the region in the destination image, aligned on blocks.
+	/// @param Extent Texel extent of the region, an extent ending inside a block covers the whole block to include the partial blocks at the edge of compressed images.
+	/// A conversion requires an uncompressed destination format and a source format either uncompressed or with a decoder.
+	template <typename texture_src_type, typename texture_dst_type>
+	void copy(
+		texture_src_type const& TextureSrc, size_t LayerSrc, size_t FaceSrc, size_t LevelSrc, texture::extent_type const& OffsetSrc,
+		texture_dst_type& TextureDst, size_t LayerDst, size_t FaceDst, size_t LevelDst, texture::extent_type const& OffsetDst,
+		texture::extent_type const& Extent);
+
 	/// Copy a texture
 	template <typename texture_src_type, typename texture_dst_type>
 	void copy(
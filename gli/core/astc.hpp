@@ -0,0 +1,39 @@
+/// @brief Include to decompress the ASTC compression scheme
+/// @file gli/astc.hpp
+
+#pragma once
+
+#include "./block_cache.hpp"
+
+namespace gli
+{
+	namespace detail
+	{
+		// ASTC blocks of every 2D footprint, stored as a little endian 128 bits integer
+		struct astc_block {
+			glm::uint8 Data[16];
+		};
+
+		// Decode the BlockWidth x BlockHeight texels of a block to Texels[Row * RowPitch + Col].
+		// LDR endpoints decode to [0, 1], HDR endpoints decode to half float values. With SRGB, the color channels are the
+		// sRGB encoded values and HDR blocks are errors. Error blocks decode to magenta.
+		template <glm::uint BlockWidth, glm::uint BlockHeight>
+		void decode_astc_block(const astc_block &Block, bool SRGB, glm::vec4 *Texels, size_t RowPitch);
+		void decode_astc_block(const astc_block &Block, extent2d const& BlockExtent, bool SRGB, glm::vec4 *Texels, size_t RowPitch);
+
+		// Decode a row of BlockCount contiguous blocks to the BlockExtent.y rows of BlockCount * BlockExtent.x texels starting at Texels, RowPitch texels apart
+		template <glm::uint BlockWidth, glm::uint BlockHeight>
+		void decode_astc_row(const astc_block *Blocks, size_t BlockCount, bool SRGB, glm::vec4 *Texels, size_t RowPitch);
+		void decode_astc_row(const astc_block *Blocks, size_t BlockCount, extent2d const& BlockExtent, bool SRGB, glm::vec4 *Texels, size_t RowPitch);
+
+		template <glm::uint BlockWidth, glm::uint BlockHeight, bool SRGB>
+		texel_block12x12 decompress_astc_block(const astc_block &Block);
+
+		typedef texel_block12x12(*astc_decompress_func)(const astc_block &Block);
+
+		// Return the function decompressing the blocks of an ASTC format
+		astc_decompress_func astc_decompress_function(format Format);
+	}//namespace detail
+}//namespace gli
+
+#include "./astc.inl"
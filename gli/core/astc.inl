@@ -0,0 +1,1166 @@
+#include <glm/gtc/packing.hpp>
+#include <glm/ext/scalar_uint_sized.hpp>
+#include <utility>
+
+namespace gli
+{
+	namespace detail
+	{
+		// Trits, quints and bits of the integer sequence encoding ranges, by increasing number of levels
+		struct astc_range
+		{
+			glm::uint8 Trits;
+			glm::uint8 Quints;
+			glm::uint8 Bits;
+		};
+
+		static astc_range const ASTC_RANGES[21] =
+		{
+			{0, 0, 1}, {1, 0, 0}, {0, 0, 2}, {0, 1, 0}, {1, 0, 1}, {0, 0, 3}, {0, 1, 1},	// 2, 3, 4, 5, 6, 8, 10 levels
+			{1, 0, 2}, {0, 0, 4}, {0, 1, 2}, {1, 0, 3}, {0, 0, 5}, {0, 1, 3}, {1, 0, 4},	// 12, 16, 20, 24, 32, 40, 48 levels
+			{0, 0, 6}, {0, 1, 4}, {1, 0, 5}, {0, 0, 7}, {0, 1, 5}, {1, 0, 6}, {0, 0, 8}		// 64, 80, 96, 128, 160, 192, 256 levels
+		};
+
+		// Color endpoint values are decoded with the smallest range of 6 levels
+		static unsigned const ASTC_MIN_COLOR_RANGE = 4;
+
+		static glm::vec4 const ASTC_ERROR_COLOR(1.0f, 0.0f, 1.0f, 1.0f);
+
+		class astc_bit_reader
+		{
+		public:
+			explicit astc_bit_reader(glm::uint8 const *Data) :
+				Low(0),
+				High(0)
+			{
+				for(int Byte = 0; Byte < 8; ++Byte)
+				{
+					this->Low |= static_cast<glm::uint64>(Data[Byte]) << (Byte * 8);
+					this->High |= static_cast<glm::uint64>(Data[Byte + 8]) << (Byte * 8);
+				}
+			}
+
+			// Read Count bits, up to 32, starting at bit Position. Bits past the end of the block read as zero.
+			glm::uint32 read(unsigned Position, unsigned Count) const
+			{
+				if(Count == 0 || Position >= 128)
+					return 0;
+
+				glm::uint64 Bits;
+				if(Position == 0)
+					Bits = this->Low;
+				else if(Position < 64)
+					Bits = (this->Low >> Position) | (this->High << (64 - Position));
+				else
+					Bits = this->High >> (Position - 64);
+
+				return static_cast<glm::uint32>(Bits & ((static_cast<glm::uint64>(1) << Count) - 1));
+			}
+
+		private:
+			glm::uint64 Low;
+			glm::uint64 High;
+		};
+
+		inline glm::uint8 astc_reverse_byte(glm::uint8 Byte)
+		{
+			Byte = static_cast<glm::uint8>(((Byte & 0xF0) >> 4) | ((Byte & 0x0F) << 4));
+			Byte = static_cast<glm::uint8>(((Byte & 0xCC) >> 2) | ((Byte & 0x33) << 2));
+			return static_cast<glm::uint8>(((Byte & 0xAA) >> 1) | ((Byte & 0x55) << 1));
+		}
+
+		inline unsigned astc_ise_bit_count(unsigned Count, unsigned Range)
+		{
+			astc_range const& R = ASTC_RANGES[Range];
+			return Count * R.Bits + (R.Trits ? (Count * 8 + 4) / 5 : 0) + (R.Quints ? (Count * 7 + 2) / 3 : 0);
+		}
+
+		// Unpack the 5 trits encoded by the 8 bits T
+		inline void astc_decode_trits(unsigned T, unsigned *Trits)
+		{
+			unsigned C;
+			if(((T >> 2) & 7) == 7)
+			{
+				C = (((T >> 5) & 7) << 2) | (T & 3);
+				Trits[4] = 2;
+				Trits[3] = 2;
+			}
+			else
+			{
+				C = T & 0x1F;
+				if(((T >> 5) & 3) == 3)
+				{
+					Trits[4] = 2;
+					Trits[3] = (T >> 7) & 1;
+				}
+				else
+				{
+					Trits[4] = (T >> 7) & 1;
+					Trits[3] = (T >> 5) & 3;
+				}
+			}
+
+			if((C & 3) == 3)
+			{
+				Trits[2] = 2;
+				Trits[1] = (C >> 4) & 1;
+				Trits[0] = (((C >> 3) & 1) << 1) | ((C >> 2) & ~(C >> 3) & 1);
+			}
+			else if(((C >> 2) & 3) == 3)
+			{
+				Trits[2] = 2;
+				Trits[1] = 2;
+				Trits[0] = C & 3;
+			}
+			else
+			{
+				Trits[2] = (C >> 4) & 1;
+				Trits[1] = (C >> 2) & 3;
+				Trits[0] = (((C >> 1) & 1) << 1) | (C & ~(C >> 1) & 1);
+			}
+		}
+
+		// Unpack the 3 quints encoded by the 7 bits Q
+		inline void astc_decode_quints(unsigned Q, unsigned *Quints)
+		{
+			if(((Q >> 1) & 3) == 3 && ((Q >> 5) & 3) == 0)
+			{
+				unsigned const Q0 = Q & 1;
+				Quints[2] = (Q0 << 2) | ((((Q >> 4) & ~Q0) & 1) << 1) | (((Q >> 3) & ~Q0) & 1);
+				Quints[1] = 4;
+				Quints[0] = 4;
+				return;
+			}
+
+			unsigned C;
+			if(((Q >> 1) & 3) == 3)
+			{
+				Quints[2] = 4;
+				C = (((Q >> 3) & 3) << 3) | ((~(Q >> 5) & 3) << 1) | (Q & 1);
+			}
+			else
+			{
+				Quints[2] = (Q >> 5) & 3;
+				C = Q & 0x1F;
+			}
+
+			if((C & 7) == 5)
+			{
+				Quints[1] = 4;
+				Quints[0] = (C >> 3) & 3;
+			}
+			else
+			{
+				Quints[1] = (C >> 3) & 3;
+				Quints[0] = C & 7;
+			}
+		}
+
+		// Decode Count integers of Range encoded from bit Position to Values, each stored as its trit or quint above its bits
+		inline void astc_decode_ise(astc_bit_reader const& Reader, unsigned Position, unsigned Count, unsigned Range, glm::uint8 *Values)
+		{
+			astc_range const& R = ASTC_RANGES[Range];
+			unsigned const End = Position + astc_ise_bit_count(Count, Range);
+
+			// The last block of trits or quints may be partial, its missing bits are zero
+			auto Read = [&](unsigned BitCount) -> unsigned
+			{
+				unsigned const Value = Position < End ? Reader.read(Position, glm::min(BitCount, End - Position)) : 0;
+				Position += BitCount;
+				return Value;
+			};
+
+			if(R.Trits)
+			{
+				for(unsigned First = 0; First < Count; First += 5)
+				{
+					unsigned Bits[5];
+					unsigned T = 0;
+					Bits[0] = Read(R.Bits);
+					T |= Read(2);
+					Bits[1] = Read(R.Bits);
+					T |= Read(2) << 2;
+					Bits[2] = Read(R.Bits);
+					T |= Read(1) << 4;
+					Bits[3] = Read(R.Bits);
+					T |= Read(2) << 5;
+					Bits[4] = Read(R.Bits);
+					T |= Read(1) << 7;
+
+					unsigned Trits[5];
+					astc_decode_trits(T, Trits);
+					for(unsigned Index = 0; Index < 5 && First + Index < Count; ++Index)
+						Values[First + Index] = static_cast<glm::uint8>((Trits[Index] << R.Bits) | Bits[Index]);
+				}
+			}
+			else if(R.Quints)
+			{
+				for(unsigned First = 0; First < Count; First += 3)
+				{
+					unsigned Bits[3];
+					unsigned Q = 0;
+					Bits[0] = Read(R.Bits);
+					Q |= Read(3);
+					Bits[1] = Read(R.Bits);
+					Q |= Read(2) << 3;
+					Bits[2] = Read(R.Bits);
+					Q |= Read(2) << 5;
+
+					unsigned Quints[3];
+					astc_decode_quints(Q, Quints);
+					for(unsigned Index = 0; Index < 3 && First + Index < Count; ++Index)
+						Values[First + Index] = static_cast<glm::uint8>((Quints[Index] << R.Bits) | Bits[Index]);
+				}
+			}
+			else
+			{
+				for(unsigned Index = 0; Index < Count; ++Index)
+					Values[Index] = static_cast<glm::uint8>(Read(R.Bits));
+			}
+		}
+
+		// Repeat the Bits bits of Value to fill TargetBits bits
+		inline unsigned astc_replicate(unsigned Value, unsigned Bits, unsigned TargetBits)
+		{
+			unsigned Result = 0;
+			unsigned Filled = 0;
+			for(; Filled < TargetBits; Filled += Bits)
+				Result = (Result << Bits) | Value;
+			return Result >> (Filled - TargetBits);
+		}
+
+		// Unquantize a color endpoint value to [0, 255]
+		inline unsigned astc_unquantize_color(unsigned Value, unsigned Range)
+		{
+			astc_range const& R = ASTC_RANGES[Range];
+			if(!R.Trits && !R.Quints)
+				return astc_replicate(Value, R.Bits, 8);
+
+			unsigned const D = Value >> R.Bits;
+			unsigned const A = (Value & 1) ? 0x1FF : 0;
+			unsigned const X = (Value & ((1u << R.Bits) - 1)) >> 1;
+
+			unsigned B = 0;
+			unsigned C = 0;
+			if(R.Trits)
+			{
+				switch(R.Bits)
+				{
+				case 1: C = 204; break;
+				case 2: C = 93; B = (X << 8) | (X << 4) | (X << 2) | (X << 1); break;
+				case 3: C = 44; B = (X << 7) | (X << 2) | X; break;
+				case 4: C = 22; B = (X << 6) | X; break;
+				case 5: C = 11; B = (X << 5) | (X >> 2); break;
+				default: C = 5; B = (X << 4) | (X >> 4); break;
+				}
+			}
+			else
+			{
+				switch(R.Bits)
+				{
+				case 1: C = 113; break;
+				case 2: C = 54; B = (X << 8) | (X << 3) | (X << 2); break;
+				case 3: C = 26; B = (X << 7) | (X << 1) | (X >> 1); break;
+				case 4: C = 13; B = (X << 6) | (X >> 1); break;
+				default: C = 6; B = (X << 5) | (X >> 3); break;
+				}
+			}
+
+			unsigned const T = ((D * C + B) ^ A) & 0x1FF;
+			return (A & 0x80) | (T >> 2);
+		}
+
+		// Unquantize a weight to [0, 64]
+		inline unsigned astc_unquantize_weight(unsigned Value, unsigned Range)
+		{
+			astc_range const& R = ASTC_RANGES[Range];
+
+			unsigned T;
+			if(!R.Trits && !R.Quints)
+				T = astc_replicate(Value, R.Bits, 6);
+			else if(R.Bits == 0)
+			{
+				static unsigned const TRITS[3] = {0, 32, 63};
+				static unsigned const QUINTS[5] = {0, 16, 32, 47, 63};
+				T = R.Trits ? TRITS[Value] : QUINTS[Value];
+			}
+			else
+			{
+				unsigned const D = Value >> R.Bits;
+				unsigned const A = (Value & 1) ? 0x7F : 0;
+				unsigned const X = (Value & ((1u << R.Bits) - 1)) >> 1;
+
+				unsigned B = 0;
+				unsigned C = 0;
+				if(R.Trits)
+				{
+					switch(R.Bits)
+					{
+					case 1: C = 50; break;
+					case 2: C = 23; B = (X << 6) | (X << 2) | X; break;
+					default: C = 11; B = (X << 5) | X; break;
+					}
+				}
+				else
+				{
+					switch(R.Bits)
+					{
+					case 1: C = 28; break;
+					default: C = 13; B = (X << 6) | (X << 1); break;
+					}
+				}
+
+				T = (A & 0x20) | ((((D * C + B) ^ A) & 0x7F) >> 2);
+			}
+
+			return T > 32 ? T + 1 : T;
+		}
+
+		inline glm::uint32 astc_hash52(glm::uint32 Value)
+		{
+			Value ^= Value >> 15;
+			Value *= 0xEEDE0891;
+			Value ^= Value >> 5;
+			Value += Value << 16;
+			Value ^= Value >> 7;
+			Value ^= Value >> 3;
+			Value ^= Value << 6;
+			Value ^= Value >> 17;
+			return Value;
+		}
+
+		// Return the partition of the texel at X, Y, Z for the partition pattern Seed
+		inline unsigned astc_select_partition(unsigned Seed, unsigned X, unsigned Y, unsigned Z, unsigned PartitionCount, bool SmallBlock)
+		{
+			if(SmallBlock)
+			{
+				X <<= 1;
+				Y <<= 1;
+				Z <<= 1;
+			}
+
+			Seed += (PartitionCount - 1) * 1024;
+
+			glm::uint32 const Random = astc_hash52(Seed);
+
+			unsigned Seeds[12];
+			for(int Index = 0; Index < 8; ++Index)
+				Seeds[Index] = (Random >> (Index * 4)) & 0xF;
+			Seeds[8] = (Random >> 18) & 0xF;
+			Seeds[9] = (Random >> 22) & 0xF;
+			Seeds[10] = (Random >> 26) & 0xF;
+			Seeds[11] = ((Random >> 30) | (Random << 2)) & 0xF;
+
+			unsigned Shift1, Shift2;
+			if(Seed & 1)
+			{
+				Shift1 = (Seed & 2) ? 4 : 5;
+				Shift2 = PartitionCount == 3 ? 6 : 5;
+			}
+			else
+			{
+				Shift1 = PartitionCount == 3 ? 6 : 5;
+				Shift2 = (Seed & 2) ? 4 : 5;
+			}
+			unsigned const Shift3 = (Seed & 0x10) ? Shift1 : Shift2;
+
+			for(int Index = 0; Index < 12; ++Index)
+				Seeds[Index] = (Seeds[Index] * Seeds[Index]) >> (Index >= 8 ? Shift3 : (Index & 1) ? Shift2 : Shift1);
+
+			unsigned const A = (Seeds[0] * X + Seeds[1] * Y + Seeds[10] * Z + (Random >> 14)) & 0x3F;
+			unsigned const B = (Seeds[2] * X + Seeds[3] * Y + Seeds[11] * Z + (Random >> 10)) & 0x3F;
+			unsigned const C = PartitionCount < 3 ? 0 : (Seeds[4] * X + Seeds[5] * Y + Seeds[8] * Z + (Random >> 6)) & 0x3F;
+			unsigned const D = PartitionCount < 4 ? 0 : (Seeds[6] * X + Seeds[7] * Y + Seeds[9] * Z + (Random >> 2)) & 0x3F;
+
+			if(A >= B && A >= C && A >= D)
+				return 0;
+			if(B >= C && B >= D)
+				return 1;
+			if(C >= D)
+				return 2;
+			return 3;
+		}
+
+		// Decode the block mode to the weight grid dimensions and range, returns false for reserved modes
+		inline bool astc_decode_block_mode(glm::uint32 Mode, unsigned &WeightWidth, unsigned &WeightHeight, unsigned &WeightRange, bool &DualPlane)
+		{
+			unsigned const A = (Mode >> 5) & 3;
+			unsigned HighPrecision = (Mode >> 9) & 1;
+			unsigned Range;
+			DualPlane = ((Mode >> 10) & 1) != 0;
+
+			if(Mode & 3)
+			{
+				Range = ((Mode & 3) << 1) | ((Mode >> 4) & 1);
+				unsigned const B = (Mode >> 7) & 3;
+				switch((Mode >> 2) & 3)
+				{
+				case 0: WeightWidth = B + 4; WeightHeight = A + 2; break;
+				case 1: WeightWidth = B + 8; WeightHeight = A + 2; break;
+				case 2: WeightWidth = A + 2; WeightHeight = B + 8; break;
+				default:
+					if((Mode >> 8) & 1)
+					{
+						WeightWidth = (B & 1) + 2;
+						WeightHeight = A + 2;
+					}
+					else
+					{
+						WeightWidth = A + 2;
+						WeightHeight = (B & 1) + 6;
+					}
+					break;
+				}
+			}
+			else
+			{
+				Range = (((Mode >> 2) & 3) << 1) | ((Mode >> 4) & 1);
+				unsigned const B = (Mode >> 9) & 3;
+				switch((Mode >> 7) & 3)
+				{
+				case 0: WeightWidth = 12; WeightHeight = A + 2; break;
+				case 1: WeightWidth = A + 2; WeightHeight = 12; break;
+				case 2:
+					WeightWidth = A + 6;
+					WeightHeight = B + 6;
+					HighPrecision = 0;
+					DualPlane = false;
+					break;
+				default:
+					if(A == 0)
+					{
+						WeightWidth = 6;
+						WeightHeight = 10;
+					}
+					else if(A == 1)
+					{
+						WeightWidth = 10;
+						WeightHeight = 6;
+					}
+					else
+						return false;
+					break;
+				}
+			}
+
+			if(Range < 2)
+				return false;
+
+			WeightRange = Range - 2 + (HighPrecision ? 6 : 0);
+			return true;
+		}
+
+		// Endpoints of a partition with 16 bits per channel, HDR channels hold logarithmic values
+		struct astc_endpoints
+		{
+			glm::ivec4 E0;
+			glm::ivec4 E1;
+			bool HDRColor;
+			bool HDRAlpha;
+		};
+
+		inline void astc_bit_transfer_signed(int &A, int &B)
+		{
+			B >>= 1;
+			B |= A & 0x80;
+			A >>= 1;
+			A &= 0x3F;
+			if(A & 0x20)
+				A -= 0x40;
+		}
+
+		inline glm::ivec4 astc_blue_contract(int R, int G, int B, int A)
+		{
+			return glm::ivec4((R + B) >> 1, (G + B) >> 1, B, A);
+		}
+
+		inline int astc_sign_extend(int Value, int Bits)
+		{
+			int const Sign = 1 << (Bits - 1);
+			return ((Value & ((1 << Bits) - 1)) ^ Sign) - Sign;
+		}
+
+		// HDR RGB endpoints of mode 11, 12 bits per channel
+		inline void astc_decode_hdr_rgb(glm::uint8 const *V, glm::ivec4 &E0, glm::ivec4 &E1)
+		{
+			int const ModeValue = ((V[1] & 0x80) >> 7) | ((V[2] & 0x80) >> 6) | ((V[3] & 0x80) >> 5);
+			int const MajorComponent = ((V[4] & 0x80) >> 7) | ((V[5] & 0x80) >> 6);
+
+			if(MajorComponent == 3)
+			{
+				E0 = glm::ivec4(V[0] << 4, V[2] << 4, (V[4] & 0x7F) << 5, 0x780);
+				E1 = glm::ivec4(V[1] << 4, V[3] << 4, (V[5] & 0x7F) << 5, 0x780);
+				return;
+			}
+
+			int A = V[0] | ((V[1] & 0x40) << 2);
+			int B0 = V[2] & 0x3F;
+			int B1 = V[3] & 0x3F;
+			int C = V[1] & 0x3F;
+			int D0 = V[4] & 0x1F;
+			int D1 = V[5] & 0x1F;
+
+			static int const DELTA_BITS[8] = {7, 6, 7, 6, 5, 6, 5, 6};
+
+			int const X0 = (V[2] >> 6) & 1;
+			int const X1 = (V[3] >> 6) & 1;
+			int const X2 = (V[4] >> 6) & 1;
+			int const X3 = (V[5] >> 6) & 1;
+			int const X4 = (V[4] >> 5) & 1;
+			int const X5 = (V[5] >> 5) & 1;
+
+			// The placement of the variable bits depends on the mode
+			int const OneHotMode = 1 << ModeValue;
+			if(OneHotMode & 0xA4)
+				A |= X0 << 9;
+			if(OneHotMode & 0x08)
+				A |= X2 << 9;
+			if(OneHotMode & 0x50)
+				A |= (X4 << 9) | (X5 << 10);
+			if(OneHotMode & 0xA0)
+				A |= X1 << 10;
+			if(OneHotMode & 0xC0)
+				A |= X2 << 11;
+
+			if(OneHotMode & 0x04)
+				C |= X1 << 6;
+			if(OneHotMode & 0xE8)
+				C |= X3 << 6;
+			if(OneHotMode & 0x20)
+				C |= X2 << 7;
+
+			if(OneHotMode & 0x5B)
+			{
+				B0 |= X0 << 6;
+				B1 |= X1 << 6;
+			}
+			if(OneHotMode & 0x12)
+			{
+				B0 |= X2 << 7;
+				B1 |= X3 << 7;
+			}
+
+			if(OneHotMode & 0xAF)
+			{
+				D0 |= X4 << 5;
+				D1 |= X5 << 5;
+			}
+			if(OneHotMode & 0x05)
+			{
+				D0 |= X2 << 6;
+				D1 |= X3 << 6;
+			}
+
+			D0 = astc_sign_extend(D0, DELTA_BITS[ModeValue]);
+			D1 = astc_sign_extend(D1, DELTA_BITS[ModeValue]);
+
+			int const Scale = 1 << ((ModeValue >> 1) ^ 3);
+			A *= Scale;
+			B0 *= Scale;
+			B1 *= Scale;
+			C *= Scale;
+			D0 *= Scale;
+			D1 *= Scale;
+
+			glm::ivec3 Color0 = glm::clamp(glm::ivec3(A - C, A - B0 - C - D0, A - B1 - C - D1), 0, 0xFFF);
+			glm::ivec3 Color1 = glm::clamp(glm::ivec3(A, A - B0, A - B1), 0, 0xFFF);
+
+			if(MajorComponent == 1)
+			{
+				std::swap(Color0.x, Color0.y);
+				std::swap(Color1.x, Color1.y);
+			}
+			else if(MajorComponent == 2)
+			{
+				std::swap(Color0.x, Color0.z);
+				std::swap(Color1.x, Color1.z);
+			}
+
+			E0 = glm::ivec4(Color0, 0x780);
+			E1 = glm::ivec4(Color1, 0x780);
+		}
+
+		// HDR RGB base and scale endpoints of mode 7, 12 bits per channel
+		inline void astc_decode_hdr_rgb_scale(glm::uint8 const *V, glm::ivec4 &E0, glm::ivec4 &E1)
+		{
+			int const ModeValue = ((V[0] & 0xC0) >> 6) | ((V[1] & 0x80) >> 5) | ((V[2] & 0x80) >> 4);
+
+			int MajorComponent, Mode;
+			if((ModeValue & 0xC) != 0xC)
+			{
+				MajorComponent = ModeValue >> 2;
+				Mode = ModeValue & 3;
+			}
+			else if(ModeValue != 0xF)
+			{
+				MajorComponent = ModeValue & 3;
+				Mode = 4;
+			}
+			else
+			{
+				MajorComponent = 0;
+				Mode = 5;
+			}
+
+			int Red = V[0] & 0x3F;
+			int Green = V[1] & 0x1F;
+			int Blue = V[2] & 0x1F;
+			int Scale = V[3] & 0x1F;
+
+			int const X0 = (V[1] >> 6) & 1;
+			int const X1 = (V[1] >> 5) & 1;
+			int const X2 = (V[2] >> 6) & 1;
+			int const X3 = (V[2] >> 5) & 1;
+			int const X4 = (V[3] >> 7) & 1;
+			int const X5 = (V[3] >> 6) & 1;
+			int const X6 = (V[3] >> 5) & 1;
+
+			// The placement of the variable bits depends on the mode
+			int const OneHotMode = 1 << Mode;
+			if(OneHotMode & 0x30)
+			{
+				Green |= X0 << 6;
+				Blue |= X2 << 6;
+			}
+			if(OneHotMode & 0x3A)
+			{
+				Green |= X1 << 5;
+				Blue |= X3 << 5;
+			}
+
+			if(OneHotMode & 0x3D)
+				Scale |= X6 << 5;
+			if(OneHotMode & 0x2D)
+				Scale |= X5 << 6;
+			if(OneHotMode & 0x04)
+				Scale |= X4 << 7;
+
+			if(OneHotMode & 0x3B)
+				Red |= X4 << 6;
+			if(OneHotMode & 0x04)
+				Red |= X3 << 6;
+			if(OneHotMode & 0x10)
+				Red |= X5 << 7;
+			if(OneHotMode & 0x0F)
+				Red |= X2 << 7;
+			if(OneHotMode & 0x05)
+				Red |= (X1 << 8) | (X0 << 9);
+			if(OneHotMode & 0x0A)
+				Red |= X0 << 8;
+			if(OneHotMode & 0x02)
+				Red |= X6 << 9;
+			if(OneHotMode & 0x01)
+				Red |= X3 << 10;
+			if(OneHotMode & 0x02)
+				Red |= X5 << 10;
+
+			static int const SHIFTS[6] = {1, 1, 2, 3, 4, 5};
+			Red <<= SHIFTS[Mode];
+			Green <<= SHIFTS[Mode];
+			Blue <<= SHIFTS[Mode];
+			Scale <<= SHIFTS[Mode];
+
+			// Green and blue are stored as differences to red except in mode 5
+			if(Mode != 5)
+			{
+				Green = Red - Green;
+				Blue = Red - Blue;
+			}
+
+			if(MajorComponent == 1)
+				std::swap(Red, Green);
+			else if(MajorComponent == 2)
+				std::swap(Red, Blue);
+
+			E0 = glm::ivec4(glm::clamp(glm::ivec3(Red - Scale, Green - Scale, Blue - Scale), 0, 0xFFF), 0x780);
+			E1 = glm::ivec4(glm::clamp(glm::ivec3(Red, Green, Blue), 0, 0xFFF), 0x780);
+		}
+
+		// HDR alpha endpoints of mode 15, 12 bits
+		inline void astc_decode_hdr_alpha(glm::uint8 const *V, int &A0, int &A1)
+		{
+			int const Mode = ((V[0] >> 7) & 1) | ((V[1] >> 6) & 2);
+			int Value0 = V[0] & 0x7F;
+			int Value1 = V[1] & 0x7F;
+
+			if(Mode == 3)
+			{
+				A0 = Value0 << 5;
+				A1 = Value1 << 5;
+				return;
+			}
+
+			Value0 |= (Value1 << (Mode + 1)) & 0x780;
+			Value1 &= 0x3F >> Mode;
+			Value1 ^= 0x20 >> Mode;
+			Value1 -= 0x20 >> Mode;
+			Value0 <<= 4 - Mode;
+			Value1 *= 1 << (4 - Mode);
+			A0 = Value0;
+			A1 = glm::clamp(Value1 + Value0, 0, 0xFFF);
+		}
+
+		// Decode the endpoints of color endpoint mode Mode from the unquantized values V, returns false when the mode is invalid
+		inline bool astc_decode_endpoints(unsigned Mode, glm::uint8 const *V, bool SRGB, astc_endpoints &Endpoints)
+		{
+			bool const HDR = Mode == 2 || Mode == 3 || Mode == 7 || Mode == 11 || Mode == 14 || Mode == 15;
+			if(HDR && SRGB)
+				return false;
+
+			glm::ivec4 E0, E1;
+			int V0 = V[0], V1 = V[1], V2 = V[2], V3 = V[3], V4 = V[4], V5 = V[5];
+
+			switch(Mode)
+			{
+			default:
+			case 0:
+				E0 = glm::ivec4(V0, V0, V0, 0xFF);
+				E1 = glm::ivec4(V1, V1, V1, 0xFF);
+				break;
+			case 1:
+			{
+				int const L0 = (V0 >> 2) | (V1 & 0xC0);
+				int const L1 = glm::min(L0 + (V1 & 0x3F), 0xFF);
+				E0 = glm::ivec4(L0, L0, L0, 0xFF);
+				E1 = glm::ivec4(L1, L1, L1, 0xFF);
+				break;
+			}
+			case 2:
+			{
+				int Y0, Y1;
+				if(V1 >= V0)
+				{
+					Y0 = V0 << 4;
+					Y1 = V1 << 4;
+				}
+				else
+				{
+					Y0 = (V1 << 4) + 8;
+					Y1 = (V0 << 4) - 8;
+				}
+				E0 = glm::ivec4(Y0, Y0, Y0, 0x780);
+				E1 = glm::ivec4(Y1, Y1, Y1, 0x780);
+				break;
+			}
+			case 3:
+			{
+				int Y0, Delta;
+				if(V0 & 0x80)
+				{
+					Y0 = ((V1 & 0xE0) << 4) | ((V0 & 0x7F) << 2);
+					Delta = (V1 & 0x1F) << 2;
+				}
+				else
+				{
+					Y0 = ((V1 & 0xF0) << 4) | ((V0 & 0x7F) << 1);
+					Delta = (V1 & 0x0F) << 1;
+				}
+				int const Y1 = glm::min(Y0 + Delta, 0xFFF);
+				E0 = glm::ivec4(Y0, Y0, Y0, 0x780);
+				E1 = glm::ivec4(Y1, Y1, Y1, 0x780);
+				break;
+			}
+			case 4:
+				E0 = glm::ivec4(V0, V0, V0, V2);
+				E1 = glm::ivec4(V1, V1, V1, V3);
+				break;
+			case 5:
+				astc_bit_transfer_signed(V1, V0);
+				astc_bit_transfer_signed(V3, V2);
+				E0 = glm::ivec4(V0, V0, V0, V2);
+				E1 = glm::ivec4(V0 + V1, V0 + V1, V0 + V1, V2 + V3);
+				break;
+			case 6:
+				E0 = glm::ivec4((V0 * V3) >> 8, (V1 * V3) >> 8, (V2 * V3) >> 8, 0xFF);
+				E1 = glm::ivec4(V0, V1, V2, 0xFF);
+				break;
+			case 7:
+				astc_decode_hdr_rgb_scale(V, E0, E1);
+				break;
+			case 8:
+			case 12:
+			{
+				int const A0 = Mode == 12 ? V[6] : 0xFF;
+				int const A1 = Mode == 12 ? V[7] : 0xFF;
+				if(V1 + V3 + V5 >= V0 + V2 + V4)
+				{
+					E0 = glm::ivec4(V0, V2, V4, A0);
+					E1 = glm::ivec4(V1, V3, V5, A1);
+				}
+				else
+				{
+					E0 = astc_blue_contract(V1, V3, V5, A1);
+					E1 = astc_blue_contract(V0, V2, V4, A0);
+				}
+				break;
+			}
+			case 9:
+			case 13:
+			{
+				int V6 = Mode == 13 ? V[6] : 0;
+				int V7 = Mode == 13 ? V[7] : 0;
+				astc_bit_transfer_signed(V1, V0);
+				astc_bit_transfer_signed(V3, V2);
+				astc_bit_transfer_signed(V5, V4);
+				if(Mode == 13)
+					astc_bit_transfer_signed(V7, V6);
+				int const A0 = Mode == 13 ? V6 : 0xFF;
+				int const A1 = Mode == 13 ? V6 + V7 : 0xFF;
+				if(V1 + V3 + V5 >= 0)
+				{
+					E0 = glm::ivec4(V0, V2, V4, A0);
+					E1 = glm::ivec4(V0 + V1, V2 + V3, V4 + V5, A1);
+				}
+				else
+				{
+					E0 = astc_blue_contract(V0 + V1, V2 + V3, V4 + V5, A1);
+					E1 = astc_blue_contract(V0, V2, V4, A0);
+				}
+				break;
+			}
+			case 10:
+				E0 = glm::ivec4((V0 * V3) >> 8, (V1 * V3) >> 8, (V2 * V3) >> 8, V[4]);
+				E1 = glm::ivec4(V0, V1, V2, V[5]);
+				break;
+			case 11:
+			case 14:
+			case 15:
+				astc_decode_hdr_rgb(V, E0, E1);
+				if(Mode == 14)
+				{
+					E0.w = V[6];
+					E1.w = V[7];
+				}
+				else if(Mode == 15)
+					astc_decode_hdr_alpha(V + 6, E0.w, E1.w);
+				break;
+			}
+
+			Endpoints.HDRColor = HDR;
+			Endpoints.HDRAlpha = HDR && Mode != 14;
+
+			// Expand LDR channels from 8 bits and HDR channels from 12 bits to 16 bits
+			for(int Component = 0; Component < 4; ++Component)
+			{
+				if(Component < 3 ? Endpoints.HDRColor : Endpoints.HDRAlpha)
+				{
+					Endpoints.E0[Component] = E0[Component] << 4;
+					Endpoints.E1[Component] = E1[Component] << 4;
+				}
+				else if(SRGB && Component < 3)
+				{
+					Endpoints.E0[Component] = (glm::clamp(E0[Component], 0, 0xFF) << 8) | 0x80;
+					Endpoints.E1[Component] = (glm::clamp(E1[Component], 0, 0xFF) << 8) | 0x80;
+				}
+				else
+				{
+					Endpoints.E0[Component] = glm::clamp(E0[Component], 0, 0xFF) * 257;
+					Endpoints.E1[Component] = glm::clamp(E1[Component], 0, 0xFF) * 257;
+				}
+			}
+
+			return true;
+		}
+
+		// Convert a 16 bits logarithmic HDR value to a half float
+		inline glm::uint16 astc_lns_to_half(int Value)
+		{
+			int const Mantissa = Value & 0x7FF;
+			int const Exponent = (Value >> 11) & 0x1F;
+
+			int Transformed;
+			if(Mantissa < 512)
+				Transformed = Mantissa * 3;
+			else if(Mantissa < 1536)
+				Transformed = Mantissa * 4 - 512;
+			else
+				Transformed = Mantissa * 5 - 2048;
+
+			return static_cast<glm::uint16>(glm::min((Exponent << 10) | (Transformed >> 3), 0x7BFF));
+		}
+
+		inline void astc_fill(glm::vec4 const& Color, glm::uint BlockWidth, glm::uint BlockHeight, glm::vec4 *Texels, size_t RowPitch)
+		{
+			for(glm::uint Row = 0; Row < BlockHeight; ++Row)
+			for(glm::uint Col = 0; Col < BlockWidth; ++Col)
+				Texels[Row * RowPitch + Col] = Color;
+		}
+
+		inline bool astc_decode_void_extent(astc_bit_reader const& Reader, bool SRGB, glm::uint BlockWidth, glm::uint BlockHeight, glm::vec4 *Texels, size_t RowPitch)
+		{
+			if(Reader.read(10, 2) != 3)
+				return false;
+
+			bool const HDR = Reader.read(9, 1) != 0;
+			if(HDR && SRGB)
+				return false;
+
+			glm::vec4 Color;
+			for(int Component = 0; Component < 4; ++Component)
+			{
+				glm::uint32 const Value = Reader.read(64 + Component * 16, 16);
+				if(HDR)
+					Color[Component] = glm::unpackHalf1x16(static_cast<glm::uint16>(Value));
+				else if(SRGB && Component < 3)
+					Color[Component] = static_cast<float>(Value >> 8) / 255.0f;
+				else
+					Color[Component] = static_cast<float>(Value) / 65535.0f;
+			}
+
+			astc_fill(Color, BlockWidth, BlockHeight, Texels, RowPitch);
+			return true;
+		}
+
+		// Decode a block, returns false when the block is an error block
+		template <glm::uint BlockWidth, glm::uint BlockHeight>
+		inline bool astc_decode_texels(const astc_block &Block, bool SRGB, glm::vec4 *Texels, size_t RowPitch)
+		{
+			astc_bit_reader const Reader(Block.Data);
+			glm::uint32 const BlockMode = Reader.read(0, 11);
+
+			if((BlockMode & 0x1FF) == 0x1FC)
+				return astc_decode_void_extent(Reader, SRGB, BlockWidth, BlockHeight, Texels, RowPitch);
+
+			unsigned WeightWidth, WeightHeight, WeightRange;
+			bool DualPlane;
+			if(!astc_decode_block_mode(BlockMode, WeightWidth, WeightHeight, WeightRange, DualPlane))
+				return false;
+			if(WeightWidth > BlockWidth || WeightHeight > BlockHeight)
+				return false;
+
+			unsigned const PlaneCount = DualPlane ? 2 : 1;
+			unsigned const WeightCount = WeightWidth * WeightHeight * PlaneCount;
+			if(WeightCount > 64)
+				return false;
+
+			unsigned const WeightBits = astc_ise_bit_count(WeightCount, WeightRange);
+			if(WeightBits < 24 || WeightBits > 96)
+				return false;
+
+			unsigned const PartitionCount = Reader.read(11, 2) + 1;
+			if(DualPlane && PartitionCount == 4)
+				return false;
+
+			// The color endpoint modes, the extra mode bits and the plane component are stored below the weights
+			unsigned Modes[4];
+			unsigned PartitionIndex = 0;
+			unsigned ColorStart = 17;
+			unsigned BelowWeights = 128 - WeightBits;
+			if(PartitionCount == 1)
+				Modes[0] = Reader.read(13, 4);
+			else
+			{
+				PartitionIndex = Reader.read(13, 10);
+				ColorStart = 29;
+
+				glm::uint32 const ModeField = Reader.read(23, 6);
+				if((ModeField & 3) == 0)
+				{
+					for(unsigned Partition = 0; Partition < PartitionCount; ++Partition)
+						Modes[Partition] = ModeField >> 2;
+				}
+				else
+				{
+					unsigned const ExtraBitCount = 3 * PartitionCount - 4;
+					BelowWeights -= ExtraBitCount;
+					glm::uint32 const Field = (ModeField >> 2) | (Reader.read(BelowWeights, ExtraBitCount) << 4);
+
+					unsigned const Class = (ModeField & 3) - 1;
+					for(unsigned Partition = 0; Partition < PartitionCount; ++Partition)
+						Modes[Partition] = ((Class + ((Field >> Partition) & 1)) << 2) | ((Field >> (PartitionCount + Partition * 2)) & 3);
+				}
+			}
+
+			unsigned PlaneComponent = 4;
+			if(DualPlane)
+			{
+				BelowWeights -= 2;
+				PlaneComponent = Reader.read(BelowWeights, 2);
+			}
+
+			unsigned ValueCount = 0;
+			for(unsigned Partition = 0; Partition < PartitionCount; ++Partition)
+				ValueCount += ((Modes[Partition] >> 2) + 1) * 2;
+			if(ValueCount > 18 || BelowWeights < ColorStart)
+				return false;
+
+			// Color values use the largest range fitting in the remaining bits
+			unsigned const ColorBits = BelowWeights - ColorStart;
+			int ColorRange = 20;
+			while(ColorRange >= 0 && astc_ise_bit_count(ValueCount, static_cast<unsigned>(ColorRange)) > ColorBits)
+				--ColorRange;
+			if(ColorRange < static_cast<int>(ASTC_MIN_COLOR_RANGE))
+				return false;
+
+			glm::uint8 Values[18];
+			astc_decode_ise(Reader, ColorStart, ValueCount, static_cast<unsigned>(ColorRange), Values);
+			for(unsigned Index = 0; Index < ValueCount; ++Index)
+				Values[Index] = static_cast<glm::uint8>(astc_unquantize_color(Values[Index], static_cast<unsigned>(ColorRange)));
+
+			astc_endpoints Endpoints[4];
+			for(unsigned Partition = 0, Offset = 0; Partition < PartitionCount; ++Partition)
+			{
+				if(!astc_decode_endpoints(Modes[Partition], Values + Offset, SRGB, Endpoints[Partition]))
+					return false;
+				Offset += ((Modes[Partition] >> 2) + 1) * 2;
+			}
+
+			// The weights are stored from the last bit of the block, in reverse bit order
+			glm::uint8 Reversed[16];
+			for(int Byte = 0; Byte < 16; ++Byte)
+				Reversed[15 - Byte] = astc_reverse_byte(Block.Data[Byte]);
+
+			glm::uint8 Weights[64];
+			astc_decode_ise(astc_bit_reader(Reversed), 0, WeightCount, WeightRange, Weights);
+			for(unsigned Index = 0; Index < WeightCount; ++Index)
+				Weights[Index] = static_cast<glm::uint8>(astc_unquantize_weight(Weights[Index], WeightRange));
+
+			// Fixed point steps of the texel coordinates across the weight grid, known for each footprint
+			unsigned const StepS = (1024 + BlockWidth / 2) / (BlockWidth - 1);
+			unsigned const StepT = (1024 + BlockHeight / 2) / (BlockHeight - 1);
+			bool const SmallBlock = BlockWidth * BlockHeight < 31;
+			bool const FullGrid = WeightWidth == BlockWidth && WeightHeight == BlockHeight;
+
+			for(glm::uint Row = 0; Row < BlockHeight; ++Row)
+			for(glm::uint Col = 0; Col < BlockWidth; ++Col)
+			{
+				unsigned Weight[2] = {0, 0};
+				if(FullGrid)
+				{
+					for(unsigned Plane = 0; Plane < PlaneCount; ++Plane)
+						Weight[Plane] = Weights[(Row * WeightWidth + Col) * PlaneCount + Plane];
+				}
+				else
+				{
+					// Bilinear infill of the weight grid
+					unsigned const GridS = (StepS * Col * (WeightWidth - 1) + 32) >> 6;
+					unsigned const GridT = (StepT * Row * (WeightHeight - 1) + 32) >> 6;
+					unsigned const FracS = GridS & 0xF;
+					unsigned const FracT = GridT & 0xF;
+					unsigned const Index = (GridT >> 4) * WeightWidth + (GridS >> 4);
+
+					unsigned const W11 = (FracS * FracT + 8) >> 4;
+					unsigned const W10 = FracT - W11;
+					unsigned const W01 = FracS - W11;
+					unsigned const W00 = 16 - FracS - FracT + W11;
+
+					for(unsigned Plane = 0; Plane < PlaneCount; ++Plane)
+					{
+						unsigned Sum = Weights[Index * PlaneCount + Plane] * W00;
+						if(W01)
+							Sum += Weights[(Index + 1) * PlaneCount + Plane] * W01;
+						if(W10)
+							Sum += Weights[(Index + WeightWidth) * PlaneCount + Plane] * W10;
+						if(W11)
+							Sum += Weights[(Index + WeightWidth + 1) * PlaneCount + Plane] * W11;
+						Weight[Plane] = (Sum + 8) >> 4;
+					}
+				}
+
+				astc_endpoints const& Endpoint = Endpoints[PartitionCount > 1 ? astc_select_partition(PartitionIndex, Col, Row, 0, PartitionCount, SmallBlock) : 0];
+
+				glm::vec4 Texel;
+				for(unsigned Component = 0; Component < 4; ++Component)
+				{
+					int const W = static_cast<int>(Component == PlaneComponent ? Weight[1] : Weight[0]);
+					int const Value = (Endpoint.E0[Component] * (64 - W) + Endpoint.E1[Component] * W + 32) >> 6;
+
+					if(Component < 3 ? Endpoint.HDRColor : Endpoint.HDRAlpha)
+						Texel[Component] = glm::unpackHalf1x16(astc_lns_to_half(Value));
+					else if(SRGB && Component < 3)
+						Texel[Component] = static_cast<float>(Value >> 8) / 255.0f;
+					else
+						Texel[Component] = static_cast<float>(Value) / 65535.0f;
+				}
+
+				Texels[Row * RowPitch + Col] = Texel;
+			}
+
+			return true;
+		}
+
+		template <glm::uint BlockWidth, glm::uint BlockHeight>
+		inline void decode_astc_block(const astc_block &Block, bool SRGB, glm::vec4 *Texels, size_t RowPitch)
+		{
+			static_assert(BlockWidth >= 4 && BlockWidth <= 12 && BlockHeight >= 4 && BlockHeight <= 12, "Invalid ASTC block footprint");
+
+			if(!astc_decode_texels<BlockWidth, BlockHeight>(Block, SRGB, Texels, RowPitch))
+				astc_fill(ASTC_ERROR_COLOR, BlockWidth, BlockHeight, Texels, RowPitch);
+		}
+
+		template <glm::uint BlockWidth, glm::uint BlockHeight>
+		inline void decode_astc_row(const astc_block *Blocks, size_t BlockCount, bool SRGB, glm::vec4 *Texels, size_t RowPitch)
+		{
+			for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+				decode_astc_block<BlockWidth, BlockHeight>(Blocks[BlockIndex], SRGB, Texels + BlockIndex * BlockWidth, RowPitch);
+		}
+
+		template <glm::uint BlockWidth, glm::uint BlockHeight, bool SRGB>
+		inline texel_block12x12 decompress_astc_block(const astc_block &Block)
+		{
+			texel_block12x12 TexelBlock;
+			decode_astc_block<BlockWidth, BlockHeight>(Block, SRGB, &TexelBlock.Texel[0][0], 12);
+			return TexelBlock;
+		}
+
+		// Decoders specialized for each footprint, in the order of the ASTC formats
+		struct astc_footprint
+		{
+			glm::uint Width;
+			glm::uint Height;
+			void(*DecodeRow)(const astc_block *Blocks, size_t BlockCount, bool SRGB, glm::vec4 *Texels, size_t RowPitch);
+			astc_decompress_func Decompress[2];
+		};
+
+#		define GLI_ASTC_FOOTPRINT(Width, Height) {Width, Height, decode_astc_row<Width, Height>, {decompress_astc_block<Width, Height, false>, decompress_astc_block<Width, Height, true>}}
+
+		static astc_footprint const ASTC_FOOTPRINTS[] =
+		{
+			GLI_ASTC_FOOTPRINT(4, 4),
+			GLI_ASTC_FOOTPRINT(5, 4),
+			GLI_ASTC_FOOTPRINT(5, 5),
+			GLI_ASTC_FOOTPRINT(6, 5),
+			GLI_ASTC_FOOTPRINT(6, 6),
+			GLI_ASTC_FOOTPRINT(8, 5),
+			GLI_ASTC_FOOTPRINT(8, 6),
+			GLI_ASTC_FOOTPRINT(8, 8),
+			GLI_ASTC_FOOTPRINT(10, 5),
+			GLI_ASTC_FOOTPRINT(10, 6),
+			GLI_ASTC_FOOTPRINT(10, 8),
+			GLI_ASTC_FOOTPRINT(10, 10),
+			GLI_ASTC_FOOTPRINT(12, 10),
+			GLI_ASTC_FOOTPRINT(12, 12)
+		};
+
+#		undef GLI_ASTC_FOOTPRINT
+
+		inline astc_footprint const* astc_find_footprint(extent2d const& BlockExtent)
+		{
+			for(size_t Index = 0; Index < sizeof(ASTC_FOOTPRINTS) / sizeof(ASTC_FOOTPRINTS[0]); ++Index)
+				if(ASTC_FOOTPRINTS[Index].Width == static_cast<glm::uint>(BlockExtent.x) && ASTC_FOOTPRINTS[Index].Height == static_cast<glm::uint>(BlockExtent.y))
+					return &ASTC_FOOTPRINTS[Index];
+			return nullptr;
+		}
+
+		inline void decode_astc_block(const astc_block &Block, extent2d const& BlockExtent, bool SRGB, glm::vec4 *Texels, size_t RowPitch)
+		{
+			decode_astc_row(&Block, 1, BlockExtent, SRGB, Texels, RowPitch);
+		}
+
+		inline void decode_astc_row(const astc_block *Blocks, size_t BlockCount, extent2d const& BlockExtent, bool SRGB, glm::vec4 *Texels, size_t RowPitch)
+		{
+			astc_footprint const* Footprint = astc_find_footprint(BlockExtent);
+			GLI_ASSERT(Footprint);
+			if(Footprint)
+				Footprint->DecodeRow(Blocks, BlockCount, SRGB, Texels, RowPitch);
+		}
+
+		inline astc_decompress_func astc_decompress_function(format Format)
+		{
+			GLI_ASSERT(Format >= FORMAT_RGBA_ASTC_4X4_UNORM_BLOCK16 && Format <= FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16);
+
+			size_t const Index = static_cast<size_t>(Format - FORMAT_RGBA_ASTC_4X4_UNORM_BLOCK16);
+			return ASTC_FOOTPRINTS[Index / 2].Decompress[Index % 2];
+		}
+	}//namespace detail
+}//namespace gli
@@ -28,6 +28,14 @@ namespace gli
 			glm::uint8 GreenBitmap[6];
 		};
 
+		struct bc6h_block {
+			glm::uint8 Data[16];
+		};
+
+		struct bc7_block {
+			glm::uint8 Data[16];
+		};
+
 		glm::vec4 decompress_bc1(const bc1_block &Block, const extent2d &BlockTexelCoord);
 		texel_block4x4 decompress_dxt1_block(const dxt1_block &Block);
 
@@ -46,6 +54,21 @@ namespace gli
 		glm::vec4 decompress_bc5snorm(const bc5_block &Block, const extent2d &BlockTexelCoord);
 		texel_block4x4 decompress_bc5unorm_block(const bc5_block &Block);
 		texel_block4x4 decompress_bc5snorm_block(const bc5_block &Block);
+
+		// Decode the 16 texels of a BC6H block as half floats, in row major order
+		void decode_bc6h_block(const bc6h_block &Block, bool Signed, glm::u16vec3 *Texels);
+		texel_block4x4 decompress_bc6hufloat_block(const bc6h_block &Block);
+		texel_block4x4 decompress_bc6hsfloat_block(const bc6h_block &Block);
+
+		// Decode BlockCount contiguous BC6H blocks, 16 half float texels per block
+		void decode_bc6h_blocks(const bc6h_block *Blocks, size_t BlockCount, bool Signed, glm::u16vec3 *Texels);
+
+		// Decode the 16 texels of a BC7 block as 8 bits integers, in row major order
+		void decode_bc7_block(const bc7_block &Block, glm::u8vec4 *Texels);
+		texel_block4x4 decompress_bc7_block(const bc7_block &Block);
+
+		// Decode BlockCount contiguous BC7 blocks, 16 texels per block
+		void decode_bc7_blocks(const bc7_block *Blocks, size_t BlockCount, glm::u8vec4 *Texels);
 	}//namespace detail
 }//namespace gli
 
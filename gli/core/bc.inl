@@ -1,5 +1,7 @@
 #include <glm/ext/vector_packing.hpp>
 #include <glm/ext/scalar_uint_sized.hpp>
+#include <glm/gtc/packing.hpp>
+#include <utility>
 
 namespace gli
 {
@@ -238,5 +240,479 @@ namespace gli
 			return TexelBlock;
 		}
 
+		// Subset of each texel of the BPTC partitions of 2 subsets, bit i is the subset of texel i
+		static glm::uint16 const BPTC_PARTITION2[64] =
+		{
+			0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+			0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+			0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+			0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+		};
+
+		// Subset of each texel of the BPTC partitions of 3 subsets, bits 2i and 2i+1 are the subset of texel i
+		static glm::uint32 const BPTC_PARTITION3[64] =
+		{
+			0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+			0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+			0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+			0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+			0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+			0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+			0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+			0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254
+		};
+
+		// Anchor texel of the second subset of the partitions of 2 subsets
+		static glm::uint8 const BPTC_ANCHOR2[64] =
+		{
+			15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+			15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+			15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+			 6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15
+		};
+
+		// Anchor texels of the second and third subsets of the partitions of 3 subsets
+		static glm::uint8 const BPTC_ANCHOR3[2][64] =
+		{
+			{
+				 3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3,
+				 3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15,
+				 8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15,
+				 3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3
+			},
+			{
+				15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8,
+				15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8,
+				15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8,
+				15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8
+			}
+		};
+
+		static glm::uint8 const BPTC_WEIGHT2[4] = {0, 21, 43, 64};
+		static glm::uint8 const BPTC_WEIGHT3[8] = {0, 9, 18, 27, 37, 46, 55, 64};
+		static glm::uint8 const BPTC_WEIGHT4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+		inline glm::uint8 const* bptc_weights(unsigned IndexBits)
+		{
+			return IndexBits == 2 ? BPTC_WEIGHT2 : IndexBits == 3 ? BPTC_WEIGHT3 : BPTC_WEIGHT4;
+		}
+
+		inline unsigned bptc_subset(unsigned SubsetCount, unsigned Partition, unsigned Texel)
+		{
+			if(SubsetCount == 2)
+				return (BPTC_PARTITION2[Partition] >> Texel) & 0x1;
+			if(SubsetCount == 3)
+				return (BPTC_PARTITION3[Partition] >> (Texel * 2)) & 0x3;
+			return 0;
+		}
+
+		// The index of the anchor texel of each subset is stored with one bit less, its most significant bit is zero
+		inline bool bptc_is_anchor(unsigned SubsetCount, unsigned Partition, unsigned Texel)
+		{
+			if(Texel == 0)
+				return true;
+			if(SubsetCount == 2)
+				return Texel == BPTC_ANCHOR2[Partition];
+			if(SubsetCount == 3)
+				return Texel == BPTC_ANCHOR3[0][Partition] || Texel == BPTC_ANCHOR3[1][Partition];
+			return false;
+		}
+
+		inline int bptc_interpolate(int Endpoint0, int Endpoint1, unsigned Weight)
+		{
+			return ((64 - static_cast<int>(Weight)) * Endpoint0 + static_cast<int>(Weight) * Endpoint1 + 32) >> 6;
+		}
+
+		// Read the bits of a 128 bits block from the least significant bit of the first byte
+		class bptc_bit_reader
+		{
+		public:
+			explicit bptc_bit_reader(glm::uint8 const* Data)
+				: Low(0)
+				, High(0)
+				, Position(0)
+			{
+				for(int Byte = 7; Byte >= 0; --Byte)
+				{
+					this->Low = (this->Low << 8) | Data[Byte];
+					this->High = (this->High << 8) | Data[Byte + 8];
+				}
+			}
+
+			// Read Count bits, at most 32
+			glm::uint32 read(unsigned Count)
+			{
+				if(Count == 0)
+					return 0;
+
+				glm::uint64 Value = 0;
+				if(this->Position >= 64)
+					Value = this->High >> (this->Position - 64);
+				else if(this->Position + Count <= 64)
+					Value = this->Low >> this->Position;
+				else
+					Value = (this->Low >> this->Position) | (this->High << (64 - this->Position));
+
+				this->Position += Count;
+				return static_cast<glm::uint32>(Value & ((glm::uint64(1) << Count) - 1));
+			}
+
+			void seek(unsigned Position)
+			{
+				this->Position = Position;
+			}
+
+		private:
+			glm::uint64 Low;
+			glm::uint64 High;
+			unsigned Position;
+		};
+
+		struct bc7_mode_info
+		{
+			glm::uint8 SubsetCount;
+			glm::uint8 PartitionBits;
+			glm::uint8 RotationBits;
+			glm::uint8 IndexSelectionBits;
+			glm::uint8 ColorBits;
+			glm::uint8 AlphaBits;
+			glm::uint8 EndpointPBits;
+			glm::uint8 SharedPBits;
+			glm::uint8 IndexBits;
+			glm::uint8 SecondaryIndexBits;
+		};
+
+		static bc7_mode_info const BC7_MODES[8] =
+		{
+			{3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+			{2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+			{3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+			{2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+			{1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+			{1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+			{1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+			{2, 6, 0, 0, 5, 5, 1, 0, 2, 0}
+		};
+
+		inline void decode_bc7_block(const bc7_block &Block, glm::u8vec4 *Texels)
+		{
+			// The mode is the number of zero bits before the first bit set
+			unsigned Mode = 0;
+			while(Mode < 8 && !(Block.Data[0] & (1 << Mode)))
+				++Mode;
+
+			// Reserved mode
+			if(Mode == 8)
+			{
+				for(int Texel = 0; Texel < 16; ++Texel)
+					Texels[Texel] = glm::u8vec4(0);
+				return;
+			}
+
+			bc7_mode_info const& Info = BC7_MODES[Mode];
+			bptc_bit_reader Reader(Block.Data);
+			Reader.seek(Mode + 1);
+
+			unsigned const Partition = Reader.read(Info.PartitionBits);
+			unsigned const Rotation = Reader.read(Info.RotationBits);
+			unsigned const IndexSelection = Reader.read(Info.IndexSelectionBits);
+
+			// Endpoints are stored by channel, then by subset
+			unsigned const EndpointCount = Info.SubsetCount * 2u;
+			unsigned Endpoints[6][4];
+			for(unsigned Channel = 0; Channel < 3; ++Channel)
+			for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+				Endpoints[Endpoint][Channel] = Reader.read(Info.ColorBits);
+			for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+				Endpoints[Endpoint][3] = Info.AlphaBits ? Reader.read(Info.AlphaBits) : 255u;
+
+			unsigned ColorBits = Info.ColorBits;
+			unsigned AlphaBits = Info.AlphaBits;
+			if(Info.EndpointPBits || Info.SharedPBits)
+			{
+				unsigned PBits[6];
+				if(Info.EndpointPBits)
+				{
+					for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+						PBits[Endpoint] = Reader.read(1);
+				}
+				else
+				{
+					for(unsigned Subset = 0; Subset < Info.SubsetCount; ++Subset)
+						PBits[Subset * 2 + 0] = PBits[Subset * 2 + 1] = Reader.read(1);
+				}
+
+				for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+				for(unsigned Channel = 0; Channel < (AlphaBits ? 4u : 3u); ++Channel)
+					Endpoints[Endpoint][Channel] = (Endpoints[Endpoint][Channel] << 1) | PBits[Endpoint];
+
+				++ColorBits;
+				if(AlphaBits)
+					++AlphaBits;
+			}
+
+			// Expand the endpoints to 8 bits by replicating their most significant bits
+			for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+			for(unsigned Channel = 0; Channel < 4; ++Channel)
+			{
+				unsigned const Bits = Channel < 3 ? ColorBits : AlphaBits;
+				if(Bits == 0)
+					continue;
+				unsigned const Value = Endpoints[Endpoint][Channel] << (8 - Bits);
+				Endpoints[Endpoint][Channel] = Value | (Value >> Bits);
+			}
+
+			unsigned Indices[16];
+			for(unsigned Texel = 0; Texel < 16; ++Texel)
+				Indices[Texel] = Reader.read(Info.IndexBits - (bptc_is_anchor(Info.SubsetCount, Partition, Texel) ? 1 : 0));
+
+			unsigned SecondaryIndices[16];
+			for(unsigned Texel = 0; Texel < 16; ++Texel)
+				SecondaryIndices[Texel] = Info.SecondaryIndexBits ? Reader.read(Info.SecondaryIndexBits - (Texel == 0 ? 1 : 0)) : Indices[Texel];
+
+			// Modes with two index sets interpolate the colors and the alpha with different indices
+			bool const SwapIndices = IndexSelection != 0;
+			glm::uint8 const* const ColorWeights = bptc_weights(SwapIndices ? Info.SecondaryIndexBits : Info.IndexBits);
+			glm::uint8 const* const AlphaWeights = bptc_weights(Info.SecondaryIndexBits && !SwapIndices ? Info.SecondaryIndexBits : Info.IndexBits);
+
+			for(unsigned Texel = 0; Texel < 16; ++Texel)
+			{
+				unsigned const Subset = bptc_subset(Info.SubsetCount, Partition, Texel);
+				unsigned const* const Endpoint0 = Endpoints[Subset * 2 + 0];
+				unsigned const* const Endpoint1 = Endpoints[Subset * 2 + 1];
+				unsigned const ColorWeight = ColorWeights[SwapIndices ? SecondaryIndices[Texel] : Indices[Texel]];
+				unsigned const AlphaWeight = AlphaWeights[SwapIndices ? Indices[Texel] : SecondaryIndices[Texel]];
+
+				glm::u8vec4 Color(
+					static_cast<glm::uint8>(bptc_interpolate(static_cast<int>(Endpoint0[0]), static_cast<int>(Endpoint1[0]), ColorWeight)),
+					static_cast<glm::uint8>(bptc_interpolate(static_cast<int>(Endpoint0[1]), static_cast<int>(Endpoint1[1]), ColorWeight)),
+					static_cast<glm::uint8>(bptc_interpolate(static_cast<int>(Endpoint0[2]), static_cast<int>(Endpoint1[2]), ColorWeight)),
+					static_cast<glm::uint8>(bptc_interpolate(static_cast<int>(Endpoint0[3]), static_cast<int>(Endpoint1[3]), AlphaWeight)));
+
+				// The rotation swaps the alpha with one of the color channels
+				if(Rotation > 0)
+					std::swap(Color[Rotation - 1], Color.a);
+
+				Texels[Texel] = Color;
+			}
+		}
+
+		inline texel_block4x4 decompress_bc7_block(const bc7_block &Block)
+		{
+			glm::u8vec4 Texels[16];
+			decode_bc7_block(Block, Texels);
+
+			texel_block4x4 TexelBlock;
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+				TexelBlock.Texel[Row][Col] = glm::vec4(Texels[Row * 4 + Col]) / 255.0f;
+
+			return TexelBlock;
+		}
+
+		inline void decode_bc7_blocks(const bc7_block *Blocks, size_t BlockCount, glm::u8vec4 *Texels)
+		{
+			for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+				decode_bc7_block(Blocks[BlockIndex], Texels + BlockIndex * 16);
+		}
+
+		// BC6H header fields, endpoint 0 and 1 of the first region followed by endpoint 0 and 1 of the second region, and the partition
+		enum bc6h_field
+		{
+			BC6H_R0, BC6H_G0, BC6H_B0,
+			BC6H_R1, BC6H_G1, BC6H_B1,
+			BC6H_R2, BC6H_G2, BC6H_B2,
+			BC6H_R3, BC6H_G3, BC6H_B3,
+			BC6H_D
+		};
+
+		// Count bits of the block stored at bit Shift of a header field
+		struct bc6h_segment
+		{
+			glm::uint8 Field;
+			glm::uint8 Shift;
+			glm::uint8 Count;
+		};
+
+		struct bc6h_mode_info
+		{
+			glm::uint8 Code;
+			glm::uint8 Transformed;
+			glm::uint8 EndpointBits;
+			glm::uint8 DeltaBits[3];
+			bc6h_segment Segments[28];
+		};
+
+		// Layout of the header of each mode following the mode bits, as described by the BC6H specification
+		static bc6h_mode_info const BC6H_MODES[14] =
+		{
+			{ 0, 1, 10, {5, 5, 5}, {{BC6H_G2, 4, 1}, {BC6H_B2, 4, 1}, {BC6H_B3, 4, 1}, {BC6H_R0, 0, 10}, {BC6H_G0, 0, 10}, {BC6H_B0, 0, 10}, {BC6H_R1, 0, 5}, {BC6H_G3, 4, 1}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 5}, {BC6H_B3, 0, 1}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 5}, {BC6H_B3, 1, 1}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 5}, {BC6H_B3, 2, 1}, {BC6H_R3, 0, 5}, {BC6H_B3, 3, 1}, {BC6H_D, 0, 5}}},
+			{ 1, 1, 7, {6, 6, 6}, {{BC6H_G2, 5, 1}, {BC6H_G3, 4, 1}, {BC6H_G3, 5, 1}, {BC6H_R0, 0, 7}, {BC6H_B3, 0, 1}, {BC6H_B3, 1, 1}, {BC6H_B2, 4, 1}, {BC6H_G0, 0, 7}, {BC6H_B2, 5, 1}, {BC6H_B3, 2, 1}, {BC6H_G2, 4, 1}, {BC6H_B0, 0, 7}, {BC6H_B3, 3, 1}, {BC6H_B3, 5, 1}, {BC6H_B3, 4, 1}, {BC6H_R1, 0, 6}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 6}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 6}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 6}, {BC6H_R3, 0, 6}, {BC6H_D, 0, 5}}},
+			{ 2, 1, 11, {5, 4, 4}, {{BC6H_R0, 0, 10}, {BC6H_G0, 0, 10}, {BC6H_B0, 0, 10}, {BC6H_R1, 0, 5}, {BC6H_R0, 10, 1}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 4}, {BC6H_G0, 10, 1}, {BC6H_B3, 0, 1}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 4}, {BC6H_B0, 10, 1}, {BC6H_B3, 1, 1}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 5}, {BC6H_B3, 2, 1}, {BC6H_R3, 0, 5}, {BC6H_B3, 3, 1}, {BC6H_D, 0, 5}}},
+			{ 6, 1, 11, {4, 5, 4}, {{BC6H_R0, 0, 10}, {BC6H_G0, 0, 10}, {BC6H_B0, 0, 10}, {BC6H_R1, 0, 4}, {BC6H_R0, 10, 1}, {BC6H_G3, 4, 1}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 5}, {BC6H_G0, 10, 1}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 4}, {BC6H_B0, 10, 1}, {BC6H_B3, 1, 1}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 4}, {BC6H_B3, 0, 1}, {BC6H_B3, 2, 1}, {BC6H_R3, 0, 4}, {BC6H_G2, 4, 1}, {BC6H_B3, 3, 1}, {BC6H_D, 0, 5}}},
+			{10, 1, 11, {4, 4, 5}, {{BC6H_R0, 0, 10}, {BC6H_G0, 0, 10}, {BC6H_B0, 0, 10}, {BC6H_R1, 0, 4}, {BC6H_R0, 10, 1}, {BC6H_B2, 4, 1}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 4}, {BC6H_G0, 10, 1}, {BC6H_B3, 0, 1}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 5}, {BC6H_B0, 10, 1}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 4}, {BC6H_B3, 1, 1}, {BC6H_B3, 2, 1}, {BC6H_R3, 0, 4}, {BC6H_B3, 4, 1}, {BC6H_B3, 3, 1}, {BC6H_D, 0, 5}}},
+			{14, 1, 9, {5, 5, 5}, {{BC6H_R0, 0, 9}, {BC6H_B2, 4, 1}, {BC6H_G0, 0, 9}, {BC6H_G2, 4, 1}, {BC6H_B0, 0, 9}, {BC6H_B3, 4, 1}, {BC6H_R1, 0, 5}, {BC6H_G3, 4, 1}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 5}, {BC6H_B3, 0, 1}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 5}, {BC6H_B3, 1, 1}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 5}, {BC6H_B3, 2, 1}, {BC6H_R3, 0, 5}, {BC6H_B3, 3, 1}, {BC6H_D, 0, 5}}},
+			{18, 1, 8, {6, 5, 5}, {{BC6H_R0, 0, 8}, {BC6H_G3, 4, 1}, {BC6H_B2, 4, 1}, {BC6H_G0, 0, 8}, {BC6H_B3, 2, 1}, {BC6H_G2, 4, 1}, {BC6H_B0, 0, 8}, {BC6H_B3, 3, 1}, {BC6H_B3, 4, 1}, {BC6H_R1, 0, 6}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 5}, {BC6H_B3, 0, 1}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 5}, {BC6H_B3, 1, 1}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 6}, {BC6H_R3, 0, 6}, {BC6H_D, 0, 5}}},
+			{22, 1, 8, {5, 6, 5}, {{BC6H_R0, 0, 8}, {BC6H_B3, 0, 1}, {BC6H_B2, 4, 1}, {BC6H_G0, 0, 8}, {BC6H_G2, 5, 1}, {BC6H_G2, 4, 1}, {BC6H_B0, 0, 8}, {BC6H_G3, 5, 1}, {BC6H_B3, 4, 1}, {BC6H_R1, 0, 5}, {BC6H_G3, 4, 1}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 6}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 5}, {BC6H_B3, 1, 1}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 5}, {BC6H_B3, 2, 1}, {BC6H_R3, 0, 5}, {BC6H_B3, 3, 1}, {BC6H_D, 0, 5}}},
+			{26, 1, 8, {5, 5, 6}, {{BC6H_R0, 0, 8}, {BC6H_B3, 1, 1}, {BC6H_B2, 4, 1}, {BC6H_G0, 0, 8}, {BC6H_B2, 5, 1}, {BC6H_G2, 4, 1}, {BC6H_B0, 0, 8}, {BC6H_B3, 5, 1}, {BC6H_B3, 4, 1}, {BC6H_R1, 0, 5}, {BC6H_G3, 4, 1}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 5}, {BC6H_B3, 0, 1}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 6}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 5}, {BC6H_B3, 2, 1}, {BC6H_R3, 0, 5}, {BC6H_B3, 3, 1}, {BC6H_D, 0, 5}}},
+			{30, 0, 6, {6, 6, 6}, {{BC6H_R0, 0, 6}, {BC6H_G3, 4, 1}, {BC6H_B3, 0, 1}, {BC6H_B3, 1, 1}, {BC6H_B2, 4, 1}, {BC6H_G0, 0, 6}, {BC6H_G2, 5, 1}, {BC6H_B2, 5, 1}, {BC6H_B3, 2, 1}, {BC6H_G2, 4, 1}, {BC6H_B0, 0, 6}, {BC6H_G3, 5, 1}, {BC6H_B3, 3, 1}, {BC6H_B3, 5, 1}, {BC6H_B3, 4, 1}, {BC6H_R1, 0, 6}, {BC6H_G2, 0, 4}, {BC6H_G1, 0, 6}, {BC6H_G3, 0, 4}, {BC6H_B1, 0, 6}, {BC6H_B2, 0, 4}, {BC6H_R2, 0, 6}, {BC6H_R3, 0, 6}, {BC6H_D, 0, 5}}},
+			{ 3, 0, 10, {10, 10, 10}, {{BC6H_R0, 0, 10}, {BC6H_G0, 0, 10}, {BC6H_B0, 0, 10}, {BC6H_R1, 0, 10}, {BC6H_G1, 0, 10}, {BC6H_B1, 0, 10}}},
+			{ 7, 1, 11, {9, 9, 9}, {{BC6H_R0, 0, 10}, {BC6H_G0, 0, 10}, {BC6H_B0, 0, 10}, {BC6H_R1, 0, 9}, {BC6H_R0, 10, 1}, {BC6H_G1, 0, 9}, {BC6H_G0, 10, 1}, {BC6H_B1, 0, 9}, {BC6H_B0, 10, 1}}},
+			{11, 1, 12, {8, 8, 8}, {{BC6H_R0, 0, 10}, {BC6H_G0, 0, 10}, {BC6H_B0, 0, 10}, {BC6H_R1, 0, 8}, {BC6H_R0, 11, 1}, {BC6H_R0, 10, 1}, {BC6H_G1, 0, 8}, {BC6H_G0, 11, 1}, {BC6H_G0, 10, 1}, {BC6H_B1, 0, 8}, {BC6H_B0, 11, 1}, {BC6H_B0, 10, 1}}},
+			{15, 1, 16, {4, 4, 4}, {{BC6H_R0, 0, 10}, {BC6H_G0, 0, 10}, {BC6H_B0, 0, 10}, {BC6H_R1, 0, 4}, {BC6H_R0, 15, 1}, {BC6H_R0, 14, 1}, {BC6H_R0, 13, 1}, {BC6H_R0, 12, 1}, {BC6H_R0, 11, 1}, {BC6H_R0, 10, 1}, {BC6H_G1, 0, 4}, {BC6H_G0, 15, 1}, {BC6H_G0, 14, 1}, {BC6H_G0, 13, 1}, {BC6H_G0, 12, 1}, {BC6H_G0, 11, 1}, {BC6H_G0, 10, 1}, {BC6H_B1, 0, 4}, {BC6H_B0, 15, 1}, {BC6H_B0, 14, 1}, {BC6H_B0, 13, 1}, {BC6H_B0, 12, 1}, {BC6H_B0, 11, 1}, {BC6H_B0, 10, 1}}}
+		};
+
+		inline int bc6h_sign_extend(glm::uint32 Value, unsigned Bits)
+		{
+			return (Value & (1u << (Bits - 1))) ? static_cast<int>(Value) - (1 << Bits) : static_cast<int>(Value);
+		}
+
+		// Scale a quantized endpoint to 16 bits
+		inline int bc6h_unquantize(int Value, unsigned Bits, bool Signed)
+		{
+			if(!Signed)
+			{
+				if(Bits >= 15 || Value == 0)
+					return Value;
+				if(Value == (1 << Bits) - 1)
+					return 0xFFFF;
+				return ((Value << 15) + 0x4000) >> (Bits - 1);
+			}
+
+			if(Bits >= 16)
+				return Value;
+
+			bool const Negative = Value < 0;
+			int const Magnitude = Negative ? -Value : Value;
+			int Unquantized = 0;
+			if(Magnitude == 0)
+				Unquantized = 0;
+			else if(Magnitude >= (1 << (Bits - 1)) - 1)
+				Unquantized = 0x7FFF;
+			else
+				Unquantized = ((Magnitude << 15) + 0x4000) >> (Bits - 1);
+			return Negative ? -Unquantized : Unquantized;
+		}
+
+		// Scale an interpolated value to the bits of a half float
+		inline glm::uint16 bc6h_finish_unquantize(int Value, bool Signed)
+		{
+			if(!Signed)
+				return static_cast<glm::uint16>((Value * 31) >> 6);
+			if(Value < 0)
+				return static_cast<glm::uint16>(0x8000 | (((-Value) * 31) >> 5));
+			return static_cast<glm::uint16>((Value * 31) >> 5);
+		}
+
+		inline void decode_bc6h_block(const bc6h_block &Block, bool Signed, glm::u16vec3 *Texels)
+		{
+			bptc_bit_reader Reader(Block.Data);
+
+			unsigned Code = Reader.read(2);
+			if(Code > 1)
+				Code |= Reader.read(3) << 2;
+
+			bc6h_mode_info const* Info = nullptr;
+			for(int ModeIndex = 0; ModeIndex < 14; ++ModeIndex)
+				if(BC6H_MODES[ModeIndex].Code == Code)
+					Info = &BC6H_MODES[ModeIndex];
+
+			// Reserved modes decode to zero
+			if(!Info)
+			{
+				for(int Texel = 0; Texel < 16; ++Texel)
+					Texels[Texel] = glm::u16vec3(0);
+				return;
+			}
+
+			glm::uint32 Fields[BC6H_D + 1] = {0};
+			for(int SegmentIndex = 0; SegmentIndex < 28 && Info->Segments[SegmentIndex].Count > 0; ++SegmentIndex)
+			{
+				bc6h_segment const& Segment = Info->Segments[SegmentIndex];
+				Fields[Segment.Field] |= Reader.read(Segment.Count) << Segment.Shift;
+			}
+
+			// The modes of a single region are the modes which two lowest bits are set
+			bool const Partitioned = (Code & 0x3) != 0x3;
+			unsigned const Partition = Fields[BC6H_D];
+			unsigned const EndpointCount = Partitioned ? 4u : 2u;
+			unsigned const EndpointBits = Info->EndpointBits;
+
+			int Endpoints[4][3];
+			for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+			for(unsigned Channel = 0; Channel < 3; ++Channel)
+			{
+				glm::uint32 const Value = Fields[Endpoint * 3 + Channel];
+				if(Endpoint == 0)
+					Endpoints[Endpoint][Channel] = Signed ? bc6h_sign_extend(Value, EndpointBits) : static_cast<int>(Value);
+				else
+					Endpoints[Endpoint][Channel] = Signed || Info->Transformed ? bc6h_sign_extend(Value, Info->DeltaBits[Channel]) : static_cast<int>(Value);
+			}
+
+			// Transformed modes store the other endpoints as deltas to the first endpoint
+			if(Info->Transformed)
+			{
+				for(unsigned Endpoint = 1; Endpoint < EndpointCount; ++Endpoint)
+				for(unsigned Channel = 0; Channel < 3; ++Channel)
+				{
+					glm::uint32 const Value = static_cast<glm::uint32>(Endpoints[0][Channel] + Endpoints[Endpoint][Channel]) & ((1u << EndpointBits) - 1);
+					Endpoints[Endpoint][Channel] = Signed ? bc6h_sign_extend(Value, EndpointBits) : static_cast<int>(Value);
+				}
+			}
+
+			for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+			for(unsigned Channel = 0; Channel < 3; ++Channel)
+				Endpoints[Endpoint][Channel] = bc6h_unquantize(Endpoints[Endpoint][Channel], EndpointBits, Signed);
+
+			unsigned const IndexBits = Partitioned ? 3u : 4u;
+			glm::uint8 const* const Weights = bptc_weights(IndexBits);
+			Reader.seek(Partitioned ? 82u : 65u);
+
+			for(unsigned Texel = 0; Texel < 16; ++Texel)
+			{
+				unsigned const Subset = Partitioned ? bptc_subset(2, Partition, Texel) : 0u;
+				unsigned const Weight = Weights[Reader.read(IndexBits - (bptc_is_anchor(Partitioned ? 2u : 1u, Partition, Texel) ? 1 : 0))];
+				int const* const Endpoint0 = Endpoints[Subset * 2 + 0];
+				int const* const Endpoint1 = Endpoints[Subset * 2 + 1];
+
+				Texels[Texel] = glm::u16vec3(
+					bc6h_finish_unquantize(bptc_interpolate(Endpoint0[0], Endpoint1[0], Weight), Signed),
+					bc6h_finish_unquantize(bptc_interpolate(Endpoint0[1], Endpoint1[1], Weight), Signed),
+					bc6h_finish_unquantize(bptc_interpolate(Endpoint0[2], Endpoint1[2], Weight), Signed));
+			}
+		}
+
+		inline texel_block4x4 decompress_bc6h_block(const bc6h_block &Block, bool Signed)
+		{
+			glm::u16vec3 Texels[16];
+			decode_bc6h_block(Block, Signed, Texels);
+
+			texel_block4x4 TexelBlock;
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+			{
+				glm::u16vec3 const& Texel = Texels[Row * 4 + Col];
+				TexelBlock.Texel[Row][Col] = glm::vec4(glm::unpackHalf1x16(Texel.x), glm::unpackHalf1x16(Texel.y), glm::unpackHalf1x16(Texel.z), 1.0f);
+			}
+
+			return TexelBlock;
+		}
+
+		inline texel_block4x4 decompress_bc6hufloat_block(const bc6h_block &Block)
+		{
+			return decompress_bc6h_block(Block, false);
+		}
+
+		inline texel_block4x4 decompress_bc6hsfloat_block(const bc6h_block &Block)
+		{
+			return decompress_bc6h_block(Block, true);
+		}
+
+		inline void decode_bc6h_blocks(const bc6h_block *Blocks, size_t BlockCount, bool Signed, glm::u16vec3 *Texels)
+		{
+			for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+				decode_bc6h_block(Blocks[BlockIndex], Signed, Texels + BlockIndex * 16);
+		}
+
 	}//namespace detail
 }//namespace gli
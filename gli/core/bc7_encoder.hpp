@@ -0,0 +1,44 @@
+/// @brief Include to compress blocks with the BC7 compression scheme
+/// @file gli/core/bc7_encoder.hpp
+
+#pragma once
+
+#include "./bc.hpp"
+#include "./simd.hpp"
+
+namespace gli
+{
+	namespace detail
+	{
+		// Search space of the BC7 encoder
+		struct bc7_encoder_settings
+		{
+			// Bit N is set when mode N is tried
+			glm::uint8 ModeMask;
+			// Number of partitions fully encoded by the modes with subsets, picked among all the partitions by a quick error estimate
+			glm::uint8 PartitionCandidates;
+			// Least squares refinements of the endpoints once the indices are known
+			glm::uint8 RefineIterations;
+			// Try every combination of per endpoint p-bits instead of the p-bits closest to each endpoint
+			bool ExhaustivePBits;
+			// Try every channel rotation and index selection of modes 4 and 5
+			bool Rotations;
+		};
+
+		// Settings of the fast, default and slow presets, indexed by encode_preset
+		static bc7_encoder_settings const BC7_ENCODER_PRESETS[3] =
+		{
+			{(1 << 1) | (1 << 6), 1, 0, false, false},
+			{(1 << 1) | (1 << 3) | (1 << 4) | (1 << 5) | (1 << 6) | (1 << 7), 4, 1, false, false},
+			{0xFF, 64, 2, true, true}
+		};
+
+		// Encode the 16 texels of a block, in row major order
+		void encode_bc7_block(const glm::u8vec4 *Texels, bc7_encoder_settings const& Settings, bc7_block &Block);
+
+		// Encode BlockCount blocks of 16 texels each
+		void encode_bc7_blocks(const glm::u8vec4 *Texels, size_t BlockCount, bc7_encoder_settings const& Settings, bc7_block *Blocks);
+	}//namespace detail
+}//namespace gli
+
+#include "./bc7_encoder.inl"
@@ -0,0 +1,636 @@
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <utility>
+
+namespace gli
+{
+	namespace detail
+	{
+		// Texels of a block stored by channel so that the errors of 4 texels are evaluated at once
+		struct bc7_texels
+		{
+			float Channel[4][16];
+		};
+
+		// Channels fitted by a set of endpoints and indices
+		struct bc7_channels
+		{
+			unsigned First;
+			unsigned Count;
+			unsigned ColorBits;
+			unsigned AlphaBits;
+			// 0 without p-bits, 1 with a p-bit per endpoint, 2 with a p-bit shared by the endpoints of a subset
+			unsigned PBitMode;
+			unsigned IndexBits;
+		};
+
+		// Quantized endpoints of a subset, the stored values exclude the p-bits
+		struct bc7_endpoints
+		{
+			unsigned Stored[2][4];
+			unsigned PBits[2];
+		};
+
+		// Encoding of a block with a mode
+		struct bc7_candidate
+		{
+			unsigned Mode;
+			unsigned Partition;
+			unsigned Rotation;
+			unsigned IndexSelection;
+			bc7_endpoints Endpoints[3];
+			glm::uint8 Indices[16];
+			glm::uint8 AlphaIndices[16];
+			float Error;
+		};
+
+		// Write the bits of a 128 bits block from the least significant bit of the first byte
+		class bptc_bit_writer
+		{
+		public:
+			explicit bptc_bit_writer(glm::uint8* Data)
+				: Data(Data)
+				, Position(0)
+			{
+				std::memset(Data, 0, 16);
+			}
+
+			void write(unsigned Value, unsigned Count)
+			{
+				for(unsigned Bit = 0; Bit < Count; ++Bit, ++this->Position)
+					this->Data[this->Position >> 3] |= static_cast<glm::uint8>(((Value >> Bit) & 1) << (this->Position & 7));
+			}
+
+		private:
+			glm::uint8* Data;
+			unsigned Position;
+		};
+
+		// Expand an endpoint channel of Bits bits, p-bit included, to 8 bits like the decoder
+		inline int bc7_expand(unsigned Value, unsigned Bits)
+		{
+			unsigned const Shifted = Value << (8 - Bits);
+			return static_cast<int>((Shifted | (Shifted >> Bits)) & 0xFF);
+		}
+
+		// Return the value of Bits bits whose expansion with PBit, -1 without p-bit, is the closest to Value
+		inline unsigned bc7_quantize(float Value, unsigned Bits, int PBit)
+		{
+			unsigned const TotalBits = Bits + (PBit >= 0 ? 1 : 0);
+			float const Scaled = Value * static_cast<float>((1u << TotalBits) - 1) / 255.0f;
+			int const Guess = PBit >= 0 ? static_cast<int>((Scaled - static_cast<float>(PBit)) * 0.5f + 0.5f) : static_cast<int>(Scaled + 0.5f);
+
+			unsigned Best = 0;
+			float BestError = FLT_MAX;
+			for(int Candidate = glm::max(Guess - 1, 0); Candidate <= glm::min(Guess + 1, static_cast<int>((1u << Bits) - 1)); ++Candidate)
+			{
+				unsigned const Value8 = PBit >= 0 ? (static_cast<unsigned>(Candidate) << 1) | static_cast<unsigned>(PBit) : static_cast<unsigned>(Candidate);
+				float const Error = glm::abs(static_cast<float>(bc7_expand(Value8, TotalBits)) - Value);
+				if(Error < BestError)
+				{
+					BestError = Error;
+					Best = static_cast<unsigned>(Candidate);
+				}
+			}
+
+			return Best;
+		}
+
+		inline int bc7_expand_endpoint(bc7_endpoints const& Endpoints, bc7_channels const& Channels, unsigned Endpoint, unsigned Channel)
+		{
+			unsigned const Bits = Channel < 3 ? Channels.ColorBits : Channels.AlphaBits;
+			if(Channels.PBitMode == 0)
+				return bc7_expand(Endpoints.Stored[Endpoint][Channel], Bits);
+			return bc7_expand((Endpoints.Stored[Endpoint][Channel] << 1) | Endpoints.PBits[Endpoint], Bits + 1);
+		}
+
+		// Quantize the endpoints E with the p-bits PBit0 and PBit1, -1 picks the p-bit closest to each endpoint
+		inline void bc7_quantize_endpoints(glm::vec4 const (&E)[2], bc7_channels const& Channels, int PBit0, int PBit1, bc7_endpoints &Endpoints)
+		{
+			int const PBits[2] = {PBit0, PBit1};
+
+			for(unsigned Endpoint = 0; Endpoint < 2; ++Endpoint)
+			{
+				unsigned BestPBit = 0;
+				if(Channels.PBitMode != 0 && PBits[Endpoint] >= 0)
+					BestPBit = static_cast<unsigned>(PBits[Endpoint]);
+				else if(Channels.PBitMode != 0)
+				{
+					float BestError = FLT_MAX;
+					for(unsigned PBit = 0; PBit < 2; ++PBit)
+					{
+						float Error = 0.0f;
+						for(unsigned Channel = Channels.First; Channel < Channels.First + Channels.Count; ++Channel)
+						{
+							unsigned const Bits = Channel < 3 ? Channels.ColorBits : Channels.AlphaBits;
+							unsigned const Stored = bc7_quantize(E[Endpoint][Channel], Bits, static_cast<int>(PBit));
+							float const Difference = static_cast<float>(bc7_expand((Stored << 1) | PBit, Bits + 1)) - E[Endpoint][Channel];
+							Error += Difference * Difference;
+						}
+						if(Error < BestError)
+						{
+							BestError = Error;
+							BestPBit = PBit;
+						}
+					}
+				}
+
+				Endpoints.PBits[Endpoint] = BestPBit;
+				for(unsigned Channel = Channels.First; Channel < Channels.First + Channels.Count; ++Channel)
+				{
+					unsigned const Bits = Channel < 3 ? Channels.ColorBits : Channels.AlphaBits;
+					Endpoints.Stored[Endpoint][Channel] = bc7_quantize(E[Endpoint][Channel], Bits, Channels.PBitMode != 0 ? static_cast<int>(BestPBit) : -1);
+				}
+			}
+		}
+
+		// Assign to each texel of Mask the nearest palette entry, returns the squared error
+		inline float bc7_assign_indices(bc7_texels const& Texels, unsigned Mask, bc7_channels const& Channels, float const (*Palette)[4], unsigned PaletteSize, glm::uint8* Indices)
+		{
+			float Error = 0.0f;
+
+#			if defined(GLI_SIMD_SSE2)
+				for(unsigned Group = 0; Group < 4; ++Group)
+				{
+					if(((Mask >> (Group * 4)) & 0xF) == 0)
+						continue;
+
+					__m128 Texel[4];
+					for(unsigned Channel = Channels.First; Channel < Channels.First + Channels.Count; ++Channel)
+						Texel[Channel] = _mm_loadu_ps(&Texels.Channel[Channel][Group * 4]);
+
+					__m128 Best = _mm_set1_ps(FLT_MAX);
+					__m128i BestIndex = _mm_setzero_si128();
+					for(unsigned Entry = 0; Entry < PaletteSize; ++Entry)
+					{
+						__m128 Distance = _mm_setzero_ps();
+						for(unsigned Channel = Channels.First; Channel < Channels.First + Channels.Count; ++Channel)
+						{
+							__m128 const Difference = _mm_sub_ps(Texel[Channel], _mm_set1_ps(Palette[Entry][Channel]));
+							Distance = _mm_add_ps(Distance, _mm_mul_ps(Difference, Difference));
+						}
+
+						__m128i const Closer = _mm_castps_si128(_mm_cmplt_ps(Distance, Best));
+						Best = _mm_min_ps(Distance, Best);
+						BestIndex = _mm_or_si128(_mm_andnot_si128(Closer, BestIndex), _mm_and_si128(Closer, _mm_set1_epi32(static_cast<int>(Entry))));
+					}
+
+					float Distances[4];
+					glm::int32 Nearest[4];
+					_mm_storeu_ps(Distances, Best);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Nearest), BestIndex);
+
+					for(unsigned Lane = 0; Lane < 4; ++Lane)
+					{
+						if(!(Mask & (1u << (Group * 4 + Lane))))
+							continue;
+						Indices[Group * 4 + Lane] = static_cast<glm::uint8>(Nearest[Lane]);
+						Error += Distances[Lane];
+					}
+				}
+#			else
+				for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				{
+					if(!(Mask & (1u << TexelIndex)))
+						continue;
+
+					float Best = FLT_MAX;
+					for(unsigned Entry = 0; Entry < PaletteSize; ++Entry)
+					{
+						float Distance = 0.0f;
+						for(unsigned Channel = Channels.First; Channel < Channels.First + Channels.Count; ++Channel)
+						{
+							float const Difference = Texels.Channel[Channel][TexelIndex] - Palette[Entry][Channel];
+							Distance += Difference * Difference;
+						}
+						if(Distance < Best)
+						{
+							Best = Distance;
+							Indices[TexelIndex] = static_cast<glm::uint8>(Entry);
+						}
+					}
+					Error += Best;
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			return Error;
+		}
+
+		// Assign the indices of the texels of Mask for quantized endpoints, returns the squared error
+		inline float bc7_evaluate(bc7_texels const& Texels, unsigned Mask, bc7_channels const& Channels, bc7_endpoints const& Endpoints, glm::uint8* Indices)
+		{
+			unsigned const PaletteSize = 1u << Channels.IndexBits;
+			glm::uint8 const* const Weights = bptc_weights(Channels.IndexBits);
+
+			float Palette[16][4];
+			for(unsigned Channel = Channels.First; Channel < Channels.First + Channels.Count; ++Channel)
+			{
+				int const E0 = bc7_expand_endpoint(Endpoints, Channels, 0, Channel);
+				int const E1 = bc7_expand_endpoint(Endpoints, Channels, 1, Channel);
+				for(unsigned Entry = 0; Entry < PaletteSize; ++Entry)
+					Palette[Entry][Channel] = static_cast<float>(bptc_interpolate(E0, E1, Weights[Entry]));
+			}
+
+			return bc7_assign_indices(Texels, Mask, Channels, Palette, PaletteSize, Indices);
+		}
+
+		// Quantize the endpoints E trying the p-bits allowed by Settings, keeps the best encoding, returns the squared error
+		inline float bc7_evaluate_endpoints(bc7_texels const& Texels, unsigned Mask, bc7_channels const& Channels, bc7_encoder_settings const& Settings, glm::vec4 const (&E)[2], bc7_endpoints &Endpoints, glm::uint8* Indices)
+		{
+			int Configurations[4][2] = {{-1, -1}};
+			unsigned ConfigurationCount = 1;
+			if(Channels.PBitMode == 2)
+			{
+				Configurations[0][0] = Configurations[0][1] = 0;
+				Configurations[1][0] = Configurations[1][1] = 1;
+				ConfigurationCount = 2;
+			}
+			else if(Channels.PBitMode == 1 && Settings.ExhaustivePBits)
+			{
+				for(int Configuration = 0; Configuration < 4; ++Configuration)
+				{
+					Configurations[Configuration][0] = Configuration & 1;
+					Configurations[Configuration][1] = Configuration >> 1;
+				}
+				ConfigurationCount = 4;
+			}
+
+			float BestError = FLT_MAX;
+			for(unsigned Configuration = 0; Configuration < ConfigurationCount; ++Configuration)
+			{
+				bc7_endpoints Quantized;
+				glm::uint8 QuantizedIndices[16];
+				bc7_quantize_endpoints(E, Channels, Configurations[Configuration][0], Configurations[Configuration][1], Quantized);
+				float const Error = bc7_evaluate(Texels, Mask, Channels, Quantized, QuantizedIndices);
+				if(Error < BestError)
+				{
+					BestError = Error;
+					Endpoints = Quantized;
+					for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+						if(Mask & (1u << TexelIndex))
+							Indices[TexelIndex] = QuantizedIndices[TexelIndex];
+				}
+			}
+
+			return BestError;
+		}
+
+		// Solve the endpoints minimizing the squared error of the texels of Mask for their indices, returns false for degenerate indices
+		inline bool bc7_least_squares(bc7_texels const& Texels, unsigned Mask, bc7_channels const& Channels, glm::uint8 const* Indices, glm::vec4 (&E)[2])
+		{
+			glm::uint8 const* const Weights = bptc_weights(Channels.IndexBits);
+
+			float A = 0.0f, B = 0.0f, C = 0.0f;
+			glm::vec4 D0(0.0f), D1(0.0f);
+			for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+			{
+				if(!(Mask & (1u << TexelIndex)))
+					continue;
+
+				float const W = static_cast<float>(Weights[Indices[TexelIndex]]) / 64.0f;
+				A += (1.0f - W) * (1.0f - W);
+				B += (1.0f - W) * W;
+				C += W * W;
+				for(unsigned Channel = Channels.First; Channel < Channels.First + Channels.Count; ++Channel)
+				{
+					D0[Channel] += (1.0f - W) * Texels.Channel[Channel][TexelIndex];
+					D1[Channel] += W * Texels.Channel[Channel][TexelIndex];
+				}
+			}
+
+			float const Determinant = A * C - B * B;
+			if(glm::abs(Determinant) < 1e-6f)
+				return false;
+
+			E[0] = glm::clamp((C * D0 - B * D1) / Determinant, 0.0f, 255.0f);
+			E[1] = glm::clamp((A * D1 - B * D0) / Determinant, 0.0f, 255.0f);
+			return true;
+		}
+
+		// Fit the endpoints and the indices of the texels of Mask, returns the squared error
+		inline float bc7_fit_subset(bc7_texels const& Texels, unsigned Mask, bc7_channels const& Channels, bc7_encoder_settings const& Settings, bc7_endpoints &Endpoints, glm::uint8* Indices)
+		{
+			unsigned const First = Channels.First;
+			unsigned const Last = Channels.First + Channels.Count;
+
+			glm::vec4 Mean(0.0f);
+			float Count = 0.0f;
+			for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+			{
+				if(!(Mask & (1u << TexelIndex)))
+					continue;
+				for(unsigned Channel = First; Channel < Last; ++Channel)
+					Mean[Channel] += Texels.Channel[Channel][TexelIndex];
+				Count += 1.0f;
+			}
+			Mean /= glm::max(Count, 1.0f);
+
+			glm::mat4 Covariance(0.0f);
+			for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+			{
+				if(!(Mask & (1u << TexelIndex)))
+					continue;
+				for(unsigned Row = First; Row < Last; ++Row)
+				for(unsigned Col = First; Col < Last; ++Col)
+					Covariance[Col][Row] += (Texels.Channel[Row][TexelIndex] - Mean[Row]) * (Texels.Channel[Col][TexelIndex] - Mean[Col]);
+			}
+
+			// Principal axis by power iteration, starting from the covariances of the channel of largest variance so that
+			// the initial axis isn't orthogonal to the principal axis as (1, 1, 1) is for anti-correlated channels
+			unsigned Largest = First;
+			for(unsigned Channel = First; Channel < Last; ++Channel)
+				if(Covariance[Channel][Channel] > Covariance[Largest][Largest])
+					Largest = Channel;
+			glm::vec4 Axis = Covariance[Largest];
+			for(int Iteration = 0; Iteration < 8; ++Iteration)
+			{
+				Axis = Covariance * Axis;
+				float const Length = glm::max(glm::max(glm::abs(Axis.x), glm::abs(Axis.y)), glm::max(glm::abs(Axis.z), glm::abs(Axis.w)));
+				if(Length < 1e-6f)
+					break;
+				Axis /= Length;
+			}
+
+			glm::vec4 E[2] = {Mean, Mean};
+			float const AxisLength = glm::dot(Axis, Axis);
+			if(AxisLength > 1e-6f)
+			{
+				float MinT = FLT_MAX, MaxT = -FLT_MAX;
+				for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				{
+					if(!(Mask & (1u << TexelIndex)))
+						continue;
+					glm::vec4 Texel(0.0f);
+					for(unsigned Channel = First; Channel < Last; ++Channel)
+						Texel[Channel] = Texels.Channel[Channel][TexelIndex];
+					float const T = glm::dot(Texel - Mean, Axis) / AxisLength;
+					MinT = glm::min(MinT, T);
+					MaxT = glm::max(MaxT, T);
+				}
+				E[0] = glm::clamp(Mean + Axis * MinT, 0.0f, 255.0f);
+				E[1] = glm::clamp(Mean + Axis * MaxT, 0.0f, 255.0f);
+			}
+
+			float Error = bc7_evaluate_endpoints(Texels, Mask, Channels, Settings, E, Endpoints, Indices);
+
+			for(unsigned Iteration = 0; Iteration < Settings.RefineIterations && Error > 0.0f; ++Iteration)
+			{
+				glm::vec4 Refined[2];
+				if(!bc7_least_squares(Texels, Mask, Channels, Indices, Refined))
+					break;
+
+				bc7_endpoints RefinedEndpoints;
+				glm::uint8 RefinedIndices[16];
+				float const RefinedError = bc7_evaluate_endpoints(Texels, Mask, Channels, Settings, Refined, RefinedEndpoints, RefinedIndices);
+				if(RefinedError >= Error)
+					break;
+
+				Error = RefinedError;
+				Endpoints = RefinedEndpoints;
+				for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+					if(Mask & (1u << TexelIndex))
+						Indices[TexelIndex] = RefinedIndices[TexelIndex];
+			}
+
+			return Error;
+		}
+
+		inline unsigned bc7_subset_mask(unsigned SubsetCount, unsigned Partition, unsigned Subset)
+		{
+			unsigned Mask = 0;
+			for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				if(bptc_subset(SubsetCount, Partition, TexelIndex) == Subset)
+					Mask |= 1u << TexelIndex;
+			return Mask;
+		}
+
+		inline unsigned bc7_anchor(unsigned SubsetCount, unsigned Partition, unsigned Subset)
+		{
+			if(Subset == 0)
+				return 0;
+			if(SubsetCount == 2)
+				return BPTC_ANCHOR2[Partition];
+			return BPTC_ANCHOR3[Subset - 1][Partition];
+		}
+
+		// Estimate the error of a partition from the spread of each subset around the diagonal of its bounding box
+		inline float bc7_estimate_partition(bc7_texels const& Texels, unsigned SubsetCount, unsigned Partition)
+		{
+			float Error = 0.0f;
+
+			for(unsigned Subset = 0; Subset < SubsetCount; ++Subset)
+			{
+				glm::vec4 Mean(0.0f), Min(255.0f), Max(0.0f);
+				float Count = 0.0f;
+				for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				{
+					if(bptc_subset(SubsetCount, Partition, TexelIndex) != Subset)
+						continue;
+					glm::vec4 const Texel(Texels.Channel[0][TexelIndex], Texels.Channel[1][TexelIndex], Texels.Channel[2][TexelIndex], Texels.Channel[3][TexelIndex]);
+					Mean += Texel;
+					Min = glm::min(Min, Texel);
+					Max = glm::max(Max, Texel);
+					Count += 1.0f;
+				}
+				Mean /= glm::max(Count, 1.0f);
+
+				glm::vec4 const Axis = Max - Min;
+				float const AxisLength = glm::dot(Axis, Axis);
+				for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				{
+					if(bptc_subset(SubsetCount, Partition, TexelIndex) != Subset)
+						continue;
+					glm::vec4 const Difference = glm::vec4(Texels.Channel[0][TexelIndex], Texels.Channel[1][TexelIndex], Texels.Channel[2][TexelIndex], Texels.Channel[3][TexelIndex]) - Mean;
+					float const Projection = AxisLength > 0.0f ? glm::dot(Difference, Axis) : 0.0f;
+					Error += glm::dot(Difference, Difference) - (AxisLength > 0.0f ? Projection * Projection / AxisLength : 0.0f);
+				}
+			}
+
+			return Error;
+		}
+
+		// Store to Partitions the Count partitions among the first PartitionCount with the lowest estimated error, returns the number stored
+		inline unsigned bc7_rank_partitions(bc7_texels const& Texels, unsigned SubsetCount, unsigned PartitionCount, unsigned Count, unsigned* Partitions)
+		{
+			std::pair<float, unsigned> Estimates[64];
+			for(unsigned Partition = 0; Partition < PartitionCount; ++Partition)
+				Estimates[Partition] = std::make_pair(bc7_estimate_partition(Texels, SubsetCount, Partition), Partition);
+
+			unsigned const Ranked = glm::min(Count, PartitionCount);
+			std::partial_sort(Estimates, Estimates + Ranked, Estimates + PartitionCount);
+			for(unsigned Index = 0; Index < Ranked; ++Index)
+				Partitions[Index] = Estimates[Index].second;
+
+			return Ranked;
+		}
+
+		// Encode the texels with a mode, Texels are already rotated for Rotation
+		inline void bc7_encode_mode(bc7_texels const& Texels, unsigned Mode, unsigned Partition, unsigned Rotation, unsigned IndexSelection, bc7_encoder_settings const& Settings, bc7_candidate &Candidate)
+		{
+			bc7_mode_info const& Info = BC7_MODES[Mode];
+
+			Candidate.Mode = Mode;
+			Candidate.Partition = Partition;
+			Candidate.Rotation = Rotation;
+			Candidate.IndexSelection = IndexSelection;
+			Candidate.Error = 0.0f;
+
+			// Modes 4 and 5 encode the color and the alpha with separate indices
+			bool const SeparateAlpha = Info.SecondaryIndexBits != 0;
+			bc7_channels const Color = {0, Info.AlphaBits && !SeparateAlpha ? 4u : 3u, Info.ColorBits, Info.AlphaBits, Info.EndpointPBits ? 1u : Info.SharedPBits ? 2u : 0u, IndexSelection ? Info.SecondaryIndexBits : Info.IndexBits};
+
+			for(unsigned Subset = 0; Subset < Info.SubsetCount; ++Subset)
+				Candidate.Error += bc7_fit_subset(Texels, bc7_subset_mask(Info.SubsetCount, Partition, Subset), Color, Settings, Candidate.Endpoints[Subset], Candidate.Indices);
+
+			if(SeparateAlpha)
+			{
+				bc7_channels const Alpha = {3, 1, Info.ColorBits, Info.AlphaBits, 0, IndexSelection ? Info.IndexBits : Info.SecondaryIndexBits};
+				bc7_endpoints AlphaEndpoints;
+				Candidate.Error += bc7_fit_subset(Texels, 0xFFFF, Alpha, Settings, AlphaEndpoints, Candidate.AlphaIndices);
+				Candidate.Endpoints[0].Stored[0][3] = AlphaEndpoints.Stored[0][3];
+				Candidate.Endpoints[0].Stored[1][3] = AlphaEndpoints.Stored[1][3];
+			}
+		}
+
+		inline void bc7_pack(bc7_candidate Candidate, bc7_block &Block)
+		{
+			bc7_mode_info const& Info = BC7_MODES[Candidate.Mode];
+			bool const SeparateAlpha = Info.SecondaryIndexBits != 0;
+			unsigned const ColorIndexBits = SeparateAlpha && Candidate.IndexSelection ? Info.SecondaryIndexBits : Info.IndexBits;
+			unsigned const AlphaIndexBits = SeparateAlpha && !Candidate.IndexSelection ? Info.SecondaryIndexBits : Info.IndexBits;
+
+			// The most significant bit of the index of each anchor texel is implicitly zero, swap the endpoints when it's set
+			for(unsigned Subset = 0; Subset < Info.SubsetCount; ++Subset)
+			{
+				unsigned const Anchor = bc7_anchor(Info.SubsetCount, Candidate.Partition, Subset);
+				if(!(Candidate.Indices[Anchor] >> (ColorIndexBits - 1)))
+					continue;
+
+				bc7_endpoints& Endpoints = Candidate.Endpoints[Subset];
+				for(unsigned Channel = 0; Channel < (SeparateAlpha ? 3u : 4u); ++Channel)
+					std::swap(Endpoints.Stored[0][Channel], Endpoints.Stored[1][Channel]);
+				std::swap(Endpoints.PBits[0], Endpoints.PBits[1]);
+
+				for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+					if(bptc_subset(Info.SubsetCount, Candidate.Partition, TexelIndex) == Subset)
+						Candidate.Indices[TexelIndex] = static_cast<glm::uint8>((1u << ColorIndexBits) - 1 - Candidate.Indices[TexelIndex]);
+			}
+
+			if(SeparateAlpha && (Candidate.AlphaIndices[0] >> (AlphaIndexBits - 1)))
+			{
+				std::swap(Candidate.Endpoints[0].Stored[0][3], Candidate.Endpoints[0].Stored[1][3]);
+				for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+					Candidate.AlphaIndices[TexelIndex] = static_cast<glm::uint8>((1u << AlphaIndexBits) - 1 - Candidate.AlphaIndices[TexelIndex]);
+			}
+
+			bptc_bit_writer Writer(Block.Data);
+			Writer.write(1u << Candidate.Mode, Candidate.Mode + 1);
+			Writer.write(Candidate.Partition, Info.PartitionBits);
+			Writer.write(Candidate.Rotation, Info.RotationBits);
+			Writer.write(Candidate.IndexSelection, Info.IndexSelectionBits);
+
+			// Endpoints are stored by channel, then by subset
+			unsigned const EndpointCount = Info.SubsetCount * 2u;
+			for(unsigned Channel = 0; Channel < 3; ++Channel)
+			for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+				Writer.write(Candidate.Endpoints[Endpoint / 2].Stored[Endpoint % 2][Channel], Info.ColorBits);
+			for(unsigned Endpoint = 0; Endpoint < EndpointCount && Info.AlphaBits; ++Endpoint)
+				Writer.write(Candidate.Endpoints[Endpoint / 2].Stored[Endpoint % 2][3], Info.AlphaBits);
+
+			if(Info.EndpointPBits)
+			{
+				for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+					Writer.write(Candidate.Endpoints[Endpoint / 2].PBits[Endpoint % 2], 1);
+			}
+			else if(Info.SharedPBits)
+			{
+				for(unsigned Subset = 0; Subset < Info.SubsetCount; ++Subset)
+					Writer.write(Candidate.Endpoints[Subset].PBits[0], 1);
+			}
+
+			// The primary indices are the alpha indices when the index selection swaps them
+			glm::uint8 const* const Primary = SeparateAlpha && Candidate.IndexSelection ? Candidate.AlphaIndices : Candidate.Indices;
+			glm::uint8 const* const Secondary = SeparateAlpha && Candidate.IndexSelection ? Candidate.Indices : Candidate.AlphaIndices;
+			for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				Writer.write(Primary[TexelIndex], Info.IndexBits - (bptc_is_anchor(Info.SubsetCount, Candidate.Partition, TexelIndex) ? 1 : 0));
+			for(unsigned TexelIndex = 0; TexelIndex < 16 && SeparateAlpha; ++TexelIndex)
+				Writer.write(Secondary[TexelIndex], Info.SecondaryIndexBits - (TexelIndex == 0 ? 1 : 0));
+		}
+
+		inline void encode_bc7_block(const glm::u8vec4 *Texels, bc7_encoder_settings const& Settings, bc7_block &Block)
+		{
+			bc7_texels Channels;
+			bool Opaque = true;
+			for(unsigned TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+			{
+				for(unsigned Channel = 0; Channel < 4; ++Channel)
+					Channels.Channel[Channel][TexelIndex] = static_cast<float>(Texels[TexelIndex][Channel]);
+				Opaque = Opaque && Texels[TexelIndex].a == 255;
+			}
+
+			bc7_candidate Best;
+			Best.Error = FLT_MAX;
+			bc7_candidate Candidate;
+
+			// Partitions ranked once per block for the 2 subsets modes, the 3 subsets modes and mode 0 which only has 16 partitions
+			unsigned RankedPartitions[3][64];
+			unsigned RankedCount[3] = {0, 0, 0};
+			bool Ranked[3] = {false, false, false};
+
+			// Modes 0 to 3 are opaque, mode 6 encodes any block when the settings exclude every mode able to
+			unsigned const ModeMask = (Settings.ModeMask & (Opaque ? 0xFF : 0xF0)) ? Settings.ModeMask : (1 << 6);
+
+			for(unsigned Mode = 0; Mode < 8 && Best.Error > 0.0f; ++Mode)
+			{
+				bc7_mode_info const& Info = BC7_MODES[Mode];
+				if(!(ModeMask & (1u << Mode)) || (!Info.AlphaBits && !Opaque))
+					continue;
+
+				if(Info.SubsetCount == 1)
+				{
+					unsigned const RotationCount = Info.RotationBits && Settings.Rotations ? 4u : 1u;
+					unsigned const SelectionCount = Info.IndexSelectionBits && Settings.Rotations ? 2u : 1u;
+					for(unsigned Rotation = 0; Rotation < RotationCount; ++Rotation)
+					{
+						// The decoder swaps the alpha with a color channel after interpolation
+						bc7_texels Rotated = Channels;
+						if(Rotation)
+							std::swap(Rotated.Channel[Rotation - 1], Rotated.Channel[3]);
+
+						for(unsigned Selection = 0; Selection < SelectionCount; ++Selection)
+						{
+							bc7_encode_mode(Rotated, Mode, 0, Rotation, Selection, Settings, Candidate);
+							if(Candidate.Error < Best.Error)
+								Best = Candidate;
+						}
+					}
+				}
+				else
+				{
+					unsigned const Set = Mode == 0 ? 2 : Info.SubsetCount - 2;
+					if(!Ranked[Set])
+					{
+						RankedCount[Set] = bc7_rank_partitions(Channels, Info.SubsetCount, 1u << Info.PartitionBits, glm::max<unsigned>(Settings.PartitionCandidates, 1), RankedPartitions[Set]);
+						Ranked[Set] = true;
+					}
+
+					for(unsigned Index = 0; Index < RankedCount[Set] && Best.Error > 0.0f; ++Index)
+					{
+						bc7_encode_mode(Channels, Mode, RankedPartitions[Set][Index], 0, 0, Settings, Candidate);
+						if(Candidate.Error < Best.Error)
+							Best = Candidate;
+					}
+				}
+			}
+
+			bc7_pack(Best, Block);
+		}
+
+		inline void encode_bc7_blocks(const glm::u8vec4 *Texels, size_t BlockCount, bc7_encoder_settings const& Settings, bc7_block *Blocks)
+		{
+			for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+				encode_bc7_block(Texels + BlockIndex * 16, Settings, Blocks[BlockIndex]);
+		}
+	}//namespace detail
+}//namespace gli
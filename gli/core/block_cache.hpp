@@ -0,0 +1,97 @@
+/// @brief Include to cache the decoded blocks of compressed textures
+/// @file gli/core/block_cache.hpp
+///
+/// Define GLI_BLOCK_CACHE_SIZE before including GLI to set the number of decoded 4x4 blocks cached by each thread, a power of two.
+/// Define GLI_LARGE_BLOCK_CACHE_SIZE to set the number of decoded blocks of footprints up to 12x12 cached by each thread, a power of two.
+
+#pragma once
+
+#include "../type.hpp"
+#include "../format.hpp"
+#include "s3tc.hpp"
+#include <cstring>
+
+#ifndef GLI_BLOCK_CACHE_SIZE
+#	define GLI_BLOCK_CACHE_SIZE 64
+#endif
+
+#ifndef GLI_LARGE_BLOCK_CACHE_SIZE
+#	define GLI_LARGE_BLOCK_CACHE_SIZE 16
+#endif
+
+namespace gli{
+namespace detail
+{
+	/// Decoded texels of blocks of footprints up to 12x12
+	struct texel_block12x12
+	{
+		// row x col
+		glm::vec4 Texel[12][12];
+	};
+
+	/// Direct mapped cache of Size decoded blocks.
+	/// An entry is identified by the address and the format of a compressed block and keeps a copy of the compressed block
+	/// so that a block written since it was decoded is decoded again.
+	template <typename texel_block_type, size_t Size>
+	class basic_block_cache
+	{
+		static_assert(Size > 0 && (Size & (Size - 1)) == 0, "The size of a block cache must be a power of two");
+
+	public:
+		basic_block_cache()
+		{
+			for(size_t EntryIndex = 0; EntryIndex < Size; ++EntryIndex)
+				this->Entries[EntryIndex].Address = nullptr;
+		}
+
+		/// Return the decoded texels of Block, decoding it with Decompress if it isn't cached
+		template <typename block_type>
+		texel_block_type const& get(block_type const& Block, format Format, texel_block_type(*Decompress)(block_type const&))
+		{
+			static_assert(sizeof(block_type) <= 16, "Compressed blocks larger than 16 bytes aren't supported");
+
+			// Mix the address bits so that blocks of adjacent rows don't share an entry
+			glm::uint64 const Address = static_cast<glm::uint64>(reinterpret_cast<size_t>(&Block));
+			entry& Entry = this->Entries[((Address >> 3) * 0x9E3779B97F4A7C15ULL >> 32) & (Size - 1)];
+
+			if(Entry.Address != &Block || Entry.Format != Format || std::memcmp(Entry.Data, &Block, sizeof(block_type)) != 0)
+			{
+				Entry.Address = &Block;
+				Entry.Format = Format;
+				std::memcpy(Entry.Data, &Block, sizeof(block_type));
+				Entry.Texels = Decompress(Block);
+			}
+
+			return Entry.Texels;
+		}
+
+	private:
+		struct entry
+		{
+			void const* Address;
+			format Format;
+			glm::uint8 Data[16];
+			texel_block_type Texels;
+		};
+
+		entry Entries[Size];
+	};
+
+	typedef basic_block_cache<texel_block4x4, GLI_BLOCK_CACHE_SIZE> block_cache;
+	typedef basic_block_cache<texel_block12x12, GLI_LARGE_BLOCK_CACHE_SIZE> large_block_cache;
+
+	/// Return the decoded block cache of the calling thread, shared by all the samplers used by the thread
+	inline block_cache& thread_block_cache()
+	{
+		static thread_local block_cache Cache;
+		return Cache;
+	}
+
+	/// Return the cache of decoded blocks of large footprints of the calling thread
+	inline large_block_cache& thread_large_block_cache()
+	{
+		static thread_local large_block_cache Cache;
+		return Cache;
+	}
+}//namespace detail
+}//namespace gli
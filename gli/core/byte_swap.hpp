@@ -0,0 +1,82 @@
+/// @brief Include to copy memory while reversing the byte order of its elements, used to load containers written on hosts of the other endianness
+/// @file gli/core/byte_swap.hpp
+
+#pragma once
+
+#include "../type.hpp"
+#include "simd.hpp"
+#include <cstring>
+
+namespace gli{
+namespace detail
+{
+	inline std::uint32_t swap_bytes(std::uint32_t Value)
+	{
+		return (Value >> 24) | ((Value >> 8) & 0x0000FF00) | ((Value << 8) & 0x00FF0000) | (Value << 24);
+	}
+
+	inline void copy_swap_scalar(glm::uint8* Dst, glm::uint8 const* Src, size_t Size, size_t ElementSize)
+	{
+		for(size_t Offset = 0; Offset < Size; Offset += ElementSize)
+		for(size_t Byte = 0, Half = ElementSize / 2; Byte < Half; ++Byte)
+		{
+			// Read both bytes before writing so that Dst may be Src
+			glm::uint8 const First = Src[Offset + Byte];
+			glm::uint8 const Last = Src[Offset + ElementSize - 1 - Byte];
+			Dst[Offset + Byte] = Last;
+			Dst[Offset + ElementSize - 1 - Byte] = First;
+		}
+	}
+
+#	if defined(GLI_SIMD_SSE2)
+		// Reverse the bytes of each element of ElementSize bytes of a vector
+		inline __m128i swap_bytes(__m128i Vector, size_t ElementSize)
+		{
+#			if defined(GLI_SIMD_SSSE3)
+				static glm::uint8 const Shuffles[3][16] =
+				{
+					{1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+					{3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+					{7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8}
+				};
+				size_t const Index = ElementSize == 2 ? 0 : (ElementSize == 4 ? 1 : 2);
+				return _mm_shuffle_epi8(Vector, _mm_loadu_si128(reinterpret_cast<__m128i const*>(Shuffles[Index])));
+#			else
+				// Reverse the 16 bits words of each element, then the bytes of each word
+				if(ElementSize >= 4)
+				{
+					Vector = ElementSize == 4
+						? _mm_shufflehi_epi16(_mm_shufflelo_epi16(Vector, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1))
+						: _mm_shufflehi_epi16(_mm_shufflelo_epi16(Vector, _MM_SHUFFLE(0, 1, 2, 3)), _MM_SHUFFLE(0, 1, 2, 3));
+				}
+				return _mm_or_si128(_mm_slli_epi16(Vector, 8), _mm_srli_epi16(Vector, 8));
+#			endif//defined(GLI_SIMD_SSSE3)
+		}
+#	endif//defined(GLI_SIMD_SSE2)
+
+	/// Copy Size bytes from Src to Dst reversing the byte order of each element of ElementSize bytes, in a single pass over the memory.
+	/// Size must be a multiple of ElementSize, elements of 1 byte are copied as is. Dst may be Src to swap in place, otherwise the ranges must not overlap.
+	inline void copy_swap(void* Dst, void const* Src, size_t Size, size_t ElementSize)
+	{
+		GLI_ASSERT((ElementSize == 1 || ElementSize == 2 || ElementSize == 4 || ElementSize == 8) && Size % ElementSize == 0);
+
+		if(ElementSize <= 1)
+		{
+			if(Dst != Src)
+				std::memcpy(Dst, Src, Size);
+			return;
+		}
+
+		glm::uint8* DstBytes = static_cast<glm::uint8*>(Dst);
+		glm::uint8 const* SrcBytes = static_cast<glm::uint8 const*>(Src);
+
+#		if defined(GLI_SIMD_SSE2)
+			for(glm::uint8 const* const End = SrcBytes + Size / 16 * 16; SrcBytes < End; SrcBytes += 16, DstBytes += 16)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(DstBytes), swap_bytes(_mm_loadu_si128(reinterpret_cast<__m128i const*>(SrcBytes)), ElementSize));
+			Size %= 16;
+#		endif//defined(GLI_SIMD_SSE2)
+
+		copy_swap_scalar(DstBytes, SrcBytes, Size, ElementSize);
+	}
+}//namespace detail
+}//namespace gli
@@ -0,0 +1,122 @@
+/// @brief Include to validate the texture descriptions read from container headers before creating textures and reading their images
+/// @file gli/core/check.hpp
+
+#pragma once
+
+#include "../format.hpp"
+#include "../target.hpp"
+#include "../levels.hpp"
+#include <glm/gtc/round.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace gli{
+namespace detail
+{
+	enum
+	{
+		// Textures may have more levels than their extent, the levels past the smallest one are a single block
+		LEVELS_MAX = 32
+	};
+
+	/// Size of the storage of a texture described by a container header, 0 if the description is invalid
+	inline std::uint64_t get_storage_size(format Format, extent3d const& Extent, std::uint64_t Images, size_t Levels)
+	{
+		if(!is_valid(Format) || glm::any(glm::lessThan(Extent, extent3d(1))) || Levels > LEVELS_MAX)
+			return 0;
+
+		std::uint64_t Size = 0;
+		for(size_t Level = 0; Level < Levels; ++Level)
+		{
+			extent3d const BlockCount = glm::ceilMultiple(glm::max(Extent >> static_cast<int>(Level), extent3d(1)), block_extent(Format)) / block_extent(Format);
+			Size += static_cast<std::uint64_t>(block_size(Format)) * static_cast<std::uint64_t>(BlockCount.x) * static_cast<std::uint64_t>(BlockCount.y) * static_cast<std::uint64_t>(BlockCount.z);
+		}
+
+		return Size * Images;
+	}
+
+	/// Check that a texture description read from a container can create a texture.
+	/// The storage is bounded to 2^48 texels so that no size computation overflows.
+	inline bool check_texture_desc(
+		std::uint32_t Target, std::uint32_t Format,
+		std::uint32_t Width, std::uint32_t Height, std::uint32_t Depth,
+		std::uint32_t Layers, std::uint32_t Faces, std::uint32_t Levels)
+	{
+		if(!is_valid(static_cast<format>(Format)) || Target > TARGET_LAST)
+			return false;
+
+		std::uint32_t const MaxExtent = static_cast<std::uint32_t>(std::numeric_limits<int>::max());
+		if(Width == 0 || Height == 0 || Depth == 0 || Width > MaxExtent || Height > MaxExtent || Depth > MaxExtent)
+			return false;
+
+		target const TargetValue = static_cast<target>(Target);
+		if(Faces != (is_target_cube(TargetValue) ? 6u : 1u) || Layers == 0 || (!is_target_array(TargetValue) && Layers != 1))
+			return false;
+		if((is_target_1d(TargetValue) && Height != 1) || (TargetValue != TARGET_3D && Depth != 1))
+			return false;
+		if(is_target_cube(TargetValue) && Width != Height)
+			return false;
+
+		std::uint64_t const Images = static_cast<std::uint64_t>(Layers) * Faces;
+		std::uint64_t const Texels = static_cast<std::uint64_t>(Width) * Height;
+		if(Texels > (static_cast<std::uint64_t>(1) << 48) / Depth / Images)
+			return false;
+
+		return Levels > 0 && Levels <= LEVELS_MAX;
+	}
+
+	/// Check the swizzles read from a container
+	inline bool check_swizzles(std::uint32_t Red, std::uint32_t Green, std::uint32_t Blue, std::uint32_t Alpha)
+	{
+		return Red <= SWIZZLE_LAST && Green <= SWIZZLE_LAST && Blue <= SWIZZLE_LAST && Alpha <= SWIZZLE_LAST;
+	}
+
+	/// Result of the validation of a container before its images are read
+	enum parse_error
+	{
+		PARSE_SUCCESS = 0,
+		PARSE_TRUNCATED,			// The container ends before the end of its header or of its images
+		PARSE_BAD_HEADER,			// The header isn't a valid description of a texture
+		PARSE_UNSUPPORTED_FORMAT	// The format or the supercompression isn't supported
+	};
+
+	/// Texture stored in a container, and range of the container holding its images.
+	/// Once a container is parsed and End is checked against the size of the container, the images are read without further checks.
+	struct container_desc
+	{
+		target Target;
+		format Format;
+		extent3d Extent;
+		size_t Layers;
+		size_t Faces;
+		size_t Levels;
+		swizzles Swizzles;
+
+		/// Offset of the first image from the beginning of the container
+		std::uint64_t Offset;
+
+		/// Offset of the end of the last image, the container must be at least End bytes
+		std::uint64_t End;
+
+		/// Size of the elements which bytes are reversed while reading the images, 0 if the container has the endianness of the host
+		size_t Swap;
+	};
+
+	/// Check the texture description read from a container header
+	inline parse_error check_container_desc(container_desc const& Desc)
+	{
+		if(!is_valid(Desc.Format))
+			return PARSE_UNSUPPORTED_FORMAT;
+		if(glm::any(glm::lessThan(Desc.Extent, extent3d(1))) || Desc.Layers > 0xffffffffu || Desc.Faces > 0xffffffffu || Desc.Levels > 0xffffffffu)
+			return PARSE_BAD_HEADER;
+		if(!check_texture_desc(
+			static_cast<std::uint32_t>(Desc.Target), static_cast<std::uint32_t>(Desc.Format),
+			static_cast<std::uint32_t>(Desc.Extent.x), static_cast<std::uint32_t>(Desc.Extent.y), static_cast<std::uint32_t>(Desc.Extent.z),
+			static_cast<std::uint32_t>(Desc.Layers), static_cast<std::uint32_t>(Desc.Faces), static_cast<std::uint32_t>(Desc.Levels)))
+			return PARSE_BAD_HEADER;
+
+		return PARSE_SUCCESS;
+	}
+}//namespace detail
+}//namespace gli
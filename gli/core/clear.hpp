@@ -1,6 +1,7 @@
 #pragma once
 
 #include "convert_func.hpp"
+#include "fill.hpp"
 
 namespace gli{
 namespace detail
@@ -16,9 +17,7 @@ namespace detail
 			textureType Texel(ConvertTexel);
 			Write(Texel, typename textureType::extent_type(0), 0, 0, 0, Color);
 
-			size_t const BlockSize(block_size(Texture.format()));
-			for(size_t BlockIndex = 0, BlockCount = Texture.size() / BlockSize; BlockIndex < BlockCount; ++BlockIndex)
-				memcpy(static_cast<std::uint8_t*>(Texture.data()) + BlockSize * BlockIndex, Texel.data(), BlockSize);
+			fill_parallel(static_cast<glm::uint8*>(Texture.data()), Texture.size(), static_cast<glm::uint8 const*>(Texel.data()), block_size(Texture.format()));
 		}
 	};
 }//namespace detail
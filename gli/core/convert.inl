@@ -1,9 +1,168 @@
 #include "../core/convert_func.hpp"
+#include "../core/swizzle.hpp"
+#include "../core/parallel.hpp"
+#include "../core/convert_span.hpp"
+#include "../core/bc7_encoder.hpp"
+#include "../core/etc_encoder.hpp"
+#include <vector>
 
-namespace gli
+namespace gli{
+namespace detail
 {
+	inline glm::u8vec4 encode_unorm8(vec4 const& Texel)
+	{
+		return glm::u8vec4(glm::clamp(Texel, 0.0f, 1.0f) * 255.0f + 0.5f);
+	}
+
+	inline glm::i16vec2 encode_eac11(vec4 const& Texel, bool Signed)
+	{
+		return Signed
+			? glm::i16vec2(glm::round(glm::clamp(vec2(Texel), -1.0f, 1.0f) * 1023.0f))
+			: glm::i16vec2(glm::round(glm::clamp(vec2(Texel), 0.0f, 1.0f) * 2047.0f));
+	}
+
+	/// Encode BlockCount blocks of Format from 16 texels per block in row major order
+	inline void encode_blocks(format Format, vec4 const* Texels, size_t BlockCount, encode_preset Preset, void* Blocks)
+	{
+		bool const Signed = is_signed(Format);
+
+		for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+		{
+			vec4 const* const BlockTexels = Texels + BlockIndex * 16;
+			glm::u8vec4 Colors[16];
+			glm::i16vec2 Values[16];
+
+			switch(Format)
+			{
+			case FORMAT_RGBA_BP_UNORM_BLOCK16:
+			case FORMAT_RGBA_BP_SRGB_BLOCK16:
+				for(int Texel = 0; Texel < 16; ++Texel)
+					Colors[Texel] = encode_unorm8(BlockTexels[Texel]);
+				encode_bc7_block(Colors, BC7_ENCODER_PRESETS[Preset], static_cast<bc7_block*>(Blocks)[BlockIndex]);
+				break;
+			case FORMAT_RGB_ETC_UNORM_BLOCK8:
+			case FORMAT_RGB_ETC2_UNORM_BLOCK8:
+			case FORMAT_RGB_ETC2_SRGB_BLOCK8:
+				for(int Texel = 0; Texel < 16; ++Texel)
+					Colors[Texel] = encode_unorm8(BlockTexels[Texel]);
+				encode_etc2_rgb_block(Colors, Format == FORMAT_RGB_ETC_UNORM_BLOCK8, ETC_ENCODER_PRESETS[Preset], static_cast<etc2_rgb_block*>(Blocks)[BlockIndex]);
+				break;
+			case FORMAT_RGBA_ETC2_UNORM_BLOCK16:
+			case FORMAT_RGBA_ETC2_SRGB_BLOCK16:
+				for(int Texel = 0; Texel < 16; ++Texel)
+					Colors[Texel] = encode_unorm8(BlockTexels[Texel]);
+				encode_etc2_rgba_block(Colors, ETC_ENCODER_PRESETS[Preset], static_cast<etc2_rgba_block*>(Blocks)[BlockIndex]);
+				break;
+			case FORMAT_R_EAC_UNORM_BLOCK8:
+			case FORMAT_R_EAC_SNORM_BLOCK8:
+			{
+				glm::int16 Red[16];
+				for(int Texel = 0; Texel < 16; ++Texel)
+					Red[Texel] = encode_eac11(BlockTexels[Texel], Signed).x;
+				encode_eac_r11_block(Red, Signed, ETC_ENCODER_PRESETS[Preset], static_cast<eac_block*>(Blocks)[BlockIndex]);
+				break;
+			}
+			case FORMAT_RG_EAC_UNORM_BLOCK16:
+			case FORMAT_RG_EAC_SNORM_BLOCK16:
+				for(int Texel = 0; Texel < 16; ++Texel)
+					Values[Texel] = encode_eac11(BlockTexels[Texel], Signed);
+				encode_eac_rg11_block(Values, Signed, ETC_ENCODER_PRESETS[Preset], static_cast<eac_rg_block*>(Blocks)[BlockIndex]);
+				break;
+			default:
+				GLI_ASSERT(0);
+				return;
+			}
+		}
+	}
+
+	/// Encode a level of Texture, read with Fetch, to the blocks of the same level of Storage.
+	/// Each task gathers a row of blocks and encodes it at once, texels outside the level repeat the edge texels.
+	template <typename texture_type, typename fetch_type>
+	inline void encode_level(texture_type const& Texture, fetch_type Fetch, texture& Storage, size_t Layer, size_t Face, size_t Level, encode_preset Preset)
+	{
+		typedef typename texture::extent_type extent_type;
+
+		GLI_ASSERT(has_encoder(Storage.format()));
+
+		extent_type const Dimensions = Storage.extent(Level);
+		extent_type const BlockExtent = block_extent(Storage.format());
+		extent_type const BlockCount = (Dimensions + BlockExtent - 1) / BlockExtent;
+		size_t const BlockSize = block_size(Storage.format());
+		bool const SRGB = is_srgb(Storage.format());
+		srgb_tables const& Tables = get_srgb_tables();
+		glm::uint8* const Blocks = Storage.data<glm::uint8>(Layer, Face, Level);
+
+		parallel_for(0, static_cast<size_t>(BlockCount.y * BlockCount.z), 1, [&](size_t RowBegin, size_t RowEnd)
+		{
+			std::vector<vec4> Texels(static_cast<size_t>(BlockCount.x) * 16);
+
+			for(size_t Row = RowBegin; Row < RowEnd; ++Row)
+			{
+				int const BlockY = static_cast<int>(Row % BlockCount.y);
+				int const Z = static_cast<int>(Row / BlockCount.y);
+
+				for(int BlockX = 0; BlockX < BlockCount.x; ++BlockX)
+				for(int Y = 0; Y < BlockExtent.y; ++Y)
+				for(int X = 0; X < BlockExtent.x; ++X)
+				{
+					extent_type const TexelCoord(
+						glm::min(BlockX * BlockExtent.x + X, Dimensions.x - 1),
+						glm::min(BlockY * BlockExtent.y + Y, Dimensions.y - 1), Z);
+					vec4 Texel = Fetch(Texture, typename texture_type::extent_type(TexelCoord), Layer, Face, Level);
+					if(SRGB)
+						Texel = vec4(
+							linear_to_srgb8(Tables, Texel.x) / 255.0f,
+							linear_to_srgb8(Tables, Texel.y) / 255.0f,
+							linear_to_srgb8(Tables, Texel.z) / 255.0f, Texel.w);
+					Texels[BlockX * 16 + Y * 4 + X] = Texel;
+				}
+
+				encode_blocks(Storage.format(), &Texels[0], static_cast<size_t>(BlockCount.x), Preset, Blocks + Row * BlockCount.x * BlockSize);
+			}
+		});
+	}
+
+	/// Convert a level of Texture to the same level of Copy, one row of texels at a time.
+	/// Rows are read with FetchSpan and written with WriteSpan when they aren't null, texel by texel with Fetch and Write otherwise.
+	template <typename texture_type, typename fetch_type, typename write_type>
+	inline void convert_level(
+		texture_type const& Texture, fetch_type Fetch, fetch_span_func FetchSpan,
+		texture_type& Copy, write_type Write, write_span_func WriteSpan,
+		size_t Layer, size_t Face, size_t Level)
+	{
+		typedef typename texture::extent_type extent_type;
+
+		extent_type const Dimensions = Texture.texture::extent(Level);
+		size_t const RowLength = static_cast<size_t>(Dimensions.x);
+		size_t const SrcRowSize = RowLength * block_size(Texture.format());
+		size_t const DstRowSize = RowLength * block_size(Copy.format());
+		glm::uint8 const* const SrcData = static_cast<glm::uint8 const*>(Texture.texture::data(Layer, Face, Level));
+		glm::uint8* const DstData = static_cast<glm::uint8*>(Copy.texture::data(Layer, Face, Level));
+
+		parallel_for(0, static_cast<size_t>(Dimensions.y * Dimensions.z), glm::max<size_t>((size_t(1) << 14) / RowLength, 1), [&](size_t RowBegin, size_t RowEnd)
+		{
+			std::vector<vec4> Texels(RowLength);
+
+			for(size_t Row = RowBegin; Row < RowEnd; ++Row)
+			{
+				extent_type const RowCoord(0, static_cast<int>(Row % Dimensions.y), static_cast<int>(Row / Dimensions.y));
+
+				if(FetchSpan)
+					FetchSpan(SrcData + Row * SrcRowSize, &Texels[0], RowLength);
+				else for(size_t i = 0; i < RowLength; ++i)
+					Texels[i] = Fetch(Texture, typename texture_type::extent_type(extent_type(static_cast<int>(i), RowCoord.y, RowCoord.z)), Layer, Face, Level);
+
+				if(WriteSpan)
+					WriteSpan(&Texels[0], DstData + Row * DstRowSize, RowLength);
+				else for(size_t i = 0; i < RowLength; ++i)
+					Write(Copy, typename texture_type::extent_type(extent_type(static_cast<int>(i), RowCoord.y, RowCoord.z)), Layer, Face, Level, Texels[i]);
+			}
+		});
+	}
+}//namespace detail
+
 	template <typename texture_type>
-	inline texture_type convert(texture_type const& Texture, format Format)
+	inline texture_type convert(texture_type const& Texture, format Format, encode_preset Preset)
 	{
 		typedef float T;
 		typedef typename texture::extent_type extent_type;
@@ -14,10 +173,27 @@ namespace gli
 
 		GLI_ASSERT(!Texture.empty());
 		GLI_ASSERT(has_decoder(Texture.format()) || !is_compressed(Texture.format()));
-		GLI_ASSERT(!is_compressed(Format));
+		GLI_ASSERT(has_encoder(Format) || !is_compressed(Format));
 
-		fetch_type Fetch = detail::convert<texture_type, T, defaultp>::call(Texture.format()).Fetch;
+		fetch_type const FetchFormat = detail::convert<texture_type, T, defaultp>::call(Texture.format()).Fetch;
 		write_type Write = detail::convert<texture_type, T, defaultp>::call(Format).Write;
+		detail::fetch_span_func const FetchSpan = is_compressed(Texture.format()) ? nullptr : detail::get_span_func(Texture.format()).Fetch;
+		detail::write_span_func const WriteSpan = detail::get_span_func(Format).Write;
+
+		// Compressed sRGB formats fetch their encoded values, they are decoded so that every conversion starts from linear values
+		bool const Linearize = is_compressed(Texture.format()) && is_srgb(Texture.format());
+		detail::srgb_tables const& Tables = detail::get_srgb_tables();
+		auto const Fetch = [FetchFormat, Linearize, &Tables](texture_type const& Source, typename texture_type::extent_type const& TexelCoord, size_type Layer, size_type Face, size_type Level) -> vec<4, T, defaultp>
+		{
+			vec<4, T, defaultp> const Texel = FetchFormat(Source, TexelCoord, Layer, Face, Level);
+			if(!Linearize)
+				return Texel;
+			glm::u8vec3 const Codes(glm::clamp(vec<3, T, defaultp>(Texel), T(0), T(1)) * T(255) + T(0.5));
+			return vec<4, T, defaultp>(
+				detail::srgb8_to_linear(Tables, Codes.x),
+				detail::srgb8_to_linear(Tables, Codes.y),
+				detail::srgb8_to_linear(Tables, Codes.z), Texel.w);
+		};
 
 		texture Storage(Texture.target(), Format, Texture.texture::extent(), Texture.layers(), Texture.faces(), Texture.levels(), Texture.swizzles());
 		texture_type Copy(Storage);
@@ -26,6 +202,18 @@ namespace gli
 		for(size_type Face = 0; Face < Texture.faces(); ++Face)
 		for(size_type Level = 0; Level < Texture.levels(); ++Level)
 		{
+			if(is_compressed(Format))
+			{
+				detail::encode_level(Texture, Fetch, Storage, Layer, Face, Level, Preset);
+				continue;
+			}
+
+			if(FetchSpan || WriteSpan)
+			{
+				detail::convert_level(Texture, Fetch, FetchSpan, Copy, Write, WriteSpan, Layer, Face, Level);
+				continue;
+			}
+
 			extent_type const& Dimensions = Texture.texture::extent(Level);
 
 			for(component_type k = 0; k < Dimensions.z; ++k)
@@ -42,5 +230,35 @@ namespace gli
 		return texture_type(Copy);
 	}
 
-}//namespace gli
+	template <typename texture_type>
+	inline texture_type reorder_components(texture_type const& Texture, format Format)
+	{
+		typedef typename texture_type::size_type size_type;
+
+		GLI_ASSERT(!Texture.empty());
+		GLI_ASSERT(detail::is_reorderable(Texture.format(), Format));
 
+		detail::swizzle_shuffle const Shuffle = detail::make_swizzle_shuffle(Texture.format(), Texture.swizzles(), Format);
+
+		texture Storage(Texture.target(), Format, Texture.texture::extent(), Texture.layers(), Texture.faces(), Texture.levels());
+
+		for(size_type Layer = 0; Layer < Texture.layers(); ++Layer)
+		for(size_type Face = 0; Face < Texture.faces(); ++Face)
+		for(size_type Level = 0; Level < Texture.levels(); ++Level)
+		{
+			glm::uint8 const* const DataSrc = static_cast<glm::uint8 const*>(Texture.data(Layer, Face, Level));
+			glm::uint8* const DataDst = static_cast<glm::uint8*>(Storage.data(Layer, Face, Level));
+			size_t const TexelCount = Storage.size(Level) / Shuffle.DstTexelSize;
+
+			detail::parallel_for(0, TexelCount, (size_t(1) << 16) / Shuffle.DstTexelSize, [&](size_t TexelBegin, size_t TexelEnd)
+			{
+				detail::swizzle_texels(
+					DataDst + TexelBegin * Shuffle.DstTexelSize,
+					DataSrc + TexelBegin * Shuffle.SrcTexelSize,
+					TexelEnd - TexelBegin, Shuffle);
+			});
+		}
+
+		return texture_type(Storage);
+	}
+}//namespace gli
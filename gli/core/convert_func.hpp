@@ -10,6 +10,12 @@
 #include "../texture_cube_array.hpp"
 #include "./s3tc.hpp"
 #include "./bc.hpp"
+#include "./etc.hpp"
+#include "./astc.hpp"
+#include "./block_cache.hpp"
+#include "./half.hpp"
+#include "./packed.hpp"
+#include "./srgb.hpp"
 #include <glm/gtc/packing.hpp>
 #include <glm/gtc/color_space.hpp>
 #include <limits>
@@ -50,7 +56,18 @@ namespace detail
 		CONVERT_MODE_BC4UNORM,
 		CONVERT_MODE_BC4SNORM,
 		CONVERT_MODE_BC5UNORM,
-		CONVERT_MODE_BC5SNORM
+		CONVERT_MODE_BC5SNORM,
+		CONVERT_MODE_BC6HUFLOAT,
+		CONVERT_MODE_BC6HSFLOAT,
+		CONVERT_MODE_BC7UNORM,
+		CONVERT_MODE_ETC2RGBUNORM,
+		CONVERT_MODE_ETC2RGBA1UNORM,
+		CONVERT_MODE_ETC2RGBAUNORM,
+		CONVERT_MODE_EACR11UNORM,
+		CONVERT_MODE_EACR11SNORM,
+		CONVERT_MODE_EACRG11UNORM,
+		CONVERT_MODE_EACRG11SNORM,
+		CONVERT_MODE_ASTCUNORM
 	};
 
 	template <typename textureType, typename genType>
@@ -220,16 +237,35 @@ namespace detail
 	{
 		typedef accessFunc<textureType, vec<L, T, P> > access;
 
+		// The fourth component is a linear alpha
+		enum
+		{
+			COLOR_COUNT = L == 4 ? 3 : L
+		};
+
 		static vec<4, retType, P> fetch(textureType const & Texture, typename textureType::extent_type const & TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
 		{
 			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_SRGB requires a float sampler");
-			return make_vec4<retType, P>(convertSRGBToLinear(compNormalize<retType>(access::load(Texture, TexelCoord, Layer, Face, Level))));
+			vec<L, T, P> const Encoded(access::load(Texture, TexelCoord, Layer, Face, Level));
+			srgb_tables const& Tables = get_srgb_tables();
+
+			vec<L, retType, P> Texel(compNormalize<retType>(Encoded));
+			for(length_t Component = 0; Component < COLOR_COUNT; ++Component)
+				Texel[Component] = static_cast<retType>(srgb8_to_linear(Tables, Encoded[Component]));
+			return make_vec4<retType, P>(Texel);
 		}
 
 		static void write(textureType & Texture, typename textureType::extent_type const & TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
 		{
 			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_SRGB requires a float sampler");
-			access::store(Texture, TexelCoord, Layer, Face, Level, gli::compScale<T>(convertLinearToSRGB(vec<L, retType, P>(Texel))));
+			srgb_tables const& Tables = get_srgb_tables();
+
+			vec<L, T, P> Encoded;
+			for(length_t Component = 0; Component < COLOR_COUNT; ++Component)
+				Encoded[Component] = static_cast<T>(linear_to_srgb8(Tables, static_cast<float>(Texel[Component])));
+			if(L == 4)
+				Encoded[L - 1] = gli::compScale<T>(vec<1, retType, P>(Texel.w)).x;
+			access::store(Texture, TexelCoord, Layer, Face, Level, Encoded);
 		}
 	};
 
@@ -241,13 +277,13 @@ namespace detail
 		static vec<4, retType, P> fetch(textureType const & Texture, typename textureType::extent_type const & TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
 		{
 			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_RGB9E5 requires a float sampler");
-			return vec<4, retType, P>(unpackF3x9_E1x5(access::load(Texture, TexelCoord, Layer, Face, Level)), static_cast<retType>(1));
+			return vec<4, retType, P>(unpack_rgb9e5(access::load(Texture, TexelCoord, Layer, Face, Level)));
 		}
 
 		static void write(textureType & Texture, typename textureType::extent_type const & TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
 		{
 			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_RGB9E5 requires a float sampler");
-			access::store(Texture, TexelCoord, Layer, Face, Level, packF3x9_E1x5(vec<3, float, P>(Texel)));
+			access::store(Texture, TexelCoord, Layer, Face, Level, pack_rgb9e5(vec4(Texel)));
 		}
 	};
 
@@ -259,13 +295,13 @@ namespace detail
 		static vec<4, retType, P> fetch(textureType const & Texture, typename textureType::extent_type const & TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
 		{
 			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_RG11B10F requires a float sampler");
-			return vec<4, retType, P>(unpackF2x11_1x10(access::load(Texture, TexelCoord, Layer, Face, Level)), static_cast<retType>(1));
+			return vec<4, retType, P>(unpack_rg11b10f(access::load(Texture, TexelCoord, Layer, Face, Level)));
 		}
 
 		static void write(textureType & Texture, typename textureType::extent_type const & TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
 		{
 			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_RG11B10F requires a float sampler");
-			access::store(Texture, TexelCoord, Layer, Face, Level, packF2x11_1x10(vec<3, float, P>(Texel)));
+			access::store(Texture, TexelCoord, Layer, Face, Level, pack_rg11b10f(vec4(Texel)));
 		}
 	};
 
@@ -277,13 +313,19 @@ namespace detail
 		static vec<4, retType, P> fetch(textureType const & Texture, typename textureType::extent_type const & TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
 		{
 			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_HALF requires a float sampler");
-			return make_vec4<retType, P>(vec<L, retType, P>(unpackHalf(access::load(Texture, TexelCoord, Layer, Face, Level))));
+			vec<L, uint16, P> const Packed(access::load(Texture, TexelCoord, Layer, Face, Level));
+			vec<L, float, P> Unpacked;
+			unpack_half_span(&Packed[0], &Unpacked[0], L);
+			return make_vec4<retType, P>(vec<L, retType, P>(Unpacked));
 		}
 
 		static void write(textureType & Texture, typename textureType::extent_type const & TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
 		{
 			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_HALF requires a float sampler");
-			access::store(Texture, TexelCoord, Layer, Face, Level, packHalf(vec<L, float, P>(Texel)));
+			vec<L, float, P> const Unpacked(Texel);
+			vec<L, uint16, P> Packed;
+			pack_half_span(&Unpacked[0], &Packed[0], L);
+			access::store(Texture, TexelCoord, Layer, Face, Level, Packed);
 		}
 	};
 
@@ -499,6 +541,27 @@ namespace detail
 		}
 	};
 
+	// Fetch a texel of a block compressed image, the decoded blocks are cached by the calling thread so that neighboring fetches decode each block once
+	template <typename textureType, typename blockType, typename texelBlockType, size_t CacheSize>
+	inline glm::vec4 fetch_compressed_texel(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, texelBlockType(*Decompress)(blockType const&), basic_block_cache<texelBlockType, CacheSize>& Cache)
+	{
+		blockType const* Data = Texture.template data<blockType>(Layer, Face, Level);
+		gli::extent3d const BlockExtent = block_extent(Texture.format());
+		gli::extent3d const BlockCount = glm::ceilMultiple(Texture.texture::extent(Level), BlockExtent) / BlockExtent;
+		gli::extent3d const BlockCoord(TexelCoord / BlockExtent);
+		gli::extent3d const TexelCoordInBlock(TexelCoord - BlockCoord * BlockExtent);
+
+		blockType const& Block = Data[(BlockCoord.z * BlockCount.y + BlockCoord.y) * BlockCount.x + BlockCoord.x];
+
+		return Cache.get(Block, Texture.format(), Decompress).Texel[TexelCoordInBlock.y][TexelCoordInBlock.x];
+	}
+
+	template <typename textureType, typename blockType>
+	inline glm::vec4 fetch_compressed_texel(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, texel_block4x4(*Decompress)(blockType const&))
+	{
+		return fetch_compressed_texel<textureType, blockType>(Texture, TexelCoord, Layer, Face, Level, Decompress, thread_block_cache());
+	}
+
 	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
 	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_DXT1UNORM, true>
 	{
@@ -524,16 +587,7 @@ namespace detail
 				return glm::vec<4, retType, P>(0, 0, 0, 1);
 			}
 			
-			const dxt1_block *Data = Texture.template data<dxt1_block>(Layer, Face, Level);
-			const gli::extent3d &BlockExtent = block_extent(Texture.format());
-			int WidthInBlocks = glm::max(1, Texture.extent(Level).x / BlockExtent.x);
-			int BlocksInSlice = glm::max(1, Texture.extent(Level).y / BlockExtent.y) * WidthInBlocks;
-			gli::extent3d BlockCoord(TexelCoord / BlockExtent);
-			glm::ivec2 TexelCoordInBlock(TexelCoord.x - (BlockCoord.x * BlockExtent.x), TexelCoord.y - (BlockCoord.y * BlockExtent.y));
-			
-			const dxt1_block &Block = Data[BlockCoord.z * BlocksInSlice + (BlockCoord.y * WidthInBlocks + BlockCoord.x)];
-
-			return decompress_dxt1(Block, TexelCoordInBlock);
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, dxt1_block>(Texture, TexelCoord, Layer, Face, Level, decompress_dxt1_block));
 		}
 
 		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
@@ -568,16 +622,7 @@ namespace detail
 				return glm::vec<4, retType, P>(0, 0, 0, 1);
 			}
 
-			const dxt3_block *Data = Texture.template data<dxt3_block>(Layer, Face, Level);
-			const gli::extent3d &BlockExtent = block_extent(Texture.format());
-			int WidthInBlocks = glm::max(1, Texture.extent(Level).x / BlockExtent.x);
-			int BlocksInSlice = glm::max(1, Texture.extent(Level).y / BlockExtent.y) * WidthInBlocks;
-			gli::extent3d BlockCoord(TexelCoord / BlockExtent);
-			glm::ivec2 TexelCoordInBlock(TexelCoord.x - (BlockCoord.x * BlockExtent.x), TexelCoord.y - (BlockCoord.y * BlockExtent.y));
-
-			const dxt3_block &Block = Data[BlockCoord.z * BlocksInSlice + (BlockCoord.y * WidthInBlocks + BlockCoord.x)];
-
-			return decompress_dxt3(Block, TexelCoordInBlock);
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, dxt3_block>(Texture, TexelCoord, Layer, Face, Level, decompress_dxt3_block));
 		}
 
 		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
@@ -612,16 +657,7 @@ namespace detail
 				return glm::vec<4, retType, P>(0, 0, 0, 1);
 			}
 
-			const dxt5_block *Data = Texture.template data<dxt5_block>(Layer, Face, Level);
-			const gli::extent3d &BlockExtent = block_extent(Texture.format());
-			int WidthInBlocks = glm::max(1, Texture.extent(Level).x / BlockExtent.x);
-			int BlocksInSlice = glm::max(1, Texture.extent(Level).y / BlockExtent.y) * WidthInBlocks;
-			gli::extent3d BlockCoord(TexelCoord / BlockExtent);
-			glm::ivec2 TexelCoordInBlock(TexelCoord.x - (BlockCoord.x * BlockExtent.x), TexelCoord.y - (BlockCoord.y * BlockExtent.y));
-
-			const dxt5_block &Block = Data[BlockCoord.z * BlocksInSlice + (BlockCoord.y * WidthInBlocks + BlockCoord.x)];
-
-			return decompress_dxt5(Block, TexelCoordInBlock);
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, dxt5_block>(Texture, TexelCoord, Layer, Face, Level, decompress_dxt5_block));
 		}
 
 		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
@@ -656,16 +692,7 @@ namespace detail
 				return glm::vec<4, retType, P>(0, 0, 0, 1);
 			}
 
-			const bc4_block *Data = Texture.template data<bc4_block>(Layer, Face, Level);
-			const gli::extent3d &BlockExtent = block_extent(Texture.format());
-			int WidthInBlocks = glm::max(1, Texture.extent(Level).x / BlockExtent.x);
-			int BlocksInSlice = glm::max(1, Texture.extent(Level).y / BlockExtent.y) * WidthInBlocks;
-			gli::extent3d BlockCoord(TexelCoord / BlockExtent);
-			glm::ivec2 TexelCoordInBlock(TexelCoord.x - (BlockCoord.x * BlockExtent.x), TexelCoord.y - (BlockCoord.y * BlockExtent.y));
-
-			const bc4_block &Block = Data[BlockCoord.z * BlocksInSlice + (BlockCoord.y * WidthInBlocks + BlockCoord.x)];
-			
-			return decompress_bc4unorm(Block, TexelCoordInBlock);
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, bc4_block>(Texture, TexelCoord, Layer, Face, Level, decompress_bc4unorm_block));
 		}
 
 		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
@@ -700,16 +727,7 @@ namespace detail
 				return glm::vec<4, retType, P>(0, 0, 0, 1);
 			}
 
-			const bc4_block *Data = Texture.template data<bc4_block>(Layer, Face, Level);
-			const gli::extent3d &BlockExtent = block_extent(Texture.format());
-			int WidthInBlocks = glm::max(1, Texture.extent(Level).x / BlockExtent.x);
-			int BlocksInSlice = glm::max(1, Texture.extent(Level).y / BlockExtent.y) * WidthInBlocks;
-			gli::extent3d BlockCoord(TexelCoord / BlockExtent);
-			glm::ivec2 TexelCoordInBlock(TexelCoord.x - (BlockCoord.x * BlockExtent.x), TexelCoord.y - (BlockCoord.y * BlockExtent.y));
-
-			const bc4_block &Block = Data[BlockCoord.z * BlocksInSlice + (BlockCoord.y * WidthInBlocks + BlockCoord.x)];
-
-			return decompress_bc4snorm(Block, TexelCoordInBlock);
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, bc4_block>(Texture, TexelCoord, Layer, Face, Level, decompress_bc4snorm_block));
 		}
 
 		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
@@ -744,16 +762,7 @@ namespace detail
 				return glm::vec<4, retType, P>(0, 0, 0, 1);
 			}
 
-			const bc5_block *Data = Texture.template data<bc5_block>(Layer, Face, Level);
-			const gli::extent3d &BlockExtent = block_extent(Texture.format());
-			int WidthInBlocks = glm::max(1, Texture.extent(Level).x / BlockExtent.x);
-			int BlocksInSlice = glm::max(1, Texture.extent(Level).y / BlockExtent.y) * WidthInBlocks;
-			gli::extent3d BlockCoord(TexelCoord / BlockExtent);
-			glm::ivec2 TexelCoordInBlock(TexelCoord.x - (BlockCoord.x * BlockExtent.x), TexelCoord.y - (BlockCoord.y * BlockExtent.y));
-
-			const bc5_block &Block = Data[BlockCoord.z * BlocksInSlice + (BlockCoord.y * WidthInBlocks + BlockCoord.x)];
-
-			return decompress_bc5unorm(Block, TexelCoordInBlock);
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, bc5_block>(Texture, TexelCoord, Layer, Face, Level, decompress_bc5unorm_block));
 		}
 
 		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
@@ -788,16 +797,7 @@ namespace detail
 				return glm::vec<4, retType, P>(0, 0, 0, 1);
 			}
 
-			const bc5_block *Data = Texture.template data<bc5_block>(Layer, Face, Level);
-			const gli::extent3d &BlockExtent = block_extent(Texture.format());
-			int WidthInBlocks = glm::max(1, Texture.extent(Level).x / BlockExtent.x);
-			int BlocksInSlice = glm::max(1, Texture.extent(Level).y / BlockExtent.y) * WidthInBlocks;
-			gli::extent3d BlockCoord(TexelCoord / BlockExtent);
-			glm::ivec2 TexelCoordInBlock(TexelCoord.x - (BlockCoord.x * BlockExtent.x), TexelCoord.y - (BlockCoord.y * BlockExtent.y));
-
-			const bc5_block &Block = Data[BlockCoord.z * BlocksInSlice + (BlockCoord.y * WidthInBlocks + BlockCoord.x)];
-
-			return decompress_bc5snorm(Block, TexelCoordInBlock);
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, bc5_block>(Texture, TexelCoord, Layer, Face, Level, decompress_bc5snorm_block));
 		}
 
 		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
@@ -808,6 +808,391 @@ namespace detail
 		}
 	};
 
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_BC6HUFLOAT, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_BC6HUFLOAT requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, bc6h_block>(Texture, TexelCoord, Layer, Face, Level, decompress_bc6hufloat_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_BC6HUFLOAT requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of a BC6H compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_BC6HSFLOAT, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_BC6HSFLOAT requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, bc6h_block>(Texture, TexelCoord, Layer, Face, Level, decompress_bc6hsfloat_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_BC6HSFLOAT requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of a BC6H compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_BC7UNORM, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_BC7UNORM requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, bc7_block>(Texture, TexelCoord, Layer, Face, Level, decompress_bc7_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_BC7UNORM requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of a BC7 compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_ETC2RGBUNORM, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_ETC2RGBUNORM requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, etc2_rgb_block>(Texture, TexelCoord, Layer, Face, Level, decompress_etc2_rgb_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_ETC2RGBUNORM requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of an ETC2 compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_ETC2RGBA1UNORM, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_ETC2RGBA1UNORM requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, etc2_rgb_block>(Texture, TexelCoord, Layer, Face, Level, decompress_etc2_rgba1_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_ETC2RGBA1UNORM requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of an ETC2 compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_ETC2RGBAUNORM, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_ETC2RGBAUNORM requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, etc2_rgba_block>(Texture, TexelCoord, Layer, Face, Level, decompress_etc2_rgba_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_ETC2RGBAUNORM requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of an ETC2 compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_EACR11UNORM, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_EACR11UNORM requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, eac_block>(Texture, TexelCoord, Layer, Face, Level, decompress_eac_r11unorm_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_EACR11UNORM requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of an EAC compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_EACR11SNORM, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_EACR11SNORM requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, eac_block>(Texture, TexelCoord, Layer, Face, Level, decompress_eac_r11snorm_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_EACR11SNORM requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of an EAC compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_EACRG11UNORM, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_EACRG11UNORM requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, eac_rg_block>(Texture, TexelCoord, Layer, Face, Level, decompress_eac_rg11unorm_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_EACRG11UNORM requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of an EAC compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_EACRG11SNORM, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_EACRG11SNORM requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, eac_rg_block>(Texture, TexelCoord, Layer, Face, Level, decompress_eac_rg11snorm_block));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_EACRG11SNORM requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of an EAC compressed image is not supported");
+		}
+	};
+
+	template <typename textureType, typename retType, length_t L, typename T, qualifier P>
+	struct convertFunc<textureType, retType, L, T, P, CONVERT_MODE_ASTCUNORM, true> {
+		typedef accessFunc<gli::texture2d, uint32> access;
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent1d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			return glm::vec<4, retType, P>(0, 0, 0, 1);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent2d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			gli::extent3d TexelCoord3d(TexelCoord, 0);
+			return fetch(Texture, TexelCoord3d, Layer, Face, Level);
+		}
+
+		static vec<4, retType, P> fetch(textureType const& Texture, gli::extent3d const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_ASTCUNORM requires an float sampler");
+
+			if(Texture.target() == gli::TARGET_1D || Texture.target() == gli::TARGET_1D_ARRAY)
+			{
+				return glm::vec<4, retType, P>(0, 0, 0, 1);
+			}
+
+			return vec<4, retType, P>(fetch_compressed_texel<textureType, astc_block>(Texture, TexelCoord, Layer, Face, Level, astc_decompress_function(Texture.format()), thread_large_block_cache()));
+		}
+
+		static void write(textureType& Texture, typename textureType::extent_type const& TexelCoord, typename textureType::size_type Layer, typename textureType::size_type Face, typename textureType::size_type Level, vec<4, retType, P> const & Texel)
+		{
+			static_assert(std::numeric_limits<retType>::is_iec559, "CONVERT_MODE_ASTCUNORM requires an float sampler");
+
+			GLI_ASSERT("Writing to single texel of an ASTC compressed image is not supported");
+		}
+	};
+
 	template <typename textureType, typename samplerValType, qualifier P>
 	struct convert
 	{
@@ -1004,50 +1389,50 @@ namespace detail
 				{conv<1, u8, CONVERT_MODE_BC4SNORM>::fetch, conv<1, i8, CONVERT_MODE_BC4SNORM>::write},				// FORMAT_R_ATI1N_SNORM_BLOCK8
 				{conv<2, u8, CONVERT_MODE_BC5UNORM>::fetch, conv<2, u8, CONVERT_MODE_BC5UNORM>::write},				// FORMAT_RG_ATI2N_UNORM_BLOCK16
 				{conv<2, u8, CONVERT_MODE_BC5SNORM>::fetch, conv<2, i8, CONVERT_MODE_BC5SNORM>::write},				// FORMAT_RG_ATI2N_SNORM_BLOCK16
-				{conv<3, f32, CONVERT_MODE_DEFAULT>::fetch, conv<3, f32, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGB_BP_UFLOAT_BLOCK16
-				{conv<3, f32, CONVERT_MODE_DEFAULT>::fetch, conv<3, f32, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGB_BP_SFLOAT_BLOCK16
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_BP_UNORM_BLOCK16
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_BP_SRGB_BLOCK16
-
-				{conv<3, u8, CONVERT_MODE_DEFAULT>::fetch, conv<3, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGB_ETC2_UNORM_BLOCK8
-				{conv<3, u8, CONVERT_MODE_DEFAULT>::fetch, conv<3, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGB_ETC2_SRGB_BLOCK8
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_ETC2_A1_UNORM_BLOCK8
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_ETC2_A1_SRGB_BLOCK8
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_ETC2_UNORM_BLOCK16
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_ETC2_SRGB_BLOCK16
-				{conv<1, u8, CONVERT_MODE_DEFAULT>::fetch, conv<1, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_R_EAC_UNORM_BLOCK8
-				{conv<1, u8, CONVERT_MODE_DEFAULT>::fetch, conv<1, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_R_EAC_SNORM_BLOCK8
-				{conv<2, u8, CONVERT_MODE_DEFAULT>::fetch, conv<2, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RG_EAC_UNORM_BLOCK16
-				{conv<2, u8, CONVERT_MODE_DEFAULT>::fetch, conv<2, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RG_EAC_SNORM_BLOCK16
-
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_4x4_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_4x4_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_5x4_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_5x4_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_5x5_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_5x5_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_6x5_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_6x5_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_6x6_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_6x6_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_8x5_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_8x5_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_8x6_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_8x6_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_8x8_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_8x8_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_10x5_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_10x5_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_10x6_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_10x6_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_10x8_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_10x8_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_10x10_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_10x10_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_12x10_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_12x10_SRGB
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_12x12_UNORM
-				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_ASTC_12x12_SRGB
+				{conv<3, f32, CONVERT_MODE_BC6HUFLOAT>::fetch, conv<3, f32, CONVERT_MODE_BC6HUFLOAT>::write},		// FORMAT_RGB_BP_UFLOAT_BLOCK16
+				{conv<3, f32, CONVERT_MODE_BC6HSFLOAT>::fetch, conv<3, f32, CONVERT_MODE_BC6HSFLOAT>::write},		// FORMAT_RGB_BP_SFLOAT_BLOCK16
+				{conv<4, u8, CONVERT_MODE_BC7UNORM>::fetch, conv<4, u8, CONVERT_MODE_BC7UNORM>::write},				// FORMAT_RGBA_BP_UNORM_BLOCK16
+				{conv<4, u8, CONVERT_MODE_BC7UNORM>::fetch, conv<4, u8, CONVERT_MODE_BC7UNORM>::write},				// FORMAT_RGBA_BP_SRGB_BLOCK16
+
+				{conv<3, u8, CONVERT_MODE_ETC2RGBUNORM>::fetch, conv<3, u8, CONVERT_MODE_ETC2RGBUNORM>::write},		// FORMAT_RGB_ETC2_UNORM_BLOCK8
+				{conv<3, u8, CONVERT_MODE_ETC2RGBUNORM>::fetch, conv<3, u8, CONVERT_MODE_ETC2RGBUNORM>::write},		// FORMAT_RGB_ETC2_SRGB_BLOCK8
+				{conv<4, u8, CONVERT_MODE_ETC2RGBA1UNORM>::fetch, conv<4, u8, CONVERT_MODE_ETC2RGBA1UNORM>::write},		// FORMAT_RGBA_ETC2_A1_UNORM_BLOCK8
+				{conv<4, u8, CONVERT_MODE_ETC2RGBA1UNORM>::fetch, conv<4, u8, CONVERT_MODE_ETC2RGBA1UNORM>::write},		// FORMAT_RGBA_ETC2_A1_SRGB_BLOCK8
+				{conv<4, u8, CONVERT_MODE_ETC2RGBAUNORM>::fetch, conv<4, u8, CONVERT_MODE_ETC2RGBAUNORM>::write},		// FORMAT_RGBA_ETC2_UNORM_BLOCK16
+				{conv<4, u8, CONVERT_MODE_ETC2RGBAUNORM>::fetch, conv<4, u8, CONVERT_MODE_ETC2RGBAUNORM>::write},		// FORMAT_RGBA_ETC2_SRGB_BLOCK16
+				{conv<1, u8, CONVERT_MODE_EACR11UNORM>::fetch, conv<1, u8, CONVERT_MODE_EACR11UNORM>::write},		// FORMAT_R_EAC_UNORM_BLOCK8
+				{conv<1, u8, CONVERT_MODE_EACR11SNORM>::fetch, conv<1, u8, CONVERT_MODE_EACR11SNORM>::write},		// FORMAT_R_EAC_SNORM_BLOCK8
+				{conv<2, u8, CONVERT_MODE_EACRG11UNORM>::fetch, conv<2, u8, CONVERT_MODE_EACRG11UNORM>::write},		// FORMAT_RG_EAC_UNORM_BLOCK16
+				{conv<2, u8, CONVERT_MODE_EACRG11SNORM>::fetch, conv<2, u8, CONVERT_MODE_EACRG11SNORM>::write},		// FORMAT_RG_EAC_SNORM_BLOCK16
+
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_4x4_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_4x4_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_5x4_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_5x4_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_5x5_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_5x5_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_6x5_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_6x5_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_6x6_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_6x6_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_8x5_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_8x5_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_8x6_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_8x6_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_8x8_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_8x8_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_10x5_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_10x5_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_10x6_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_10x6_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_10x8_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_10x8_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_10x10_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_10x10_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_12x10_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_12x10_SRGB
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_12x12_UNORM
+				{conv<4, u8, CONVERT_MODE_ASTCUNORM>::fetch, conv<4, u8, CONVERT_MODE_ASTCUNORM>::write},		// FORMAT_ASTC_12x12_SRGB
 
 				{conv<3, u8, CONVERT_MODE_DEFAULT>::fetch, conv<3, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGB_PVRTC1_8X8_UNORM_BLOCK32
 				{conv<3, u8, CONVERT_MODE_DEFAULT>::fetch, conv<3, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGB_PVRTC1_8X8_SRGB_BLOCK32
@@ -1062,7 +1447,7 @@ namespace detail
 				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_PVRTC2_8X4_UNORM_BLOCK8
 				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_PVRTC2_8X4_SRGB_BLOCK8
 
-				{conv<3, u8, CONVERT_MODE_DEFAULT>::fetch, conv<3, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGB_ETC_UNORM_BLOCK8
+				{conv<3, u8, CONVERT_MODE_ETC2RGBUNORM>::fetch, conv<3, u8, CONVERT_MODE_ETC2RGBUNORM>::write},		// FORMAT_RGB_ETC_UNORM_BLOCK8
 				{conv<3, u8, CONVERT_MODE_DEFAULT>::fetch, conv<3, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGB_ATC_UNORM_BLOCK8
 				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_ATCA_UNORM_BLOCK16
 				{conv<4, u8, CONVERT_MODE_DEFAULT>::fetch, conv<4, u8, CONVERT_MODE_DEFAULT>::write},				// FORMAT_RGBA_ATCI_UNORM_BLOCK16
@@ -0,0 +1,227 @@
+/// @brief Include to convert spans of contiguous texels of some formats to and from vec4 at once
+/// @file gli/core/convert_span.hpp
+
+#pragma once
+
+#include "../type.hpp"
+#include "../format.hpp"
+#include "./half.hpp"
+#include "./packed.hpp"
+#include "./srgb.hpp"
+
+namespace gli{
+namespace detail
+{
+	// Convert Count contiguous texels starting at Src to Dst
+	typedef void (*fetch_span_func)(void const* Src, vec4* Dst, size_t Count);
+	typedef void (*write_span_func)(vec4 const* Src, void* Dst, size_t Count);
+
+	// Null functions when the format has no span conversion
+	struct span_func
+	{
+		fetch_span_func Fetch;
+		write_span_func Write;
+	};
+
+	// Texels converted per step by the span conversions going through a buffer on the stack
+	enum
+	{
+		SPAN_CHUNK = 256
+	};
+
+	// Missing components are set to zero for color and to one for alpha
+	template <length_t L>
+	inline void expand_span(float const* Src, vec4* Dst, size_t Count)
+	{
+		for(size_t Texel = 0; Texel < Count; ++Texel)
+		{
+			vec4 Value(0.0f, 0.0f, 0.0f, 1.0f);
+			for(length_t Component = 0; Component < L; ++Component)
+				Value[Component] = Src[Texel * L + Component];
+			Dst[Texel] = Value;
+		}
+	}
+
+	template <length_t L>
+	inline void shrink_span(vec4 const* Src, float* Dst, size_t Count)
+	{
+		for(size_t Texel = 0; Texel < Count; ++Texel)
+		for(length_t Component = 0; Component < L; ++Component)
+			Dst[Texel * L + Component] = Src[Texel][Component];
+	}
+
+	template <length_t L>
+	struct half_span
+	{
+		static void fetch(void const* Src, vec4* Dst, size_t Count)
+		{
+			glm::uint16 const* Half = static_cast<glm::uint16 const*>(Src);
+
+			if(L == 4)
+			{
+				unpack_half_span(Half, &Dst[0][0], Count * 4);
+				return;
+			}
+
+			float Buffer[SPAN_CHUNK * L];
+			for(size_t Offset = 0; Offset < Count; Offset += SPAN_CHUNK)
+			{
+				size_t const ChunkCount = glm::min<size_t>(SPAN_CHUNK, Count - Offset);
+				unpack_half_span(Half + Offset * L, Buffer, ChunkCount * L);
+				expand_span<L>(Buffer, Dst + Offset, ChunkCount);
+			}
+		}
+
+		static void write(vec4 const* Src, void* Dst, size_t Count)
+		{
+			glm::uint16* Half = static_cast<glm::uint16*>(Dst);
+
+			if(L == 4)
+			{
+				pack_half_span(&Src[0][0], Half, Count * 4);
+				return;
+			}
+
+			float Buffer[SPAN_CHUNK * L];
+			for(size_t Offset = 0; Offset < Count; Offset += SPAN_CHUNK)
+			{
+				size_t const ChunkCount = glm::min<size_t>(SPAN_CHUNK, Count - Offset);
+				shrink_span<L>(Src + Offset, Buffer, ChunkCount);
+				pack_half_span(Buffer, Half + Offset * L, ChunkCount * L);
+			}
+		}
+	};
+
+	template <length_t L>
+	struct float_span
+	{
+		static void fetch(void const* Src, vec4* Dst, size_t Count)
+		{
+			expand_span<L>(static_cast<float const*>(Src), Dst, Count);
+		}
+
+		static void write(vec4 const* Src, void* Dst, size_t Count)
+		{
+			shrink_span<L>(Src, static_cast<float*>(Dst), Count);
+		}
+	};
+
+	// Texels of L 8 bit components, the fourth one is a linear alpha
+	template <length_t L>
+	struct srgb8_span
+	{
+		enum
+		{
+			COLOR_COUNT = L == 4 ? 3 : L
+		};
+
+		static void fetch(void const* Src, vec4* Dst, size_t Count)
+		{
+			glm::uint8 const* Encoded = static_cast<glm::uint8 const*>(Src);
+			srgb_tables const& Tables = get_srgb_tables();
+
+			for(size_t Texel = 0; Texel < Count; ++Texel, Encoded += L)
+			{
+				vec4 Value(0.0f, 0.0f, 0.0f, 1.0f);
+				for(length_t Component = 0; Component < COLOR_COUNT; ++Component)
+					Value[Component] = srgb8_to_linear(Tables, Encoded[Component]);
+				if(L == 4)
+					Value.w = static_cast<float>(Encoded[3]) / 255.0f;
+				Dst[Texel] = Value;
+			}
+		}
+
+		static void write(vec4 const* Src, void* Dst, size_t Count)
+		{
+			glm::uint8* Encoded = static_cast<glm::uint8*>(Dst);
+			srgb_tables const& Tables = get_srgb_tables();
+
+			for(size_t Texel = 0; Texel < Count; ++Texel, Encoded += L)
+			{
+				for(length_t Component = 0; Component < COLOR_COUNT; ++Component)
+					Encoded[Component] = linear_to_srgb8(Tables, Src[Texel][Component]);
+				if(L == 4)
+					Encoded[L - 1] = compScale<glm::uint8>(glm::vec1(Src[Texel].w)).x;
+			}
+		}
+	};
+
+	template <typename span_type>
+	inline span_func make_span_func()
+	{
+		span_func const Func = {span_type::fetch, span_type::write};
+		return Func;
+	}
+
+	/// Span conversions of Format, selected once per conversion
+	inline span_func get_span_func(format Format)
+	{
+		switch(Format)
+		{
+		case FORMAT_R16_SFLOAT_PACK16:
+			return make_span_func<half_span<1> >();
+		case FORMAT_RG16_SFLOAT_PACK16:
+			return make_span_func<half_span<2> >();
+		case FORMAT_RGB16_SFLOAT_PACK16:
+			return make_span_func<half_span<3> >();
+		case FORMAT_RGBA16_SFLOAT_PACK16:
+			return make_span_func<half_span<4> >();
+		case FORMAT_R8_SRGB_PACK8:
+			return make_span_func<srgb8_span<1> >();
+		case FORMAT_RG8_SRGB_PACK8:
+			return make_span_func<srgb8_span<2> >();
+		case FORMAT_RGB8_SRGB_PACK8:
+		case FORMAT_BGR8_SRGB_PACK8:
+			return make_span_func<srgb8_span<3> >();
+		case FORMAT_RGBA8_SRGB_PACK8:
+		case FORMAT_BGRA8_SRGB_PACK8:
+		case FORMAT_RGBA8_SRGB_PACK32:
+		case FORMAT_BGR8_SRGB_PACK32:
+			return make_span_func<srgb8_span<4> >();
+		case FORMAT_RG4_UNORM_PACK8:
+			return make_span_func<unorm_packed_span<glm::uint8, 4, 4, 0, 0> >();
+		case FORMAT_RG3B2_UNORM_PACK8:
+			return make_span_func<unorm_packed_span<glm::uint8, 3, 3, 2, 0> >();
+		case FORMAT_RGBA4_UNORM_PACK16:
+		case FORMAT_BGRA4_UNORM_PACK16:
+			return make_span_func<unorm_packed_span<glm::uint16, 4, 4, 4, 4> >();
+		case FORMAT_R5G6B5_UNORM_PACK16:
+		case FORMAT_B5G6R5_UNORM_PACK16:
+			return make_span_func<unorm_packed_span<glm::uint16, 5, 6, 5, 0> >();
+		case FORMAT_RGB5A1_UNORM_PACK16:
+		case FORMAT_BGR5A1_UNORM_PACK16:
+		case FORMAT_A1RGB5_UNORM_PACK16:
+			return make_span_func<unorm_packed_span<glm::uint16, 5, 5, 5, 1> >();
+		case FORMAT_RGB10A2_UNORM_PACK32:
+		case FORMAT_BGR10A2_UNORM_PACK32:
+			return make_span_func<unorm_packed_span<glm::uint32, 10, 10, 10, 2> >();
+		case FORMAT_RGB10A2_SNORM_PACK32:
+		case FORMAT_BGR10A2_SNORM_PACK32:
+			return make_span_func<rgb10a2_snorm_span>();
+		case FORMAT_RGB10A2_USCALED_PACK32:
+		case FORMAT_BGR10A2_USCALED_PACK32:
+			return make_span_func<rgb10a2_scaled_span<false> >();
+		case FORMAT_RGB10A2_SSCALED_PACK32:
+		case FORMAT_BGR10A2_SSCALED_PACK32:
+			return make_span_func<rgb10a2_scaled_span<true> >();
+		case FORMAT_RG11B10_UFLOAT_PACK32:
+			return make_span_func<rg11b10f_span>();
+		case FORMAT_RGB9E5_UFLOAT_PACK32:
+			return make_span_func<rgb9e5_span>();
+		case FORMAT_R32_SFLOAT_PACK32:
+			return make_span_func<float_span<1> >();
+		case FORMAT_RG32_SFLOAT_PACK32:
+			return make_span_func<float_span<2> >();
+		case FORMAT_RGB32_SFLOAT_PACK32:
+			return make_span_func<float_span<3> >();
+		case FORMAT_RGBA32_SFLOAT_PACK32:
+			return make_span_func<float_span<4> >();
+		default:
+		{
+			span_func const None = {nullptr, nullptr};
+			return None;
+		}
+		}
+	}
+}//namespace detail
+}//namespace gli
@@ -1,4 +1,7 @@
 #include "../type.hpp"
+#include "convert_func.hpp"
+#include "swizzle.hpp"
+#include "parallel.hpp"
 #include <cstring>
 
 namespace gli
@@ -13,6 +16,75 @@ namespace gli
 		TextureDst.copy(TextureSrc, LayerSrc, FaceSrc, LevelSrc, LayerDst, FaceDst, LevelDst);
 	}
 
+	template <typename texture_src_type, typename texture_dst_type>
+	void copy
+	(
+		texture_src_type const& TextureSrc, size_t LayerSrc, size_t FaceSrc, size_t LevelSrc, texture::extent_type const& OffsetSrc,
+		texture_dst_type& TextureDst, size_t LayerDst, size_t FaceDst, size_t LevelDst, texture::extent_type const& OffsetDst,
+		texture::extent_type const& Extent
+	)
+	{
+		typedef float T;
+		typedef texture::extent_type extent_type;
+		typedef typename detail::convert<texture_src_type, T, defaultp>::fetchFunc fetch_type;
+		typedef typename detail::convert<texture_dst_type, T, defaultp>::writeFunc write_type;
+
+		if(TextureSrc.format() == TextureDst.format())
+		{
+			TextureDst.texture::copy(TextureSrc, LayerSrc, FaceSrc, LevelSrc, OffsetSrc, LayerDst, FaceDst, LevelDst, OffsetDst, Extent);
+			return;
+		}
+
+		GLI_ASSERT(has_decoder(TextureSrc.format()) || !is_compressed(TextureSrc.format()));
+		GLI_ASSERT(!is_compressed(TextureDst.format()));
+		GLI_ASSERT(glm::all(glm::lessThanEqual(OffsetSrc + Extent, TextureSrc.texture::extent(LevelSrc))));
+		GLI_ASSERT(glm::all(glm::lessThanEqual(OffsetDst + Extent, TextureDst.texture::extent(LevelDst))));
+
+		size_t const RowCount = static_cast<size_t>(Extent.y) * static_cast<size_t>(Extent.z);
+		if(Extent.x <= 0 || RowCount == 0)
+			return;
+
+		// Formats storing the same components in a different order are converted by shuffling the bytes of each row
+		if(detail::is_reorderable(TextureSrc.format(), TextureDst.format()))
+		{
+			detail::swizzle_shuffle const Shuffle = detail::make_swizzle_shuffle(TextureSrc.format(), detail::get_format_info(TextureSrc.format()).Swizzles, TextureDst.format());
+			extent_type const ExtentSrc = TextureSrc.texture::extent(LevelSrc);
+			extent_type const ExtentDst = TextureDst.texture::extent(LevelDst);
+			glm::uint8 const* const ImageSrc = static_cast<glm::uint8 const*>(TextureSrc.texture::data(LayerSrc, FaceSrc, LevelSrc));
+			glm::uint8* const ImageDst = static_cast<glm::uint8*>(TextureDst.texture::data(LayerDst, FaceDst, LevelDst));
+
+			detail::parallel_for(0, RowCount, glm::max<size_t>((1 << 16) / (Extent.x * Shuffle.DstTexelSize), 1), [&](size_t RangeBegin, size_t RangeEnd)
+			{
+				for(size_t RowIndex = RangeBegin; RowIndex < RangeEnd; ++RowIndex)
+				{
+					extent_type const Row(0, static_cast<int>(RowIndex % Extent.y), static_cast<int>(RowIndex / Extent.y));
+					extent_type const RowSrc(OffsetSrc + Row);
+					extent_type const RowDst(OffsetDst + Row);
+					size_t const TexelSrc = static_cast<size_t>(RowSrc.x + (RowSrc.y + RowSrc.z * ExtentSrc.y) * ExtentSrc.x);
+					size_t const TexelDst = static_cast<size_t>(RowDst.x + (RowDst.y + RowDst.z * ExtentDst.y) * ExtentDst.x);
+					detail::swizzle_texels(ImageDst + TexelDst * Shuffle.DstTexelSize, ImageSrc + TexelSrc * Shuffle.SrcTexelSize, static_cast<size_t>(Extent.x), Shuffle);
+				}
+			});
+			return;
+		}
+
+		fetch_type Fetch = detail::convert<texture_src_type, T, defaultp>::call(TextureSrc.format()).Fetch;
+		write_type Write = detail::convert<texture_dst_type, T, defaultp>::call(TextureDst.format()).Write;
+		GLI_ASSERT(Fetch && Write);
+
+		detail::parallel_for(0, RowCount, glm::max<size_t>((1 << 12) / Extent.x, 1), [&](size_t RangeBegin, size_t RangeEnd)
+		{
+			for(size_t RowIndex = RangeBegin; RowIndex < RangeEnd; ++RowIndex)
+			for(int TexelIndex = 0; TexelIndex < Extent.x; ++TexelIndex)
+			{
+				extent_type const Texel(TexelIndex, static_cast<int>(RowIndex % Extent.y), static_cast<int>(RowIndex / Extent.y));
+				Write(
+					TextureDst, typename texture_dst_type::extent_type(OffsetDst + Texel), LayerDst, FaceDst, LevelDst,
+					Fetch(TextureSrc, typename texture_src_type::extent_type(OffsetSrc + Texel), LayerSrc, FaceSrc, LevelSrc));
+			}
+		});
+	}
+
 	template <typename texture_src_type, typename texture_dst_type>
 	void copy
 	(
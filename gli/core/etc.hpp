@@ -0,0 +1,60 @@
+/// @brief Include to decompress the ETC1, ETC2 and EAC compression schemes
+/// @file gli/etc.hpp
+
+#pragma once
+
+#include "./s3tc.hpp"
+
+namespace gli
+{
+	namespace detail
+	{
+		// ETC1 and ETC2 color blocks, stored as a big endian 64 bits integer
+		struct etc2_rgb_block {
+			glm::uint8 Data[8];
+		};
+
+		typedef etc2_rgb_block etc1_block;
+
+		// EAC blocks of a single channel, stored as a big endian 64 bits integer
+		struct eac_block {
+			glm::uint8 Data[8];
+		};
+
+		struct etc2_rgba_block {
+			eac_block Alpha;
+			etc2_rgb_block Color;
+		};
+
+		struct eac_rg_block {
+			eac_block Red;
+			eac_block Green;
+		};
+
+		// Decode the 16 texels of a block to Texels[Row * RowPitch + Col].
+		// ETC1 blocks are decoded as ETC2 blocks. With PunchThrough, the block is decoded as an ETC2 block with punch-through alpha.
+		void decode_etc2_rgb_block(const etc2_rgb_block &Block, bool PunchThrough, glm::u8vec4 *Texels, size_t RowPitch);
+		void decode_etc2_rgba_block(const etc2_rgba_block &Block, glm::u8vec4 *Texels, size_t RowPitch);
+
+		// EAC texels are decoded to 11 bits values, [0, 2047] when unsigned and [-1023, 1023] when signed
+		void decode_eac_r11_block(const eac_block &Block, bool Signed, glm::int16 *Texels, size_t RowPitch);
+		void decode_eac_rg11_block(const eac_rg_block &Block, bool Signed, glm::i16vec2 *Texels, size_t RowPitch);
+
+		// Decode a row of BlockCount contiguous blocks to the 4 rows of BlockCount * 4 texels starting at Texels, RowPitch texels apart
+		void decode_etc2_rgb_row(const etc2_rgb_block *Blocks, size_t BlockCount, bool PunchThrough, glm::u8vec4 *Texels, size_t RowPitch);
+		void decode_etc2_rgba_row(const etc2_rgba_block *Blocks, size_t BlockCount, glm::u8vec4 *Texels, size_t RowPitch);
+		void decode_eac_r11_row(const eac_block *Blocks, size_t BlockCount, bool Signed, glm::int16 *Texels, size_t RowPitch);
+		void decode_eac_rg11_row(const eac_rg_block *Blocks, size_t BlockCount, bool Signed, glm::i16vec2 *Texels, size_t RowPitch);
+
+		texel_block4x4 decompress_etc1_block(const etc1_block &Block);
+		texel_block4x4 decompress_etc2_rgb_block(const etc2_rgb_block &Block);
+		texel_block4x4 decompress_etc2_rgba1_block(const etc2_rgb_block &Block);
+		texel_block4x4 decompress_etc2_rgba_block(const etc2_rgba_block &Block);
+		texel_block4x4 decompress_eac_r11unorm_block(const eac_block &Block);
+		texel_block4x4 decompress_eac_r11snorm_block(const eac_block &Block);
+		texel_block4x4 decompress_eac_rg11unorm_block(const eac_rg_block &Block);
+		texel_block4x4 decompress_eac_rg11snorm_block(const eac_rg_block &Block);
+	}//namespace detail
+}//namespace gli
+
+#include "./etc.inl"
@@ -0,0 +1,402 @@
+#include <glm/ext/scalar_uint_sized.hpp>
+#include <glm/ext/scalar_int_sized.hpp>
+
+namespace gli
+{
+	namespace detail
+	{
+		// Intensity modifiers of the individual and differential modes, by pixel index
+		static int const ETC_MODIFIERS[8][4] =
+		{
+			{  2,   8,   -2,   -8},
+			{  5,  17,   -5,  -17},
+			{  9,  29,   -9,  -29},
+			{ 13,  42,  -13,  -42},
+			{ 18,  60,  -18,  -60},
+			{ 24,  80,  -24,  -80},
+			{ 33, 106,  -33, -106},
+			{ 47, 183,  -47, -183}
+		};
+
+		// Distances between the paint colors of the T and H modes
+		static int const ETC_DISTANCES[8] = {3, 6, 11, 16, 23, 32, 41, 64};
+
+		static int const EAC_MODIFIERS[16][8] =
+		{
+			{-3, -6, -9, -15, 2, 5, 8, 14},
+			{-3, -7, -10, -13, 2, 6, 9, 12},
+			{-2, -5, -8, -13, 1, 4, 7, 12},
+			{-2, -4, -6, -13, 1, 3, 5, 12},
+			{-3, -6, -8, -12, 2, 5, 7, 11},
+			{-3, -7, -9, -11, 2, 6, 8, 10},
+			{-4, -7, -8, -11, 3, 6, 7, 10},
+			{-3, -5, -8, -11, 2, 4, 7, 10},
+			{-2, -6, -8, -10, 1, 5, 7, 9},
+			{-2, -5, -8, -10, 1, 4, 7, 9},
+			{-2, -4, -8, -10, 1, 3, 7, 9},
+			{-2, -5, -7, -10, 1, 4, 6, 9},
+			{-3, -4, -7, -10, 2, 3, 6, 9},
+			{-1, -2, -3, -10, 0, 1, 2, 9},
+			{-4, -6, -8, -9, 3, 5, 7, 8},
+			{-3, -5, -7, -9, 2, 4, 6, 8}
+		};
+
+		inline glm::uint32 etc_load_big_endian(glm::uint8 const* Data)
+		{
+			return (glm::uint32(Data[0]) << 24) | (glm::uint32(Data[1]) << 16) | (glm::uint32(Data[2]) << 8) | glm::uint32(Data[3]);
+		}
+
+		inline glm::uint8 etc_clamp(int Value)
+		{
+			return static_cast<glm::uint8>(Value < 0 ? 0 : Value > 255 ? 255 : Value);
+		}
+
+		inline int etc_expand4(glm::uint32 Value)
+		{
+			return static_cast<int>(Value * 17);
+		}
+
+		inline int etc_expand5(glm::uint32 Value)
+		{
+			return static_cast<int>((Value << 3) | (Value >> 2));
+		}
+
+		inline int etc_expand6(glm::uint32 Value)
+		{
+			return static_cast<int>((Value << 2) | (Value >> 4));
+		}
+
+		inline int etc_expand7(glm::uint32 Value)
+		{
+			return static_cast<int>((Value << 1) | (Value >> 6));
+		}
+
+		// Pixel indices are stored by column, the most significant bits in the high half of Low
+		inline unsigned etc_pixel_index(glm::uint32 Low, unsigned Row, unsigned Col)
+		{
+			unsigned const Bit = Col * 4 + Row;
+			return (((Low >> (Bit + 16)) & 1) << 1) | ((Low >> Bit) & 1);
+		}
+
+		// Store the paint colors selected by the pixel indices of the T and H modes, the index 2 is transparent with punch-through alpha
+		inline void etc_store_paint_colors(glm::u8vec4 const (&Paint)[4], glm::uint32 Low, bool Transparent, glm::u8vec4 *Texels, size_t RowPitch)
+		{
+			for(unsigned Row = 0; Row < 4; ++Row)
+			for(unsigned Col = 0; Col < 4; ++Col)
+			{
+				unsigned const Index = etc_pixel_index(Low, Row, Col);
+				Texels[Row * RowPitch + Col] = Transparent && Index == 2 ? glm::u8vec4(0) : Paint[Index];
+			}
+		}
+
+		inline glm::u8vec4 etc_paint_color(glm::ivec3 const& Color, int Distance)
+		{
+			return glm::u8vec4(etc_clamp(Color.r + Distance), etc_clamp(Color.g + Distance), etc_clamp(Color.b + Distance), 255);
+		}
+
+		inline void decode_etc2_rgb_block(const etc2_rgb_block &Block, bool PunchThrough, glm::u8vec4 *Texels, size_t RowPitch)
+		{
+			glm::uint32 const High = etc_load_big_endian(Block.Data);
+			glm::uint32 const Low = etc_load_big_endian(Block.Data + 4);
+
+			// With punch-through alpha, the differential bit is the opaque bit and the individual mode doesn't exist
+			bool const Differential = PunchThrough || ((High >> 1) & 1) != 0;
+			bool const Transparent = PunchThrough && ((High >> 1) & 1) == 0;
+
+			glm::ivec3 Base[2];
+			if(Differential)
+			{
+				int const Red = static_cast<int>((High >> 27) & 0x1F);
+				int const Green = static_cast<int>((High >> 19) & 0x1F);
+				int const Blue = static_cast<int>((High >> 11) & 0x1F);
+				int const RedDelta = static_cast<int>((High >> 24) & 0x7) - (((High >> 24) & 0x4) ? 8 : 0);
+				int const GreenDelta = static_cast<int>((High >> 16) & 0x7) - (((High >> 16) & 0x4) ? 8 : 0);
+				int const BlueDelta = static_cast<int>((High >> 8) & 0x7) - (((High >> 8) & 0x4) ? 8 : 0);
+
+				// T mode
+				if(Red + RedDelta < 0 || Red + RedDelta > 31)
+				{
+					glm::ivec3 const Color0(
+						etc_expand4(((High >> 27) & 0x3) << 2 | ((High >> 24) & 0x3)),
+						etc_expand4((High >> 20) & 0xF),
+						etc_expand4((High >> 16) & 0xF));
+					glm::ivec3 const Color1(
+						etc_expand4((High >> 12) & 0xF),
+						etc_expand4((High >> 8) & 0xF),
+						etc_expand4((High >> 4) & 0xF));
+					int const Distance = ETC_DISTANCES[((High >> 2) & 0x3) << 1 | (High & 0x1)];
+
+					glm::u8vec4 const Paint[4] =
+					{
+						etc_paint_color(Color0, 0),
+						etc_paint_color(Color1, Distance),
+						etc_paint_color(Color1, 0),
+						etc_paint_color(Color1, -Distance)
+					};
+					etc_store_paint_colors(Paint, Low, Transparent, Texels, RowPitch);
+					return;
+				}
+
+				// H mode
+				if(Green + GreenDelta < 0 || Green + GreenDelta > 31)
+				{
+					glm::uint32 const Red0 = (High >> 27) & 0xF;
+					glm::uint32 const Green0 = ((High >> 24) & 0x7) << 1 | ((High >> 20) & 0x1);
+					glm::uint32 const Blue0 = ((High >> 19) & 0x1) << 3 | ((High >> 15) & 0x7);
+					glm::uint32 const Red1 = (High >> 11) & 0xF;
+					glm::uint32 const Green1 = (High >> 7) & 0xF;
+					glm::uint32 const Blue1 = (High >> 3) & 0xF;
+
+					// The order of the base colors stores the least significant bit of the distance index
+					glm::uint32 const Order = ((Red0 << 8) | (Green0 << 4) | Blue0) >= ((Red1 << 8) | (Green1 << 4) | Blue1) ? 1 : 0;
+					int const Distance = ETC_DISTANCES[((High >> 2) & 0x1) << 2 | (High & 0x1) << 1 | Order];
+
+					glm::ivec3 const Color0(etc_expand4(Red0), etc_expand4(Green0), etc_expand4(Blue0));
+					glm::ivec3 const Color1(etc_expand4(Red1), etc_expand4(Green1), etc_expand4(Blue1));
+
+					glm::u8vec4 const Paint[4] =
+					{
+						etc_paint_color(Color0, Distance),
+						etc_paint_color(Color0, -Distance),
+						etc_paint_color(Color1, Distance),
+						etc_paint_color(Color1, -Distance)
+					};
+					etc_store_paint_colors(Paint, Low, Transparent, Texels, RowPitch);
+					return;
+				}
+
+				// Planar mode, always opaque
+				if(Blue + BlueDelta < 0 || Blue + BlueDelta > 31)
+				{
+					glm::ivec3 const Origin(
+						etc_expand6((High >> 25) & 0x3F),
+						etc_expand7(((High >> 24) & 0x1) << 6 | ((High >> 17) & 0x3F)),
+						etc_expand6(((High >> 16) & 0x1) << 5 | ((High >> 11) & 0x3) << 3 | ((High >> 7) & 0x7)));
+					glm::ivec3 const Horizontal(
+						etc_expand6(((High >> 2) & 0x1F) << 1 | (High & 0x1)),
+						etc_expand7((Low >> 25) & 0x7F),
+						etc_expand6((Low >> 19) & 0x3F));
+					glm::ivec3 const Vertical(
+						etc_expand6((Low >> 13) & 0x3F),
+						etc_expand7((Low >> 6) & 0x7F),
+						etc_expand6(Low & 0x3F));
+
+					for(int Row = 0; Row < 4; ++Row)
+					for(int Col = 0; Col < 4; ++Col)
+					{
+						glm::ivec3 const Color = (Col * (Horizontal - Origin) + Row * (Vertical - Origin) + 4 * Origin + 2) >> 2;
+						Texels[Row * RowPitch + Col] = glm::u8vec4(etc_clamp(Color.r), etc_clamp(Color.g), etc_clamp(Color.b), 255);
+					}
+					return;
+				}
+
+				Base[0] = glm::ivec3(etc_expand5(Red), etc_expand5(Green), etc_expand5(Blue));
+				Base[1] = glm::ivec3(etc_expand5(Red + RedDelta), etc_expand5(Green + GreenDelta), etc_expand5(Blue + BlueDelta));
+			}
+			else
+			{
+				Base[0] = glm::ivec3(etc_expand4((High >> 28) & 0xF), etc_expand4((High >> 20) & 0xF), etc_expand4((High >> 12) & 0xF));
+				Base[1] = glm::ivec3(etc_expand4((High >> 24) & 0xF), etc_expand4((High >> 16) & 0xF), etc_expand4((High >> 8) & 0xF));
+			}
+
+			unsigned const Table[2] = {(High >> 5) & 0x7, (High >> 2) & 0x7};
+			bool const Flip = (High & 0x1) != 0;
+
+			for(unsigned Row = 0; Row < 4; ++Row)
+			for(unsigned Col = 0; Col < 4; ++Col)
+			{
+				// Without flip the sub-blocks are 2x4 side by side, with flip 4x2 on top of each other
+				unsigned const SubBlock = Flip ? Row / 2 : Col / 2;
+				unsigned const Index = etc_pixel_index(Low, Row, Col);
+
+				glm::u8vec4& Texel = Texels[Row * RowPitch + Col];
+				if(Transparent && Index == 2)
+				{
+					Texel = glm::u8vec4(0);
+					continue;
+				}
+
+				// The smallest modifiers are zero for the blocks with punch-through alpha which aren't opaque
+				int const Modifier = Transparent && (Index & 1) == 0 ? 0 : ETC_MODIFIERS[Table[SubBlock]][Index];
+				Texel = etc_paint_color(Base[SubBlock], Modifier);
+			}
+		}
+
+		enum eac_mode
+		{
+			EAC_ALPHA8,
+			EAC_UNSIGNED11,
+			EAC_SIGNED11
+		};
+
+		// Decode the 16 values of an EAC block in row major order
+		inline void decode_eac_values(const eac_block &Block, eac_mode Mode, int *Values)
+		{
+			int const Multiplier = Block.Data[1] >> 4;
+			int const* const Modifiers = EAC_MODIFIERS[Block.Data[1] & 0xF];
+
+			// 48 bits of 3 bits indices, stored by column from the most significant bits
+			glm::uint64 Indices = 0;
+			for(int Byte = 2; Byte < 8; ++Byte)
+				Indices = (Indices << 8) | Block.Data[Byte];
+
+			int Base = 0;
+			switch(Mode)
+			{
+			case EAC_ALPHA8:
+				Base = Block.Data[0];
+				break;
+			case EAC_UNSIGNED11:
+				Base = Block.Data[0] * 8 + 4;
+				break;
+			case EAC_SIGNED11:
+				Base = glm::max(static_cast<int>(static_cast<glm::int8>(Block.Data[0])), -127) * 8;
+				break;
+			}
+
+			// The 11 bits formats use a multiplier of 1/8 when the multiplier is zero
+			int const Scale = Mode == EAC_ALPHA8 ? Multiplier : Multiplier == 0 ? 1 : Multiplier * 8;
+			int const Min = Mode == EAC_SIGNED11 ? -1023 : 0;
+			int const Max = Mode == EAC_ALPHA8 ? 255 : Mode == EAC_SIGNED11 ? 1023 : 2047;
+
+			for(int Col = 0; Col < 4; ++Col)
+			for(int Row = 0; Row < 4; ++Row)
+			{
+				unsigned const Index = static_cast<unsigned>(Indices >> (45 - (Col * 4 + Row) * 3)) & 0x7;
+				Values[Row * 4 + Col] = glm::clamp(Base + Modifiers[Index] * Scale, Min, Max);
+			}
+		}
+
+		inline void decode_etc2_rgba_block(const etc2_rgba_block &Block, glm::u8vec4 *Texels, size_t RowPitch)
+		{
+			decode_etc2_rgb_block(Block.Color, false, Texels, RowPitch);
+
+			int Alpha[16];
+			decode_eac_values(Block.Alpha, EAC_ALPHA8, Alpha);
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+				Texels[Row * RowPitch + Col].a = static_cast<glm::uint8>(Alpha[Row * 4 + Col]);
+		}
+
+		inline void decode_eac_r11_block(const eac_block &Block, bool Signed, glm::int16 *Texels, size_t RowPitch)
+		{
+			int Red[16];
+			decode_eac_values(Block, Signed ? EAC_SIGNED11 : EAC_UNSIGNED11, Red);
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+				Texels[Row * RowPitch + Col] = static_cast<glm::int16>(Red[Row * 4 + Col]);
+		}
+
+		inline void decode_eac_rg11_block(const eac_rg_block &Block, bool Signed, glm::i16vec2 *Texels, size_t RowPitch)
+		{
+			int Red[16], Green[16];
+			decode_eac_values(Block.Red, Signed ? EAC_SIGNED11 : EAC_UNSIGNED11, Red);
+			decode_eac_values(Block.Green, Signed ? EAC_SIGNED11 : EAC_UNSIGNED11, Green);
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+				Texels[Row * RowPitch + Col] = glm::i16vec2(Red[Row * 4 + Col], Green[Row * 4 + Col]);
+		}
+
+		inline void decode_etc2_rgb_row(const etc2_rgb_block *Blocks, size_t BlockCount, bool PunchThrough, glm::u8vec4 *Texels, size_t RowPitch)
+		{
+			for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+				decode_etc2_rgb_block(Blocks[BlockIndex], PunchThrough, Texels + BlockIndex * 4, RowPitch);
+		}
+
+		inline void decode_etc2_rgba_row(const etc2_rgba_block *Blocks, size_t BlockCount, glm::u8vec4 *Texels, size_t RowPitch)
+		{
+			for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+				decode_etc2_rgba_block(Blocks[BlockIndex], Texels + BlockIndex * 4, RowPitch);
+		}
+
+		inline void decode_eac_r11_row(const eac_block *Blocks, size_t BlockCount, bool Signed, glm::int16 *Texels, size_t RowPitch)
+		{
+			for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+				decode_eac_r11_block(Blocks[BlockIndex], Signed, Texels + BlockIndex * 4, RowPitch);
+		}
+
+		inline void decode_eac_rg11_row(const eac_rg_block *Blocks, size_t BlockCount, bool Signed, glm::i16vec2 *Texels, size_t RowPitch)
+		{
+			for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+				decode_eac_rg11_block(Blocks[BlockIndex], Signed, Texels + BlockIndex * 4, RowPitch);
+		}
+
+		inline texel_block4x4 decompress_etc2_block(const etc2_rgb_block &Block, bool PunchThrough)
+		{
+			glm::u8vec4 Texels[16];
+			decode_etc2_rgb_block(Block, PunchThrough, Texels, 4);
+
+			texel_block4x4 TexelBlock;
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+				TexelBlock.Texel[Row][Col] = glm::vec4(Texels[Row * 4 + Col]) / 255.0f;
+
+			return TexelBlock;
+		}
+
+		inline texel_block4x4 decompress_etc1_block(const etc1_block &Block)
+		{
+			return decompress_etc2_block(Block, false);
+		}
+
+		inline texel_block4x4 decompress_etc2_rgb_block(const etc2_rgb_block &Block)
+		{
+			return decompress_etc2_block(Block, false);
+		}
+
+		inline texel_block4x4 decompress_etc2_rgba1_block(const etc2_rgb_block &Block)
+		{
+			return decompress_etc2_block(Block, true);
+		}
+
+		inline texel_block4x4 decompress_etc2_rgba_block(const etc2_rgba_block &Block)
+		{
+			glm::u8vec4 Texels[16];
+			decode_etc2_rgba_block(Block, Texels, 4);
+
+			texel_block4x4 TexelBlock;
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+				TexelBlock.Texel[Row][Col] = glm::vec4(Texels[Row * 4 + Col]) / 255.0f;
+
+			return TexelBlock;
+		}
+
+		inline texel_block4x4 decompress_eac_block(const eac_block &Red, const eac_block *Green, bool Signed)
+		{
+			int RedValues[16], GreenValues[16];
+			decode_eac_values(Red, Signed ? EAC_SIGNED11 : EAC_UNSIGNED11, RedValues);
+			if(Green)
+				decode_eac_values(*Green, Signed ? EAC_SIGNED11 : EAC_UNSIGNED11, GreenValues);
+
+			float const Max = Signed ? 1023.0f : 2047.0f;
+
+			texel_block4x4 TexelBlock;
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+				TexelBlock.Texel[Row][Col] = glm::vec4(RedValues[Row * 4 + Col] / Max, Green ? GreenValues[Row * 4 + Col] / Max : 0.0f, 0.0f, 1.0f);
+
+			return TexelBlock;
+		}
+
+		inline texel_block4x4 decompress_eac_r11unorm_block(const eac_block &Block)
+		{
+			return decompress_eac_block(Block, nullptr, false);
+		}
+
+		inline texel_block4x4 decompress_eac_r11snorm_block(const eac_block &Block)
+		{
+			return decompress_eac_block(Block, nullptr, true);
+		}
+
+		inline texel_block4x4 decompress_eac_rg11unorm_block(const eac_rg_block &Block)
+		{
+			return decompress_eac_block(Block.Red, &Block.Green, false);
+		}
+
+		inline texel_block4x4 decompress_eac_rg11snorm_block(const eac_rg_block &Block)
+		{
+			return decompress_eac_block(Block.Red, &Block.Green, true);
+		}
+	}//namespace detail
+}//namespace gli
@@ -0,0 +1,44 @@
+/// @brief Include to compress blocks with the ETC1, ETC2 and EAC compression schemes
+/// @file gli/core/etc_encoder.hpp
+
+#pragma once
+
+#include "./etc.hpp"
+
+namespace gli
+{
+	namespace detail
+	{
+		// Search space of the ETC and EAC encoders
+		struct etc_encoder_settings
+		{
+			// Base colors tried around the average color of each sub-block, in quantization steps of each channel
+			glm::uint8 BaseColorRadius;
+			// Try the planar mode of ETC2 blocks, fitting smooth gradients
+			bool Planar;
+			// EAC multipliers tried around the multiplier covering the range of the values with each table
+			glm::uint8 MultiplierRadius;
+			// EAC base codewords tried around the codeword centering each table on the values
+			glm::uint8 CodewordRadius;
+		};
+
+		// Settings of the fast, default and slow presets, indexed by encode_preset
+		static etc_encoder_settings const ETC_ENCODER_PRESETS[3] =
+		{
+			{0, false, 0, 0},
+			{0, true, 1, 1},
+			{1, true, 2, 4}
+		};
+
+		// Encode the 16 texels of a block, in row major order, ignoring the alpha.
+		// With ETC1, the block only uses the individual and differential modes shared by ETC1 and ETC2.
+		void encode_etc2_rgb_block(const glm::u8vec4 *Texels, bool ETC1, etc_encoder_settings const& Settings, etc2_rgb_block &Block);
+		void encode_etc2_rgba_block(const glm::u8vec4 *Texels, etc_encoder_settings const& Settings, etc2_rgba_block &Block);
+
+		// Encode 16 values of 11 bits, [0, 2047] when unsigned and [-1023, 1023] when signed, in row major order
+		void encode_eac_r11_block(const glm::int16 *Values, bool Signed, etc_encoder_settings const& Settings, eac_block &Block);
+		void encode_eac_rg11_block(const glm::i16vec2 *Values, bool Signed, etc_encoder_settings const& Settings, eac_rg_block &Block);
+	}//namespace detail
+}//namespace gli
+
+#include "./etc_encoder.inl"
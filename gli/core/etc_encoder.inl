@@ -0,0 +1,455 @@
+#include <algorithm>
+#include <climits>
+
+namespace gli
+{
+	namespace detail
+	{
+		inline void etc_store_big_endian(glm::uint32 Value, glm::uint8* Data)
+		{
+			Data[0] = static_cast<glm::uint8>(Value >> 24);
+			Data[1] = static_cast<glm::uint8>(Value >> 16);
+			Data[2] = static_cast<glm::uint8>(Value >> 8);
+			Data[3] = static_cast<glm::uint8>(Value);
+		}
+
+		inline int etc_expand(int Value, unsigned Bits)
+		{
+			switch(Bits)
+			{
+			case 4:
+				return etc_expand4(static_cast<glm::uint32>(Value));
+			case 5:
+				return etc_expand5(static_cast<glm::uint32>(Value));
+			case 6:
+				return etc_expand6(static_cast<glm::uint32>(Value));
+			default:
+				return etc_expand7(static_cast<glm::uint32>(Value));
+			}
+		}
+
+		inline int etc_quantize(float Value, unsigned Bits)
+		{
+			int const Max = (1 << Bits) - 1;
+			return glm::clamp(static_cast<int>(Value * static_cast<float>(Max) / 255.0f + 0.5f), 0, Max);
+		}
+
+		// Index in the block of the texel Index of a sub-block, in row major order
+		inline unsigned etc_subblock_texel(bool Flip, unsigned SubBlock, unsigned Index)
+		{
+			// Without flip the sub-blocks are 2x4 side by side, with flip 4x2 on top of each other
+			return Flip ? (SubBlock * 2 + Index / 4) * 4 + Index % 4 : (Index / 2) * 4 + SubBlock * 2 + Index % 2;
+		}
+
+		// Modifier table and pixel indices of the 8 texels of a sub-block
+		struct etc_subblock
+		{
+			unsigned Table;
+			unsigned Indices[8];
+			int Error;
+		};
+
+		// Select the table and the pixel indices with the lowest error for a base color
+		inline etc_subblock etc_fit_subblock(glm::ivec3 const* Texels, glm::ivec3 const& Base)
+		{
+			etc_subblock Best = etc_subblock();
+			Best.Error = INT_MAX;
+
+			for(unsigned Table = 0; Table < 8; ++Table)
+			{
+				etc_subblock Current;
+				Current.Table = Table;
+				Current.Error = 0;
+
+				for(unsigned Texel = 0; Texel < 8 && Current.Error < Best.Error; ++Texel)
+				{
+					int TexelError = INT_MAX;
+					for(unsigned Index = 0; Index < 4; ++Index)
+					{
+						glm::ivec3 const Difference = glm::clamp(Base + ETC_MODIFIERS[Table][Index], 0, 255) - Texels[Texel];
+						int const Error = Difference.x * Difference.x + Difference.y * Difference.y + Difference.z * Difference.z;
+						if(Error < TexelError)
+						{
+							TexelError = Error;
+							Current.Indices[Texel] = Index;
+						}
+					}
+					Current.Error += TexelError;
+				}
+
+				if(Current.Error < Best.Error)
+					Best = Current;
+			}
+
+			return Best;
+		}
+
+		// Search the base color of Bits bits per channel, within [Min, Max], around the average of the texels of a sub-block
+		inline etc_subblock etc_search_base(glm::ivec3 const* Texels, unsigned Bits, int Radius, glm::ivec3 const& Min, glm::ivec3 const& Max, glm::ivec3 &Base)
+		{
+			glm::vec3 Average(0.0f);
+			for(unsigned Texel = 0; Texel < 8; ++Texel)
+				Average += glm::vec3(Texels[Texel]);
+			Average /= 8.0f;
+
+			glm::ivec3 const Center = glm::clamp(glm::ivec3(etc_quantize(Average.x, Bits), etc_quantize(Average.y, Bits), etc_quantize(Average.z, Bits)), Min, Max);
+
+			etc_subblock Best = etc_subblock();
+			Best.Error = INT_MAX;
+			for(int Red = glm::max(Center.x - Radius, Min.x); Red <= glm::min(Center.x + Radius, Max.x); ++Red)
+			for(int Green = glm::max(Center.y - Radius, Min.y); Green <= glm::min(Center.y + Radius, Max.y); ++Green)
+			for(int Blue = glm::max(Center.z - Radius, Min.z); Blue <= glm::min(Center.z + Radius, Max.z); ++Blue)
+			{
+				glm::ivec3 const Quantized(Red, Green, Blue);
+				etc_subblock const Current = etc_fit_subblock(Texels, glm::ivec3(etc_expand(Red, Bits), etc_expand(Green, Bits), etc_expand(Blue, Bits)));
+				if(Current.Error < Best.Error)
+				{
+					Best = Current;
+					Base = Quantized;
+				}
+			}
+
+			return Best;
+		}
+
+		// Encoding of a block with the individual or the differential mode
+		struct etc_candidate
+		{
+			bool Differential;
+			bool Flip;
+			glm::ivec3 Base[2];
+			etc_subblock SubBlocks[2];
+			int Error;
+		};
+
+		inline void etc_encode_subblocks(glm::ivec3 const (&Texels)[16], bool Flip, bool Differential, int Radius, etc_candidate &Candidate)
+		{
+			glm::ivec3 SubBlockTexels[2][8];
+			for(unsigned SubBlock = 0; SubBlock < 2; ++SubBlock)
+			for(unsigned Index = 0; Index < 8; ++Index)
+				SubBlockTexels[SubBlock][Index] = Texels[etc_subblock_texel(Flip, SubBlock, Index)];
+
+			Candidate.Differential = Differential;
+			Candidate.Flip = Flip;
+
+			if(!Differential)
+			{
+				for(unsigned SubBlock = 0; SubBlock < 2; ++SubBlock)
+					Candidate.SubBlocks[SubBlock] = etc_search_base(SubBlockTexels[SubBlock], 4, Radius, glm::ivec3(0), glm::ivec3(15), Candidate.Base[SubBlock]);
+				Candidate.Error = Candidate.SubBlocks[0].Error + Candidate.SubBlocks[1].Error;
+				return;
+			}
+
+			// The second base color is stored as a difference in [-4, 3] to the first one,
+			// either sub-block picks its base color first and the other one is constrained to its neighborhood
+			Candidate.Error = INT_MAX;
+			for(unsigned First = 0; First < 2; ++First)
+			{
+				unsigned const Second = 1 - First;
+				glm::ivec3 Base[2];
+				etc_subblock SubBlocks[2];
+
+				SubBlocks[First] = etc_search_base(SubBlockTexels[First], 5, Radius, glm::ivec3(0), glm::ivec3(31), Base[First]);
+				glm::ivec3 const Min = glm::max(First == 0 ? Base[First] - 4 : Base[First] - 3, 0);
+				glm::ivec3 const Max = glm::min(First == 0 ? Base[First] + 3 : Base[First] + 4, 31);
+				SubBlocks[Second] = etc_search_base(SubBlockTexels[Second], 5, Radius, Min, Max, Base[Second]);
+
+				int const Error = SubBlocks[0].Error + SubBlocks[1].Error;
+				if(Error < Candidate.Error)
+				{
+					Candidate.Error = Error;
+					Candidate.Base[0] = Base[0];
+					Candidate.Base[1] = Base[1];
+					Candidate.SubBlocks[0] = SubBlocks[0];
+					Candidate.SubBlocks[1] = SubBlocks[1];
+				}
+			}
+		}
+
+		inline void etc_pack_subblocks(etc_candidate const& Candidate, etc2_rgb_block &Block)
+		{
+			glm::uint32 High = 0;
+			if(Candidate.Differential)
+			{
+				glm::ivec3 const Delta = Candidate.Base[1] - Candidate.Base[0];
+				High |= glm::uint32(Candidate.Base[0].x) << 27 | (glm::uint32(Delta.x) & 0x7) << 24;
+				High |= glm::uint32(Candidate.Base[0].y) << 19 | (glm::uint32(Delta.y) & 0x7) << 16;
+				High |= glm::uint32(Candidate.Base[0].z) << 11 | (glm::uint32(Delta.z) & 0x7) << 8;
+				High |= 1 << 1;
+			}
+			else
+			{
+				High |= glm::uint32(Candidate.Base[0].x) << 28 | glm::uint32(Candidate.Base[1].x) << 24;
+				High |= glm::uint32(Candidate.Base[0].y) << 20 | glm::uint32(Candidate.Base[1].y) << 16;
+				High |= glm::uint32(Candidate.Base[0].z) << 12 | glm::uint32(Candidate.Base[1].z) << 8;
+			}
+			High |= glm::uint32(Candidate.SubBlocks[0].Table) << 5 | glm::uint32(Candidate.SubBlocks[1].Table) << 2;
+			High |= Candidate.Flip ? 1 : 0;
+
+			// Pixel indices are stored by column, the most significant bits in the high half of Low
+			glm::uint32 Low = 0;
+			for(unsigned SubBlock = 0; SubBlock < 2; ++SubBlock)
+			for(unsigned Index = 0; Index < 8; ++Index)
+			{
+				unsigned const Texel = etc_subblock_texel(Candidate.Flip, SubBlock, Index);
+				unsigned const Bit = (Texel % 4) * 4 + Texel / 4;
+				unsigned const PixelIndex = Candidate.SubBlocks[SubBlock].Indices[Index];
+				Low |= glm::uint32(PixelIndex >> 1) << (Bit + 16) | glm::uint32(PixelIndex & 1) << Bit;
+			}
+
+			etc_store_big_endian(High, Block.Data);
+			etc_store_big_endian(Low, Block.Data + 4);
+		}
+
+		// Squared error of a channel of the planar mode
+		inline int etc_planar_error(int const* Values, int Origin, int Horizontal, int Vertical)
+		{
+			int Error = 0;
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+			{
+				int const Difference = glm::clamp((Col * (Horizontal - Origin) + Row * (Vertical - Origin) + 4 * Origin + 2) >> 2, 0, 255) - Values[Row * 4 + Col];
+				Error += Difference * Difference;
+			}
+			return Error;
+		}
+
+		// Fit the colors of the corners of the planar mode, returns the squared error
+		inline int etc_fit_planar(glm::ivec3 const (&Texels)[16], int Radius, glm::ivec3 (&Colors)[3])
+		{
+			static unsigned const Bits[3] = {6, 7, 6};
+
+			int Error = 0;
+			for(int Channel = 0; Channel < 3; ++Channel)
+			{
+				int Values[16];
+				for(int Texel = 0; Texel < 16; ++Texel)
+					Values[Texel] = Texels[Texel][Channel];
+
+				// Least squares plane through the values, the colors of the origin, of the texel (4, 0) and of the texel (0, 4)
+				float Mean = 0.0f, SlopeX = 0.0f, SlopeY = 0.0f;
+				for(int Row = 0; Row < 4; ++Row)
+				for(int Col = 0; Col < 4; ++Col)
+				{
+					float const Value = static_cast<float>(Values[Row * 4 + Col]);
+					Mean += Value / 16.0f;
+					SlopeX += (static_cast<float>(Col) - 1.5f) * Value / 20.0f;
+					SlopeY += (static_cast<float>(Row) - 1.5f) * Value / 20.0f;
+				}
+				float const Origin = Mean - 1.5f * SlopeX - 1.5f * SlopeY;
+				int const Center[3] = {etc_quantize(Origin, Bits[Channel]), etc_quantize(Origin + 4.0f * SlopeX, Bits[Channel]), etc_quantize(Origin + 4.0f * SlopeY, Bits[Channel])};
+				int const Max = (1 << Bits[Channel]) - 1;
+
+				int BestError = INT_MAX;
+				for(int O = glm::max(Center[0] - Radius, 0); O <= glm::min(Center[0] + Radius, Max); ++O)
+				for(int H = glm::max(Center[1] - Radius, 0); H <= glm::min(Center[1] + Radius, Max); ++H)
+				for(int V = glm::max(Center[2] - Radius, 0); V <= glm::min(Center[2] + Radius, Max); ++V)
+				{
+					int const ChannelError = etc_planar_error(Values, etc_expand(O, Bits[Channel]), etc_expand(H, Bits[Channel]), etc_expand(V, Bits[Channel]));
+					if(ChannelError < BestError)
+					{
+						BestError = ChannelError;
+						Colors[0][Channel] = O;
+						Colors[1][Channel] = H;
+						Colors[2][Channel] = V;
+					}
+				}
+				Error += BestError;
+			}
+
+			return Error;
+		}
+
+		inline bool etc_overflows(glm::uint32 Base, glm::uint32 Delta)
+		{
+			int const Sum = static_cast<int>(Base) + static_cast<int>(Delta & 0x7) - ((Delta & 0x4) ? 8 : 0);
+			return Sum < 0 || Sum > 31;
+		}
+
+		inline void etc_pack_planar(glm::ivec3 const (&Colors)[3], etc2_rgb_block &Block)
+		{
+			glm::uint32 const RO = glm::uint32(Colors[0].x), GO = glm::uint32(Colors[0].y), BO = glm::uint32(Colors[0].z);
+			glm::uint32 const RH = glm::uint32(Colors[1].x), GH = glm::uint32(Colors[1].y), BH = glm::uint32(Colors[1].z);
+			glm::uint32 const RV = glm::uint32(Colors[2].x), GV = glm::uint32(Colors[2].y), BV = glm::uint32(Colors[2].z);
+
+			glm::uint32 High = RO << 25 | (GO >> 6) << 24 | (GO & 0x3F) << 17 | (BO >> 5) << 16 | ((BO >> 3) & 0x3) << 11 | (BO & 0x7) << 7 | (RH >> 1) << 2 | (RH & 0x1) | 1 << 1;
+			glm::uint32 const Low = GH << 25 | BH << 19 | RV << 13 | GV << 6 | BV;
+
+			// The bits 31, 23, 13 to 15 and 10 are free, select them so that the decoder identifies the planar mode:
+			// the red and green differential colors are valid, the blue one overflows
+			static glm::uint32 const FreeBits[6] = {31, 23, 15, 14, 13, 10};
+			for(glm::uint32 Combination = 0; Combination < 64; ++Combination)
+			{
+				glm::uint32 Candidate = High;
+				for(unsigned Bit = 0; Bit < 6; ++Bit)
+					Candidate |= ((Combination >> Bit) & 1) << FreeBits[Bit];
+
+				if(!etc_overflows((Candidate >> 27) & 0x1F, Candidate >> 24) && !etc_overflows((Candidate >> 19) & 0x1F, Candidate >> 16) && etc_overflows((Candidate >> 11) & 0x1F, Candidate >> 8))
+				{
+					High = Candidate;
+					break;
+				}
+			}
+
+			etc_store_big_endian(High, Block.Data);
+			etc_store_big_endian(Low, Block.Data + 4);
+		}
+
+		inline void encode_etc2_rgb_block(const glm::u8vec4 *Texels, bool ETC1, etc_encoder_settings const& Settings, etc2_rgb_block &Block)
+		{
+			glm::ivec3 Colors[16];
+			for(int Texel = 0; Texel < 16; ++Texel)
+				Colors[Texel] = glm::ivec3(Texels[Texel]);
+
+			// Start from the first mode so that every field of Best is set
+			etc_candidate Best;
+			etc_encode_subblocks(Colors, false, false, Settings.BaseColorRadius, Best);
+			for(int Mode = 1; Mode < 4 && Best.Error > 0; ++Mode)
+			{
+				etc_candidate Candidate;
+				etc_encode_subblocks(Colors, (Mode & 1) != 0, (Mode & 2) != 0, Settings.BaseColorRadius, Candidate);
+				if(Candidate.Error < Best.Error)
+					Best = Candidate;
+			}
+
+			if(!ETC1 && Settings.Planar && Best.Error > 0)
+			{
+				glm::ivec3 Corners[3];
+				if(etc_fit_planar(Colors, Settings.BaseColorRadius, Corners) < Best.Error)
+				{
+					etc_pack_planar(Corners, Block);
+					return;
+				}
+			}
+
+			etc_pack_subblocks(Best, Block);
+		}
+
+		inline int eac_scale(eac_mode Mode, int Multiplier)
+		{
+			return Mode == EAC_ALPHA8 ? Multiplier : Multiplier == 0 ? 1 : Multiplier * 8;
+		}
+
+		inline int eac_base(eac_mode Mode, int Codeword)
+		{
+			return Mode == EAC_ALPHA8 ? Codeword : Mode == EAC_UNSIGNED11 ? Codeword * 8 + 4 : Codeword * 8;
+		}
+
+		// Encode 16 values in row major order, in the range decoded by decode_eac_values for Mode
+		inline void encode_eac_values(const int *Values, eac_mode Mode, etc_encoder_settings const& Settings, eac_block &Block)
+		{
+			int const MinValue = *std::min_element(Values, Values + 16);
+			int const MaxValue = *std::max_element(Values, Values + 16);
+			int const Min = Mode == EAC_SIGNED11 ? -1023 : 0;
+			int const Max = Mode == EAC_ALPHA8 ? 255 : Mode == EAC_SIGNED11 ? 1023 : 2047;
+			int const MinCodeword = Mode == EAC_SIGNED11 ? -127 : 0;
+			int const MaxCodeword = Mode == EAC_SIGNED11 ? 127 : 255;
+
+			int BestError = INT_MAX;
+			int BestTable = 0, BestMultiplier = 1, BestCodeword = 0;
+
+			for(int Table = 0; Table < 16 && BestError > 0; ++Table)
+			{
+				int const* const Modifiers = EAC_MODIFIERS[Table];
+				int const ModifierMin = *std::min_element(Modifiers, Modifiers + 8);
+				int const ModifierMax = *std::max_element(Modifiers, Modifiers + 8);
+
+				// Multiplier spreading the modifiers over the range of the values
+				float const Scale = static_cast<float>(MaxValue - MinValue) / static_cast<float>(ModifierMax - ModifierMin);
+				int const MultiplierGuess = static_cast<int>((Mode == EAC_ALPHA8 ? Scale : Scale / 8.0f) + 0.5f);
+
+				for(int Multiplier = glm::max(MultiplierGuess - Settings.MultiplierRadius, Mode == EAC_ALPHA8 ? 1 : 0); Multiplier <= glm::min(MultiplierGuess + Settings.MultiplierRadius, 15); ++Multiplier)
+				{
+					int const MultiplierScale = eac_scale(Mode, Multiplier);
+
+					// Codeword centering the modifiers on the values
+					float const BaseGuess = static_cast<float>(MinValue + MaxValue) * 0.5f - static_cast<float>((ModifierMin + ModifierMax) * MultiplierScale) * 0.5f;
+					float const CodewordGuess = Mode == EAC_ALPHA8 ? BaseGuess : Mode == EAC_UNSIGNED11 ? (BaseGuess - 4.0f) / 8.0f : BaseGuess / 8.0f;
+					int const Codeword = static_cast<int>(glm::floor(CodewordGuess + 0.5f));
+
+					for(int Candidate = glm::max(Codeword - Settings.CodewordRadius, MinCodeword); Candidate <= glm::min(Codeword + Settings.CodewordRadius, MaxCodeword); ++Candidate)
+					{
+						int const Base = eac_base(Mode, Candidate);
+
+						int Error = 0;
+						for(int Value = 0; Value < 16 && Error < BestError; ++Value)
+						{
+							int ValueError = INT_MAX;
+							for(int Index = 0; Index < 8; ++Index)
+							{
+								int const Difference = glm::clamp(Base + Modifiers[Index] * MultiplierScale, Min, Max) - Values[Value];
+								ValueError = glm::min(ValueError, Difference * Difference);
+							}
+							Error += ValueError;
+						}
+
+						if(Error < BestError)
+						{
+							BestError = Error;
+							BestTable = Table;
+							BestMultiplier = Multiplier;
+							BestCodeword = Candidate;
+						}
+					}
+				}
+			}
+
+			int const Base = eac_base(Mode, BestCodeword);
+			int const MultiplierScale = eac_scale(Mode, BestMultiplier);
+
+			// 48 bits of 3 bits indices, stored by column from the most significant bits
+			glm::uint64 Indices = 0;
+			for(int Col = 0; Col < 4; ++Col)
+			for(int Row = 0; Row < 4; ++Row)
+			{
+				int BestIndex = 0;
+				int IndexError = INT_MAX;
+				for(int Index = 0; Index < 8; ++Index)
+				{
+					int const Difference = glm::clamp(Base + EAC_MODIFIERS[BestTable][Index] * MultiplierScale, Min, Max) - Values[Row * 4 + Col];
+					if(Difference * Difference < IndexError)
+					{
+						IndexError = Difference * Difference;
+						BestIndex = Index;
+					}
+				}
+				Indices |= glm::uint64(BestIndex) << (45 - (Col * 4 + Row) * 3);
+			}
+
+			Block.Data[0] = static_cast<glm::uint8>(BestCodeword & 0xFF);
+			Block.Data[1] = static_cast<glm::uint8>(BestMultiplier << 4 | BestTable);
+			for(int Byte = 2; Byte < 8; ++Byte)
+				Block.Data[Byte] = static_cast<glm::uint8>(Indices >> ((7 - Byte) * 8));
+		}
+
+		inline void encode_etc2_rgba_block(const glm::u8vec4 *Texels, etc_encoder_settings const& Settings, etc2_rgba_block &Block)
+		{
+			encode_etc2_rgb_block(Texels, false, Settings, Block.Color);
+
+			int Alpha[16];
+			for(int Texel = 0; Texel < 16; ++Texel)
+				Alpha[Texel] = Texels[Texel].a;
+			encode_eac_values(Alpha, EAC_ALPHA8, Settings, Block.Alpha);
+		}
+
+		inline void encode_eac_r11_block(const glm::int16 *Values, bool Signed, etc_encoder_settings const& Settings, eac_block &Block)
+		{
+			int Red[16];
+			for(int Texel = 0; Texel < 16; ++Texel)
+				Red[Texel] = Values[Texel];
+			encode_eac_values(Red, Signed ? EAC_SIGNED11 : EAC_UNSIGNED11, Settings, Block);
+		}
+
+		inline void encode_eac_rg11_block(const glm::i16vec2 *Values, bool Signed, etc_encoder_settings const& Settings, eac_rg_block &Block)
+		{
+			int Red[16], Green[16];
+			for(int Texel = 0; Texel < 16; ++Texel)
+			{
+				Red[Texel] = Values[Texel].x;
+				Green[Texel] = Values[Texel].y;
+			}
+			encode_eac_values(Red, Signed ? EAC_SIGNED11 : EAC_UNSIGNED11, Settings, Block.Red);
+			encode_eac_values(Green, Signed ? EAC_SIGNED11 : EAC_UNSIGNED11, Settings, Block.Green);
+		}
+	}//namespace detail
+}//namespace gli
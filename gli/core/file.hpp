@@ -4,11 +4,44 @@
 #pragma once
 
 #include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace gli{
 namespace detail
 {
 	FILE* open_file(const char *Filename, const char *mode);
+
+	/// Set the position of File with a 64 bits offset, long is 32 bits on Windows. Returns false on failure.
+	bool seek_file(FILE* File, std::int64_t Offset, int Origin);
+
+	/// Retrieve the position of File as a 64 bits offset. Returns -1 on failure.
+	std::int64_t tell_file(FILE* File);
+
+	/// Read the whole content of File, returns false if the file is empty or can't be read
+	bool read_file(FILE* File, std::vector<char>& Data);
+
+	/// Content of a file mapped in memory with copy on write pages: writes to the content are private to the process.
+	/// When the platform can't map files, the content is read in memory instead.
+	class mapped_file
+	{
+	public:
+		explicit mapped_file(char const* Filename);
+		~mapped_file();
+
+		bool empty() const;
+		char* data() const;
+		std::size_t size() const;
+
+	private:
+		mapped_file(mapped_file const&);
+		mapped_file& operator=(mapped_file const&);
+
+		char* Data;
+		std::size_t Size;
+		std::vector<char> Memory;
+	};
 }//namespace detail
 }//namespace gli
 
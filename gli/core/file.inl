@@ -2,6 +2,20 @@
 
 #include <glm/simd/platform.h>
 
+#if GLM_PLATFORM & GLM_PLATFORM_WINDOWS
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#	define GLI_MAPPED_FILE_WINDOWS
+#elif GLM_PLATFORM & (GLM_PLATFORM_LINUX | GLM_PLATFORM_APPLE | GLM_PLATFORM_ANDROID | GLM_PLATFORM_UNIX)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#	define GLI_MAPPED_FILE_POSIX
+#endif
+
 namespace gli{
 namespace detail
 {
@@ -15,5 +29,130 @@ namespace detail
 			return std::fopen(Filename, Mode);
 #		endif
 	}
+
+	inline bool seek_file(FILE* File, std::int64_t Offset, int Origin)
+	{
+#		if defined(GLI_MAPPED_FILE_WINDOWS)
+			return _fseeki64(File, Offset, Origin) == 0;
+#		elif defined(GLI_MAPPED_FILE_POSIX)
+			return fseeko(File, static_cast<off_t>(Offset), Origin) == 0;
+#		else
+			return std::fseek(File, static_cast<long>(Offset), Origin) == 0;
+#		endif
+	}
+
+	inline std::int64_t tell_file(FILE* File)
+	{
+#		if defined(GLI_MAPPED_FILE_WINDOWS)
+			return _ftelli64(File);
+#		elif defined(GLI_MAPPED_FILE_POSIX)
+			return static_cast<std::int64_t>(ftello(File));
+#		else
+			return std::ftell(File);
+#		endif
+	}
+
+	inline bool read_file(FILE* File, std::vector<char>& Data)
+	{
+		if(!seek_file(File, 0, SEEK_END))
+			return false;
+		std::int64_t const End = tell_file(File);
+		if(End <= 0 || static_cast<std::uint64_t>(End) > static_cast<std::size_t>(-1) || !seek_file(File, 0, SEEK_SET))
+			return false;
+
+		Data.resize(static_cast<std::size_t>(End));
+		return std::fread(&Data[0], 1, Data.size(), File) == Data.size();
+	}
+
+	inline mapped_file::mapped_file(char const* Filename)
+		: Data(nullptr)
+		, Size(0)
+	{
+#		if defined(GLI_MAPPED_FILE_WINDOWS)
+			HANDLE const File = CreateFileA(Filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if(File == INVALID_HANDLE_VALUE)
+				return;
+
+			LARGE_INTEGER FileSize;
+			if(GetFileSizeEx(File, &FileSize) && FileSize.QuadPart > 0 && static_cast<unsigned long long>(FileSize.QuadPart) <= static_cast<std::size_t>(-1))
+			{
+				HANDLE const Mapping = CreateFileMappingA(File, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+				if(Mapping)
+				{
+					void* const View = MapViewOfFile(Mapping, FILE_MAP_COPY, 0, 0, 0);
+					if(View)
+					{
+						this->Data = static_cast<char*>(View);
+						this->Size = static_cast<std::size_t>(FileSize.QuadPart);
+					}
+					CloseHandle(Mapping);
+				}
+			}
+			CloseHandle(File);
+#		elif defined(GLI_MAPPED_FILE_POSIX)
+			int const File = ::open(Filename, O_RDONLY);
+			if(File < 0)
+				return;
+
+			struct stat Stat;
+			if(::fstat(File, &Stat) == 0 && Stat.st_size > 0 && static_cast<unsigned long long>(Stat.st_size) <= static_cast<std::size_t>(-1))
+			{
+				void* const View = ::mmap(nullptr, static_cast<std::size_t>(Stat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, File, 0);
+				if(View != MAP_FAILED)
+				{
+					this->Data = static_cast<char*>(View);
+					this->Size = static_cast<std::size_t>(Stat.st_size);
+				}
+			}
+			::close(File);
+#		else
+			FILE* File = open_file(Filename, "rb");
+			if(!File)
+				return;
+
+			seek_file(File, 0, SEEK_END);
+			std::int64_t const End = tell_file(File);
+			seek_file(File, 0, SEEK_SET);
+
+			if(End > 0 && static_cast<std::uint64_t>(End) <= static_cast<std::size_t>(-1))
+			{
+				this->Memory.resize(static_cast<std::size_t>(End));
+				if(std::fread(&this->Memory[0], 1, this->Memory.size(), File) == this->Memory.size())
+				{
+					this->Data = &this->Memory[0];
+					this->Size = this->Memory.size();
+				}
+				else
+					this->Memory.clear();
+			}
+			std::fclose(File);
+#		endif
+	}
+
+	inline mapped_file::~mapped_file()
+	{
+#		if defined(GLI_MAPPED_FILE_WINDOWS)
+			if(this->Data)
+				UnmapViewOfFile(this->Data);
+#		elif defined(GLI_MAPPED_FILE_POSIX)
+			if(this->Data)
+				::munmap(this->Data, this->Size);
+#		endif
+	}
+
+	inline bool mapped_file::empty() const
+	{
+		return this->Data == nullptr;
+	}
+
+	inline char* mapped_file::data() const
+	{
+		return this->Data;
+	}
+
+	inline std::size_t mapped_file::size() const
+	{
+		return this->Size;
+	}
 }//namespace detail
 }//namespace gli
@@ -0,0 +1,157 @@
+/// @brief Include to fill memory with a repeated block of data and to copy large memory ranges
+/// @file gli/core/fill.hpp
+///
+/// Define GLI_STREAM_THRESHOLD before including GLI to set the size in bytes from which fills and copies use non-temporal stores,
+/// which avoid evicting the cache content when clearing textures much larger than the cache.
+
+#pragma once
+
+#include "../type.hpp"
+#include "parallel.hpp"
+#include "simd.hpp"
+#include <cstring>
+
+#ifndef GLI_STREAM_THRESHOLD
+#	define GLI_STREAM_THRESHOLD (8 << 20)
+#endif
+
+namespace gli{
+namespace detail
+{
+	inline size_t fill_gcd(size_t A, size_t B)
+	{
+		while(B != 0)
+		{
+			size_t const R = A % B;
+			A = B;
+			B = R;
+		}
+		return A;
+	}
+
+	// Fill Size bytes by repeating Pattern, copying from the part of the destination already filled
+	inline void fill_scalar(glm::uint8* Dst, size_t Size, glm::uint8 const* Pattern, size_t PatternSize)
+	{
+		if(Size == 0)
+			return;
+
+		size_t Filled = PatternSize;
+		std::memcpy(Dst, Pattern, PatternSize);
+
+		// Double the filled part up to a few kilobytes then repeat it so that the copies read from the L1 cache
+		for(; Filled < Size && Filled < 4096; Filled *= 2)
+			std::memcpy(Dst + Filled, Dst, glm::min(Filled, Size - Filled));
+
+		for(size_t const Period = Filled; Filled < Size; Filled += Period)
+			std::memcpy(Dst + Filled, Dst, glm::min(Period, Size - Filled));
+	}
+
+	/// Fill Size bytes at Dst by repeating the PatternSize bytes of Pattern. Size must be a multiple of PatternSize.
+	/// Stream requests non-temporal stores, used when supported by the build.
+	inline void fill(glm::uint8* Dst, size_t Size, glm::uint8 const* Pattern, size_t PatternSize, bool Stream)
+	{
+		GLI_ASSERT(PatternSize > 0 && Size % PatternSize == 0);
+
+#		if defined(GLI_SIMD_SSE2)
+			// The pattern repeats every least common multiple of its size and of the vector size
+			size_t const PeriodSize = PatternSize / fill_gcd(PatternSize, 16) * 16;
+			size_t const HeadSize = (16 - reinterpret_cast<size_t>(Dst) % 16) % 16;
+			if(PeriodSize <= 256 && Size >= HeadSize + PeriodSize)
+			{
+				// Store the unaligned head, then build the period starting where the head stops
+				for(size_t Byte = 0; Byte < HeadSize; ++Byte)
+					Dst[Byte] = Pattern[Byte % PatternSize];
+
+				glm::uint8 Period[256];
+				for(size_t Byte = 0; Byte < PeriodSize; ++Byte)
+					Period[Byte] = Pattern[(HeadSize + Byte) % PatternSize];
+
+				__m128i Vectors[16];
+				size_t const VectorCount = PeriodSize / 16;
+				for(size_t VectorIndex = 0; VectorIndex < VectorCount; ++VectorIndex)
+					Vectors[VectorIndex] = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Period + VectorIndex * 16));
+
+				glm::uint8* Current = Dst + HeadSize;
+				glm::uint8* const End = Current + (Size - HeadSize) / PeriodSize * PeriodSize;
+				if(Stream)
+				{
+					for(; Current < End; Current += PeriodSize)
+					for(size_t VectorIndex = 0; VectorIndex < VectorCount; ++VectorIndex)
+						_mm_stream_si128(reinterpret_cast<__m128i*>(Current) + VectorIndex, Vectors[VectorIndex]);
+					_mm_sfence();
+				}
+				else
+				{
+					for(; Current < End; Current += PeriodSize)
+					for(size_t VectorIndex = 0; VectorIndex < VectorCount; ++VectorIndex)
+						_mm_store_si128(reinterpret_cast<__m128i*>(Current) + VectorIndex, Vectors[VectorIndex]);
+				}
+
+				// The tail starts at the same phase of the pattern as the vector stores
+				for(size_t Byte = 0, TailSize = static_cast<size_t>(Dst + Size - Current); Byte < TailSize; ++Byte)
+					Current[Byte] = Period[Byte];
+				return;
+			}
+#		endif//defined(GLI_SIMD_SSE2)
+
+		(void)Stream;
+		fill_scalar(Dst, Size, Pattern, PatternSize);
+	}
+
+	/// Fill Size bytes at Dst by repeating Pattern, splitting the work across threads
+	inline void fill_parallel(glm::uint8* Dst, size_t Size, glm::uint8 const* Pattern, size_t PatternSize)
+	{
+		bool const Stream = Size >= static_cast<size_t>(GLI_STREAM_THRESHOLD);
+
+		// Each range is a whole number of patterns of about 64KB
+		parallel_for(0, Size / PatternSize, glm::max<size_t>((1 << 16) / PatternSize, 1), [=](size_t RangeBegin, size_t RangeEnd)
+		{
+			fill(Dst + RangeBegin * PatternSize, (RangeEnd - RangeBegin) * PatternSize, Pattern, PatternSize, Stream);
+		});
+	}
+
+	/// Copy Size bytes from Src to Dst which must not overlap.
+	/// Stream requests non-temporal stores, used when supported by the build.
+	inline void copy_memory(glm::uint8* Dst, glm::uint8 const* Src, size_t Size, bool Stream)
+	{
+#		if defined(GLI_SIMD_SSE2)
+			size_t const HeadSize = (16 - reinterpret_cast<size_t>(Dst) % 16) % 16;
+			if(Stream && Size >= HeadSize + 64)
+			{
+				std::memcpy(Dst, Src, HeadSize);
+
+				size_t Offset = HeadSize;
+				for(size_t const End = HeadSize + (Size - HeadSize) / 64 * 64; Offset < End; Offset += 64)
+				{
+					__m128i const A = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + Offset) + 0);
+					__m128i const B = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + Offset) + 1);
+					__m128i const C = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + Offset) + 2);
+					__m128i const D = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + Offset) + 3);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(Dst + Offset) + 0, A);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(Dst + Offset) + 1, B);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(Dst + Offset) + 2, C);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(Dst + Offset) + 3, D);
+				}
+				_mm_sfence();
+
+				std::memcpy(Dst + Offset, Src + Offset, Size - Offset);
+				return;
+			}
+#		endif//defined(GLI_SIMD_SSE2)
+
+		(void)Stream;
+		std::memcpy(Dst, Src, Size);
+	}
+
+	/// Copy Size bytes from Src to Dst which must not overlap, splitting the work across threads
+	inline void copy_memory_parallel(glm::uint8* Dst, glm::uint8 const* Src, size_t Size)
+	{
+		bool const Stream = Size >= static_cast<size_t>(GLI_STREAM_THRESHOLD);
+
+		parallel_for(0, Size, 1 << 16, [=](size_t RangeBegin, size_t RangeEnd)
+		{
+			copy_memory(Dst + RangeBegin, Src + RangeBegin, RangeEnd - RangeBegin, Stream);
+		});
+	}
+}//namespace detail
+}//namespace gli
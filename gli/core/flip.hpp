@@ -9,9 +9,19 @@
 
 namespace gli
 {
+	/// Flip vertically a texture into a new texture.
+	/// Uncompressed, S3TC, BC4 and BC5 formats are flipped by permuting their blocks when the height of each level is a multiple of the block height or fits in a block.
+	/// Otherwise formats with a decoder and an encoder, see has_encoder, are decoded, flipped and encoded again, which loses some quality.
+	/// Returns an empty texture if the texture can't be flipped.
 	template <typename texture>
 	texture flip(texture const & Texture);
 
+	/// Flip vertically a texture without allocating a new texture storage, the formats supported are those of flip.
+	/// The texture storage is modified so every texture sharing it observes the flip.
+	/// Returns false, leaving the texture unchanged, if the texture can't be flipped.
+	template <typename texture>
+	bool flip_in_place(texture & Texture);
+
 }//namespace gli
 
 #include "flip.inl"
@@ -1,25 +1,33 @@
-#include "./s3tc.hpp"
+#include "../convert.hpp"
+#include "./bc.hpp"
+#include "./parallel.hpp"
 
 namespace gli{
 namespace detail
 {
-	inline void flip(image ImageDst, image ImageSrc, size_t BlockSize)
+	// Source row of the row Row of a flipped block which texels fill only the first Height rows, the other rows are left in place
+	inline int flip_block_row(int Row, int Height)
 	{
-		size_t const LineSize = BlockSize * ImageDst.extent().x;
+		return Row < Height ? Height - 1 - Row : Row;
+	}
 
-		for(int y = 0; y < ImageDst.extent().y; ++y)
-		{
-			size_t OffsetDst = LineSize * y;
-			size_t OffsetSrc = ImageSrc.size() - (LineSize * (y + 1));
+	// Flip the rows of a 4x4 block of 3 bits indices, used by the DXT5 alpha, BC4 and BC5 blocks
+	inline void flip_bitmap_3bits(uint8* BitmapDst, uint8 const* BitmapSrc, int Height)
+	{
+		glm::uint64 Src = 0;
+		for(int i = 0; i < 6; ++i)
+			Src |= static_cast<glm::uint64>(BitmapSrc[i]) << (i * 8);
 
-			memcpy(
-				ImageDst.data<gli::byte>() + OffsetDst,
-				ImageSrc.data<gli::byte>() + OffsetSrc,
-				LineSize);
-		}
+		glm::uint64 Dst = 0;
+		for(int Row = 0; Row < 4; ++Row)
+			Dst |= ((Src >> (flip_block_row(Row, Height) * 12)) & 0xFFF) << (Row * 12);
+
+		for(int i = 0; i < 6; ++i)
+			BitmapDst[i] = static_cast<uint8>(Dst >> (i * 8));
 	}
 
-	inline void flip_block_s3tc(uint8* BlockDst, uint8* BlockSrc, format Format, bool HeightTwo)
+	// Flip the first Height rows of texels of a block. BlockDst and BlockSrc must not overlap.
+	inline void flip_block(uint8* BlockDst, uint8 const* BlockSrc, format Format, int Height)
 	{
 		// There is no distinction between RGB and RGBA in DXT-compressed textures,
 		// it is used only to tell OpenGL how to interpret the data.
@@ -30,27 +38,13 @@ namespace detail
 		if(Format == FORMAT_RGB_DXT1_UNORM_BLOCK8 || Format == FORMAT_RGB_DXT1_SRGB_BLOCK8
 		|| Format == FORMAT_RGBA_DXT1_UNORM_BLOCK8 || Format == FORMAT_RGBA_DXT1_SRGB_BLOCK8)
 		{
-			dxt1_block* Src = reinterpret_cast<dxt1_block*>(BlockSrc);
+			dxt1_block const* Src = reinterpret_cast<dxt1_block const*>(BlockSrc);
 			dxt1_block* Dst = reinterpret_cast<dxt1_block*>(BlockDst);
 
-			if(HeightTwo)
-			{
-				Dst->Color0 = Src->Color0;
-				Dst->Color1 = Src->Color1;
-				Dst->Row[0] = Src->Row[1];
-				Dst->Row[1] = Src->Row[0];
-				Dst->Row[2] = Src->Row[2];
-				Dst->Row[3] = Src->Row[3];
-
-				return;
-			}
-
 			Dst->Color0 = Src->Color0;
 			Dst->Color1 = Src->Color1;
-			Dst->Row[0] = Src->Row[3];
-			Dst->Row[1] = Src->Row[2];
-			Dst->Row[2] = Src->Row[1];
-			Dst->Row[3] = Src->Row[0];
+			for(int Row = 0; Row < 4; ++Row)
+				Dst->Row[Row] = Src->Row[flip_block_row(Row, Height)];
 
 			return;
 		}
@@ -58,35 +52,16 @@ namespace detail
 		// DXT3
 		if(Format == FORMAT_RGBA_DXT3_UNORM_BLOCK16 || Format == FORMAT_RGBA_DXT3_SRGB_BLOCK16)
 		{
-			dxt3_block* Src = reinterpret_cast<dxt3_block*>(BlockSrc);
+			dxt3_block const* Src = reinterpret_cast<dxt3_block const*>(BlockSrc);
 			dxt3_block* Dst = reinterpret_cast<dxt3_block*>(BlockDst);
 
-			if(HeightTwo)
-			{
-				Dst->AlphaRow[0] = Src->AlphaRow[1];
-				Dst->AlphaRow[1] = Src->AlphaRow[0];
-				Dst->AlphaRow[2] = Src->AlphaRow[2];
-				Dst->AlphaRow[3] = Src->AlphaRow[3];
-				Dst->Color0 = Src->Color0;
-				Dst->Color1 = Src->Color1;
-				Dst->Row[0] = Src->Row[1];
-				Dst->Row[1] = Src->Row[0];
-				Dst->Row[2] = Src->Row[2];
-				Dst->Row[3] = Src->Row[3];
-
-				return;
-			}
-
-			Dst->AlphaRow[0] = Src->AlphaRow[3];
-			Dst->AlphaRow[1] = Src->AlphaRow[2];
-			Dst->AlphaRow[2] = Src->AlphaRow[1];
-			Dst->AlphaRow[3] = Src->AlphaRow[0];
 			Dst->Color0 = Src->Color0;
 			Dst->Color1 = Src->Color1;
-			Dst->Row[0] = Src->Row[3];
-			Dst->Row[1] = Src->Row[2];
-			Dst->Row[2] = Src->Row[1];
-			Dst->Row[3] = Src->Row[0];
+			for(int Row = 0; Row < 4; ++Row)
+			{
+				Dst->AlphaRow[Row] = Src->AlphaRow[flip_block_row(Row, Height)];
+				Dst->Row[Row] = Src->Row[flip_block_row(Row, Height)];
+			}
 
 			return;
 		}
@@ -94,49 +69,43 @@ namespace detail
 		// DXT5
 		if(Format == FORMAT_RGBA_DXT5_UNORM_BLOCK16 || Format == FORMAT_RGBA_DXT5_SRGB_BLOCK16)
 		{
-			dxt5_block* Src = reinterpret_cast<dxt5_block*>(BlockSrc);
+			dxt5_block const* Src = reinterpret_cast<dxt5_block const*>(BlockSrc);
 			dxt5_block* Dst = reinterpret_cast<dxt5_block*>(BlockDst);
 
-			if(HeightTwo)
-			{
-				Dst->Alpha[0] = Src->Alpha[0];
-				Dst->Alpha[1] = Src->Alpha[1];
-				// operator+ has precedence over operator>> and operator<<, hence the parentheses. very important!
-				// the values below are bitmasks used to retrieve alpha values according to the DXT specification
-				// 0xF0 == 0b11110000 and 0xF == 0b1111
-				Dst->AlphaBitmap[0] = ((Src->AlphaBitmap[1] & 0xF0) >> 4) + ((Src->AlphaBitmap[2] & 0xF) << 4);
-				Dst->AlphaBitmap[1] = ((Src->AlphaBitmap[2] & 0xF0) >> 4) + ((Src->AlphaBitmap[0] & 0xF) << 4);
-				Dst->AlphaBitmap[2] = ((Src->AlphaBitmap[0] & 0xF0) >> 4) + ((Src->AlphaBitmap[1] & 0xF) << 4);
-				Dst->AlphaBitmap[3] = Src->AlphaBitmap[3];
-				Dst->AlphaBitmap[4] = Src->AlphaBitmap[4];
-				Dst->AlphaBitmap[5] = Src->AlphaBitmap[5];
-				Dst->Color0 = Src->Color0;
-				Dst->Color1 = Src->Color1;
-				Dst->Row[0] = Src->Row[1];
-				Dst->Row[1] = Src->Row[0];
-				Dst->Row[2] = Src->Row[2];
-				Dst->Row[3] = Src->Row[3];
-
-				return;
-			}
-
 			Dst->Alpha[0] = Src->Alpha[0];
 			Dst->Alpha[1] = Src->Alpha[1];
-			// operator+ has precedence over operator>> and operator<<, hence the parentheses. very important!
-			// the values below are bitmasks used to retrieve alpha values according to the DXT specification
-			// 0xF0 == 0b11110000 and 0xF == 0b1111
-			Dst->AlphaBitmap[0] = ((Src->AlphaBitmap[4] & 0xF0) >> 4) + ((Src->AlphaBitmap[5] & 0xF) << 4);
-			Dst->AlphaBitmap[1] = ((Src->AlphaBitmap[5] & 0xF0) >> 4) + ((Src->AlphaBitmap[3] & 0xF) << 4);
-			Dst->AlphaBitmap[2] = ((Src->AlphaBitmap[3] & 0xF0) >> 4) + ((Src->AlphaBitmap[4] & 0xF) << 4);
-			Dst->AlphaBitmap[3] = ((Src->AlphaBitmap[1] & 0xF0) >> 4) + ((Src->AlphaBitmap[2] & 0xF) << 4);
-			Dst->AlphaBitmap[4] = ((Src->AlphaBitmap[2] & 0xF0) >> 4) + ((Src->AlphaBitmap[0] & 0xF) << 4);
-			Dst->AlphaBitmap[5] = ((Src->AlphaBitmap[0] & 0xF0) >> 4) + ((Src->AlphaBitmap[1] & 0xF) << 4);
+			flip_bitmap_3bits(Dst->AlphaBitmap, Src->AlphaBitmap, Height);
 			Dst->Color0 = Src->Color0;
 			Dst->Color1 = Src->Color1;
-			Dst->Row[0] = Src->Row[3];
-			Dst->Row[1] = Src->Row[2];
-			Dst->Row[2] = Src->Row[1];
-			Dst->Row[3] = Src->Row[0];
+			for(int Row = 0; Row < 4; ++Row)
+				Dst->Row[Row] = Src->Row[flip_block_row(Row, Height)];
+
+			return;
+		}
+
+		if(Format == FORMAT_R_ATI1N_UNORM_BLOCK8 || Format == FORMAT_R_ATI1N_SNORM_BLOCK8)
+		{
+			bc4_block const* Src = reinterpret_cast<bc4_block const*>(BlockSrc);
+			bc4_block* Dst = reinterpret_cast<bc4_block*>(BlockDst);
+
+			Dst->Red0 = Src->Red0;
+			Dst->Red1 = Src->Red1;
+			flip_bitmap_3bits(Dst->Bitmap, Src->Bitmap, Height);
+
+			return;
+		}
+
+		if(Format == FORMAT_RG_ATI2N_UNORM_BLOCK16 || Format == FORMAT_RG_ATI2N_SNORM_BLOCK16)
+		{
+			bc5_block const* Src = reinterpret_cast<bc5_block const*>(BlockSrc);
+			bc5_block* Dst = reinterpret_cast<bc5_block*>(BlockDst);
+
+			Dst->Red0 = Src->Red0;
+			Dst->Red1 = Src->Red1;
+			flip_bitmap_3bits(Dst->RedBitmap, Src->RedBitmap, Height);
+			Dst->Green0 = Src->Green0;
+			Dst->Green1 = Src->Green1;
+			flip_bitmap_3bits(Dst->GreenBitmap, Src->GreenBitmap, Height);
 
 			return;
 		}
@@ -145,31 +114,174 @@ namespace detail
 		assert(false);
 	}
 
-	inline void flip_s3tc(image ImageDst, image ImageSrc, format Format)
+	// Formats which blocks can be flipped by permuting their rows without decoding them
+	inline bool is_block_flippable(format Format)
+	{
+		return !is_compressed(Format) || is_s3tc_compressed(Format)
+			|| (Format >= FORMAT_R_ATI1N_UNORM_BLOCK8 && Format <= FORMAT_RG_ATI2N_SNORM_BLOCK16);
+	}
+
+	// Whether an image can be flipped by permuting its rows of blocks and the rows of texels inside each block.
+	// When the texels don't fill the last row of blocks, the rows of texels would have to move across blocks.
+	inline bool is_block_flippable(format Format, extent2d const& Extent)
 	{
-		if(ImageSrc.extent().y == 1)
+		int const BlockHeight = block_extent(Format).y;
+		return is_block_flippable(Format) && (Extent.y <= BlockHeight || Extent.y % BlockHeight == 0);
+	}
+
+	// Copy a row of blocks, flipping the first Height rows of texels of each block when the format is compressed. RowDst and RowSrc must not overlap.
+	inline void flip_row(uint8* RowDst, uint8 const* RowSrc, size_t BlockCount, size_t BlockSize, format Format, int Height)
+	{
+		if(!is_compressed(Format))
 		{
-			memcpy(ImageDst.data(),
-				   ImageSrc.data(),
-				   ImageSrc.size());
+			memcpy(RowDst, RowSrc, BlockCount * BlockSize);
 			return;
 		}
 
-		std::size_t const XBlocks = ImageSrc.extent().x <= 4 ? 1 : ImageSrc.extent().x / 4;
-		if(ImageSrc.extent().y == 2)
-		{
-			for(std::size_t i_block = 0; i_block < XBlocks; ++i_block)
-				flip_block_s3tc(ImageDst.data<uint8>() + i_block * block_size(Format), ImageSrc.data<uint8>() + i_block * block_size(Format), Format, true);
+		for(size_t BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
+			flip_block(RowDst + BlockIndex * BlockSize, RowSrc + BlockIndex * BlockSize, Format, Height);
+	}
+
+	// Part of the rows of an image to flip by permuting its blocks
+	struct flip_task
+	{
+		uint8* ImageDst;
+		uint8 const* ImageSrc;
+		extent2d Extent;
+		size_t PairBegin;
+		size_t PairEnd;
+	};
+
+	// Flip vertically the pairs of rows of blocks [PairBegin, PairEnd) of a two dimensional image, the first pair being the first and the last rows.
+	// ImageDst and ImageSrc may point to the same memory to flip the image in place, in which case each pair of rows is swapped through a bounce buffer of one row.
+	inline void flip_rows(flip_task const& Task, format Format, std::vector<uint8>& Bounce)
+	{
+		GLI_ASSERT(is_block_flippable(Format, Task.Extent));
+
+		extent2d const BlockExtent(block_extent(Format));
+		extent2d const BlockCount((Task.Extent + BlockExtent - 1) / BlockExtent);
+		size_t const BlockSize = block_size(Format);
+		size_t const RowSize = BlockSize * BlockCount.x;
+		size_t const RowCount = BlockCount.y;
+		bool const InPlace = Task.ImageDst == Task.ImageSrc;
+		int const Height = BlockExtent.y;
 
+		if(InPlace)
+			Bounce.resize(RowSize);
+
+		// The texels of a single row of compressed blocks are flipped inside each block
+		if(RowCount == 1)
+		{
+			if(InPlace)
+				memcpy(&Bounce[0], Task.ImageSrc, RowSize);
+			flip_row(Task.ImageDst, InPlace ? &Bounce[0] : Task.ImageSrc, BlockCount.x, BlockSize, Format, Task.Extent.y);
 			return;
 		}
 
-		std::size_t const MaxYBlock = ImageSrc.extent().y / 4 - 1;
-		for(std::size_t i_row = 0; i_row <= MaxYBlock; ++i_row)
-			for(std::size_t i_block = 0; i_block < XBlocks; ++i_block)
-				flip_block_s3tc(ImageDst.data<uint8>() + (MaxYBlock - i_row) * block_size(Format) * XBlocks + i_block * block_size(Format), ImageSrc.data<uint8>() + i_row * block_size(Format) * XBlocks + i_block * block_size(Format), Format, false);
+		for(size_t RowA = Task.PairBegin; RowA < Task.PairEnd; ++RowA)
+		{
+			size_t const RowB = RowCount - RowA - 1;
+			uint8* const DstA = Task.ImageDst + RowA * RowSize;
+			uint8* const DstB = Task.ImageDst + RowB * RowSize;
+			uint8 const* const SrcA = Task.ImageSrc + RowA * RowSize;
+			uint8 const* const SrcB = Task.ImageSrc + RowB * RowSize;
+
+			if(!InPlace)
+			{
+				flip_row(DstA, SrcB, BlockCount.x, BlockSize, Format, Height);
+				if(RowA != RowB)
+					flip_row(DstB, SrcA, BlockCount.x, BlockSize, Format, Height);
+			}
+			else if(RowA == RowB)
+			{
+				if(is_compressed(Format))
+				{
+					memcpy(&Bounce[0], SrcA, RowSize);
+					flip_row(DstA, &Bounce[0], BlockCount.x, BlockSize, Format, Height);
+				}
+			}
+			else
+			{
+				flip_row(&Bounce[0], SrcA, BlockCount.x, BlockSize, Format, Height);
+				flip_row(DstA, SrcB, BlockCount.x, BlockSize, Format, Height);
+				memcpy(DstB, &Bounce[0], RowSize);
+			}
+		}
+	}
+
+	// Flip an image of a format that has a decoder and an encoder: the image is decoded, flipped and encoded again, which loses some quality.
+	inline void flip_image_encoded(uint8* ImageDst, uint8 const* ImageSrc, extent2d const& Extent, format Format)
+	{
+		texture2d Encoded(Format, texture2d::extent_type(Extent), 1);
+		memcpy(Encoded.data(), ImageSrc, Encoded.size());
+
+		texture2d Decoded(gli::convert(Encoded, FORMAT_RGBA32_SFLOAT_PACK32));
+		std::vector<uint8> Bounce;
+		flip_task const Task = {Decoded.data<uint8>(), Decoded.data<uint8>(), Extent, 0, (static_cast<size_t>(Extent.y) + 1) / 2};
+		flip_rows(Task, FORMAT_RGBA32_SFLOAT_PACK32, Bounce);
+
+		Encoded = gli::convert(Decoded, Format);
+		memcpy(ImageDst, Encoded.data(), Encoded.size());
 	}
 
+	// Flip each image of TextureSrc into TextureDst, which can be TextureSrc itself to flip in place.
+	// Returns false, leaving TextureDst unchanged, if the images can't be flipped by permuting their blocks and the format has no encoder.
+	inline bool flip_texture(texture& TextureDst, texture const& TextureSrc)
+	{
+		GLI_ASSERT(TextureDst.format() == TextureSrc.format());
+		GLI_ASSERT(TextureDst.layers() == TextureSrc.layers() && TextureDst.faces() == TextureSrc.faces() && TextureDst.levels() == TextureSrc.levels());
+
+		format const Format = TextureSrc.format();
+
+		bool BlockFlippable = true;
+		for(texture::size_type Level = 0; Level < TextureSrc.levels(); ++Level)
+			BlockFlippable = BlockFlippable && is_block_flippable(Format, extent2d(TextureSrc.extent(Level)));
+
+		if(!BlockFlippable)
+		{
+			if(!has_decoder(Format) || !has_encoder(Format))
+				return false;
+
+			// The encoder already splits each image across threads
+			for(texture::size_type Layer = 0; Layer < TextureSrc.layers(); ++Layer)
+			for(texture::size_type Face = 0; Face < TextureSrc.faces(); ++Face)
+			for(texture::size_type Level = 0; Level < TextureSrc.levels(); ++Level)
+				flip_image_encoded(TextureDst.data<uint8>(Layer, Face, Level), TextureSrc.data<uint8>(Layer, Face, Level), extent2d(TextureSrc.extent(Level)), Format);
+
+			return true;
+		}
+
+		// The rows of all the images are split in tasks of about 64 KB, run at once so that small images and levels are flipped in parallel too
+		extent2d const BlockExtent(block_extent(Format));
+		std::vector<flip_task> Tasks;
+		for(texture::size_type Layer = 0; Layer < TextureSrc.layers(); ++Layer)
+		for(texture::size_type Face = 0; Face < TextureSrc.faces(); ++Face)
+		for(texture::size_type Level = 0; Level < TextureSrc.levels(); ++Level)
+		{
+			extent2d const Extent(TextureSrc.extent(Level));
+			extent2d const BlockCount((Extent + BlockExtent - 1) / BlockExtent);
+			size_t const RowSize = block_size(Format) * BlockCount.x;
+			size_t const PairCount = (static_cast<size_t>(BlockCount.y) + 1) / 2;
+			size_t const Grain = std::max<size_t>(size_t(1) << 16, RowSize) / RowSize;
+
+			for(size_t PairBegin = 0; PairBegin < PairCount; PairBegin += Grain)
+			{
+				flip_task const Task = {
+					TextureDst.data<uint8>(Layer, Face, Level), TextureSrc.data<uint8>(Layer, Face, Level),
+					Extent, PairBegin, std::min(PairBegin + Grain, PairCount)};
+				Tasks.push_back(Task);
+			}
+		}
+
+		detail::parallel_for(0, Tasks.size(), 1, [&](size_t TaskBegin, size_t TaskEnd)
+		{
+			std::vector<uint8> Bounce;
+			for(size_t TaskIndex = TaskBegin; TaskIndex < TaskEnd; ++TaskIndex)
+				flip_rows(Tasks[TaskIndex], Format, Bounce);
+		});
+
+		return true;
+	}
 }//namespace detail
 
 /*
@@ -183,20 +295,9 @@ inline image flip(image const & Image)
 template <>
 inline texture2d flip(texture2d const& Texture)
 {
-	GLI_ASSERT(!gli::is_compressed(Texture.format()) || gli::is_s3tc_compressed(Texture.format()));
-
 	texture2d Flip(Texture.format(), Texture.extent(), Texture.levels());
-
-	if(!is_compressed(Texture.format()))
-	{
-		texture2d::size_type const BlockSize = block_size(Texture.format());
-
-		for(texture2d::size_type Level = 0; Level < Flip.levels(); ++Level)
-			detail::flip(Flip[Level], Texture[Level], BlockSize);
-	}
-	else
-		for(texture2d::size_type Level = 0; Level < Flip.levels(); ++Level)
-			detail::flip_s3tc(Flip[Level], Texture[Level], Texture.format());
+	if(!detail::flip_texture(Flip, Texture))
+		return texture2d();
 
 	return Flip;
 }
@@ -204,22 +305,9 @@ inline texture2d flip(texture2d const& Texture)
 template <>
 inline texture2d_array flip(texture2d_array const& Texture)
 {
-	GLI_ASSERT(!gli::is_compressed(Texture.format()) || gli::is_s3tc_compressed(Texture.format()));
-
 	texture2d_array Flip(Texture.format(), Texture.extent(), Texture.layers(), Texture.levels());
-
-	if(!gli::is_compressed(Texture.format()))
-	{
-		texture2d_array::size_type const BlockSize = block_size(Texture.format());
-
-		for(texture2d_array::size_type Layer = 0; Layer < Flip.layers(); ++Layer)
-		for(texture2d_array::size_type Level = 0; Level < Flip.levels(); ++Level)
-			detail::flip(Flip[Layer][Level], Texture[Layer][Level], BlockSize);
-	}
-	else
-		for(texture2d_array::size_type Layer = 0; Layer < Flip.layers(); ++Layer)
-		for(texture2d_array::size_type Level = 0; Level < Flip.levels(); ++Level)
-			detail::flip_s3tc(Flip[Layer][Level], Texture[Layer][Level], Texture.format());
+	if(!detail::flip_texture(Flip, Texture))
+		return texture2d_array();
 
 	return Flip;
 }
@@ -227,22 +315,9 @@ inline texture2d_array flip(texture2d_array const& Texture)
 template <>
 inline texture_cube flip(texture_cube const & Texture)
 {
-	GLI_ASSERT(!gli::is_compressed(Texture.format()) || gli::is_s3tc_compressed(Texture.format()));
-
 	texture_cube Flip(Texture.format(), Texture.extent(), Texture.levels());
-
-	if(!gli::is_compressed(Texture.format()))
-	{
-		texture_cube::size_type const BlockSize = block_size(Texture.format());
-
-		for(texture_cube::size_type Face = 0; Face < Flip.faces(); ++Face)
-		for(texture_cube::size_type Level = 0; Level < Flip.levels(); ++Level)
-			detail::flip(Flip[Face][Level], Texture[Face][Level], BlockSize);
-	}
-	else
-		for(texture_cube::size_type Face = 0; Face < Flip.faces(); ++Face)
-		for(texture_cube::size_type Level = 0; Level < Flip.levels(); ++Level)
-			detail::flip_s3tc(Flip[Face][Level], Texture[Face][Level], Texture.format());
+	if(!detail::flip_texture(Flip, Texture))
+		return texture_cube();
 
 	return Flip;
 }
@@ -250,24 +325,9 @@ inline texture_cube flip(texture_cube const & Texture)
 template <>
 inline texture_cube_array flip(texture_cube_array const & Texture)
 {
-	assert(!is_compressed(Texture.format()) || is_s3tc_compressed(Texture.format()));
-
 	texture_cube_array Flip(Texture.format(), Texture.extent(), Texture.layers(), Texture.levels());
-
-	if(!is_compressed(Texture.format()))
-	{
-		gli::size_t const BlockSize = block_size(Texture.format());
-
-		for(std::size_t Layer = 0; Layer < Flip.layers(); ++Layer)
-		for(std::size_t Face = 0; Face < Flip.faces(); ++Face)
-		for(std::size_t Level = 0; Level < Flip.levels(); ++Level)
-			detail::flip(Flip[Layer][Face][Level], Texture[Layer][Face][Level], BlockSize);
-	}
-	else
-		for(std::size_t Layer = 0; Layer < Flip.layers(); ++Layer)
-		for(std::size_t Face = 0; Face < Flip.faces(); ++Face)
-		for(std::size_t Level = 0; Level < Flip.levels(); ++Level)
-			detail::flip_s3tc(Flip[Layer][Face][Level], Texture[Layer][Face][Level], Texture.format());
+	if(!detail::flip_texture(Flip, Texture))
+		return texture_cube_array();
 
 	return Flip;
 }
@@ -295,4 +355,15 @@ inline texture flip(texture const & Texture)
 	}
 }
 
+template <typename texture_type>
+inline bool flip_in_place(texture_type& Texture)
+{
+	GLI_ASSERT(
+		Texture.target() == TARGET_2D || Texture.target() == TARGET_2D_ARRAY ||
+		Texture.target() == TARGET_RECT || Texture.target() == TARGET_RECT_ARRAY ||
+		Texture.target() == TARGET_CUBE || Texture.target() == TARGET_CUBE_ARRAY);
+
+	return detail::flip_texture(Texture, Texture);
+}
+
 }//namespace gli
@@ -5,6 +5,7 @@
 #include "../sampler3d.hpp"
 #include "../sampler_cube.hpp"
 #include "../sampler_cube_array.hpp"
+#include "../duplicate.hpp"
 
 namespace gli
 {
@@ -124,4 +125,71 @@ namespace gli
 	{
 		return generate_mipmaps(Texture, Texture.base_layer(), Texture.max_layer(), Texture.base_face(), Texture.max_face(), Texture.base_level(), Texture.max_level(), Minification);
 	}
+
+namespace detail
+{
+	// Generate a level of every layer and face from the previous level
+	inline void generate_mipmap_level(texture1d& Texture, texture1d::size_type Level, filter Minification)
+	{
+		Texture = generate_mipmaps(Texture, Level - 1, Level, Minification);
+	}
+
+	inline void generate_mipmap_level(texture1d_array& Texture, texture1d_array::size_type Level, filter Minification)
+	{
+		Texture = generate_mipmaps(Texture, Texture.base_layer(), Texture.max_layer(), Level - 1, Level, Minification);
+	}
+
+	inline void generate_mipmap_level(texture2d& Texture, texture2d::size_type Level, filter Minification)
+	{
+		Texture = generate_mipmaps(Texture, Level - 1, Level, Minification);
+	}
+
+	inline void generate_mipmap_level(texture2d_array& Texture, texture2d_array::size_type Level, filter Minification)
+	{
+		Texture = generate_mipmaps(Texture, Texture.base_layer(), Texture.max_layer(), Level - 1, Level, Minification);
+	}
+
+	inline void generate_mipmap_level(texture3d& Texture, texture3d::size_type Level, filter Minification)
+	{
+		Texture = generate_mipmaps(Texture, Level - 1, Level, Minification);
+	}
+
+	inline void generate_mipmap_level(texture_cube& Texture, texture_cube::size_type Level, filter Minification)
+	{
+		Texture = generate_mipmaps(Texture, Texture.base_face(), Texture.max_face(), Level - 1, Level, Minification);
+	}
+
+	inline void generate_mipmap_level(texture_cube_array& Texture, texture_cube_array::size_type Level, filter Minification)
+	{
+		Texture = generate_mipmaps(Texture, Texture.base_layer(), Texture.max_layer(), Texture.base_face(), Texture.max_face(), Level - 1, Level, Minification);
+	}
+}//namespace detail
+
+	template <typename texture_type>
+	inline texture_type generate_mipmaps(texture_type const& Texture, filter Minification, format Format, encode_preset Preset)
+	{
+		typedef typename texture_type::size_type size_type;
+		typedef typename detail::convert<texture_type, float, defaultp>::fetchFunc fetch_type;
+
+		GLI_ASSERT(!Texture.empty());
+		GLI_ASSERT(!is_compressed(Texture.format()));
+		GLI_ASSERT(has_encoder(Format));
+
+		texture_type Mipmaps(duplicate(Texture));
+		fetch_type const Fetch = detail::convert<texture_type, float, defaultp>::call(Mipmaps.format()).Fetch;
+
+		texture Storage(Mipmaps.target(), Format, Mipmaps.texture::extent(), Mipmaps.layers(), Mipmaps.faces(), Mipmaps.levels(), Mipmaps.swizzles());
+
+		for(size_type Level = Mipmaps.base_level(); Level <= Mipmaps.max_level(); ++Level)
+		{
+			if(Level > Mipmaps.base_level())
+				detail::generate_mipmap_level(Mipmaps, Level, Minification);
+
+			for(size_type Layer = 0; Layer < Mipmaps.layers(); ++Layer)
+			for(size_type Face = 0; Face < Mipmaps.faces(); ++Face)
+				detail::encode_level(Mipmaps, Fetch, Storage, Layer, Face, Level, Preset);
+		}
+
+		return texture_type(Storage);
+	}
 }//namespace gli
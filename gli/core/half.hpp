@@ -0,0 +1,159 @@
+/// @brief Include to convert spans of half floats to and from floats
+/// @file gli/core/half.hpp
+///
+/// The spans are converted 8 at a time with F16C when the build enables it, 4 at a time with SSE2 otherwise.
+/// Every path rounds to nearest even, keeps denormals and infinities and makes NaNs quiet, giving the same results as F16C.
+
+#pragma once
+
+#include "../type.hpp"
+#include "simd.hpp"
+#include <cstring>
+
+// F16C is implied by AVX2, MSVC doesn't define __F16C__ but defines __AVX2__ with /arch:AVX2
+#if !defined(GLM_FORCE_PURE) && (defined(__F16C__) || defined(__AVX2__) || (GLM_ARCH & GLM_ARCH_AVX2_BIT))
+#	include <immintrin.h>
+#	define GLI_HALF_F16C
+#endif
+
+namespace gli{
+namespace detail
+{
+	inline glm::uint32 half_float_bits(float Value)
+	{
+		glm::uint32 Bits;
+		std::memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	inline float half_bits_float(glm::uint32 Bits)
+	{
+		float Value;
+		std::memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	inline float unpack_half_scalar(glm::uint16 Half)
+	{
+		glm::uint32 const Shifted = static_cast<glm::uint32>(Half & 0x7fff) << 13;
+		glm::uint32 const Exponent = Shifted & (0x1f << 23);
+		glm::uint32 Bits = Shifted + ((127 - 15) << 23);
+
+		// Infinities and NaNs, made quiet
+		if(Exponent == (0x1f << 23))
+			Bits = (Bits + ((128 - 16) << 23)) | (Shifted > (0x1f << 23) ? 0x00400000 : 0);
+		else if(Exponent == 0)
+			// Denormals are renormalized by the float subtraction
+			Bits = half_float_bits(half_bits_float(Bits + (1 << 23)) - half_bits_float(113 << 23));
+
+		return half_bits_float(Bits | (static_cast<glm::uint32>(Half & 0x8000) << 16));
+	}
+
+	inline glm::uint16 pack_half_scalar(float Value)
+	{
+		glm::uint32 Bits = half_float_bits(Value);
+		glm::uint32 const Sign = Bits & 0x80000000u;
+		Bits ^= Sign;
+
+		glm::uint32 Half;
+		if(Bits >= (143u << 23))
+			// Infinity when the value is too large, NaN keeping the upper bits of the payload and quiet
+			Half = Bits > 0x7f800000u ? 0x7e00 | ((Bits >> 13) & 0x3ff) : 0x7c00;
+		else if(Bits < (113u << 23))
+			// Denormals and zeros, the float addition rounds the mantissa
+			Half = half_float_bits(half_bits_float(Bits) + half_bits_float(126u << 23)) - (126u << 23);
+		else
+			// Rebias the exponent and round the mantissa to nearest even
+			Half = (Bits + ((15u - 127u) << 23) + 0xfff + ((Bits >> 13) & 1)) >> 13;
+
+		return static_cast<glm::uint16>(Half | (Sign >> 16));
+	}
+
+#	if defined(GLI_SIMD_SSE2)
+		// Convert the 4 half floats in the low 16 bits of each 32 bits lane
+		inline __m128 unpack_half_sse2(__m128i Half)
+		{
+			__m128i const ExponentMantissa = _mm_and_si128(Half, _mm_set1_epi32(0x7fff));
+			__m128i const Sign = _mm_slli_epi32(_mm_xor_si128(Half, ExponentMantissa), 16);
+
+			// Scaling by 2^112 rebiases the exponent and renormalizes the denormals
+			__m128 const Scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(ExponentMantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+			__m128i const InfNaN = _mm_or_si128(
+				_mm_and_si128(_mm_cmpgt_epi32(ExponentMantissa, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(255 << 23)),
+				_mm_and_si128(_mm_cmpgt_epi32(ExponentMantissa, _mm_set1_epi32(0x7c00)), _mm_set1_epi32(0x00400000)));
+
+			return _mm_or_ps(Scaled, _mm_castsi128_ps(_mm_or_si128(Sign, InfNaN)));
+		}
+
+		// Convert 4 floats to half floats in the low 16 bits of each 32 bits lane, sign extended
+		inline __m128i pack_half_sse2(__m128 Value)
+		{
+			__m128 const SignMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+			__m128 const Sign = _mm_and_ps(Value, SignMask);
+			__m128 const Abs = _mm_xor_ps(Value, Sign);
+			__m128i const Bits = _mm_castps_si128(Abs);
+
+			__m128i const NaN = _mm_castps_si128(_mm_cmpunord_ps(Abs, Abs));
+			__m128i const NaNMantissa = _mm_and_si128(NaN, _mm_or_si128(_mm_set1_epi32(0x200), _mm_and_si128(_mm_srli_epi32(Bits, 13), _mm_set1_epi32(0x3ff))));
+			__m128i const InfNaN = _mm_or_si128(_mm_set1_epi32(0x7c00), NaNMantissa);
+
+			__m128i const Regular = _mm_cmpgt_epi32(_mm_set1_epi32(143 << 23), Bits);
+			__m128i const Denormal = _mm_cmpgt_epi32(_mm_set1_epi32(113 << 23), Bits);
+
+			__m128i const DenormalHalf = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(Abs, _mm_castsi128_ps(_mm_set1_epi32(126 << 23)))), _mm_set1_epi32(126 << 23));
+			__m128i const Odd = _mm_and_si128(_mm_srli_epi32(Bits, 13), _mm_set1_epi32(1));
+			__m128i const NormalHalf = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(Bits, _mm_set1_epi32(static_cast<int>(((15u - 127u) << 23) + 0xfff))), Odd), 13);
+
+			__m128i const Finite = _mm_or_si128(_mm_and_si128(Denormal, DenormalHalf), _mm_andnot_si128(Denormal, NormalHalf));
+			__m128i const Half = _mm_or_si128(_mm_and_si128(Regular, Finite), _mm_andnot_si128(Regular, InfNaN));
+
+			// The arithmetic shift keeps the lanes in the int16 range for the saturating pack
+			return _mm_or_si128(Half, _mm_srai_epi32(_mm_castps_si128(Sign), 16));
+		}
+#	endif//defined(GLI_SIMD_SSE2)
+
+	/// Convert Count half floats at Src to floats at Dst
+	inline void unpack_half_span(glm::uint16 const* Src, float* Dst, size_t Count)
+	{
+		size_t Index = 0;
+
+#		if defined(GLI_HALF_F16C)
+			for(; Index + 8 <= Count; Index += 8)
+				_mm256_storeu_ps(Dst + Index, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + Index))));
+			for(; Index + 4 <= Count; Index += 4)
+				_mm_storeu_ps(Dst + Index, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(Src + Index))));
+#		elif defined(GLI_SIMD_SSE2)
+			for(; Index + 4 <= Count; Index += 4)
+			{
+				__m128i const Half = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(Src + Index)), _mm_setzero_si128());
+				_mm_storeu_ps(Dst + Index, unpack_half_sse2(Half));
+			}
+#		endif
+
+		for(; Index < Count; ++Index)
+			Dst[Index] = unpack_half_scalar(Src[Index]);
+	}
+
+	/// Convert Count floats at Src to half floats at Dst
+	inline void pack_half_span(float const* Src, glm::uint16* Dst, size_t Count)
+	{
+		size_t Index = 0;
+
+#		if defined(GLI_HALF_F16C)
+			for(; Index + 8 <= Count; Index += 8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + Index), _mm256_cvtps_ph(_mm256_loadu_ps(Src + Index), _MM_FROUND_TO_NEAREST_INT));
+			for(; Index + 4 <= Count; Index += 4)
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(Dst + Index), _mm_cvtps_ph(_mm_loadu_ps(Src + Index), _MM_FROUND_TO_NEAREST_INT));
+#		elif defined(GLI_SIMD_SSE2)
+			for(; Index + 4 <= Count; Index += 4)
+			{
+				__m128i const Half = pack_half_sse2(_mm_loadu_ps(Src + Index));
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(Dst + Index), _mm_packs_epi32(Half, Half));
+			}
+#		endif
+
+		for(; Index < Count; ++Index)
+			Dst[Index] = pack_half_scalar(Src[Index]);
+	}
+}//namespace detail
+}//namespace gli
@@ -0,0 +1,239 @@
+#include <cstring>
+#include <vector>
+
+namespace gli{
+namespace detail
+{
+	static glm::uint64 const HASH_PRIME1 = 11400714785074694791ULL;
+	static glm::uint64 const HASH_PRIME2 = 14029467366897019727ULL;
+	static glm::uint64 const HASH_PRIME3 = 1609587929392839161ULL;
+	static glm::uint64 const HASH_PRIME4 = 9650029242287828579ULL;
+	static glm::uint64 const HASH_PRIME5 = 2870177450012600261ULL;
+
+	GLI_FORCE_INLINE glm::uint64 hash_rotl(glm::uint64 Value, int Shift)
+	{
+		return (Value << Shift) | (Value >> (64 - Shift));
+	}
+
+	GLI_FORCE_INLINE glm::uint64 hash_read64(glm::uint8 const* Data)
+	{
+		glm::uint64 Value;
+		std::memcpy(&Value, Data, sizeof(Value));
+		return Value;
+	}
+
+	GLI_FORCE_INLINE glm::uint32 hash_read32(glm::uint8 const* Data)
+	{
+		glm::uint32 Value;
+		std::memcpy(&Value, Data, sizeof(Value));
+		return Value;
+	}
+
+	GLI_FORCE_INLINE glm::uint64 hash_round(glm::uint64 Lane, glm::uint64 Input)
+	{
+		Lane += Input * HASH_PRIME2;
+		Lane = hash_rotl(Lane, 31);
+		return Lane * HASH_PRIME1;
+	}
+
+	GLI_FORCE_INLINE glm::uint64 hash_merge(glm::uint64 Hash, glm::uint64 Lane)
+	{
+		Hash ^= hash_round(0, Lane);
+		return Hash * HASH_PRIME1 + HASH_PRIME4;
+	}
+
+	inline hasher::hasher(glm::uint64 Seed)
+		: Seed(Seed)
+		, TotalSize(0)
+		, BufferSize(0)
+	{
+		this->Lanes[0] = Seed + HASH_PRIME1 + HASH_PRIME2;
+		this->Lanes[1] = Seed + HASH_PRIME2;
+		this->Lanes[2] = Seed;
+		this->Lanes[3] = Seed - HASH_PRIME1;
+	}
+
+	inline void hasher::update(void const* Data, size_t Size)
+	{
+		glm::uint8 const* Input = static_cast<glm::uint8 const*>(Data);
+		this->TotalSize += Size;
+
+		// Complete a stripe left over by the previous update
+		if(this->BufferSize > 0)
+		{
+			size_t const CopySize = glm::min(Size, sizeof(this->Buffer) - this->BufferSize);
+			std::memcpy(this->Buffer + this->BufferSize, Input, CopySize);
+			this->BufferSize += CopySize;
+			Input += CopySize;
+			Size -= CopySize;
+
+			if(this->BufferSize < sizeof(this->Buffer))
+				return;
+
+			for(int LaneIndex = 0; LaneIndex < 4; ++LaneIndex)
+				this->Lanes[LaneIndex] = hash_round(this->Lanes[LaneIndex], hash_read64(this->Buffer + LaneIndex * 8));
+			this->BufferSize = 0;
+		}
+
+		// The four lanes are independent which lets the compiler interleave the multiplications
+		glm::uint64 Lane0 = this->Lanes[0];
+		glm::uint64 Lane1 = this->Lanes[1];
+		glm::uint64 Lane2 = this->Lanes[2];
+		glm::uint64 Lane3 = this->Lanes[3];
+		for(; Size >= 32; Input += 32, Size -= 32)
+		{
+			Lane0 = hash_round(Lane0, hash_read64(Input + 0));
+			Lane1 = hash_round(Lane1, hash_read64(Input + 8));
+			Lane2 = hash_round(Lane2, hash_read64(Input + 16));
+			Lane3 = hash_round(Lane3, hash_read64(Input + 24));
+		}
+		this->Lanes[0] = Lane0;
+		this->Lanes[1] = Lane1;
+		this->Lanes[2] = Lane2;
+		this->Lanes[3] = Lane3;
+
+		if(Size > 0)
+		{
+			std::memcpy(this->Buffer, Input, Size);
+			this->BufferSize = Size;
+		}
+	}
+
+	inline glm::uint64 hasher::digest() const
+	{
+		glm::uint64 Hash = 0;
+		if(this->TotalSize >= 32)
+		{
+			Hash = hash_rotl(this->Lanes[0], 1) + hash_rotl(this->Lanes[1], 7) + hash_rotl(this->Lanes[2], 12) + hash_rotl(this->Lanes[3], 18);
+			for(int LaneIndex = 0; LaneIndex < 4; ++LaneIndex)
+				Hash = hash_merge(Hash, this->Lanes[LaneIndex]);
+		}
+		else
+			Hash = this->Seed + HASH_PRIME5;
+
+		Hash += this->TotalSize;
+
+		glm::uint8 const* Input = this->Buffer;
+		size_t Size = this->BufferSize;
+		for(; Size >= 8; Input += 8, Size -= 8)
+			Hash = hash_rotl(Hash ^ hash_round(0, hash_read64(Input)), 27) * HASH_PRIME1 + HASH_PRIME4;
+		for(; Size >= 4; Input += 4, Size -= 4)
+			Hash = hash_rotl(Hash ^ (static_cast<glm::uint64>(hash_read32(Input)) * HASH_PRIME1), 23) * HASH_PRIME2 + HASH_PRIME3;
+		for(; Size > 0; ++Input, --Size)
+			Hash = hash_rotl(Hash ^ (*Input * HASH_PRIME5), 11) * HASH_PRIME1;
+
+		Hash ^= Hash >> 33;
+		Hash *= HASH_PRIME2;
+		Hash ^= Hash >> 29;
+		Hash *= HASH_PRIME3;
+		Hash ^= Hash >> 32;
+		return Hash;
+	}
+
+	inline glm::uint64 hash_data(void const* Data, size_t Size, glm::uint64 Seed)
+	{
+		hasher Hasher(Seed);
+		Hasher.update(Data, Size);
+		return Hasher.digest();
+	}
+
+	inline glm::u64vec2 hash_data128(void const* Data, size_t Size)
+	{
+		// Both hashers read each chunk while it is in the cache
+		std::size_t const ChunkSize = 1 << 14;
+
+		hasher Low(0);
+		hasher High(HASH_PRIME5);
+
+		glm::uint8 const* Input = static_cast<glm::uint8 const*>(Data);
+		for(size_t Offset = 0; Offset < Size; Offset += ChunkSize)
+		{
+			size_t const Length = glm::min(ChunkSize, Size - Offset);
+			Low.update(Input + Offset, Length);
+			High.update(Input + Offset, Length);
+		}
+
+		return glm::u64vec2(Low.digest(), High.digest());
+	}
+}//namespace detail
+
+	inline glm::uint64 hash(image const& Image)
+	{
+		GLI_ASSERT(!Image.empty());
+
+		return detail::hash_data(Image.data(), Image.size());
+	}
+
+	inline glm::uint64 hash(texture const& Texture, size_t Layer, size_t Face, size_t Level)
+	{
+		GLI_ASSERT(!Texture.empty());
+
+		return detail::hash_data(Texture.data(Layer, Face, Level), Texture.size(Level));
+	}
+
+	inline glm::uint64 hash(texture const& Texture)
+	{
+		if(Texture.empty())
+			return detail::hash_data(nullptr, 0);
+
+		glm::uint64 const Description[] =
+		{
+			static_cast<glm::uint64>(Texture.target()),
+			static_cast<glm::uint64>(Texture.format()),
+			static_cast<glm::uint64>(Texture.layers()),
+			static_cast<glm::uint64>(Texture.faces()),
+			static_cast<glm::uint64>(Texture.levels())
+		};
+
+		detail::hasher Hasher;
+		Hasher.update(Description, sizeof(Description));
+
+		for(texture::size_type LayerIndex = 0, LayerCount = Texture.layers(); LayerIndex < LayerCount; ++LayerIndex)
+		for(texture::size_type FaceIndex = 0, FaceCount = Texture.faces(); FaceIndex < FaceCount; ++FaceIndex)
+		for(texture::size_type LevelIndex = 0, LevelCount = Texture.levels(); LevelIndex < LevelCount; ++LevelIndex)
+		{
+			glm::uint64 const ImageHash = gli::hash(Texture, LayerIndex, FaceIndex, LevelIndex);
+			Hasher.update(&ImageHash, sizeof(ImageHash));
+		}
+
+		return Hasher.digest();
+	}
+
+	inline glm::u64vec2 hash128(image const& Image)
+	{
+		GLI_ASSERT(!Image.empty());
+
+		return detail::hash_data128(Image.data(), Image.size());
+	}
+
+	inline glm::u64vec2 hash128(texture const& Texture, size_t Layer, size_t Face, size_t Level)
+	{
+		GLI_ASSERT(!Texture.empty());
+
+		return detail::hash_data128(Texture.data(Layer, Face, Level), Texture.size(Level));
+	}
+
+	inline glm::u64vec2 hash128(texture const& Texture)
+	{
+		if(Texture.empty())
+			return detail::hash_data128(nullptr, 0);
+
+		glm::uint64 const Description[] =
+		{
+			static_cast<glm::uint64>(Texture.target()),
+			static_cast<glm::uint64>(Texture.format()),
+			static_cast<glm::uint64>(Texture.layers()),
+			static_cast<glm::uint64>(Texture.faces()),
+			static_cast<glm::uint64>(Texture.levels())
+		};
+
+		std::vector<glm::u64vec2> Hashes(1, detail::hash_data128(Description, sizeof(Description)));
+
+		for(texture::size_type LayerIndex = 0, LayerCount = Texture.layers(); LayerIndex < LayerCount; ++LayerIndex)
+		for(texture::size_type FaceIndex = 0, FaceCount = Texture.faces(); FaceIndex < FaceCount; ++FaceIndex)
+		for(texture::size_type LevelIndex = 0, LevelCount = Texture.levels(); LevelIndex < LevelCount; ++LevelIndex)
+			Hashes.push_back(gli::hash128(Texture, LayerIndex, FaceIndex, LevelIndex));
+
+		return detail::hash_data128(&Hashes[0], Hashes.size() * sizeof(glm::u64vec2));
+	}
+}//namespace gli
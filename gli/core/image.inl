@@ -1,3 +1,5 @@
+#include "./fill.hpp"
+
 namespace gli{
 namespace detail
 {
@@ -209,8 +211,7 @@ namespace detail
 		GLI_ASSERT(!this->empty());
 		GLI_ASSERT(this->Storage->block_size() == sizeof(genType));
 
-		for(size_type TexelIndex = 0; TexelIndex < this->size<genType>(); ++TexelIndex)
-			*(this->data<genType>() + TexelIndex) = Texel;
+		detail::fill_parallel(this->data<glm::uint8>(), this->size(), reinterpret_cast<glm::uint8 const*>(&Texel), sizeof(genType));
 	}
 
 	inline image::data_type* image::compute_data(size_type BaseLayer, size_type BaseFace, size_type BaseLevel)
@@ -0,0 +1,182 @@
+/// @brief Include to run tasks on a bounded pool of threads dedicated to file loading
+/// @file gli/core/io_pool.hpp
+///
+/// Define GLI_IO_THREAD_COUNT before including GLI to override the number of I/O threads, 4 by default.
+/// Define GLI_IO_QUEUE_SIZE to override the number of pending tasks, 256 by default. Submitting to a full queue waits for a task to start.
+/// The threads are created on the first asynchronous load and joined at exit once every pending task is done.
+
+#pragma once
+
+#include "../type.hpp"
+
+// STD
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace gli{
+namespace detail
+{
+	/// Return the number of threads of the I/O pool
+	inline size_t io_thread_count()
+	{
+#		ifdef GLI_IO_THREAD_COUNT
+			return GLI_IO_THREAD_COUNT > 0 ? static_cast<size_t>(GLI_IO_THREAD_COUNT) : 1;
+#		else
+			return 4;
+#		endif
+	}
+
+	/// Return the maximum number of tasks waiting for an I/O thread
+	inline size_t io_queue_size()
+	{
+#		ifdef GLI_IO_QUEUE_SIZE
+			return GLI_IO_QUEUE_SIZE > 0 ? static_cast<size_t>(GLI_IO_QUEUE_SIZE) : 1;
+#		else
+			return 256;
+#		endif
+	}
+
+	/// Fixed number of threads running the submitted tasks in submission order.
+	/// Exceptions thrown by the tasks are discarded, tasks report their own errors.
+	class io_pool
+	{
+	public:
+		explicit io_pool(size_t ThreadCount, size_t QueueSize = io_queue_size())
+			: QueueSize(QueueSize)
+			, Stop(false)
+		{
+			Threads.reserve(ThreadCount);
+
+			// When the system can't create more threads, the pool runs with the threads created so far
+			for(size_t ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+			{
+				try
+				{
+					Threads.push_back(std::thread([this]()
+					{
+						this->run();
+					}));
+				}
+				catch(std::system_error const&)
+				{
+					break;
+				}
+			}
+		}
+
+		~io_pool()
+		{
+			{
+				std::lock_guard<std::mutex> Lock(this->Mutex);
+				this->Stop = true;
+			}
+			this->Condition.notify_all();
+
+			for(size_t ThreadIndex = 0; ThreadIndex < this->Threads.size(); ++ThreadIndex)
+				this->Threads[ThreadIndex].join();
+		}
+
+		/// Queue Task to run on one of the threads, waiting while the queue is full.
+		/// Task runs on the calling thread if the pool has no thread, or if the queue is full and the caller is one of the threads of the pool.
+		void submit(std::function<void()> const& Task)
+		{
+			bool const Inline = this->Threads.empty() || is_pool_thread();
+			{
+				std::unique_lock<std::mutex> Lock(this->Mutex);
+				if(!Inline)
+				{
+					this->NotFull.wait(Lock, [this]()
+					{
+						return this->Tasks.size() < this->QueueSize;
+					});
+				}
+
+				if(this->Tasks.size() < this->QueueSize && !this->Threads.empty())
+				{
+					this->Tasks.push_back(Task);
+					Lock.unlock();
+					this->Condition.notify_one();
+					return;
+				}
+			}
+
+			run_task(Task);
+		}
+
+		/// Return true if the calling thread is one of the threads of an I/O pool
+		static bool is_pool_thread()
+		{
+			return pool_thread_flag();
+		}
+
+	private:
+		io_pool(io_pool const&);
+		io_pool& operator=(io_pool const&);
+
+		static bool& pool_thread_flag()
+		{
+			static thread_local bool Flag = false;
+			return Flag;
+		}
+
+		// An exception escaping a task would terminate the process
+		static void run_task(std::function<void()> const& Task)
+		{
+			try
+			{
+				Task();
+			}
+			catch(...)
+			{
+			}
+		}
+
+		// Pending tasks are still run after the pool is stopped
+		void run()
+		{
+			pool_thread_flag() = true;
+
+			for(;;)
+			{
+				std::function<void()> Task;
+				{
+					std::unique_lock<std::mutex> Lock(this->Mutex);
+					this->Condition.wait(Lock, [this]()
+					{
+						return this->Stop || !this->Tasks.empty();
+					});
+
+					if(this->Tasks.empty())
+						return;
+
+					Task.swap(this->Tasks.front());
+					this->Tasks.pop_front();
+				}
+				this->NotFull.notify_one();
+
+				run_task(Task);
+			}
+		}
+
+		std::mutex Mutex;
+		std::condition_variable Condition;
+		std::condition_variable NotFull;
+		std::deque<std::function<void()> > Tasks;
+		std::vector<std::thread> Threads;
+		size_t const QueueSize;
+		bool Stop;
+	};
+
+	/// Pool shared by all the asynchronous loads
+	inline io_pool& get_io_pool()
+	{
+		static io_pool Pool(io_thread_count());
+		return Pool;
+	}
+}//namespace detail
+}//namespace gli
@@ -2,49 +2,139 @@
 #include "../load_kmg.hpp"
 #include "../load_ktx.hpp"
 #include "file.hpp"
+#include <cstring>
+#include <limits>
 
-namespace gli
+namespace gli{
+namespace detail
 {
-	/// Load a texture (DDS, KTX or KMG) from memory
-	inline texture load(char const * Data, std::size_t Size)
+	inline container find_container(char const* Data, std::size_t Size)
+	{
+		if(Size >= sizeof(FOURCC_DDS) && std::memcmp(Data, FOURCC_DDS, sizeof(FOURCC_DDS)) == 0)
+			return CONTAINER_DDS;
+		if(Size >= sizeof(FOURCC_KTX10) && std::memcmp(Data, FOURCC_KTX10, sizeof(FOURCC_KTX10)) == 0)
+			return CONTAINER_KTX10;
+		if(Size >= sizeof(FOURCC_KTX20) && std::memcmp(Data, FOURCC_KTX20, sizeof(FOURCC_KTX20)) == 0)
+			return CONTAINER_KTX20;
+		if(Size >= sizeof(FOURCC_KMG100) && std::memcmp(Data, FOURCC_KMG100, sizeof(FOURCC_KMG100)) == 0)
+			return CONTAINER_KMG100;
+		if(Size >= sizeof(FOURCC_KMG200) && std::memcmp(Data, FOURCC_KMG200, sizeof(FOURCC_KMG200)) == 0)
+			return CONTAINER_KMG200;
+		return CONTAINER_UNKNOWN;
+	}
+
+	inline parse_error parse_container(container Container, char const* Data, std::size_t Size, container_desc& Desc)
 	{
+		switch(Container)
 		{
-			texture Texture = load_dds(Data, Size);
-			if(!Texture.empty())
-				return Texture;
+		case CONTAINER_DDS:
+			return parse_dds(Data, Size, Desc);
+		case CONTAINER_KTX10:
+			return parse_ktx10(Data, Size, Desc);
+		case CONTAINER_KTX20:
+			return parse_ktx20(Data, Size, Desc);
+		case CONTAINER_KMG100:
+			return parse_kmg100(Data, Size, Desc);
+		case CONTAINER_KMG200:
+			return parse_kmg200(Data, Size, Desc);
+		default:
+			return PARSE_BAD_HEADER;
 		}
+	}
+
+	// The loaders parse the header again, which only reads the header and the level or chunk index
+	inline texture load_container(container Container, char const* Data, std::size_t Size)
+	{
+		switch(Container)
 		{
-			texture Texture = load_kmg(Data, Size);
-			if(!Texture.empty())
-				return Texture;
+		case CONTAINER_DDS:
+			return load_dds(Data, Size);
+		case CONTAINER_KTX10:
+			return load_ktx10(Data, Size, 0, std::numeric_limits<texture::size_type>::max());
+		case CONTAINER_KTX20:
+			return load_ktx20(Data, Size, 0, std::numeric_limits<texture::size_type>::max());
+		case CONTAINER_KMG100:
+			return load_kmg100(Data, Size);
+		case CONTAINER_KMG200:
+			return load_kmg200(Data, Size, 0, std::numeric_limits<texture::size_type>::max());
+		default:
+			return texture();
 		}
+	}
+}//namespace detail
+
+	inline load_result try_load(char const* Data, std::size_t Size)
+	{
+		static load_error const Errors[] = {LOAD_SUCCESS, LOAD_TRUNCATED, LOAD_BAD_HEADER, LOAD_UNSUPPORTED_FORMAT};
+
+		load_result Result;
+		Result.Container = Data != nullptr ? detail::find_container(Data, Size) : CONTAINER_UNKNOWN;
+		if(Result.Container == CONTAINER_UNKNOWN)
 		{
-			texture Texture = load_ktx(Data, Size);
-			if(!Texture.empty())
-				return Texture;
+			Result.Error = LOAD_UNKNOWN_CONTAINER;
+			return Result;
 		}
 
-		return texture();
+		detail::container_desc Desc = detail::container_desc();
+		detail::parse_error const Error = detail::parse_container(Result.Container, Data, Size, Desc);
+		if(Error != detail::PARSE_SUCCESS)
+		{
+			Result.Error = Errors[Error];
+			return Result;
+		}
+
+		Result.Target = Desc.Target;
+		Result.Format = Desc.Format;
+		Result.Extent = Desc.Extent;
+		Result.Layers = Desc.Layers;
+		Result.Faces = Desc.Faces;
+		Result.Levels = Desc.Levels;
+		Result.Swizzles = Desc.Swizzles;
+
+		if(Desc.End > Size)
+		{
+			Result.Error = LOAD_TRUNCATED;
+			return Result;
+		}
+
+		Result.Texture = detail::load_container(Result.Container, Data, Size);
+		Result.Error = Result.Texture.empty() ? LOAD_CORRUPTED_DATA : LOAD_SUCCESS;
+		return Result;
 	}
 
-	/// Load a texture (DDS, KTX or KMG) from file
-	inline texture load(char const * Filename)
+	inline load_result try_load(char const* Path)
 	{
-		FILE* File = detail::open_file(Filename, "rb");
+		load_result Result;
+		Result.Error = LOAD_FILE_ERROR;
+
+		FILE* File = detail::open_file(Path, "rb");
 		if(!File)
-			return texture();
+			return Result;
 
-		long Beg = std::ftell(File);
-		std::fseek(File, 0, SEEK_END);
-		long End = std::ftell(File);
-		std::fseek(File, 0, SEEK_SET);
+		std::vector<char> Data;
+		bool const Read = detail::read_file(File, Data);
+		std::fclose(File);
+		if(!Read)
+			return Result;
 
-		std::vector<char> Data(static_cast<std::size_t>(End - Beg));
+		return try_load(&Data[0], Data.size());
+	}
 
-		std::fread(&Data[0], 1, Data.size(), File);
-		std::fclose(File);
+	inline load_result try_load(std::string const& Path)
+	{
+		return try_load(Path.c_str());
+	}
 
-		return load(&Data[0], Data.size());
+	/// Load a texture (DDS, KTX or KMG) from memory
+	inline texture load(char const * Data, std::size_t Size)
+	{
+		return try_load(Data, Size).Texture;
+	}
+
+	/// Load a texture (DDS, KTX or KMG) from file
+	inline texture load(char const * Filename)
+	{
+		return try_load(Filename).Texture;
 	}
 
 	/// Load a texture (DDS, KTX or KMG) from file
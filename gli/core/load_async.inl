@@ -0,0 +1,51 @@
+#include "../load.hpp"
+#include "io_pool.hpp"
+#include <memory>
+
+namespace gli
+{
+	inline std::future<texture> load_async(std::string const& Path)
+	{
+		std::shared_ptr<std::packaged_task<texture()> > Task(new std::packaged_task<texture()>([Path]()
+		{
+			return load(Path);
+		}));
+
+		std::future<texture> Result = Task->get_future();
+		detail::get_io_pool().submit([Task]()
+		{
+			(*Task)();
+		});
+
+		return Result;
+	}
+
+	inline std::future<texture> load_async(char const* Path)
+	{
+		return load_async(std::string(Path));
+	}
+
+	inline void load_async(std::string const& Path, std::function<void(texture const&)> const& Callback)
+	{
+		detail::get_io_pool().submit([Path, Callback]()
+		{
+			// A load failing with an exception, such as std::bad_alloc, is reported as any other failure
+			texture Texture;
+			try
+			{
+				Texture = load(Path);
+			}
+			catch(...)
+			{
+				Texture = texture();
+			}
+
+			Callback(Texture);
+		});
+	}
+
+	inline void load_async(char const* Path, std::function<void(texture const&)> const& Callback)
+	{
+		load_async(std::string(Path), Callback);
+	}
+}//namespace gli
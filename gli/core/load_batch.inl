@@ -0,0 +1,209 @@
+#include "../load.hpp"
+#include "check.hpp"
+#include "io_pool.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace gli{
+namespace detail
+{
+	enum
+	{
+		PROBE_SIZE = 256
+	};
+
+	/// Size of the texture storage loaded from a DDS, KTX or KMG container, computed from the first Size bytes of the container.
+	/// Data must point to at least PROBE_SIZE bytes. Returns 0 if the container is unknown.
+	inline std::uint64_t probe_storage_size(char const* Data, std::size_t Size)
+	{
+		container_desc Desc;
+		if(parse_dds(Data, Size, Desc) == PARSE_SUCCESS || parse_ktx10(Data, Size, Desc) == PARSE_SUCCESS || parse_kmg100(Data, Size, Desc) == PARSE_SUCCESS)
+			return get_storage_size(Desc.Format, Desc.Extent, static_cast<std::uint64_t>(Desc.Layers) * Desc.Faces, Desc.Levels);
+
+		// The level index of KTX2 and the chunk index of KMG2 may not fit in the probed bytes, only their header is read
+		if(Size >= sizeof(ktx_header20) && std::memcmp(Data, FOURCC_KTX20, sizeof(FOURCC_KTX20)) == 0)
+		{
+			ktx_header20 Header;
+			std::memcpy(&Header, Data, sizeof(Header));
+
+			texture::extent_type const Extent(
+				static_cast<int>(Header.PixelWidth),
+				std::max<int>(static_cast<int>(Header.PixelHeight), 1),
+				std::max<int>(static_cast<int>(Header.PixelDepth), 1));
+
+			return get_storage_size(get_ktx2_format(Header.VkFormat), Extent,
+				static_cast<std::uint64_t>(std::max<std::uint32_t>(Header.LayerCount, 1)) * Header.FaceCount,
+				std::max<std::uint32_t>(Header.LevelCount, 1));
+		}
+
+		if(Size >= sizeof(FOURCC_KMG200) + sizeof(kmgHeader20) && std::memcmp(Data, FOURCC_KMG200, sizeof(FOURCC_KMG200)) == 0)
+		{
+			kmgHeader20 Header;
+			std::memcpy(&Header, Data + sizeof(FOURCC_KMG200), sizeof(Header));
+
+			return get_storage_size(static_cast<format>(Header.Format), get_kmg_extent(Header), static_cast<std::uint64_t>(Header.Layers) * Header.Faces, Header.Levels);
+		}
+
+		return 0;
+	}
+
+	// Memory used to load a file: the file content while it is loaded, then the texture storage until it is delivered
+	struct batch_probe
+	{
+		std::uint64_t FileSize;
+		std::uint64_t StorageSize;
+	};
+
+	inline batch_probe probe_file(char const* Path)
+	{
+		batch_probe Probe = {0, 0};
+
+		FILE* File = open_file(Path, "rb");
+		if(!File)
+			return Probe;
+
+		char Data[PROBE_SIZE] = {};
+		std::size_t const Read = std::fread(Data, 1, sizeof(Data), File);
+		seek_file(File, 0, SEEK_END);
+		std::int64_t const End = tell_file(File);
+		std::fclose(File);
+
+		Probe.FileSize = End > 0 ? static_cast<std::uint64_t>(End) : 0;
+		Probe.StorageSize = probe_storage_size(Data, Read);
+
+		// Unknown containers are assumed to store the texture as is
+		if(Probe.StorageSize == 0)
+			Probe.StorageSize = Probe.FileSize;
+
+		return Probe;
+	}
+
+	// Shared by load_batch and its loads in flight
+	struct batch_state
+	{
+		explicit batch_state(std::size_t Count)
+			: Textures(Count)
+			, Loaded(Count, 0)
+			, Held(0)
+			, Pending(0)
+		{}
+
+		std::mutex Mutex;
+		std::condition_variable Condition;
+		std::vector<texture> Textures;
+		std::vector<char> Loaded;
+		std::uint64_t Held;
+		std::size_t Pending;
+	};
+}//namespace detail
+
+	inline void load_batch(std::vector<load_request> const& Requests, std::size_t Budget, std::function<void(std::size_t Index, texture const& Texture)> const& Callback)
+	{
+		std::size_t const Count = Requests.size();
+
+		std::vector<std::size_t> Order(Count);
+		for(std::size_t Index = 0; Index < Count; ++Index)
+			Order[Index] = Index;
+		std::stable_sort(Order.begin(), Order.end(), [&](std::size_t A, std::size_t B)
+		{
+			return Requests[A].Priority > Requests[B].Priority;
+		});
+
+		std::vector<detail::batch_probe> Probes(Count);
+		detail::parallel_for(0, Count, 16, [&](std::size_t RangeBegin, std::size_t RangeEnd)
+		{
+			for(std::size_t Index = RangeBegin; Index < RangeEnd; ++Index)
+				Probes[Index] = detail::probe_file(Requests[Index].Path.c_str());
+		});
+
+		// Owned by the tasks as well, so that the loads still running when Callback throws don't outlive it
+		std::shared_ptr<detail::batch_state> const State(new detail::batch_state(Count));
+		std::size_t Next = 0;
+
+		try
+		{
+			for(std::size_t Delivered = 0; Delivered < Count; ++Delivered)
+			{
+				// Start the loads by priority while they fit in the budget, the next texture to deliver is always started
+				std::vector<std::size_t> Starts;
+				{
+					std::lock_guard<std::mutex> Lock(State->Mutex);
+					for(; Next < Count; ++Next)
+					{
+						detail::batch_probe const& Probe = Probes[Order[Next]];
+						std::uint64_t const Cost = Probe.FileSize + Probe.StorageSize;
+						if(State->Held != 0 && State->Held + Cost > Budget)
+							break;
+
+						State->Held += Cost;
+						++State->Pending;
+						Starts.push_back(Order[Next]);
+					}
+				}
+
+				for(std::size_t Start = 0; Start < Starts.size(); ++Start)
+				{
+					std::size_t const Index = Starts[Start];
+					std::string const Path = Requests[Index].Path;
+					std::uint64_t const FileSize = Probes[Index].FileSize;
+					std::function<void()> const Task([State, Index, Path, FileSize]()
+					{
+						texture Texture;
+						try
+						{
+							Texture = load(Path);
+						}
+						catch(...)
+						{
+						}
+
+						std::lock_guard<std::mutex> Lock(State->Mutex);
+						State->Held -= FileSize;
+						State->Textures[Index] = Texture;
+						State->Loaded[Index] = 1;
+						--State->Pending;
+						State->Condition.notify_all();
+					});
+
+					// A task waiting for tasks queued behind it would never wake up, loads run inline on the I/O threads
+					if(detail::io_pool::is_pool_thread())
+						Task();
+					else
+						detail::get_io_pool().submit(Task);
+				}
+
+				std::size_t const Index = Order[Delivered];
+				texture Texture;
+				{
+					std::unique_lock<std::mutex> Lock(State->Mutex);
+					State->Condition.wait(Lock, [&]()
+					{
+						return State->Loaded[Index] != 0;
+					});
+
+					Texture = State->Textures[Index];
+					State->Textures[Index] = texture();
+				}
+
+				Callback(Index, Texture);
+
+				std::lock_guard<std::mutex> Lock(State->Mutex);
+				State->Held -= Probes[Index].StorageSize;
+			}
+		}
+		catch(...)
+		{
+			// Wait for the loads in flight so that no file is still being read once load_batch returns
+			std::unique_lock<std::mutex> Lock(State->Mutex);
+			State->Condition.wait(Lock, [&]()
+			{
+				return State->Pending == 0;
+			});
+			throw;
+		}
+	}
+}//namespace gli
@@ -1,5 +1,8 @@
 #include "../dx.hpp"
+#include "check.hpp"
 #include "file.hpp"
+#include "swizzle.hpp"
+#include "parallel.hpp"
 #include <cstdio>
 #include <cassert>
 
@@ -158,24 +161,29 @@ namespace detail
 			return dx::D3DFMT_AT2N;
 		}
 	}
-}//namespace detail
 
-	inline texture load_dds(char const * Data, std::size_t Size)
+	/// Parse and validate the header of a DDS container of Size bytes and compute the range of its images.
+	/// Only the headers are read, End must be checked against the size of the container before reading the images.
+	inline parse_error parse_dds(char const * Data, std::size_t Size, container_desc & Desc)
 	{
-		GLI_ASSERT(Data && (Size >= sizeof(detail::FOURCC_DDS)));
-
-		if(strncmp(Data, detail::FOURCC_DDS, 4) != 0)
-			return texture();
+		if(Size < sizeof(detail::FOURCC_DDS))
+			return PARSE_TRUNCATED;
+		if(std::memcmp(Data, detail::FOURCC_DDS, sizeof(detail::FOURCC_DDS)) != 0)
+			return PARSE_BAD_HEADER;
+		if(Size < sizeof(detail::FOURCC_DDS) + sizeof(detail::dds_header))
+			return PARSE_TRUNCATED;
 		std::size_t Offset = sizeof(detail::FOURCC_DDS);
 
-		GLI_ASSERT(Size >= sizeof(detail::dds_header));
-
-		detail::dds_header const & Header(*reinterpret_cast<detail::dds_header const *>(Data + Offset));
+		detail::dds_header Header;
+		std::memcpy(&Header, Data + Offset, sizeof(Header));
 		Offset += sizeof(detail::dds_header);
 
 		detail::dds_header10 Header10;
 		if((Header.Format.flags & dx::DDPF_FOURCC) && (Header.Format.fourCC == dx::D3DFMT_DX10 || Header.Format.fourCC == dx::D3DFMT_GLI1))
 		{
+			if(Size < Offset + sizeof(Header10))
+				return PARSE_TRUNCATED;
+
 			std::memcpy(&Header10, Data + Offset, sizeof(Header10));
 			Offset += sizeof(detail::dds_header10);
 		}
@@ -188,7 +196,6 @@ namespace detail
 			switch(Header.Format.bpp)
 			{
 				default:
-					GLI_ASSERT(0);
 					break;
 				case 8:
 				{
@@ -202,8 +209,6 @@ namespace detail
 						Format = FORMAT_R8_UNORM_PACK8;
 					else if(glm::all(glm::equal(Header.Format.Mask, DX.translate(FORMAT_RG3B2_UNORM_PACK8).Mask)))
 						Format = FORMAT_RG3B2_UNORM_PACK8;
-					else
-						GLI_ASSERT(0);
 					break;
 				}
 				case 16:
@@ -230,8 +235,6 @@ namespace detail
 						Format = FORMAT_A16_UNORM_PACK16;
 					else if(glm::all(glm::equal(Header.Format.Mask, DX.translate(FORMAT_R16_UNORM_PACK16).Mask)))
 						Format = FORMAT_R16_UNORM_PACK16;
-					else
-						GLI_ASSERT(0);
 					break;
 				}
 				case 24:
@@ -240,8 +243,6 @@ namespace detail
 						Format = FORMAT_RGB8_UNORM_PACK8;
 					else if(glm::all(glm::equal(Header.Format.Mask, DX.translate(FORMAT_BGR8_UNORM_PACK8).Mask)))
 						Format = FORMAT_BGR8_UNORM_PACK8;
-					else
-						GLI_ASSERT(0);
 					break;
 				}
 				case 32:
@@ -260,8 +261,6 @@ namespace detail
 						Format = FORMAT_RG16_UNORM_PACK16;
 					else if(glm::all(glm::equal(Header.Format.Mask, DX.translate(FORMAT_R32_SFLOAT_PACK32).Mask)))
 						Format = FORMAT_R32_SFLOAT_PACK32;
-					else
-						GLI_ASSERT(0);
 					break;
 				}
 			}
@@ -274,9 +273,8 @@ namespace detail
 		else if(Header.Format.fourCC == dx::D3DFMT_DX10 || Header.Format.fourCC == dx::D3DFMT_GLI1)
 			Format = DX.find(Header.Format.fourCC, Header10.Format);
 
-		GLI_ASSERT(Format != gli::FORMAT_UNDEFINED);
-
-		size_t const MipMapCount = (Header.Flags & detail::DDSD_MIPMAPCOUNT) ? Header.MipMapLevels : 1;
+		// Some writers store a level count of 0 for textures without mipmaps
+		size_t const MipMapCount = (Header.Flags & detail::DDSD_MIPMAPCOUNT) ? std::max<size_t>(Header.MipMapLevels, 1) : 1;
 		size_t FaceCount = 1;
 		if(Header.CubemapFlags & detail::DDSCAPS2_CUBEMAP)
 			FaceCount = int(glm::bitCount(Header.CubemapFlags & detail::DDSCAPS2_CUBEMAP_ALLFACES));
@@ -287,15 +285,64 @@ namespace detail
 		if(Header.CubemapFlags & detail::DDSCAPS2_VOLUME)
 			DepthCount = Header.Depth;
 
-		texture Texture(
-			get_target(Header, Header10), Format,
-			texture::extent_type(Header.Width, Header.Height, DepthCount),
-			std::max<texture::size_type>(Header10.ArraySize, 1), FaceCount, MipMapCount);
+		Desc.Target = get_target(Header, Header10);
+		Desc.Format = Format;
+		Desc.Extent = texture::extent_type(static_cast<int>(Header.Width), static_cast<int>(Header.Height), static_cast<int>(DepthCount));
+		Desc.Layers = std::max<texture::size_type>(Header10.ArraySize, 1);
+		Desc.Faces = FaceCount;
+		Desc.Levels = MipMapCount;
+		Desc.Swizzles = swizzles(SWIZZLE_RED, SWIZZLE_GREEN, SWIZZLE_BLUE, SWIZZLE_ALPHA);
+		Desc.Offset = Offset;
+		Desc.Swap = 0;
+
+		parse_error const Error = check_container_desc(Desc);
+		if(Error != PARSE_SUCCESS)
+			return Error;
+
+		Desc.End = Offset + get_storage_size(Desc.Format, Desc.Extent, static_cast<std::uint64_t>(Desc.Layers) * Desc.Faces, Desc.Levels);
+		return PARSE_SUCCESS;
+	}
+}//namespace detail
 
-		std::size_t const SourceSize = Offset + Texture.size();
-		GLI_ASSERT(SourceSize == Size);
+	inline texture load_dds(char const * Data, std::size_t Size)
+	{
+		detail::container_desc Desc;
+		if(detail::parse_dds(Data, Size, Desc) != detail::PARSE_SUCCESS || Desc.End > Size)
+			return texture();
 
-		std::memcpy(Texture.data(), Data + Offset, Texture.size());
+		texture Texture(Desc.Target, Desc.Format, Desc.Extent, Desc.Layers, Desc.Faces, Desc.Levels);
+		std::memcpy(Texture.data(), Data + Desc.Offset, Texture.size());
+
+		return Texture;
+	}
+
+	inline texture load_dds(char const * Data, std::size_t Size, format Format)
+	{
+		detail::container_desc Desc;
+		if(detail::parse_dds(Data, Size, Desc) != detail::PARSE_SUCCESS || Desc.End > Size)
+			return texture();
+
+		if(Desc.Format == Format)
+			return load_dds(Data, Size);
+		if(!detail::is_reorderable(Desc.Format, Format))
+			return texture();
+
+		texture Texture(Desc.Target, Format, Desc.Extent, Desc.Layers, Desc.Faces, Desc.Levels);
+
+		// Reorder the components of the file while copying the texel data into the texture storage
+		detail::swizzle_shuffle const Shuffle = detail::make_swizzle_shuffle(Desc.Format, detail::get_format_info(Desc.Format).Swizzles, Format);
+
+		glm::uint8 const* const Source = reinterpret_cast<glm::uint8 const*>(Data + Desc.Offset);
+		glm::uint8* const Destination = Texture.data<glm::uint8>();
+		std::size_t const TexelCount = Texture.size() / Shuffle.DstTexelSize;
+
+		detail::parallel_for(0, TexelCount, (std::size_t(1) << 16) / Shuffle.DstTexelSize, [&](std::size_t TexelBegin, std::size_t TexelEnd)
+		{
+			detail::swizzle_texels(
+				Destination + TexelBegin * Shuffle.DstTexelSize,
+				Source + TexelBegin * Shuffle.SrcTexelSize,
+				TexelEnd - TexelBegin, Shuffle);
+		});
 
 		return Texture;
 	}
@@ -306,15 +353,11 @@ namespace detail
 		if(!File)
 			return texture();
 
-		long Beg = std::ftell(File);
-		std::fseek(File, 0, SEEK_END);
-		long End = std::ftell(File);
-		std::fseek(File, 0, SEEK_SET);
-
-		std::vector<char> Data(static_cast<std::size_t>(End - Beg));
-
-		std::fread(&Data[0], 1, Data.size(), File);
+		std::vector<char> Data;
+		bool const Read = detail::read_file(File, Data);
 		std::fclose(File);
+		if(!Read)
+			return texture();
 
 		return load_dds(&Data[0], Data.size());
 	}
@@ -323,4 +366,24 @@ namespace detail
 	{
 		return load_dds(Filename.c_str());
 	}
+
+	inline texture load_dds(char const * Filename, format Format)
+	{
+		FILE* File = detail::open_file(Filename, "rb");
+		if(!File)
+			return texture();
+
+		std::vector<char> Data;
+		bool const Read = detail::read_file(File, Data);
+		std::fclose(File);
+		if(!Read)
+			return texture();
+
+		return load_dds(&Data[0], Data.size(), Format);
+	}
+
+	inline texture load_dds(std::string const & Filename, format Format)
+	{
+		return load_dds(Filename.c_str(), Format);
+	}
 }//namespace gli
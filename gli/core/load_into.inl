@@ -0,0 +1,264 @@
+#include "../load_dds.hpp"
+#include "../load_kmg.hpp"
+#include "../load_ktx.hpp"
+#include "byte_swap.hpp"
+#include "check.hpp"
+#include "file.hpp"
+#include <cstring>
+
+namespace gli{
+namespace detail
+{
+	enum
+	{
+		LOAD_INTO_HEADER_SIZE = 256
+	};
+
+	enum load_into_container
+	{
+		LOAD_INTO_DDS,
+		LOAD_INTO_KTX10,
+		LOAD_INTO_KMG100
+	};
+
+	// Description of a container which images are stored uncompressed, the images span the bytes from Offset to End
+	struct load_into_desc : public container_desc
+	{
+		load_into_container Container;
+	};
+
+	// Parse the first bytes of a container of Size bytes, Header must hold LOAD_INTO_HEADER_SIZE bytes padded with zeros after the end of the container
+	inline bool parse_load_into_header(char const* Header, std::uint64_t Size, load_into_desc& Desc)
+	{
+		std::size_t const HeaderSize = static_cast<std::size_t>(std::min<std::uint64_t>(Size, LOAD_INTO_HEADER_SIZE));
+
+		if(std::memcmp(Header, FOURCC_DDS, sizeof(FOURCC_DDS)) == 0)
+		{
+			Desc.Container = LOAD_INTO_DDS;
+			return parse_dds(Header, HeaderSize, Desc) == PARSE_SUCCESS;
+		}
+		else if(std::memcmp(Header, FOURCC_KTX10, sizeof(FOURCC_KTX10)) == 0)
+		{
+			Desc.Container = LOAD_INTO_KTX10;
+			return parse_ktx10(Header, HeaderSize, Desc) == PARSE_SUCCESS;
+		}
+		else if(std::memcmp(Header, FOURCC_KMG100, sizeof(FOURCC_KMG100)) == 0)
+		{
+			Desc.Container = LOAD_INTO_KMG100;
+			return parse_kmg100(Header, HeaderSize, Desc) == PARSE_SUCCESS;
+		}
+
+		return false;
+	}
+
+	inline bool is_load_into_compatible(texture const& Texture, load_into_desc const& Desc)
+	{
+		return !Texture.empty()
+			&& Texture.target() == Desc.Target
+			&& Texture.format() == Desc.Format
+			&& Texture.extent() == Desc.Extent
+			&& Texture.layers() == Desc.Layers
+			&& Texture.faces() == Desc.Faces
+			&& Texture.levels() == Desc.Levels;
+	}
+
+	// Source of the images of a container in memory, the range of the reads is checked beforehand against Desc.End
+	struct load_into_memory
+	{
+		bool read(std::uint64_t Offset, void* Dst, std::size_t Size, std::size_t Swap)
+		{
+			if(Swap > 1)
+				copy_swap(Dst, this->Data + Offset, Size, Swap);
+			else
+				std::memcpy(Dst, this->Data + Offset, Size);
+			return true;
+		}
+
+		char const* Data;
+	};
+
+	// Source of the images of a container in a file, consecutive reads don't seek
+	struct load_into_file
+	{
+		bool read(std::uint64_t Offset, void* Dst, std::size_t Size, std::size_t Swap)
+		{
+			if(Offset != this->Position && !seek_file(this->File, static_cast<std::int64_t>(Offset), SEEK_SET))
+				return false;
+			this->Position = Offset + Size;
+			if(std::fread(Dst, 1, Size, this->File) != Size)
+				return false;
+
+			// The images are swapped in place while they are still in the cache
+			if(Swap > 1)
+				copy_swap(Dst, Dst, Size, Swap);
+			return true;
+		}
+
+		FILE* File;
+		std::uint64_t Position;
+	};
+
+	// Read the images of the container described by Desc directly into the images of Texture
+	template <typename source>
+	inline bool load_into_images(load_into_desc const& Desc, source& Source, texture& Texture)
+	{
+		std::uint64_t Offset = Desc.Offset;
+
+		switch(Desc.Container)
+		{
+		case LOAD_INTO_DDS:
+			for(texture::size_type Layer = 0; Layer < Desc.Layers; ++Layer)
+			for(texture::size_type Face = 0; Face < Desc.Faces; ++Face)
+			for(texture::size_type Level = 0; Level < Desc.Levels; ++Level)
+			{
+				texture::size_type const ImageSize = Texture.size(Level);
+				if(!Source.read(Offset, Texture.data(Layer, Face, Level), ImageSize, Desc.Swap))
+					return false;
+				Offset += ImageSize;
+			}
+			return true;
+		case LOAD_INTO_KTX10:
+			for(texture::size_type Level = 0; Level < Desc.Levels; ++Level)
+			{
+				Offset += sizeof(std::uint32_t);
+
+				texture::size_type const ImageSize = Texture.size(Level);
+				for(texture::size_type Layer = 0; Layer < Desc.Layers; ++Layer)
+				for(texture::size_type Face = 0; Face < Desc.Faces; ++Face)
+				{
+					if(!Source.read(Offset, Texture.data(Layer, Face, Level), ImageSize, Desc.Swap))
+						return false;
+					Offset += std::max(block_size(Desc.Format), glm::ceilMultiple(ImageSize, static_cast<texture::size_type>(4)));
+				}
+			}
+			return true;
+		case LOAD_INTO_KMG100:
+			for(texture::size_type Layer = 0; Layer < Desc.Layers; ++Layer)
+			for(texture::size_type Level = 0; Level < Desc.Levels; ++Level)
+			{
+				texture::size_type const ImageSize = Texture.size(Level);
+				for(texture::size_type Face = 0; Face < Desc.Faces; ++Face)
+				{
+					if(!Source.read(Offset, Texture.data(Layer, Face, Level), ImageSize, Desc.Swap))
+						return false;
+					Offset += ImageSize;
+				}
+			}
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	inline bool parse_load_into(char const* Data, std::size_t Size, load_into_desc& Desc)
+	{
+		char Header[LOAD_INTO_HEADER_SIZE] = {};
+		std::memcpy(Header, Data, std::min<std::size_t>(Size, sizeof(Header)));
+
+		return parse_load_into_header(Header, Size, Desc) && Desc.End <= Size;
+	}
+
+	inline FILE* open_load_into(char const* Path, load_into_desc& Desc)
+	{
+		FILE* File = open_file(Path, "rb");
+		if(!File)
+			return nullptr;
+
+		char Header[LOAD_INTO_HEADER_SIZE] = {};
+		std::fread(Header, 1, sizeof(Header), File);
+		seek_file(File, 0, SEEK_END);
+		std::int64_t const End = tell_file(File);
+
+		if(End < 0 || !parse_load_into_header(Header, static_cast<std::uint64_t>(End), Desc) || Desc.End > static_cast<std::uint64_t>(End))
+		{
+			std::fclose(File);
+			return nullptr;
+		}
+
+		return File;
+	}
+
+	inline texture make_load_into(load_into_desc const& Desc, void* Buffer, std::size_t BufferSize)
+	{
+		if(Buffer == nullptr || get_storage_size(Desc.Format, Desc.Extent, static_cast<std::uint64_t>(Desc.Layers) * Desc.Faces, Desc.Levels) > BufferSize)
+			return texture();
+
+		return texture(Desc.Target, Desc.Format, Desc.Extent, Desc.Layers, Desc.Faces, Desc.Levels, Buffer, std::shared_ptr<void>(), Desc.Swizzles);
+	}
+}//namespace detail
+
+	inline bool load_into(texture& Texture, char const* Data, std::size_t Size)
+	{
+		detail::load_into_desc Desc;
+		if(!detail::parse_load_into(Data, Size, Desc) || !detail::is_load_into_compatible(Texture, Desc))
+			return false;
+
+		detail::load_into_memory Source = {Data};
+		return detail::load_into_images(Desc, Source, Texture);
+	}
+
+	inline bool load_into(texture& Texture, char const* Path)
+	{
+		detail::load_into_desc Desc;
+		FILE* File = detail::open_load_into(Path, Desc);
+		if(!File)
+			return false;
+
+		bool Result = false;
+		if(detail::is_load_into_compatible(Texture, Desc))
+		{
+			detail::load_into_file Source = {File, static_cast<std::uint64_t>(-1)};
+			Result = detail::load_into_images(Desc, Source, Texture);
+		}
+
+		std::fclose(File);
+		return Result;
+	}
+
+	inline bool load_into(texture& Texture, std::string const& Path)
+	{
+		return load_into(Texture, Path.c_str());
+	}
+
+	inline texture load_into(void* Buffer, std::size_t BufferSize, char const* Data, std::size_t Size)
+	{
+		detail::load_into_desc Desc;
+		if(!detail::parse_load_into(Data, Size, Desc))
+			return texture();
+
+		texture Texture = detail::make_load_into(Desc, Buffer, BufferSize);
+		if(Texture.empty())
+			return texture();
+
+		detail::load_into_memory Source = {Data};
+		detail::load_into_images(Desc, Source, Texture);
+		return Texture;
+	}
+
+	inline texture load_into(void* Buffer, std::size_t BufferSize, char const* Path)
+	{
+		detail::load_into_desc Desc;
+		FILE* File = detail::open_load_into(Path, Desc);
+		if(!File)
+			return texture();
+
+		texture Texture = detail::make_load_into(Desc, Buffer, BufferSize);
+
+		bool Result = false;
+		if(!Texture.empty())
+		{
+			detail::load_into_file Source = {File, static_cast<std::uint64_t>(-1)};
+			Result = detail::load_into_images(Desc, Source, Texture);
+		}
+
+		std::fclose(File);
+		if(!Result)
+			return texture();
+		return Texture;
+	}
+
+	inline texture load_into(void* Buffer, std::size_t BufferSize, std::string const& Path)
+	{
+		return load_into(Buffer, BufferSize, Path.c_str());
+	}
+}//namespace gli
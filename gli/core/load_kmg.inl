@@ -1,11 +1,26 @@
+#include "../hash.hpp"
+#include "check.hpp"
 #include "file.hpp"
+#include "parallel.hpp"
+#include <glm/gtc/round.hpp>
 #include <cstdio>
 #include <cassert>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if defined(GLI_ZSTD)
+#	include <zstd.h>
+#endif
+#if defined(GLI_LZ4)
+#	include <lz4.h>
+#endif
 
 namespace gli{
 namespace detail
 {
 	static unsigned char const FOURCC_KMG100[] = {0xAB, 0x4B, 0x49, 0x4D, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+	static unsigned char const FOURCC_KMG200[] = {0xAB, 0x4B, 0x49, 0x4D, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
 
 	struct kmgHeader10
 	{
@@ -27,21 +42,373 @@ namespace detail
 		std::uint32_t MaxLevel;
 	};
 
-	inline texture load_kmg100(char const * Data, std::size_t Size)
+	// KMG 2.0 stores the images level by level, then layer by layer and face by face, each image is split in chunks of ChunkSize bytes.
+	// The chunk index follows the header so that any range of levels is located without walking the file.
+	struct kmgHeader20
+	{
+		std::uint32_t Endianness;
+		std::uint32_t Format;
+		std::uint32_t Target;
+		std::uint32_t SwizzleRed;
+		std::uint32_t SwizzleGreen;
+		std::uint32_t SwizzleBlue;
+		std::uint32_t SwizzleAlpha;
+		std::uint32_t PixelWidth;
+		std::uint32_t PixelHeight;
+		std::uint32_t PixelDepth;
+		std::uint32_t Layers;
+		std::uint32_t Levels;
+		std::uint32_t Faces;
+		std::uint32_t Supercompression;
+		std::uint32_t ChunkSize;
+		std::uint32_t ChunkCount;
+	};
+
+	struct kmgChunk20
+	{
+		std::uint64_t ByteOffset;	// From the beginning of the file
+		std::uint64_t ByteLength;	// Size of the stored and possibly supercompressed chunk
+		std::uint64_t Checksum;		// xxHash64 of the stored bytes
+	};
+
+	enum
+	{
+		KMG_CHUNK_SIZE = 1 << 18,
+		KMG_CHUNK_SIZE_MAX = 1 << 30
+	};
+
+	inline bool is_kmg_supercompression_supported(std::uint32_t Supercompression)
+	{
+		switch(Supercompression)
+		{
+		case SUPERCOMPRESSION_NONE:
+#		if defined(GLI_ZSTD)
+		case SUPERCOMPRESSION_ZSTD:
+#		endif
+#		if defined(GLI_LZ4)
+		case SUPERCOMPRESSION_LZ4:
+#		endif
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	inline texture::extent_type get_kmg_extent(kmgHeader20 const& Header)
+	{
+		return texture::extent_type(
+			static_cast<int>(Header.PixelWidth),
+			static_cast<int>(Header.PixelHeight),
+			static_cast<int>(Header.PixelDepth));
+	}
+
+	// Size of one image of Level
+	inline std::uint64_t get_kmg_image_size(kmgHeader20 const& Header, texture::size_type Level)
+	{
+		texture::extent_type const Extent = glm::max(get_kmg_extent(Header) >> static_cast<int>(Level), texture::extent_type(1));
+		return get_storage_size(static_cast<format>(Header.Format), Extent, 1, 1);
+	}
+
+	// Index of the first chunk of Level, or the number of chunks of the file when Level is the level count
+	inline std::uint64_t get_kmg_first_chunk(kmgHeader20 const& Header, texture::size_type Level)
+	{
+		std::uint64_t First = 0;
+		for(texture::size_type Index = 0; Index < Level; ++Index)
+			First += (get_kmg_image_size(Header, Index) + Header.ChunkSize - 1) / Header.ChunkSize * Header.Layers * Header.Faces;
+		return First;
+	}
+
+	inline bool check_kmg200(kmgHeader20 const& Header)
 	{
-		detail::kmgHeader10 const & Header(*reinterpret_cast<detail::kmgHeader10 const *>(Data));
+		if(Header.Endianness != 0x04030201 || !is_kmg_supercompression_supported(Header.Supercompression))
+			return false;
+		if(Header.ChunkSize == 0 || Header.ChunkSize > KMG_CHUNK_SIZE_MAX)
+			return false;
+		if(!check_swizzles(Header.SwizzleRed, Header.SwizzleGreen, Header.SwizzleBlue, Header.SwizzleAlpha))
+			return false;
+		if(!check_texture_desc(Header.Target, Header.Format, Header.PixelWidth, Header.PixelHeight, Header.PixelDepth, Header.Layers, Header.Faces, Header.Levels))
+			return false;
 
-		size_t Offset = sizeof(detail::kmgHeader10);
+		return get_kmg_first_chunk(Header, Header.Levels) == Header.ChunkCount;
+	}
+
+	// Verify the checksum of a stored chunk and decompress it to the Size bytes pointed by Dst
+	inline bool decode_kmg_chunk(std::uint32_t Supercompression, char const* Src, std::size_t Length, std::uint64_t Checksum, char* Dst, std::size_t Size)
+	{
+		if(hash_data(Src, Length) != Checksum)
+			return false;
+
+		switch(Supercompression)
+		{
+		case SUPERCOMPRESSION_NONE:
+			if(Length != Size)
+				return false;
+			std::memcpy(Dst, Src, Size);
+			return true;
+#		if defined(GLI_ZSTD)
+		case SUPERCOMPRESSION_ZSTD:
+		{
+			std::size_t const Result = ZSTD_decompress(Dst, Size, Src, Length);
+			return !ZSTD_isError(Result) && Result == Size;
+		}
+#		endif
+#		if defined(GLI_LZ4)
+		case SUPERCOMPRESSION_LZ4:
+			if(Length > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+				return false;
+			return LZ4_decompress_safe(Src, Dst, static_cast<int>(Length), static_cast<int>(Size)) == static_cast<int>(Size);
+#		endif
+		default:
+			return false;
+		}
+	}
 
+	/// Create a texture of the levels BaseLevel to MaxLevel and decode their chunks in parallel.
+	/// Data holds DataSize bytes of the file starting at DataOffset, Chunks holds the index of the loaded levels only.
+	inline texture load_kmg200(kmgHeader20 const& Header, std::vector<kmgChunk20> const& Chunks, char const* Data, std::uint64_t DataOffset, std::size_t DataSize, texture::size_type BaseLevel, texture::size_type MaxLevel)
+	{
 		texture Texture(
 			static_cast<target>(Header.Target),
 			static_cast<format>(Header.Format),
-			texture::extent_type(Header.PixelWidth, Header.PixelHeight, Header.PixelDepth),
+			glm::max(get_kmg_extent(Header) >> static_cast<int>(BaseLevel), texture::extent_type(1)),
 			Header.Layers,
 			Header.Faces,
-			Header.Levels,
+			MaxLevel - BaseLevel + 1,
 			texture::swizzles_type(Header.SwizzleRed, Header.SwizzleGreen, Header.SwizzleBlue, Header.SwizzleAlpha));
 
+		struct chunk_task
+		{
+			char const* Src;
+			std::size_t Length;
+			char* Dst;
+			std::size_t Size;
+		};
+
+		std::vector<chunk_task> Tasks;
+		Tasks.reserve(Chunks.size());
+
+		for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
+		for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
+		for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
+		{
+			std::size_t const ImageSize = Texture.size(Level);
+			char* const Image = static_cast<char*>(Texture.data(Layer, Face, Level));
+
+			for(std::size_t Offset = 0; Offset < ImageSize; Offset += Header.ChunkSize)
+			{
+				GLI_ASSERT(Tasks.size() < Chunks.size());
+				kmgChunk20 const& Chunk = Chunks[Tasks.size()];
+				if(Chunk.ByteOffset < DataOffset || Chunk.ByteOffset - DataOffset > DataSize || Chunk.ByteLength > DataSize - (Chunk.ByteOffset - DataOffset))
+					return texture();
+
+				chunk_task const Task = {
+					Data + (Chunk.ByteOffset - DataOffset), static_cast<std::size_t>(Chunk.ByteLength),
+					Image + Offset, std::min<std::size_t>(Header.ChunkSize, ImageSize - Offset)};
+				Tasks.push_back(Task);
+			}
+		}
+		GLI_ASSERT(Tasks.size() == Chunks.size());
+
+		std::vector<char> Failed(Tasks.size(), 0);
+		detail::parallel_for(0, Tasks.size(), 1, [&](std::size_t RangeBegin, std::size_t RangeEnd)
+		{
+			for(std::size_t Index = RangeBegin; Index < RangeEnd; ++Index)
+			{
+				chunk_task const& Task = Tasks[Index];
+				Failed[Index] = decode_kmg_chunk(Header.Supercompression, Task.Src, Task.Length, Chunks[Index].Checksum, Task.Dst, Task.Size) ? 0 : 1;
+			}
+		});
+
+		for(std::size_t Index = 0; Index < Failed.size(); ++Index)
+			if(Failed[Index])
+				return texture();
+
+		return Texture;
+	}
+
+	// Clamp MaxLevel and read the index of the chunks of the levels BaseLevel to MaxLevel
+	inline bool read_kmg200_index(kmgHeader20 const& Header, texture::size_type BaseLevel, texture::size_type& MaxLevel, std::uint64_t& First, std::uint64_t& Count)
+	{
+		if(!check_kmg200(Header) || BaseLevel >= Header.Levels || BaseLevel > MaxLevel)
+			return false;
+
+		MaxLevel = std::min<texture::size_type>(MaxLevel, Header.Levels - 1);
+		First = get_kmg_first_chunk(Header, BaseLevel);
+		Count = get_kmg_first_chunk(Header, MaxLevel + 1) - First;
+
+		return true;
+	}
+
+	/// Parse and validate the header and the chunk index of a KMG 2.0 container of Size bytes.
+	/// Offset and End are the range holding the chunks, End must be checked against the size of the container before reading them.
+	inline parse_error parse_kmg200(char const* Data, std::size_t Size, container_desc& Desc)
+	{
+		std::size_t const IndexOffset = sizeof(FOURCC_KMG200) + sizeof(kmgHeader20);
+		if(Size < sizeof(FOURCC_KMG200))
+			return PARSE_TRUNCATED;
+		if(std::memcmp(Data, FOURCC_KMG200, sizeof(FOURCC_KMG200)) != 0)
+			return PARSE_BAD_HEADER;
+		if(Size < IndexOffset)
+			return PARSE_TRUNCATED;
+
+		kmgHeader20 Header;
+		std::memcpy(&Header, Data + sizeof(FOURCC_KMG200), sizeof(Header));
+
+		if(Header.Endianness != 0x04030201 || !check_swizzles(Header.SwizzleRed, Header.SwizzleGreen, Header.SwizzleBlue, Header.SwizzleAlpha))
+			return PARSE_BAD_HEADER;
+		if(!is_kmg_supercompression_supported(Header.Supercompression))
+			return PARSE_UNSUPPORTED_FORMAT;
+
+		Desc.Target = static_cast<target>(Header.Target);
+		Desc.Format = static_cast<format>(Header.Format);
+		Desc.Extent = get_kmg_extent(Header);
+		Desc.Layers = Header.Layers;
+		Desc.Faces = Header.Faces;
+		Desc.Levels = Header.Levels;
+		Desc.Swizzles = swizzles(
+			static_cast<swizzle>(Header.SwizzleRed), static_cast<swizzle>(Header.SwizzleGreen),
+			static_cast<swizzle>(Header.SwizzleBlue), static_cast<swizzle>(Header.SwizzleAlpha));
+		Desc.Swap = 0;
+
+		parse_error const Error = check_container_desc(Desc);
+		if(Error != PARSE_SUCCESS)
+			return Error;
+		if(!check_kmg200(Header))
+			return PARSE_BAD_HEADER;
+		if((Size - IndexOffset) / sizeof(kmgChunk20) < Header.ChunkCount)
+			return PARSE_TRUNCATED;
+
+		Desc.Offset = std::numeric_limits<std::uint64_t>::max();
+		Desc.End = IndexOffset + static_cast<std::uint64_t>(Header.ChunkCount) * sizeof(kmgChunk20);
+		for(std::uint32_t Index = 0; Index < Header.ChunkCount; ++Index)
+		{
+			kmgChunk20 Chunk;
+			std::memcpy(&Chunk, Data + IndexOffset + Index * sizeof(kmgChunk20), sizeof(Chunk));
+			if(Chunk.ByteLength > std::numeric_limits<std::uint64_t>::max() - Chunk.ByteOffset)
+				return PARSE_BAD_HEADER;
+
+			Desc.Offset = std::min(Desc.Offset, Chunk.ByteOffset);
+			Desc.End = std::max(Desc.End, Chunk.ByteOffset + Chunk.ByteLength);
+		}
+
+		return PARSE_SUCCESS;
+	}
+
+	inline texture load_kmg200(char const* Data, std::size_t Size, texture::size_type BaseLevel, texture::size_type MaxLevel)
+	{
+		std::size_t const IndexOffset = sizeof(FOURCC_KMG200) + sizeof(kmgHeader20);
+
+		container_desc Desc;
+		if(parse_kmg200(Data, Size, Desc) != PARSE_SUCCESS || Desc.End > Size)
+			return texture();
+
+		kmgHeader20 Header;
+		std::memcpy(&Header, Data + sizeof(FOURCC_KMG200), sizeof(Header));
+
+		std::uint64_t First = 0, Count = 0;
+		if(!read_kmg200_index(Header, BaseLevel, MaxLevel, First, Count))
+			return texture();
+
+		std::vector<kmgChunk20> Chunks(static_cast<std::size_t>(Count));
+		std::memcpy(&Chunks[0], Data + IndexOffset + First * sizeof(kmgChunk20), Chunks.size() * sizeof(kmgChunk20));
+
+		return load_kmg200(Header, Chunks, Data, 0, Size, BaseLevel, MaxLevel);
+	}
+
+	// Only the header, the index of the requested levels and the range of the file holding their chunks are read
+	inline texture load_kmg200(FILE* File, texture::size_type BaseLevel, texture::size_type MaxLevel)
+	{
+		std::size_t const IndexOffset = sizeof(FOURCC_KMG200) + sizeof(kmgHeader20);
+
+		kmgHeader20 Header;
+		if(!seek_file(File, sizeof(FOURCC_KMG200), SEEK_SET) || std::fread(&Header, sizeof(Header), 1, File) != 1)
+			return texture();
+
+		std::uint64_t First = 0, Count = 0;
+		if(!read_kmg200_index(Header, BaseLevel, MaxLevel, First, Count))
+			return texture();
+
+		seek_file(File, 0, SEEK_END);
+		std::int64_t const End = tell_file(File);
+		if(End < static_cast<std::int64_t>(IndexOffset) || (static_cast<std::uint64_t>(End) - IndexOffset) / sizeof(kmgChunk20) < Header.ChunkCount)
+			return texture();
+		std::uint64_t const FileSize = static_cast<std::uint64_t>(End);
+
+		std::vector<kmgChunk20> Chunks(static_cast<std::size_t>(Count));
+		if(!seek_file(File, static_cast<std::int64_t>(IndexOffset + First * sizeof(kmgChunk20)), SEEK_SET) || std::fread(&Chunks[0], sizeof(kmgChunk20), Chunks.size(), File) != Chunks.size())
+			return texture();
+
+		std::uint64_t Begin = FileSize;
+		std::uint64_t Last = 0;
+		for(std::size_t Index = 0; Index < Chunks.size(); ++Index)
+		{
+			if(Chunks[Index].ByteOffset > FileSize || Chunks[Index].ByteLength > FileSize - Chunks[Index].ByteOffset)
+				return texture();
+			Begin = std::min(Begin, Chunks[Index].ByteOffset);
+			Last = std::max(Last, Chunks[Index].ByteOffset + Chunks[Index].ByteLength);
+		}
+
+		if(Last <= Begin)
+			return texture();
+
+		std::vector<char> Data(static_cast<std::size_t>(Last - Begin));
+		if(!seek_file(File, static_cast<std::int64_t>(Begin), SEEK_SET) || std::fread(&Data[0], 1, Data.size(), File) != Data.size())
+			return texture();
+
+		return load_kmg200(Header, Chunks, &Data[0], Begin, Data.size(), BaseLevel, MaxLevel);
+	}
+
+	/// Parse and validate the header of a KMG 1.0 container of Size bytes and compute the range of its images.
+	/// Only the header is read, End must be checked against the size of the container before reading the images.
+	inline parse_error parse_kmg100(char const* Data, std::size_t Size, container_desc& Desc)
+	{
+		if(Size < sizeof(FOURCC_KMG100))
+			return PARSE_TRUNCATED;
+		if(std::memcmp(Data, FOURCC_KMG100, sizeof(FOURCC_KMG100)) != 0)
+			return PARSE_BAD_HEADER;
+		if(Size < sizeof(FOURCC_KMG100) + sizeof(kmgHeader10))
+			return PARSE_TRUNCATED;
+
+		kmgHeader10 Header;
+		std::memcpy(&Header, Data + sizeof(FOURCC_KMG100), sizeof(Header));
+
+		if(Header.Endianness != 0x04030201 || !check_swizzles(Header.SwizzleRed, Header.SwizzleGreen, Header.SwizzleBlue, Header.SwizzleAlpha))
+			return PARSE_BAD_HEADER;
+
+		Desc.Target = static_cast<target>(Header.Target);
+		Desc.Format = static_cast<format>(Header.Format);
+		Desc.Extent = texture::extent_type(static_cast<int>(Header.PixelWidth), static_cast<int>(Header.PixelHeight), static_cast<int>(Header.PixelDepth));
+		Desc.Layers = Header.Layers;
+		Desc.Faces = Header.Faces;
+		Desc.Levels = Header.Levels;
+		Desc.Swizzles = swizzles(
+			static_cast<swizzle>(Header.SwizzleRed), static_cast<swizzle>(Header.SwizzleGreen),
+			static_cast<swizzle>(Header.SwizzleBlue), static_cast<swizzle>(Header.SwizzleAlpha));
+		Desc.Offset = sizeof(FOURCC_KMG100) + sizeof(kmgHeader10);
+		Desc.Swap = 0;
+
+		parse_error const Error = check_container_desc(Desc);
+		if(Error != PARSE_SUCCESS)
+			return Error;
+		if(Header.BaseLevel > Header.MaxLevel || Header.MaxLevel >= Header.Levels)
+			return PARSE_BAD_HEADER;
+
+		Desc.End = Desc.Offset + get_storage_size(Desc.Format, Desc.Extent, static_cast<std::uint64_t>(Desc.Layers) * Desc.Faces, Desc.Levels);
+		return PARSE_SUCCESS;
+	}
+
+	inline texture load_kmg100(char const * Data, std::size_t Size)
+	{
+		container_desc Desc;
+		if(parse_kmg100(Data, Size, Desc) != PARSE_SUCCESS || Desc.End > Size)
+			return texture();
+
+		kmgHeader10 Header;
+		std::memcpy(&Header, Data + sizeof(FOURCC_KMG100), sizeof(Header));
+
+		texture Texture(Desc.Target, Desc.Format, Desc.Extent, Desc.Layers, Desc.Faces, Desc.Levels, Desc.Swizzles);
+
+		std::size_t Offset = static_cast<std::size_t>(Desc.Offset);
 		for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
 		for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
 		{
@@ -49,9 +416,7 @@ namespace detail
 			for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
 			{
 				std::memcpy(Texture.data(Layer, Face, Level), Data + Offset, FaceSize);
-
 				Offset += FaceSize;
-				GLI_ASSERT(Offset <= Size);
 			}
 		}
 
@@ -59,45 +424,82 @@ namespace detail
 			Texture, Texture.target(), Texture.format(),
 			Texture.base_layer(), Texture.max_layer(),
 			Texture.base_face(), Texture.max_face(),
-			Header.BaseLevel, Header.MaxLevel, 
+			Header.BaseLevel, Header.MaxLevel,
 			Texture.swizzles());
 	}
 }//namespace detail
 
-	inline texture load_kmg(char const * Data, std::size_t Size)
+	inline texture load_kmg(char const * Data, std::size_t Size, texture::size_type BaseLevel, texture::size_type MaxLevel)
 	{
-		GLI_ASSERT(Data && (Size >= sizeof(detail::kmgHeader10)));
+		if(Data == nullptr || Size < sizeof(detail::FOURCC_KMG100))
+			return texture();
 
 		// KMG100
 		{
 			if(memcmp(Data, detail::FOURCC_KMG100, sizeof(detail::FOURCC_KMG100)) == 0)
-				return detail::load_kmg100(Data + sizeof(detail::FOURCC_KMG100), Size - sizeof(detail::FOURCC_KMG100));
+			{
+				texture const Texture = detail::load_kmg100(Data, Size);
+				if(Texture.empty() || BaseLevel >= Texture.levels() || BaseLevel > MaxLevel)
+					return texture();
+
+				return texture(
+					Texture, Texture.target(), Texture.format(),
+					Texture.base_layer(), Texture.max_layer(),
+					Texture.base_face(), Texture.max_face(),
+					Texture.base_level() + BaseLevel, Texture.base_level() + std::min(MaxLevel, Texture.levels() - 1),
+					Texture.swizzles());
+			}
+		}
+
+		// KMG200
+		{
+			if(memcmp(Data, detail::FOURCC_KMG200, sizeof(detail::FOURCC_KMG200)) == 0)
+				return detail::load_kmg200(Data, Size, BaseLevel, MaxLevel);
 		}
 
 		return texture();
 	}
 
-	inline texture load_kmg(char const * Filename)
+	inline texture load_kmg(char const * Data, std::size_t Size)
+	{
+		return load_kmg(Data, Size, 0, std::numeric_limits<texture::size_type>::max());
+	}
+
+	inline texture load_kmg(char const * Filename, texture::size_type BaseLevel, texture::size_type MaxLevel)
 	{
 		FILE* File = detail::open_file(Filename, "rb");
 		if(!File)
 			return texture();
 
-		long Beg = std::ftell(File);
-		std::fseek(File, 0, SEEK_END);
-		long End = std::ftell(File);
-		std::fseek(File, 0, SEEK_SET);
-
-		std::vector<char> Data(static_cast<std::size_t>(End - Beg));
+		unsigned char FourCC[sizeof(detail::FOURCC_KMG200)];
+		if(std::fread(FourCC, sizeof(FourCC), 1, File) == 1 && memcmp(FourCC, detail::FOURCC_KMG200, sizeof(FourCC)) == 0)
+		{
+			texture const Texture = detail::load_kmg200(File, BaseLevel, MaxLevel);
+			std::fclose(File);
+			return Texture;
+		}
 
-		std::fread(&Data[0], 1, Data.size(), File);
+		std::vector<char> Data;
+		bool const Read = detail::read_file(File, Data);
 		std::fclose(File);
+		if(!Read)
+			return texture();
 
-		return load_kmg(&Data[0], Data.size());
+		return load_kmg(&Data[0], Data.size(), BaseLevel, MaxLevel);
+	}
+
+	inline texture load_kmg(char const * Filename)
+	{
+		return load_kmg(Filename, 0, std::numeric_limits<texture::size_type>::max());
 	}
 
 	inline texture load_kmg(std::string const & Filename)
 	{
 		return load_kmg(Filename.c_str());
 	}
+
+	inline texture load_kmg(std::string const & Filename, texture::size_type BaseLevel, texture::size_type MaxLevel)
+	{
+		return load_kmg(Filename.c_str(), BaseLevel, MaxLevel);
+	}
 }//namespace gli
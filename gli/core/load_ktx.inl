@@ -1,7 +1,16 @@
 #include "../gl.hpp"
+#include "../levels.hpp"
+#include "byte_swap.hpp"
+#include "check.hpp"
 #include "file.hpp"
+#include "parallel.hpp"
 #include <cstdio>
 #include <cassert>
+#include <limits>
+
+#if defined(GLI_ZSTD)
+#	include <zstd.h>
+#endif
 
 namespace gli{
 namespace detail
@@ -26,6 +35,37 @@ namespace detail
 		std::uint32_t BytesOfKeyValueData;
 	};
 
+	enum
+	{
+		KTX_ENDIAN_REF = 0x04030201,
+		KTX_ENDIAN_REF_REV = 0x01020304
+	};
+
+	/// Read the header following the KTX identifier, swapping its fields when the file was written with the other endianness.
+	/// Swap is set to the size of the elements to swap in the images, 0 if the file has the endianness of the host.
+	/// Returns false if the endianness is unknown or if the elements of the images can't be swapped.
+	inline bool read_ktx_header10(char const* Data, ktx_header10& Header, std::size_t& Swap)
+	{
+		std::memcpy(&Header, Data, sizeof(Header));
+
+		Swap = 0;
+		if(Header.Endianness == KTX_ENDIAN_REF)
+			return true;
+		if(Header.Endianness != KTX_ENDIAN_REF_REV)
+			return false;
+
+		std::uint32_t* Fields = reinterpret_cast<std::uint32_t*>(&Header);
+		for(std::size_t Index = 0; Index < sizeof(Header) / sizeof(std::uint32_t); ++Index)
+			Fields[Index] = swap_bytes(Fields[Index]);
+
+		// Compressed formats store bytes with a GLTypeSize of 1
+		if(Header.GLTypeSize != 1 && Header.GLTypeSize != 2 && Header.GLTypeSize != 4 && Header.GLTypeSize != 8)
+			return false;
+
+		Swap = Header.GLTypeSize;
+		return true;
+	}
+
 	inline target get_target(ktx_header10 const& Header)
 	{
 		if(Header.NumberOfFaces > 1)
@@ -50,45 +90,91 @@ namespace detail
 			return TARGET_2D;
 	}
 
-	inline texture load_ktx10(char const* Data, std::size_t Size)
+	/// Parse and validate the header of a KTX container of Size bytes and compute the range of its images.
+	/// Only the header is read, End must be checked against the size of the container before reading the images.
+	inline parse_error parse_ktx10(char const* Data, std::size_t Size, container_desc& Desc)
 	{
-		detail::ktx_header10 const & Header(*reinterpret_cast<detail::ktx_header10 const*>(Data));
-
-		size_t Offset = sizeof(detail::ktx_header10);
+		if(Size < sizeof(FOURCC_KTX10))
+			return PARSE_TRUNCATED;
+		if(std::memcmp(Data, FOURCC_KTX10, sizeof(FOURCC_KTX10)) != 0)
+			return PARSE_BAD_HEADER;
+		if(Size < sizeof(FOURCC_KTX10) + sizeof(ktx_header10))
+			return PARSE_TRUNCATED;
 
-		// Skip key value data
-		Offset += Header.BytesOfKeyValueData;
+		ktx_header10 Header;
+		if(!read_ktx_header10(Data + sizeof(FOURCC_KTX10), Header, Desc.Swap))
+			return PARSE_BAD_HEADER;
 
 		gl GL(gl::PROFILE_KTX);
-		gli::format const Format = GL.find(
-			static_cast<gli::gl::internal_format>(Header.GLInternalFormat),
-			static_cast<gli::gl::external_format>(Header.GLFormat),
-			static_cast<gli::gl::type_format>(Header.GLType));
-		GLI_ASSERT(Format != gli::FORMAT_UNDEFINED);
+		Desc.Target = get_target(Header);
+		Desc.Format = GL.find(
+			static_cast<gl::internal_format>(Header.GLInternalFormat),
+			static_cast<gl::external_format>(Header.GLFormat),
+			static_cast<gl::type_format>(Header.GLType));
+		Desc.Extent = texture::extent_type(
+			static_cast<int>(Header.PixelWidth),
+			std::max<int>(static_cast<int>(Header.PixelHeight), 1),
+			std::max<int>(static_cast<int>(Header.PixelDepth), 1));
+		Desc.Layers = std::max<std::uint32_t>(Header.NumberOfArrayElements, 1);
+		Desc.Faces = std::max<std::uint32_t>(Header.NumberOfFaces, 1);
+		Desc.Levels = std::max<std::uint32_t>(Header.NumberOfMipmapLevels, 1);
+		Desc.Swizzles = swizzles(SWIZZLE_RED, SWIZZLE_GREEN, SWIZZLE_BLUE, SWIZZLE_ALPHA);
+		Desc.Offset = sizeof(FOURCC_KTX10) + sizeof(ktx_header10) + static_cast<std::uint64_t>(Header.BytesOfKeyValueData);
 
-		texture::size_type const BlockSize = block_size(Format);
+		parse_error const Error = check_container_desc(Desc);
+		if(Error != PARSE_SUCCESS)
+			return Error;
+
+		std::uint64_t const BlockSize = block_size(Desc.Format);
+		if(Desc.Swap > 1 && BlockSize % Desc.Swap != 0)
+			return PARSE_BAD_HEADER;
+
+		// Each level starts with its size, each image is padded to 4 bytes
+		std::uint64_t const Images = static_cast<std::uint64_t>(Desc.Layers) * Desc.Faces;
+		Desc.End = Desc.Offset;
+		for(texture::size_type Level = 0; Level < Desc.Levels; ++Level)
+		{
+			std::uint64_t const ImageSize = get_storage_size(Desc.Format, glm::max(Desc.Extent >> static_cast<int>(Level), texture::extent_type(1)), 1, 1);
+			Desc.End += sizeof(std::uint32_t) + Images * std::max(BlockSize, glm::ceilMultiple(ImageSize, static_cast<std::uint64_t>(4)));
+		}
+
+		return PARSE_SUCCESS;
+	}
+
+	/// Load the levels BaseLevel to MaxLevel of a KTX file, KTX has no level index so the data of the previous levels is skipped
+	inline texture load_ktx10(char const* Data, std::size_t Size, texture::size_type BaseLevel, texture::size_type MaxLevel)
+	{
+		container_desc Desc;
+		if(parse_ktx10(Data, Size, Desc) != PARSE_SUCCESS || Desc.End > Size)
+			return texture();
+		if(BaseLevel >= Desc.Levels || BaseLevel > MaxLevel)
+			return texture();
+		MaxLevel = std::min(MaxLevel, Desc.Levels - 1);
 
 		texture Texture(
-			detail::get_target(Header),
-			Format,
-			texture::extent_type(
-				Header.PixelWidth,
-				std::max<texture::size_type>(Header.PixelHeight, 1),
-				std::max<texture::size_type>(Header.PixelDepth, 1)),
-			std::max<texture::size_type>(Header.NumberOfArrayElements, 1),
-			std::max<texture::size_type>(Header.NumberOfFaces, 1),
-			std::max<texture::size_type>(Header.NumberOfMipmapLevels, 1));
-
-		for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
+			Desc.Target,
+			Desc.Format,
+			glm::max(Desc.Extent >> static_cast<int>(BaseLevel), texture::extent_type(1)),
+			Desc.Layers,
+			Desc.Faces,
+			MaxLevel - BaseLevel + 1);
+
+		texture::size_type const BlockSize = block_size(Desc.Format);
+		std::size_t Offset = static_cast<std::size_t>(Desc.Offset);
+		for(texture::size_type Level = 0; Level <= MaxLevel; ++Level)
 		{
 			Offset += sizeof(std::uint32_t);
 
+			texture::extent_type const BlockCount = glm::ceilMultiple(glm::max(Desc.Extent >> static_cast<int>(Level), texture::extent_type(1)), block_extent(Desc.Format)) / block_extent(Desc.Format);
+			texture::size_type const FaceSize = BlockSize * BlockCount.x * BlockCount.y * BlockCount.z;
+
 			for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
 			for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
 			{
-				texture::size_type const FaceSize = Texture.size(Level);
-
-				std::memcpy(Texture.data(Layer, Face, Level), Data + Offset, FaceSize);
+				if(Level >= BaseLevel && Desc.Swap > 1)
+					detail::copy_swap(Texture.data(Layer, Face, Level - BaseLevel), Data + Offset, FaceSize, Desc.Swap);
+				else if(Level >= BaseLevel)
+					std::memcpy(Texture.data(Layer, Face, Level - BaseLevel), Data + Offset, FaceSize);
 
 				Offset += std::max(BlockSize, glm::ceilMultiple(FaceSize, static_cast<texture::size_type>(4)));
 			}
@@ -96,42 +182,542 @@ namespace detail
 
 		return Texture;
 	}
+
+	// KTX2 file header, including the identifier so that the 64 bits fields are aligned
+	struct ktx_header20
+	{
+		std::uint8_t Identifier[12];
+		std::uint32_t VkFormat;
+		std::uint32_t TypeSize;
+		std::uint32_t PixelWidth;
+		std::uint32_t PixelHeight;
+		std::uint32_t PixelDepth;
+		std::uint32_t LayerCount;
+		std::uint32_t FaceCount;
+		std::uint32_t LevelCount;
+		std::uint32_t SupercompressionScheme;
+		std::uint32_t DFDByteOffset;
+		std::uint32_t DFDByteLength;
+		std::uint32_t KVDByteOffset;
+		std::uint32_t KVDByteLength;
+		std::uint64_t SGDByteOffset;
+		std::uint64_t SGDByteLength;
+	};
+
+	// Entry of the level index following the header, offsets are from the beginning of the file
+	struct ktx_level20
+	{
+		std::uint64_t ByteOffset;
+		std::uint64_t ByteLength;
+		std::uint64_t UncompressedByteLength;
+	};
+
+	enum
+	{
+		KTX2_SUPERCOMPRESSION_NONE = 0,
+		KTX2_SUPERCOMPRESSION_ZSTD = 2
+	};
+
+	// Values of the Khronos Data Format basic descriptor block
+	enum
+	{
+		KHR_DF_MODEL_RGBSDA = 1,
+		KHR_DF_MODEL_BC1A = 128,
+		KHR_DF_MODEL_BC2 = 129,
+		KHR_DF_MODEL_BC3 = 130,
+		KHR_DF_MODEL_BC4 = 131,
+		KHR_DF_MODEL_BC5 = 132,
+		KHR_DF_MODEL_BC6H = 133,
+		KHR_DF_MODEL_BC7 = 134,
+		KHR_DF_MODEL_ETC2 = 161,
+		KHR_DF_MODEL_ASTC = 162,
+
+		KHR_DF_PRIMARIES_BT709 = 1,
+		KHR_DF_TRANSFER_LINEAR = 1,
+		KHR_DF_TRANSFER_SRGB = 2,
+
+		KHR_DF_CHANNEL_RED = 0,
+		KHR_DF_CHANNEL_GREEN = 1,
+		KHR_DF_CHANNEL_BLUE = 2,
+		KHR_DF_CHANNEL_STENCIL = 13,
+		KHR_DF_CHANNEL_DEPTH = 14,
+		KHR_DF_CHANNEL_ALPHA = 15,
+		KHR_DF_CHANNEL_COLOR = 0,
+		KHR_DF_CHANNEL_BC1A_ALPHAPRESENT = 1,
+		KHR_DF_CHANNEL_ETC2_COLOR = 2,
+
+		KHR_DF_SAMPLE_LINEAR = 0x10,
+		KHR_DF_SAMPLE_EXPONENT = 0x20,
+		KHR_DF_SAMPLE_SIGNED = 0x40,
+		KHR_DF_SAMPLE_FLOAT = 0x80
+	};
+
+	// gli formats up to the ASTC formats share the values of VkFormat
+	inline std::uint32_t get_ktx2_vk_format(format Format)
+	{
+		return Format >= FORMAT_FIRST && Format <= FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16 ? static_cast<std::uint32_t>(Format) : 0;
+	}
+
+	inline format get_ktx2_format(std::uint32_t VkFormat)
+	{
+		return VkFormat >= FORMAT_FIRST && VkFormat <= FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16 ? static_cast<format>(VkFormat) : FORMAT_UNDEFINED;
+	}
+
+	inline target get_target(ktx_header20 const& Header)
+	{
+		if(Header.FaceCount > 1)
+			return Header.LayerCount > 0 ? TARGET_CUBE_ARRAY : TARGET_CUBE;
+		else if(Header.LayerCount > 0)
+			return Header.PixelHeight == 0 ? TARGET_1D_ARRAY : TARGET_2D_ARRAY;
+		else if(Header.PixelHeight == 0)
+			return TARGET_1D;
+		else if(Header.PixelDepth > 0)
+			return TARGET_3D;
+		else
+			return TARGET_2D;
+	}
+
+	// Basic descriptor block fields checked against the format when loading
+	struct ktx2_dfd
+	{
+		std::uint32_t ColorModel;
+		std::uint32_t TransferFunction;
+		texture::extent_type BlockExtent;
+		std::uint32_t BytesPlane0;
+	};
+
+	inline std::uint32_t read_ktx2_word(char const* Data)
+	{
+		std::uint32_t Word;
+		std::memcpy(&Word, Data, sizeof(Word));
+		return Word;
+	}
+
+	/// Walk the descriptor blocks of a data format descriptor and read its basic descriptor block.
+	/// Returns false when the descriptor is malformed or has no basic descriptor block.
+	inline bool parse_ktx2_dfd(char const* Data, std::size_t Size, ktx2_dfd& DFD)
+	{
+		if(Size < sizeof(std::uint32_t) || read_ktx2_word(Data) != Size)
+			return false;
+
+		bool Found = false;
+		for(std::size_t Offset = sizeof(std::uint32_t); Offset + 2 * sizeof(std::uint32_t) <= Size;)
+		{
+			std::uint32_t const Vendor = read_ktx2_word(Data + Offset) & 0x1ffff;
+			std::uint32_t const Type = read_ktx2_word(Data + Offset) >> 17;
+			std::size_t const BlockSize = read_ktx2_word(Data + Offset + 4) >> 16;
+			if(BlockSize < 8 || BlockSize > Size - Offset)
+				return false;
+
+			if(Vendor == 0 && Type == 0 && BlockSize >= 24 && !Found)
+			{
+				std::uint32_t const Model = read_ktx2_word(Data + Offset + 8);
+				std::uint32_t const Dimensions = read_ktx2_word(Data + Offset + 12);
+				DFD.ColorModel = Model & 0xff;
+				DFD.TransferFunction = (Model >> 16) & 0xff;
+				DFD.BlockExtent = texture::extent_type(
+					static_cast<int>(Dimensions & 0xff) + 1,
+					static_cast<int>((Dimensions >> 8) & 0xff) + 1,
+					static_cast<int>((Dimensions >> 16) & 0xff) + 1);
+				DFD.BytesPlane0 = read_ktx2_word(Data + Offset + 16) & 0xff;
+				Found = true;
+			}
+
+			Offset += BlockSize;
+		}
+
+		return Found;
+	}
+
+	// Bits of the components from the lowest bits of the texel, zero for the formats storing components of the same size
+	inline glm::u8vec4 get_ktx2_component_bits(format Format)
+	{
+		switch(Format)
+		{
+		case FORMAT_RG4_UNORM_PACK8:
+			return glm::u8vec4(4, 4, 0, 0);
+		case FORMAT_RGBA4_UNORM_PACK16:
+		case FORMAT_BGRA4_UNORM_PACK16:
+			return glm::u8vec4(4, 4, 4, 4);
+		case FORMAT_R5G6B5_UNORM_PACK16:
+		case FORMAT_B5G6R5_UNORM_PACK16:
+			return glm::u8vec4(5, 6, 5, 0);
+		case FORMAT_RGB5A1_UNORM_PACK16:
+		case FORMAT_BGR5A1_UNORM_PACK16:
+		case FORMAT_A1RGB5_UNORM_PACK16:
+			return glm::u8vec4(5, 5, 5, 1);
+		case FORMAT_RG11B10_UFLOAT_PACK32:
+			return glm::u8vec4(11, 11, 10, 0);
+		case FORMAT_RGB9E5_UFLOAT_PACK32:
+			return glm::u8vec4(9, 9, 9, 5);
+		case FORMAT_D24_UNORM_PACK32:
+			return glm::u8vec4(24, 0, 0, 0);
+		case FORMAT_D16_UNORM_S8_UINT_PACK32:
+			return glm::u8vec4(16, 8, 0, 0);
+		case FORMAT_D24_UNORM_S8_UINT_PACK32:
+			return glm::u8vec4(24, 8, 0, 0);
+		case FORMAT_D32_SFLOAT_S8_UINT_PACK64:
+			return glm::u8vec4(32, 8, 0, 0);
+		default:
+			if(Format >= FORMAT_RGB10A2_UNORM_PACK32 && Format <= FORMAT_BGR10A2_SINT_PACK32)
+				return glm::u8vec4(10, 10, 10, 2);
+			return glm::u8vec4(0);
+		}
+	}
+
+	inline std::uint32_t ktx2_float_bits(float Value)
+	{
+		std::uint32_t Bits;
+		std::memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	inline void add_ktx2_sample(std::vector<std::uint32_t>& DFD, std::uint32_t BitOffset, std::uint32_t BitLength, std::uint32_t Channel, std::uint32_t Lower, std::uint32_t Upper)
+	{
+		DFD.push_back(BitOffset | ((BitLength - 1) << 16) | (Channel << 24));
+		DFD.push_back(0);
+		DFD.push_back(Lower);
+		DFD.push_back(Upper);
+	}
+
+	// Sample of a channel of BitLength bits, the range of values depends on the format kind
+	inline void add_ktx2_sample(std::vector<std::uint32_t>& DFD, format Format, std::uint32_t BitOffset, std::uint32_t BitLength, std::uint32_t Channel)
+	{
+		bool const Signed = is_signed(Format);
+		std::uint32_t const Max = BitLength >= 32 ? 0xffffffffu : (1u << BitLength) - 1;
+
+		if(is_float(Format))
+			add_ktx2_sample(DFD, BitOffset, BitLength, Channel | KHR_DF_SAMPLE_FLOAT | (Signed ? KHR_DF_SAMPLE_SIGNED : 0), Signed ? ktx2_float_bits(-1.0f) : 0, ktx2_float_bits(1.0f));
+		else if(is_compressed(Format))
+			add_ktx2_sample(DFD, BitOffset, BitLength, Channel | (Signed ? KHR_DF_SAMPLE_SIGNED : 0), Signed ? 0x80000000u : 0, Signed ? 0x7fffffffu : 0xffffffffu);
+		else if(is_normalized(Format))
+			add_ktx2_sample(DFD, BitOffset, BitLength, Channel | (Signed ? KHR_DF_SAMPLE_SIGNED : 0), Signed ? ~(Max >> 1) + 1 : 0, Signed ? Max >> 1 : Max);
+		else
+			add_ktx2_sample(DFD, BitOffset, BitLength, Channel | (Signed ? KHR_DF_SAMPLE_SIGNED : 0), Signed ? 0xffffffffu : 0, 1);
+	}
+
+	// Samples of a compressed format made of BlockSize / 8 bytes parts, each storing a channel
+	inline std::uint32_t add_ktx2_compressed_samples(std::vector<std::uint32_t>& DFD, format Format)
+	{
+		std::uint32_t const Bits = static_cast<std::uint32_t>(block_size(Format)) * 8;
+
+		switch(Format)
+		{
+		case FORMAT_RGB_DXT1_UNORM_BLOCK8: case FORMAT_RGB_DXT1_SRGB_BLOCK8:
+			add_ktx2_sample(DFD, Format, 0, Bits, KHR_DF_CHANNEL_COLOR);
+			return KHR_DF_MODEL_BC1A;
+		case FORMAT_RGBA_DXT1_UNORM_BLOCK8: case FORMAT_RGBA_DXT1_SRGB_BLOCK8:
+			add_ktx2_sample(DFD, Format, 0, Bits, KHR_DF_CHANNEL_BC1A_ALPHAPRESENT);
+			return KHR_DF_MODEL_BC1A;
+		case FORMAT_RGBA_DXT3_UNORM_BLOCK16: case FORMAT_RGBA_DXT3_SRGB_BLOCK16:
+		case FORMAT_RGBA_DXT5_UNORM_BLOCK16: case FORMAT_RGBA_DXT5_SRGB_BLOCK16:
+			add_ktx2_sample(DFD, Format, 0, 64, KHR_DF_CHANNEL_ALPHA);
+			add_ktx2_sample(DFD, Format, 64, 64, KHR_DF_CHANNEL_COLOR);
+			return Format <= FORMAT_RGBA_DXT3_SRGB_BLOCK16 ? KHR_DF_MODEL_BC2 : KHR_DF_MODEL_BC3;
+		case FORMAT_R_ATI1N_UNORM_BLOCK8: case FORMAT_R_ATI1N_SNORM_BLOCK8:
+			add_ktx2_sample(DFD, Format, 0, Bits, KHR_DF_CHANNEL_RED);
+			return KHR_DF_MODEL_BC4;
+		case FORMAT_RG_ATI2N_UNORM_BLOCK16: case FORMAT_RG_ATI2N_SNORM_BLOCK16:
+			add_ktx2_sample(DFD, Format, 0, 64, KHR_DF_CHANNEL_RED);
+			add_ktx2_sample(DFD, Format, 64, 64, KHR_DF_CHANNEL_GREEN);
+			return KHR_DF_MODEL_BC5;
+		case FORMAT_RGB_BP_UFLOAT_BLOCK16: case FORMAT_RGB_BP_SFLOAT_BLOCK16:
+			add_ktx2_sample(DFD, Format, 0, Bits, KHR_DF_CHANNEL_COLOR);
+			return KHR_DF_MODEL_BC6H;
+		case FORMAT_RGBA_BP_UNORM_BLOCK16: case FORMAT_RGBA_BP_SRGB_BLOCK16:
+			add_ktx2_sample(DFD, Format, 0, Bits, KHR_DF_CHANNEL_COLOR);
+			return KHR_DF_MODEL_BC7;
+		case FORMAT_RGBA_ETC2_UNORM_BLOCK16: case FORMAT_RGBA_ETC2_SRGB_BLOCK16:
+			add_ktx2_sample(DFD, Format, 0, 64, KHR_DF_CHANNEL_ALPHA);
+			add_ktx2_sample(DFD, Format, 64, 64, KHR_DF_CHANNEL_ETC2_COLOR);
+			return KHR_DF_MODEL_ETC2;
+		case FORMAT_R_EAC_UNORM_BLOCK8: case FORMAT_R_EAC_SNORM_BLOCK8:
+			add_ktx2_sample(DFD, Format, 0, Bits, KHR_DF_CHANNEL_RED);
+			return KHR_DF_MODEL_ETC2;
+		case FORMAT_RG_EAC_UNORM_BLOCK16: case FORMAT_RG_EAC_SNORM_BLOCK16:
+			add_ktx2_sample(DFD, Format, 0, 64, KHR_DF_CHANNEL_RED);
+			add_ktx2_sample(DFD, Format, 64, 64, KHR_DF_CHANNEL_GREEN);
+			return KHR_DF_MODEL_ETC2;
+		default:
+			if(Format >= FORMAT_RGB_ETC2_UNORM_BLOCK8 && Format <= FORMAT_RGBA_ETC2_SRGB_BLOCK8)
+			{
+				add_ktx2_sample(DFD, Format, 0, Bits, KHR_DF_CHANNEL_ETC2_COLOR);
+				return KHR_DF_MODEL_ETC2;
+			}
+			add_ktx2_sample(DFD, Format, 0, Bits, KHR_DF_CHANNEL_COLOR);
+			return KHR_DF_MODEL_ASTC;
+		}
+	}
+
+	// Channel stored by the component of a texel in memory order
+	inline std::uint32_t get_ktx2_channel(format Format, std::size_t Component)
+	{
+		if(is_depth(Format))
+			return Component == 0 ? KHR_DF_CHANNEL_DEPTH : KHR_DF_CHANNEL_STENCIL;
+		if(is_stencil(Format))
+			return KHR_DF_CHANNEL_STENCIL;
+
+		swizzles const Swizzles = detail::get_format_info(Format).Swizzles;
+		switch(Swizzles[static_cast<length_t>(Component)])
+		{
+		default:
+		case SWIZZLE_RED:
+			return KHR_DF_CHANNEL_RED;
+		case SWIZZLE_GREEN:
+			return KHR_DF_CHANNEL_GREEN;
+		case SWIZZLE_BLUE:
+			return KHR_DF_CHANNEL_BLUE;
+		case SWIZZLE_ALPHA:
+			return is_srgb(Format) ? KHR_DF_CHANNEL_ALPHA | KHR_DF_SAMPLE_LINEAR : KHR_DF_CHANNEL_ALPHA;
+		}
+	}
+
+	/// Data format descriptor of a format with a basic descriptor block, as 32 bits words starting with the total size.
+	/// Supercompressed levels don't have a fixed size of plane so bytesPlane0 is 0.
+	inline std::vector<std::uint32_t> make_ktx2_dfd(format Format, bool Supercompressed)
+	{
+		std::vector<std::uint32_t> Samples;
+		std::uint32_t ColorModel = KHR_DF_MODEL_RGBSDA;
+
+		if(is_compressed(Format))
+			ColorModel = add_ktx2_compressed_samples(Samples, Format);
+		else if(Format == FORMAT_RGB9E5_UFLOAT_PACK32)
+		{
+			for(std::uint32_t Channel = 0; Channel < 3; ++Channel)
+			{
+				add_ktx2_sample(Samples, Channel * 9, 9, Channel, 0, 256);
+				add_ktx2_sample(Samples, 27, 5, Channel | KHR_DF_SAMPLE_EXPONENT, 15, 31);
+			}
+		}
+		else
+		{
+			std::size_t const Components = component_count(Format);
+			glm::u8vec4 const Bits = get_ktx2_component_bits(Format);
+			std::uint32_t const UniformBits = static_cast<std::uint32_t>(block_size(Format) * 8 / Components);
+
+			for(std::size_t Component = 0, BitOffset = 0; Component < Components; ++Component)
+			{
+				std::uint32_t const BitLength = Bits.x == 0 ? UniformBits : Bits[static_cast<length_t>(Component)];
+				add_ktx2_sample(Samples, Format, static_cast<std::uint32_t>(BitOffset), BitLength, get_ktx2_channel(Format, Component));
+				BitOffset += BitLength;
+			}
+		}
+
+		std::uint32_t const BlockSize = static_cast<std::uint32_t>(24 + Samples.size() * sizeof(std::uint32_t));
+		ivec3 const BlockExtent = block_extent(Format);
+
+		std::vector<std::uint32_t> DFD;
+		DFD.push_back(BlockSize + sizeof(std::uint32_t));
+		DFD.push_back(0);
+		DFD.push_back(2 | (BlockSize << 16));
+		DFD.push_back(ColorModel | (KHR_DF_PRIMARIES_BT709 << 8) | ((is_srgb(Format) ? KHR_DF_TRANSFER_SRGB : KHR_DF_TRANSFER_LINEAR) << 16));
+		DFD.push_back(static_cast<std::uint32_t>((BlockExtent.x - 1) | ((BlockExtent.y - 1) << 8) | ((BlockExtent.z - 1) << 16)));
+		DFD.push_back(Supercompressed ? 0 : static_cast<std::uint32_t>(block_size(Format)));
+		DFD.push_back(0);
+		DFD.insert(DFD.end(), Samples.begin(), Samples.end());
+
+		return DFD;
+	}
+
+	/// Parse and validate the header, the data format descriptor and the level index of a KTX2 container of Size bytes.
+	/// Offset and End are the range holding the levels, End must be checked against the size of the container before reading them.
+	inline parse_error parse_ktx20(char const* Data, std::size_t Size, container_desc& Desc)
+	{
+		if(Size < sizeof(FOURCC_KTX20))
+			return PARSE_TRUNCATED;
+		if(std::memcmp(Data, FOURCC_KTX20, sizeof(FOURCC_KTX20)) != 0)
+			return PARSE_BAD_HEADER;
+		if(Size < sizeof(ktx_header20))
+			return PARSE_TRUNCATED;
+
+		ktx_header20 Header;
+		std::memcpy(&Header, Data, sizeof(Header));
+
+#		if defined(GLI_ZSTD)
+			if(Header.SupercompressionScheme != KTX2_SUPERCOMPRESSION_NONE && Header.SupercompressionScheme != KTX2_SUPERCOMPRESSION_ZSTD)
+				return PARSE_UNSUPPORTED_FORMAT;
+#		else
+			if(Header.SupercompressionScheme != KTX2_SUPERCOMPRESSION_NONE)
+				return PARSE_UNSUPPORTED_FORMAT;
+#		endif
+
+		Desc.Target = get_target(Header);
+		Desc.Format = get_ktx2_format(Header.VkFormat);
+		Desc.Extent = texture::extent_type(
+			static_cast<int>(Header.PixelWidth),
+			std::max<int>(static_cast<int>(Header.PixelHeight), 1),
+			std::max<int>(static_cast<int>(Header.PixelDepth), 1));
+		Desc.Layers = std::max<std::uint32_t>(Header.LayerCount, 1);
+		Desc.Faces = Header.FaceCount;
+		Desc.Levels = std::max<std::uint32_t>(Header.LevelCount, 1);
+		Desc.Swizzles = swizzles(SWIZZLE_RED, SWIZZLE_GREEN, SWIZZLE_BLUE, SWIZZLE_ALPHA);
+		Desc.Swap = 0;
+
+		parse_error const Error = check_container_desc(Desc);
+		if(Error != PARSE_SUCCESS)
+			return Error;
+
+		if((Size - sizeof(ktx_header20)) / sizeof(ktx_level20) < Desc.Levels)
+			return PARSE_TRUNCATED;
+		if(Header.DFDByteOffset > Size || Header.DFDByteLength > Size - Header.DFDByteOffset)
+			return PARSE_TRUNCATED;
+
+		ktx2_dfd DFD;
+		if(!parse_ktx2_dfd(Data + Header.DFDByteOffset, Header.DFDByteLength, DFD))
+			return PARSE_BAD_HEADER;
+		if(DFD.BlockExtent != block_extent(Desc.Format) || (DFD.BytesPlane0 != 0 && DFD.BytesPlane0 != block_size(Desc.Format)))
+			return PARSE_BAD_HEADER;
+
+		bool const Supercompressed = Header.SupercompressionScheme != KTX2_SUPERCOMPRESSION_NONE;
+		std::uint64_t const Images = static_cast<std::uint64_t>(Desc.Layers) * Desc.Faces;
+
+		Desc.Offset = std::numeric_limits<std::uint64_t>::max();
+		Desc.End = 0;
+		for(texture::size_type Level = 0; Level < Desc.Levels; ++Level)
+		{
+			ktx_level20 Index;
+			std::memcpy(&Index, Data + sizeof(ktx_header20) + sizeof(ktx_level20) * Level, sizeof(Index));
+
+			std::uint64_t const LevelSize = get_storage_size(Desc.Format, glm::max(Desc.Extent >> static_cast<int>(Level), texture::extent_type(1)), Images, 1);
+			if(Index.UncompressedByteLength != LevelSize || (!Supercompressed && Index.ByteLength != LevelSize))
+				return PARSE_BAD_HEADER;
+			if(Index.ByteLength > std::numeric_limits<std::uint64_t>::max() - Index.ByteOffset)
+				return PARSE_BAD_HEADER;
+
+			Desc.Offset = std::min(Desc.Offset, Index.ByteOffset);
+			Desc.End = std::max(Desc.End, Index.ByteOffset + Index.ByteLength);
+		}
+
+		return PARSE_SUCCESS;
+	}
+
+	/// Load the levels BaseLevel to MaxLevel of a KTX2 file, seeking them through the level index.
+	/// Zstandard supercompressed levels are decompressed in parallel when GLI_ZSTD is defined.
+	inline texture load_ktx20(char const* Data, std::size_t Size, texture::size_type BaseLevel, texture::size_type MaxLevel)
+	{
+		container_desc Desc;
+		if(parse_ktx20(Data, Size, Desc) != PARSE_SUCCESS || Desc.End > Size)
+			return texture();
+		if(BaseLevel >= Desc.Levels || BaseLevel > MaxLevel)
+			return texture();
+		MaxLevel = std::min(MaxLevel, Desc.Levels - 1);
+
+		ktx_header20 Header;
+		std::memcpy(&Header, Data, sizeof(Header));
+		bool const Supercompressed = Header.SupercompressionScheme != KTX2_SUPERCOMPRESSION_NONE;
+
+		texture Texture(
+			Desc.Target,
+			Desc.Format,
+			glm::max(Desc.Extent >> static_cast<int>(BaseLevel), texture::extent_type(1)),
+			Desc.Layers,
+			Desc.Faces,
+			MaxLevel - BaseLevel + 1);
+
+		std::vector<ktx_level20> Levels(Texture.levels());
+		std::memcpy(&Levels[0], Data + sizeof(ktx_header20) + sizeof(ktx_level20) * BaseLevel, sizeof(ktx_level20) * Levels.size());
+
+		if(!Supercompressed)
+		{
+			for(texture::size_type Level = 0; Level < Levels.size(); ++Level)
+			{
+				char const* Src = Data + Levels[Level].ByteOffset;
+				for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
+				for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face, Src += Texture.size(Level))
+					std::memcpy(Texture.data(Layer, Face, Level), Src, Texture.size(Level));
+			}
+
+			return Texture;
+		}
+
+#		if defined(GLI_ZSTD)
+			texture::size_type const Images = Texture.layers() * Texture.faces();
+			std::vector<char> Failed(Levels.size(), 0);
+			detail::parallel_for(0, Levels.size(), 1, [&](std::size_t RangeBegin, std::size_t RangeEnd)
+			{
+				for(std::size_t Level = RangeBegin; Level < RangeEnd; ++Level)
+				{
+					ktx_level20 const& Index = Levels[Level];
+					std::size_t const LevelSize = static_cast<std::size_t>(Index.UncompressedByteLength);
+
+					// The images of a level are contiguous in the file but not in the texture when it has several layers or faces
+					std::vector<char> Buffer(Images > 1 ? LevelSize : 0);
+					char* Dst = Images > 1 ? &Buffer[0] : static_cast<char*>(Texture.data(0, 0, Level));
+
+					std::size_t const Result = ZSTD_decompress(Dst, LevelSize, Data + Index.ByteOffset, static_cast<std::size_t>(Index.ByteLength));
+					if(ZSTD_isError(Result) || Result != LevelSize)
+					{
+						Failed[Level] = 1;
+						continue;
+					}
+
+					for(texture::size_type Layer = 0, Layers = Texture.layers(); Images > 1 && Layer < Layers; ++Layer)
+					for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face, Dst += Texture.size(Level))
+						std::memcpy(Texture.data(Layer, Face, Level), Dst, Texture.size(Level));
+				}
+			});
+
+			for(std::size_t Level = 0; Level < Failed.size(); ++Level)
+				if(Failed[Level])
+					return texture();
+#		endif//GLI_ZSTD
+
+		return Texture;
+	}
 }//namespace detail
 
-	inline texture load_ktx(char const* Data, std::size_t Size)
+	inline texture load_ktx(char const* Data, std::size_t Size, texture::size_type BaseLevel, texture::size_type MaxLevel)
 	{
-		GLI_ASSERT(Data && (Size >= sizeof(detail::ktx_header10)));
+		if(Data == nullptr || Size < sizeof(detail::FOURCC_KTX10))
+			return texture();
 
 		// KTX10
 		{
 			if(memcmp(Data, detail::FOURCC_KTX10, sizeof(detail::FOURCC_KTX10)) == 0)
-				return detail::load_ktx10(Data + sizeof(detail::FOURCC_KTX10), Size - sizeof(detail::FOURCC_KTX10));
+				return detail::load_ktx10(Data, Size, BaseLevel, MaxLevel);
+		}
+
+		// KTX20
+		{
+			if(memcmp(Data, detail::FOURCC_KTX20, sizeof(detail::FOURCC_KTX20)) == 0)
+				return detail::load_ktx20(Data, Size, BaseLevel, MaxLevel);
 		}
 
 		return texture();
 	}
 
-	inline texture load_ktx(char const* Filename)
+	inline texture load_ktx(char const* Data, std::size_t Size)
+	{
+		return load_ktx(Data, Size, 0, std::numeric_limits<texture::size_type>::max());
+	}
+
+	inline texture load_ktx(char const* Filename, texture::size_type BaseLevel, texture::size_type MaxLevel)
 	{
 		FILE* File = detail::open_file(Filename, "rb");
 		if(!File)
 			return texture();
 
-		long Beg = std::ftell(File);
-		std::fseek(File, 0, SEEK_END);
-		long End = std::ftell(File);
-		std::fseek(File, 0, SEEK_SET);
-
-		std::vector<char> Data(static_cast<std::size_t>(End - Beg));
-
-		std::fread(&Data[0], 1, Data.size(), File);
+		std::vector<char> Data;
+		bool const Read = detail::read_file(File, Data);
 		std::fclose(File);
+		if(!Read)
+			return texture();
 
-		return load_ktx(&Data[0], Data.size());
+		return load_ktx(&Data[0], Data.size(), BaseLevel, MaxLevel);
+	}
+
+	inline texture load_ktx(char const* Filename)
+	{
+		return load_ktx(Filename, 0, std::numeric_limits<texture::size_type>::max());
 	}
 
 	inline texture load_ktx(std::string const& Filename)
 	{
 		return load_ktx(Filename.c_str());
 	}
+
+	inline texture load_ktx(std::string const& Filename, texture::size_type BaseLevel, texture::size_type MaxLevel)
+	{
+		return load_ktx(Filename.c_str(), BaseLevel, MaxLevel);
+	}
 }//namespace gli
@@ -0,0 +1,401 @@
+#include "../load_kmg.hpp"
+#include "../hash.hpp"
+#include "check.hpp"
+#include "filter.hpp"
+#include "parallel.hpp"
+#include <glm/gtc/round.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace gli{
+namespace detail
+{
+	static unsigned char const FOURCC_PACK[] = {0xAB, 'G', 'L', 'I', ' ', 'P', 'K', 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+	enum
+	{
+		PACK_ALIGNMENT = 64
+	};
+
+	// The index follows the header at IndexOffset, then the names at NamesOffset, then the storage of the textures.
+	struct packHeader
+	{
+		std::uint32_t Endianness;
+		std::uint32_t Count;
+		std::uint64_t IndexOffset;
+		std::uint64_t NamesOffset;
+		std::uint64_t NamesSize;
+	};
+
+	// Index entries are sorted by hash then name. The description reuses the KMG header, the storage has the layout of storage_linear.
+	struct packEntry
+	{
+		std::uint64_t Hash;
+		std::uint64_t NameOffset;
+		std::uint64_t DataOffset;
+		std::uint64_t DataSize;
+		std::uint32_t NameLength;
+		std::uint32_t Reserved;
+		kmgHeader10 Desc;
+	};
+
+	// Swizzles to give to the texture constructor so that texture::swizzles() returns Swizzles, which include the swizzles of the format
+	inline texture::swizzles_type get_pack_swizzles(format Format, texture::swizzles_type const& Swizzles)
+	{
+		texture::swizzles_type const FormatSwizzles = get_format_info(Format).Swizzles;
+
+		texture::swizzles_type Result(Swizzles);
+		for(texture::swizzles_type::length_type Component = 0; Component < Result.length(); ++Component)
+		{
+			if(!is_channel(Swizzles[Component]))
+				continue;
+			for(texture::swizzles_type::length_type Channel = 0; Channel < FormatSwizzles.length(); ++Channel)
+			{
+				if(FormatSwizzles[Channel] != Swizzles[Component])
+					continue;
+				Result[Component] = static_cast<swizzle>(SWIZZLE_RED + Channel);
+				break;
+			}
+		}
+		return Result;
+	}
+
+	inline std::uint64_t hash_pack_name(char const* Name, std::size_t Length)
+	{
+		return hash_data(Name, Length);
+	}
+
+	// Order of the index entries: hash first, then the bytes of the names
+	inline int compare_pack_name(std::uint64_t HashA, char const* NameA, std::size_t LengthA, std::uint64_t HashB, char const* NameB, std::size_t LengthB)
+	{
+		if(HashA != HashB)
+			return HashA < HashB ? -1 : 1;
+
+		int const Result = std::memcmp(NameA, NameB, std::min(LengthA, LengthB));
+		if(Result != 0)
+			return Result;
+		return LengthA == LengthB ? 0 : (LengthA < LengthB ? -1 : 1);
+	}
+}//namespace detail
+
+	inline bool save_pack(std::vector<std::string> const& Names, std::vector<texture> const& Textures, std::vector<char>& Memory)
+	{
+		if(Names.size() != Textures.size() || Names.size() > static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max()))
+			return false;
+
+		std::size_t const Count = Names.size();
+
+		std::vector<std::uint64_t> Hashes(Count);
+		for(std::size_t Index = 0; Index < Count; ++Index)
+		{
+			if(Textures[Index].empty())
+				return false;
+			Hashes[Index] = detail::hash_pack_name(Names[Index].data(), Names[Index].size());
+		}
+
+		std::vector<std::size_t> Order(Count);
+		for(std::size_t Index = 0; Index < Count; ++Index)
+			Order[Index] = Index;
+		std::sort(Order.begin(), Order.end(), [&](std::size_t A, std::size_t B)
+		{
+			return detail::compare_pack_name(Hashes[A], Names[A].data(), Names[A].size(), Hashes[B], Names[B].data(), Names[B].size()) < 0;
+		});
+
+		for(std::size_t Index = 1; Index < Count; ++Index)
+		{
+			std::size_t const A = Order[Index - 1];
+			std::size_t const B = Order[Index];
+			if(detail::compare_pack_name(Hashes[A], Names[A].data(), Names[A].size(), Hashes[B], Names[B].data(), Names[B].size()) == 0)
+				return false;
+		}
+
+		std::size_t const IndexOffset = glm::ceilMultiple(sizeof(detail::FOURCC_PACK) + sizeof(detail::packHeader), sizeof(std::uint64_t));
+		std::size_t const NamesOffset = IndexOffset + sizeof(detail::packEntry) * Count;
+
+		std::vector<detail::packEntry> Entries(Count);
+		std::size_t NamesSize = 0;
+		for(std::size_t Index = 0; Index < Count; ++Index)
+		{
+			std::string const& Name = Names[Order[Index]];
+			Entries[Index].NameOffset = NamesSize;
+			Entries[Index].NameLength = static_cast<std::uint32_t>(Name.size());
+			NamesSize += Name.size();
+		}
+
+		std::size_t Offset = glm::ceilMultiple(NamesOffset + NamesSize, static_cast<std::size_t>(detail::PACK_ALIGNMENT));
+		for(std::size_t Index = 0; Index < Count; ++Index)
+		{
+			texture const& Texture = Textures[Order[Index]];
+			texture::swizzles_type const Swizzles = detail::get_pack_swizzles(Texture.format(), Texture.swizzles());
+
+			detail::packEntry& Entry = Entries[Index];
+			Entry.Hash = Hashes[Order[Index]];
+			Entry.DataOffset = Offset;
+			Entry.DataSize = Texture.size();
+			Entry.Reserved = 0;
+			Entry.Desc.Endianness = 0x04030201;
+			Entry.Desc.Format = Texture.format();
+			Entry.Desc.Target = Texture.target();
+			Entry.Desc.SwizzleRed = Swizzles[0];
+			Entry.Desc.SwizzleGreen = Swizzles[1];
+			Entry.Desc.SwizzleBlue = Swizzles[2];
+			Entry.Desc.SwizzleAlpha = Swizzles[3];
+			Entry.Desc.PixelWidth = static_cast<std::uint32_t>(Texture.extent().x);
+			Entry.Desc.PixelHeight = static_cast<std::uint32_t>(Texture.extent().y);
+			Entry.Desc.PixelDepth = static_cast<std::uint32_t>(Texture.extent().z);
+			Entry.Desc.Layers = static_cast<std::uint32_t>(Texture.layers());
+			Entry.Desc.Levels = static_cast<std::uint32_t>(Texture.levels());
+			Entry.Desc.Faces = static_cast<std::uint32_t>(Texture.faces());
+			Entry.Desc.GenerateMipmaps = FILTER_NONE;
+			Entry.Desc.BaseLevel = 0;
+			Entry.Desc.MaxLevel = static_cast<std::uint32_t>(Texture.levels() - 1);
+
+			Offset = glm::ceilMultiple(Offset + Texture.size(), static_cast<std::size_t>(detail::PACK_ALIGNMENT));
+		}
+
+		Memory.clear();
+		Memory.resize(Offset, 0);
+
+		detail::packHeader Header;
+		Header.Endianness = 0x04030201;
+		Header.Count = static_cast<std::uint32_t>(Count);
+		Header.IndexOffset = IndexOffset;
+		Header.NamesOffset = NamesOffset;
+		Header.NamesSize = NamesSize;
+
+		std::memcpy(&Memory[0], detail::FOURCC_PACK, sizeof(detail::FOURCC_PACK));
+		std::memcpy(&Memory[0] + sizeof(detail::FOURCC_PACK), &Header, sizeof(Header));
+		if(Count > 0)
+			std::memcpy(&Memory[0] + IndexOffset, &Entries[0], sizeof(detail::packEntry) * Count);
+		for(std::size_t Index = 0; Index < Count; ++Index)
+		{
+			std::string const& Name = Names[Order[Index]];
+			if(!Name.empty())
+				std::memcpy(&Memory[0] + NamesOffset + Entries[Index].NameOffset, Name.data(), Name.size());
+		}
+
+		// Each texture is written image by image in the order of storage_linear so that views are saved as whole textures
+		detail::parallel_for(0, Count, 1, [&](std::size_t RangeBegin, std::size_t RangeEnd)
+		{
+			for(std::size_t Index = RangeBegin; Index < RangeEnd; ++Index)
+			{
+				texture const& Texture = Textures[Order[Index]];
+				char* Dst = &Memory[0] + Entries[Index].DataOffset;
+
+				for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
+				for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
+				for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
+				{
+					texture::size_type const ImageSize = Texture.size(Level);
+					std::memcpy(Dst, Texture.data(Layer, Face, Level), ImageSize);
+					Dst += ImageSize;
+				}
+			}
+		});
+
+		return true;
+	}
+
+	inline bool save_pack(std::vector<std::string> const& Names, std::vector<texture> const& Textures, char const* Filename)
+	{
+		std::vector<char> Memory;
+		if(!save_pack(Names, Textures, Memory))
+			return false;
+
+		FILE* File = detail::open_file(Filename, "wb");
+		if(!File)
+			return false;
+
+		std::fwrite(&Memory[0], 1, Memory.size(), File);
+		std::fclose(File);
+
+		return true;
+	}
+
+	inline bool save_pack(std::vector<std::string> const& Names, std::vector<texture> const& Textures, std::string const& Filename)
+	{
+		return save_pack(Names, Textures, Filename.c_str());
+	}
+
+	inline pack::pack()
+		: Count(0)
+		, IndexOffset(0)
+		, NamesOffset(0)
+		, NamesSize(0)
+	{}
+
+	inline pack::pack(char const* Path)
+		: Count(0)
+		, IndexOffset(0)
+		, NamesOffset(0)
+		, NamesSize(0)
+	{
+		this->open(Path);
+	}
+
+	inline pack::pack(std::string const& Path)
+		: Count(0)
+		, IndexOffset(0)
+		, NamesOffset(0)
+		, NamesSize(0)
+	{
+		this->open(Path.c_str());
+	}
+
+	inline void pack::open(char const* Path)
+	{
+		std::shared_ptr<detail::mapped_file> Mapped(new detail::mapped_file(Path));
+		if(Mapped->empty() || Mapped->size() < sizeof(detail::FOURCC_PACK) + sizeof(detail::packHeader))
+			return;
+
+		char const* Data = Mapped->data();
+		std::size_t const Size = Mapped->size();
+		if(std::memcmp(Data, detail::FOURCC_PACK, sizeof(detail::FOURCC_PACK)) != 0)
+			return;
+
+		detail::packHeader Header;
+		std::memcpy(&Header, Data + sizeof(detail::FOURCC_PACK), sizeof(Header));
+		if(Header.Endianness != 0x04030201)
+			return;
+
+		// The index and the names must be in the file, each name is checked when it is read
+		if(Header.IndexOffset > Size || Header.Count > (Size - Header.IndexOffset) / sizeof(detail::packEntry))
+			return;
+		if(Header.NamesOffset > Size || Header.NamesSize > Size - Header.NamesOffset)
+			return;
+
+		this->File = Mapped;
+		this->Count = Header.Count;
+		this->IndexOffset = static_cast<size_t>(Header.IndexOffset);
+		this->NamesOffset = static_cast<size_t>(Header.NamesOffset);
+		this->NamesSize = static_cast<size_t>(Header.NamesSize);
+	}
+
+	inline bool pack::empty() const
+	{
+		return this->Count == 0;
+	}
+
+	inline pack::size_type pack::size() const
+	{
+		return this->Count;
+	}
+
+	inline pack::size_type pack::find(char const* Name) const
+	{
+		std::size_t const Length = std::strlen(Name);
+		std::uint64_t const Hash = detail::hash_pack_name(Name, Length);
+
+		// Binary search of the index in place, entries are copied as the mapping gives no alignment guarantee
+		size_type First = 0;
+		size_type Last = this->Count;
+		while(First < Last)
+		{
+			size_type const Middle = First + (Last - First) / 2;
+
+			detail::packEntry Entry;
+			std::memcpy(&Entry, this->File->data() + this->IndexOffset + sizeof(detail::packEntry) * Middle, sizeof(Entry));
+			if(Entry.NameOffset > this->NamesSize || Entry.NameLength > this->NamesSize - Entry.NameOffset)
+				return this->Count;
+
+			int const Result = detail::compare_pack_name(
+				Entry.Hash, this->File->data() + this->NamesOffset + Entry.NameOffset, Entry.NameLength,
+				Hash, Name, Length);
+			if(Result == 0)
+				return Middle;
+			if(Result < 0)
+				First = Middle + 1;
+			else
+				Last = Middle;
+		}
+
+		return this->Count;
+	}
+
+	inline pack::size_type pack::find(std::string const& Name) const
+	{
+		return this->find(Name.c_str());
+	}
+
+	inline std::string pack::name(size_type Index) const
+	{
+		GLI_ASSERT(Index < this->Count);
+
+		detail::packEntry Entry;
+		std::memcpy(&Entry, this->File->data() + this->IndexOffset + sizeof(detail::packEntry) * Index, sizeof(Entry));
+		if(Entry.NameOffset > this->NamesSize || Entry.NameLength > this->NamesSize - Entry.NameOffset)
+			return std::string();
+
+		return std::string(this->File->data() + this->NamesOffset + Entry.NameOffset, Entry.NameLength);
+	}
+
+	inline texture pack::open_texture(size_type Index, bool Copy) const
+	{
+		if(Index >= this->Count)
+			return texture();
+
+		detail::packEntry Entry;
+		std::memcpy(&Entry, this->File->data() + this->IndexOffset + sizeof(detail::packEntry) * Index, sizeof(Entry));
+
+		detail::kmgHeader10 const& Desc = Entry.Desc;
+		if(!detail::check_swizzles(Desc.SwizzleRed, Desc.SwizzleGreen, Desc.SwizzleBlue, Desc.SwizzleAlpha))
+			return texture();
+		if(!detail::check_texture_desc(Desc.Target, Desc.Format, Desc.PixelWidth, Desc.PixelHeight, Desc.PixelDepth, Desc.Layers, Desc.Faces, Desc.Levels))
+			return texture();
+
+		texture::extent_type const Extent(static_cast<int>(Desc.PixelWidth), static_cast<int>(Desc.PixelHeight), static_cast<int>(Desc.PixelDepth));
+		std::uint64_t const StorageSize = detail::get_storage_size(static_cast<format>(Desc.Format), Extent, static_cast<std::uint64_t>(Desc.Layers) * Desc.Faces, Desc.Levels);
+		if(Entry.DataSize != StorageSize || Entry.DataOffset > this->File->size() || Entry.DataSize > this->File->size() - Entry.DataOffset)
+			return texture();
+
+		texture::swizzles_type const Swizzles(
+			static_cast<swizzle>(Desc.SwizzleRed),
+			static_cast<swizzle>(Desc.SwizzleGreen),
+			static_cast<swizzle>(Desc.SwizzleBlue),
+			static_cast<swizzle>(Desc.SwizzleAlpha));
+
+		if(!Copy)
+		{
+			return texture(
+				static_cast<target>(Desc.Target), static_cast<format>(Desc.Format), Extent,
+				Desc.Layers, Desc.Faces, Desc.Levels,
+				this->File->data() + Entry.DataOffset, this->File, Swizzles);
+		}
+
+		texture Texture(
+			static_cast<target>(Desc.Target), static_cast<format>(Desc.Format), Extent,
+			Desc.Layers, Desc.Faces, Desc.Levels, Swizzles);
+		std::memcpy(Texture.data(), this->File->data() + Entry.DataOffset, Texture.size());
+		return Texture;
+	}
+
+	inline texture pack::map(size_type Index) const
+	{
+		return this->open_texture(Index, false);
+	}
+
+	inline texture pack::map(char const* Name) const
+	{
+		return this->map(this->find(Name));
+	}
+
+	inline texture pack::map(std::string const& Name) const
+	{
+		return this->map(Name.c_str());
+	}
+
+	inline texture pack::load(size_type Index) const
+	{
+		return this->open_texture(Index, true);
+	}
+
+	inline texture pack::load(char const* Name) const
+	{
+		return this->load(this->find(Name));
+	}
+
+	inline texture pack::load(std::string const& Name) const
+	{
+		return this->load(Name.c_str());
+	}
+}//namespace gli
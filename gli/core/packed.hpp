@@ -0,0 +1,597 @@
+/// @brief Include to convert spans of texels of packed formats to and from vec4
+/// @file gli/core/packed.hpp
+///
+/// With SSE2, 4 texels are unpacked or packed at once, the components of the texels being transposed to one vector per component.
+/// The scalar code converts the remaining texels and is used when SSE2 isn't available, giving the same results.
+
+#pragma once
+
+#include "../type.hpp"
+#include "simd.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace gli{
+namespace detail
+{
+	inline glm::uint32 packed_float_bits(float Value)
+	{
+		glm::uint32 Bits;
+		std::memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	inline float packed_bits_float(glm::uint32 Bits)
+	{
+		float Value;
+		std::memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	// Clamp to [Min, Max] like _mm_max_ps then _mm_min_ps, NaNs become Min
+	inline float packed_clamp(float Value, float Min, float Max)
+	{
+		float const Low = Value > Min ? Value : Min;
+		return Low < Max ? Low : Max;
+	}
+
+	// Unsigned floats with a 5 bits exponent and MantissaBits bits of mantissa, used by FORMAT_RG11B10_UFLOAT_PACK32
+	template <int MantissaBits>
+	inline float unpack_small_float(glm::uint32 Field)
+	{
+		glm::uint32 const Mantissa = Field & ((1u << MantissaBits) - 1);
+
+		// Infinities and NaNs, made quiet
+		if((Field >> MantissaBits) == 31)
+			return packed_bits_float(0x7f800000u | (Mantissa << (23 - MantissaBits)) | (Mantissa != 0 ? 0x00400000u : 0u));
+
+		// Scaling by 2^112 rebiases the exponent and renormalizes the denormals
+		return packed_bits_float(Field << (23 - MantissaBits)) * packed_bits_float((254 - 15) << 23);
+	}
+
+	// Round to nearest even, negative values become 0 and values too large become infinity
+	template <int MantissaBits>
+	inline glm::uint32 pack_small_float(float Value)
+	{
+		glm::uint32 const Bits = packed_float_bits(Value);
+		glm::uint32 const Abs = Bits & 0x7fffffffu;
+
+		if(Abs > 0x7f800000u)
+			return (31u << MantissaBits) | (1u << (MantissaBits - 1)) | ((Abs >> (23 - MantissaBits)) & ((1u << MantissaBits) - 1));
+		if(Bits & 0x80000000u)
+			return 0;
+		if(Abs >= (143u << 23))
+			return 31u << MantissaBits;
+		if(Abs < (113u << 23))
+		{
+			// The float addition rounds the denormal mantissa
+			glm::uint32 const Magic = (127u + 9u - MantissaBits) << 23;
+			return packed_float_bits(packed_bits_float(Abs) + packed_bits_float(Magic)) - Magic;
+		}
+		return (Abs + ((15u - 127u) << 23) + (1u << (22 - MantissaBits)) - 1 + ((Abs >> (23 - MantissaBits)) & 1)) >> (23 - MantissaBits);
+	}
+
+	// Shared exponent encoding of EXT_texture_shared_exponent
+	inline glm::uint32 pack_rgb9e5(vec4 const& Value)
+	{
+		float const Red = packed_clamp(Value.x, 0.0f, 65408.0f);
+		float const Green = packed_clamp(Value.y, 0.0f, 65408.0f);
+		float const Blue = packed_clamp(Value.z, 0.0f, 65408.0f);
+		float const MaxColor = glm::max(Red, glm::max(Green, Blue));
+
+		// max(-16, floor(log2(MaxColor))) + 16, from the exponent of MaxColor
+		glm::uint32 Exponent = glm::max<glm::uint32>(packed_float_bits(MaxColor) >> 23, 111) - 111;
+		float Scale = packed_bits_float((151 - Exponent) << 23);
+		if(static_cast<glm::uint32>(MaxColor * Scale + 0.5f) == 512)
+		{
+			++Exponent;
+			Scale = packed_bits_float((151 - Exponent) << 23);
+		}
+
+		return
+			(static_cast<glm::uint32>(Red * Scale + 0.5f) << 0) |
+			(static_cast<glm::uint32>(Green * Scale + 0.5f) << 9) |
+			(static_cast<glm::uint32>(Blue * Scale + 0.5f) << 18) |
+			(Exponent << 27);
+	}
+
+	inline vec4 unpack_rgb9e5(glm::uint32 Packed)
+	{
+		float const Scale = packed_bits_float(((Packed >> 27) + 103) << 23);
+		return vec4(
+			static_cast<float>((Packed >> 0) & 0x1ff) * Scale,
+			static_cast<float>((Packed >> 9) & 0x1ff) * Scale,
+			static_cast<float>((Packed >> 18) & 0x1ff) * Scale,
+			1.0f);
+	}
+
+	inline glm::uint32 pack_rg11b10f(vec4 const& Value)
+	{
+		return (pack_small_float<6>(Value.x) << 0) | (pack_small_float<6>(Value.y) << 11) | (pack_small_float<5>(Value.z) << 22);
+	}
+
+	inline vec4 unpack_rg11b10f(glm::uint32 Packed)
+	{
+		return vec4(
+			unpack_small_float<6>((Packed >> 0) & 0x7ff),
+			unpack_small_float<6>((Packed >> 11) & 0x7ff),
+			unpack_small_float<5>((Packed >> 22) & 0x3ff),
+			1.0f);
+	}
+
+	// Component of Bits bits starting at bit Shift, Default when the format doesn't store it
+	template <int Shift, int Bits>
+	inline float unpack_unorm_component(glm::uint32 Packed, float Default)
+	{
+		return Bits == 0 ? Default : static_cast<float>((Packed >> Shift) & ((1u << Bits) - 1)) * (1.0f / static_cast<float>((1 << Bits) - 1));
+	}
+
+	// Round half away from zero like glm::round
+	template <int Shift, int Bits>
+	inline glm::uint32 pack_unorm_component(float Value)
+	{
+		return Bits == 0 ? 0 : static_cast<glm::uint32>(std::round(packed_clamp(Value, 0.0f, 1.0f) * static_cast<float>((1 << Bits) - 1))) << Shift;
+	}
+
+#	if defined(GLI_SIMD_SSE2)
+		// Load 4 packed texels to the 32 bits lanes
+		inline __m128i packed_load4(glm::uint8 const* Src)
+		{
+			int Packed;
+			std::memcpy(&Packed, Src, sizeof(Packed));
+			return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(Packed), _mm_setzero_si128()), _mm_setzero_si128());
+		}
+
+		inline __m128i packed_load4(glm::uint16 const* Src)
+		{
+			return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(Src)), _mm_setzero_si128());
+		}
+
+		inline __m128i packed_load4(glm::uint32 const* Src)
+		{
+			return _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src));
+		}
+
+		inline void packed_store4(glm::uint8* Dst, __m128i Packed)
+		{
+			__m128i const Words = _mm_packs_epi32(Packed, Packed);
+			int const Bytes = _mm_cvtsi128_si32(_mm_packus_epi16(Words, Words));
+			std::memcpy(Dst, &Bytes, sizeof(Bytes));
+		}
+
+		inline void packed_store4(glm::uint16* Dst, __m128i Packed)
+		{
+			// Sign extend the 16 bits values so that the saturating pack keeps them
+			__m128i const Extended = _mm_srai_epi32(_mm_slli_epi32(Packed, 16), 16);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(Dst), _mm_packs_epi32(Extended, Extended));
+		}
+
+		inline void packed_store4(glm::uint32* Dst, __m128i Packed)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst), Packed);
+		}
+
+		// Transpose 4 texels to one vector per component
+		inline void packed_load_texels4(vec4 const* Src, __m128& X, __m128& Y, __m128& Z, __m128& W)
+		{
+			X = _mm_loadu_ps(&Src[0][0]);
+			Y = _mm_loadu_ps(&Src[1][0]);
+			Z = _mm_loadu_ps(&Src[2][0]);
+			W = _mm_loadu_ps(&Src[3][0]);
+			_MM_TRANSPOSE4_PS(X, Y, Z, W);
+		}
+
+		inline void packed_store_texels4(vec4* Dst, __m128 X, __m128 Y, __m128 Z, __m128 W)
+		{
+			_MM_TRANSPOSE4_PS(X, Y, Z, W);
+			_mm_storeu_ps(&Dst[0][0], X);
+			_mm_storeu_ps(&Dst[1][0], Y);
+			_mm_storeu_ps(&Dst[2][0], Z);
+			_mm_storeu_ps(&Dst[3][0], W);
+		}
+
+		inline __m128 packed_clamp_sse2(__m128 Value, float Min, float Max)
+		{
+			return _mm_min_ps(_mm_max_ps(Value, _mm_set1_ps(Min)), _mm_set1_ps(Max));
+		}
+
+		inline __m128i packed_select_sse2(__m128i Mask, __m128i A, __m128i B)
+		{
+			return _mm_or_si128(_mm_and_si128(Mask, A), _mm_andnot_si128(Mask, B));
+		}
+
+		// Round half away from zero, the conversion rounds to nearest even so only the ties rounded toward zero are fixed
+		inline __m128i packed_round_sse2(__m128 Value)
+		{
+			__m128 const SignMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+			__m128 const Abs = _mm_andnot_ps(SignMask, Value);
+			__m128i const Rounded = _mm_cvtps_epi32(Abs);
+			__m128i const Tie = _mm_castps_si128(_mm_cmpeq_ps(_mm_sub_ps(Abs, _mm_cvtepi32_ps(Rounded)), _mm_set1_ps(0.5f)));
+			__m128i const Away = _mm_sub_epi32(Rounded, Tie);
+			__m128i const Negative = _mm_srai_epi32(_mm_castps_si128(Value), 31);
+			return _mm_sub_epi32(_mm_xor_si128(Away, Negative), Negative);
+		}
+
+		template <int Shift, int Bits>
+		inline __m128 unpack_unorm_sse2(__m128i Packed, float Default)
+		{
+			if(Bits == 0)
+				return _mm_set1_ps(Default);
+
+			__m128i const Field = _mm_and_si128(_mm_srli_epi32(Packed, Shift), _mm_set1_epi32((1 << Bits) - 1));
+			return _mm_mul_ps(_mm_cvtepi32_ps(Field), _mm_set1_ps(1.0f / static_cast<float>((1 << Bits) - 1)));
+		}
+
+		template <int Shift, int Bits>
+		inline __m128i pack_unorm_sse2(__m128 Value)
+		{
+			if(Bits == 0)
+				return _mm_setzero_si128();
+
+			__m128 const Scaled = _mm_mul_ps(packed_clamp_sse2(Value, 0.0f, 1.0f), _mm_set1_ps(static_cast<float>((1 << Bits) - 1)));
+			return _mm_slli_epi32(packed_round_sse2(Scaled), Shift);
+		}
+
+		template <int Shift, int MantissaBits>
+		inline __m128 unpack_small_float_sse2(__m128i Packed)
+		{
+			__m128i const Field = _mm_and_si128(_mm_srli_epi32(Packed, Shift), _mm_set1_epi32((1 << (5 + MantissaBits)) - 1));
+			__m128 const Scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(Field, 23 - MantissaBits)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+			__m128i const InfNaN = _mm_or_si128(
+				_mm_and_si128(_mm_cmpgt_epi32(Field, _mm_set1_epi32((31 << MantissaBits) - 1)), _mm_set1_epi32(255 << 23)),
+				_mm_and_si128(_mm_cmpgt_epi32(Field, _mm_set1_epi32(31 << MantissaBits)), _mm_set1_epi32(0x00400000)));
+			return _mm_or_ps(Scaled, _mm_castsi128_ps(InfNaN));
+		}
+
+		template <int Shift, int MantissaBits>
+		inline __m128i pack_small_float_sse2(__m128 Value)
+		{
+			__m128i const Bits = _mm_castps_si128(Value);
+			__m128i const Abs = _mm_and_si128(Bits, _mm_set1_epi32(0x7fffffff));
+			__m128i const NaN = _mm_castps_si128(_mm_cmpunord_ps(Value, Value));
+			__m128i const Negative = _mm_andnot_si128(NaN, _mm_srai_epi32(Bits, 31));
+
+			__m128i const Mantissa = _mm_and_si128(_mm_srli_epi32(Abs, 23 - MantissaBits), _mm_set1_epi32((1 << MantissaBits) - 1));
+			__m128i const InfNaN = _mm_or_si128(_mm_set1_epi32(31 << MantissaBits), _mm_and_si128(NaN, _mm_or_si128(_mm_set1_epi32(1 << (MantissaBits - 1)), Mantissa)));
+
+			__m128i const Regular = _mm_cmpgt_epi32(_mm_set1_epi32(143 << 23), Abs);
+			__m128i const Denormal = _mm_cmpgt_epi32(_mm_set1_epi32(113 << 23), Abs);
+
+			int const Magic = (127 + 9 - MantissaBits) << 23;
+			__m128i const DenormalField = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(Abs), _mm_castsi128_ps(_mm_set1_epi32(Magic)))), _mm_set1_epi32(Magic));
+			__m128i const Odd = _mm_and_si128(_mm_srli_epi32(Abs, 23 - MantissaBits), _mm_set1_epi32(1));
+			__m128i const NormalField = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(Abs, _mm_set1_epi32(static_cast<int>(((15u - 127u) << 23) + (1u << (22 - MantissaBits)) - 1))), Odd), 23 - MantissaBits);
+
+			__m128i const Field = packed_select_sse2(Regular, packed_select_sse2(Denormal, DenormalField, NormalField), InfNaN);
+			return _mm_slli_epi32(_mm_andnot_si128(Negative, Field), Shift);
+		}
+
+		inline __m128i pack_rgb9e5_sse2(__m128 X, __m128 Y, __m128 Z)
+		{
+			__m128 const Red = packed_clamp_sse2(X, 0.0f, 65408.0f);
+			__m128 const Green = packed_clamp_sse2(Y, 0.0f, 65408.0f);
+			__m128 const Blue = packed_clamp_sse2(Z, 0.0f, 65408.0f);
+			__m128 const MaxColor = _mm_max_ps(Red, _mm_max_ps(Green, Blue));
+
+			__m128i const BiasedExponent = _mm_srli_epi32(_mm_castps_si128(MaxColor), 23);
+			__m128i const MinExponent = _mm_set1_epi32(111);
+			__m128i Exponent = _mm_sub_epi32(packed_select_sse2(_mm_cmpgt_epi32(BiasedExponent, MinExponent), BiasedExponent, MinExponent), MinExponent);
+
+			__m128 Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_sub_epi32(_mm_set1_epi32(151), Exponent), 23));
+			__m128i const MaxShared = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(MaxColor, Scale), _mm_set1_ps(0.5f)));
+			Exponent = _mm_sub_epi32(Exponent, _mm_cmpeq_epi32(MaxShared, _mm_set1_epi32(512)));
+			Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_sub_epi32(_mm_set1_epi32(151), Exponent), 23));
+
+			__m128 const Half = _mm_set1_ps(0.5f);
+			return _mm_or_si128(
+				_mm_or_si128(
+					_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(Red, Scale), Half)),
+					_mm_slli_epi32(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(Green, Scale), Half)), 9)),
+				_mm_or_si128(
+					_mm_slli_epi32(_mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(Blue, Scale), Half)), 18),
+					_mm_slli_epi32(Exponent, 27)));
+		}
+
+		inline void unpack_rgb9e5_sse2(__m128i Packed, __m128& X, __m128& Y, __m128& Z)
+		{
+			__m128 const Scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_srli_epi32(Packed, 27), _mm_set1_epi32(103)), 23));
+			__m128i const Mask = _mm_set1_epi32(0x1ff);
+			X = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(Packed, Mask)), Scale);
+			Y = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Packed, 9), Mask)), Scale);
+			Z = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Packed, 18), Mask)), Scale);
+		}
+#	endif//defined(GLI_SIMD_SSE2)
+
+	/// Unsigned normalized components of BitsX, BitsY, BitsZ and BitsW bits stored from the lowest bits of storage_type.
+	/// Components of 0 bits aren't stored, they are fetched as 0 for color and 1 for alpha.
+	/// Writes round half away from zero like the glm packing functions.
+	template <typename storage_type, int BitsX, int BitsY, int BitsZ, int BitsW>
+	struct unorm_packed_span
+	{
+		enum
+		{
+			SHIFT_Y = BitsX,
+			SHIFT_Z = BitsX + BitsY,
+			SHIFT_W = BitsX + BitsY + BitsZ
+		};
+
+		static void fetch(void const* Src, vec4* Dst, size_t Count)
+		{
+			storage_type const* Packed = static_cast<storage_type const*>(Src);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128i const Values = packed_load4(Packed + Texel);
+					packed_store_texels4(Dst + Texel,
+						unpack_unorm_sse2<0, BitsX>(Values, 0.0f),
+						unpack_unorm_sse2<SHIFT_Y, BitsY>(Values, 0.0f),
+						unpack_unorm_sse2<SHIFT_Z, BitsZ>(Values, 0.0f),
+						unpack_unorm_sse2<SHIFT_W, BitsW>(Values, 1.0f));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+			{
+				glm::uint32 const Value = Packed[Texel];
+				Dst[Texel] = vec4(
+					unpack_unorm_component<0, BitsX>(Value, 0.0f),
+					unpack_unorm_component<SHIFT_Y, BitsY>(Value, 0.0f),
+					unpack_unorm_component<SHIFT_Z, BitsZ>(Value, 0.0f),
+					unpack_unorm_component<SHIFT_W, BitsW>(Value, 1.0f));
+			}
+		}
+
+		static void write(vec4 const* Src, void* Dst, size_t Count)
+		{
+			storage_type* Packed = static_cast<storage_type*>(Dst);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128 X, Y, Z, W;
+					packed_load_texels4(Src + Texel, X, Y, Z, W);
+					packed_store4(Packed + Texel, _mm_or_si128(
+						_mm_or_si128(pack_unorm_sse2<0, BitsX>(X), pack_unorm_sse2<SHIFT_Y, BitsY>(Y)),
+						_mm_or_si128(pack_unorm_sse2<SHIFT_Z, BitsZ>(Z), pack_unorm_sse2<SHIFT_W, BitsW>(W))));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+			{
+				vec4 const& Value = Src[Texel];
+				Packed[Texel] = static_cast<storage_type>(
+					pack_unorm_component<0, BitsX>(Value.x) |
+					pack_unorm_component<SHIFT_Y, BitsY>(Value.y) |
+					pack_unorm_component<SHIFT_Z, BitsZ>(Value.z) |
+					pack_unorm_component<SHIFT_W, BitsW>(Value.w));
+			}
+		}
+	};
+
+	/// FORMAT_RGB10A2_SNORM_PACK32 and FORMAT_BGR10A2_SNORM_PACK32, like glm::packSnorm3x10_1x2 and glm::unpackSnorm3x10_1x2
+	struct rgb10a2_snorm_span
+	{
+		static void fetch(void const* Src, vec4* Dst, size_t Count)
+		{
+			glm::uint32 const* Packed = static_cast<glm::uint32 const*>(Src);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				__m128 const Scale = _mm_set1_ps(1.0f / 511.0f);
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128i const Values = packed_load4(Packed + Texel);
+					packed_store_texels4(Dst + Texel,
+						packed_clamp_sse2(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Values, 22), 22)), Scale), -1.0f, 1.0f),
+						packed_clamp_sse2(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Values, 12), 22)), Scale), -1.0f, 1.0f),
+						packed_clamp_sse2(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Values, 2), 22)), Scale), -1.0f, 1.0f),
+						packed_clamp_sse2(_mm_cvtepi32_ps(_mm_srai_epi32(Values, 30)), -1.0f, 1.0f));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+			{
+				glm::int32 const Value = static_cast<glm::int32>(Packed[Texel]);
+				Dst[Texel] = vec4(
+					packed_clamp(static_cast<float>(static_cast<glm::int32>(static_cast<glm::uint32>(Value) << 22) >> 22) * (1.0f / 511.0f), -1.0f, 1.0f),
+					packed_clamp(static_cast<float>(static_cast<glm::int32>(static_cast<glm::uint32>(Value) << 12) >> 22) * (1.0f / 511.0f), -1.0f, 1.0f),
+					packed_clamp(static_cast<float>(static_cast<glm::int32>(static_cast<glm::uint32>(Value) << 2) >> 22) * (1.0f / 511.0f), -1.0f, 1.0f),
+					packed_clamp(static_cast<float>(Value >> 30), -1.0f, 1.0f));
+			}
+		}
+
+		static void write(vec4 const* Src, void* Dst, size_t Count)
+		{
+			glm::uint32* Packed = static_cast<glm::uint32*>(Dst);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				__m128 const Scale = _mm_set1_ps(511.0f);
+				__m128i const Mask = _mm_set1_epi32(0x3ff);
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128 X, Y, Z, W;
+					packed_load_texels4(Src + Texel, X, Y, Z, W);
+					packed_store4(Packed + Texel, _mm_or_si128(
+						_mm_or_si128(
+							_mm_and_si128(packed_round_sse2(_mm_mul_ps(packed_clamp_sse2(X, -1.0f, 1.0f), Scale)), Mask),
+							_mm_slli_epi32(_mm_and_si128(packed_round_sse2(_mm_mul_ps(packed_clamp_sse2(Y, -1.0f, 1.0f), Scale)), Mask), 10)),
+						_mm_or_si128(
+							_mm_slli_epi32(_mm_and_si128(packed_round_sse2(_mm_mul_ps(packed_clamp_sse2(Z, -1.0f, 1.0f), Scale)), Mask), 20),
+							_mm_slli_epi32(packed_round_sse2(packed_clamp_sse2(W, -1.0f, 1.0f)), 30))));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+			{
+				vec4 const& Value = Src[Texel];
+				Packed[Texel] =
+					((static_cast<glm::uint32>(static_cast<glm::int32>(std::round(packed_clamp(Value.x, -1.0f, 1.0f) * 511.0f))) & 0x3ff) << 0) |
+					((static_cast<glm::uint32>(static_cast<glm::int32>(std::round(packed_clamp(Value.y, -1.0f, 1.0f) * 511.0f))) & 0x3ff) << 10) |
+					((static_cast<glm::uint32>(static_cast<glm::int32>(std::round(packed_clamp(Value.z, -1.0f, 1.0f) * 511.0f))) & 0x3ff) << 20) |
+					(static_cast<glm::uint32>(static_cast<glm::int32>(std::round(packed_clamp(Value.w, -1.0f, 1.0f)))) << 30);
+			}
+		}
+	};
+
+	/// FORMAT_RGB10A2_USCALED_PACK32, FORMAT_RGB10A2_SSCALED_PACK32 and their BGR variants, writes truncate like the conversions to integers
+	template <bool Signed>
+	struct rgb10a2_scaled_span
+	{
+		static float component(glm::uint32 Value, int Shift, int Bits)
+		{
+			return Signed
+				? static_cast<float>(static_cast<glm::int32>(Value << (32 - Shift - Bits)) >> (32 - Bits))
+				: static_cast<float>((Value >> Shift) & ((1u << Bits) - 1));
+		}
+
+		static void fetch(void const* Src, vec4* Dst, size_t Count)
+		{
+			glm::uint32 const* Packed = static_cast<glm::uint32 const*>(Src);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128i const Values = packed_load4(Packed + Texel);
+					if(Signed)
+						packed_store_texels4(Dst + Texel,
+							_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Values, 22), 22)),
+							_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Values, 12), 22)),
+							_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(Values, 2), 22)),
+							_mm_cvtepi32_ps(_mm_srai_epi32(Values, 30)));
+					else
+						packed_store_texels4(Dst + Texel,
+							_mm_cvtepi32_ps(_mm_and_si128(Values, _mm_set1_epi32(0x3ff))),
+							_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Values, 10), _mm_set1_epi32(0x3ff))),
+							_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(Values, 20), _mm_set1_epi32(0x3ff))),
+							_mm_cvtepi32_ps(_mm_srli_epi32(Values, 30)));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+				Dst[Texel] = vec4(component(Packed[Texel], 0, 10), component(Packed[Texel], 10, 10), component(Packed[Texel], 20, 10), component(Packed[Texel], 30, 2));
+		}
+
+		static void write(vec4 const* Src, void* Dst, size_t Count)
+		{
+			glm::uint32* Packed = static_cast<glm::uint32*>(Dst);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				__m128i const Mask = _mm_set1_epi32(0x3ff);
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128 X, Y, Z, W;
+					packed_load_texels4(Src + Texel, X, Y, Z, W);
+					packed_store4(Packed + Texel, _mm_or_si128(
+						_mm_or_si128(
+							_mm_and_si128(_mm_cvttps_epi32(X), Mask),
+							_mm_slli_epi32(_mm_and_si128(_mm_cvttps_epi32(Y), Mask), 10)),
+						_mm_or_si128(
+							_mm_slli_epi32(_mm_and_si128(_mm_cvttps_epi32(Z), Mask), 20),
+							_mm_slli_epi32(_mm_cvttps_epi32(W), 30))));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+			{
+				vec4 const& Value = Src[Texel];
+				Packed[Texel] =
+					((static_cast<glm::uint32>(static_cast<glm::int32>(Value.x)) & 0x3ff) << 0) |
+					((static_cast<glm::uint32>(static_cast<glm::int32>(Value.y)) & 0x3ff) << 10) |
+					((static_cast<glm::uint32>(static_cast<glm::int32>(Value.z)) & 0x3ff) << 20) |
+					(static_cast<glm::uint32>(static_cast<glm::int32>(Value.w)) << 30);
+			}
+		}
+	};
+
+	/// FORMAT_RG11B10_UFLOAT_PACK32
+	struct rg11b10f_span
+	{
+		static void fetch(void const* Src, vec4* Dst, size_t Count)
+		{
+			glm::uint32 const* Packed = static_cast<glm::uint32 const*>(Src);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128i const Values = packed_load4(Packed + Texel);
+					packed_store_texels4(Dst + Texel,
+						unpack_small_float_sse2<0, 6>(Values),
+						unpack_small_float_sse2<11, 6>(Values),
+						unpack_small_float_sse2<22, 5>(Values),
+						_mm_set1_ps(1.0f));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+				Dst[Texel] = unpack_rg11b10f(Packed[Texel]);
+		}
+
+		static void write(vec4 const* Src, void* Dst, size_t Count)
+		{
+			glm::uint32* Packed = static_cast<glm::uint32*>(Dst);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128 X, Y, Z, W;
+					packed_load_texels4(Src + Texel, X, Y, Z, W);
+					packed_store4(Packed + Texel, _mm_or_si128(
+						_mm_or_si128(pack_small_float_sse2<0, 6>(X), pack_small_float_sse2<11, 6>(Y)),
+						pack_small_float_sse2<22, 5>(Z)));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+				Packed[Texel] = pack_rg11b10f(Src[Texel]);
+		}
+	};
+
+	/// FORMAT_RGB9E5_UFLOAT_PACK32
+	struct rgb9e5_span
+	{
+		static void fetch(void const* Src, vec4* Dst, size_t Count)
+		{
+			glm::uint32 const* Packed = static_cast<glm::uint32 const*>(Src);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128 X, Y, Z;
+					unpack_rgb9e5_sse2(packed_load4(Packed + Texel), X, Y, Z);
+					packed_store_texels4(Dst + Texel, X, Y, Z, _mm_set1_ps(1.0f));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+				Dst[Texel] = unpack_rgb9e5(Packed[Texel]);
+		}
+
+		static void write(vec4 const* Src, void* Dst, size_t Count)
+		{
+			glm::uint32* Packed = static_cast<glm::uint32*>(Dst);
+			size_t Texel = 0;
+
+#			if defined(GLI_SIMD_SSE2)
+				for(; Texel + 4 <= Count; Texel += 4)
+				{
+					__m128 X, Y, Z, W;
+					packed_load_texels4(Src + Texel, X, Y, Z, W);
+					packed_store4(Packed + Texel, pack_rgb9e5_sse2(X, Y, Z));
+				}
+#			endif//defined(GLI_SIMD_SSE2)
+
+			for(; Texel < Count; ++Texel)
+				Packed[Texel] = pack_rgb9e5(Src[Texel]);
+		}
+	};
+}//namespace detail
+}//namespace gli
@@ -0,0 +1,103 @@
+/// @brief Include to split GLI algorithms across multiple threads
+/// @file gli/core/parallel.hpp
+///
+/// Define GLI_THREAD_COUNT before including GLI to override the number of threads used by the algorithms,
+/// GLI_THREAD_COUNT 1 runs every algorithm on the calling thread.
+
+#pragma once
+
+#include "../type.hpp"
+
+// STD
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace gli{
+namespace detail
+{
+	/// Return the maximum number of threads, including the calling thread, used by an algorithm
+	inline size_t thread_count()
+	{
+#		ifdef GLI_THREAD_COUNT
+			return GLI_THREAD_COUNT > 0 ? static_cast<size_t>(GLI_THREAD_COUNT) : 1;
+#		else
+			static size_t const Count = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+			return Count;
+#		endif
+	}
+
+	/// Split [Begin, End) in contiguous ranges of at least Grain iterations and call Function(RangeBegin, RangeEnd) for each range.
+	/// The calling thread processes a range too and the function returns once all the ranges have been processed.
+	/// If Function throws, the other ranges still run to completion, then the first exception caught is rethrown on the calling thread.
+	template <typename function_type>
+	inline void parallel_for(size_t Begin, size_t End, size_t Grain, function_type const& Function)
+	{
+		if(Begin >= End)
+			return;
+
+		size_t const Count = End - Begin;
+		size_t const TaskCount = std::min(thread_count(), (Count + std::max<size_t>(Grain, 1) - 1) / std::max<size_t>(Grain, 1));
+		if(TaskCount <= 1)
+		{
+			Function(Begin, End);
+			return;
+		}
+
+		std::mutex Mutex;
+		std::exception_ptr Exception;
+
+		// An exception escaping a thread would terminate the process, it is kept to be rethrown once every thread is joined
+		auto const Run = [&Function, &Mutex, &Exception](size_t RangeBegin, size_t RangeEnd)
+		{
+			try
+			{
+				Function(RangeBegin, RangeEnd);
+			}
+			catch(...)
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				if(!Exception)
+					Exception = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> Threads;
+		Threads.reserve(TaskCount - 1);
+
+		for(size_t TaskIndex = 0; TaskIndex < TaskCount; ++TaskIndex)
+		{
+			size_t const RangeBegin = Begin + Count * TaskIndex / TaskCount;
+			size_t const RangeEnd = Begin + Count * (TaskIndex + 1) / TaskCount;
+
+			if(TaskIndex + 1 == TaskCount)
+			{
+				Run(RangeBegin, RangeEnd);
+				break;
+			}
+
+			// When the system can't create more threads, the calling thread processes the range
+			try
+			{
+				Threads.push_back(std::thread([&Run, RangeBegin, RangeEnd]()
+				{
+					Run(RangeBegin, RangeEnd);
+				}));
+			}
+			catch(std::system_error const&)
+			{
+				Run(RangeBegin, RangeEnd);
+			}
+		}
+
+		for(size_t ThreadIndex = 0; ThreadIndex < Threads.size(); ++ThreadIndex)
+			Threads[ThreadIndex].join();
+
+		if(Exception)
+			std::rethrow_exception(Exception);
+	}
+}//namespace detail
+}//namespace gli
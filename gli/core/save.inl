@@ -15,6 +15,8 @@ namespace gli
 			return save_dds(Texture, Path);
 		if(Path.rfind(".kmg") != std::string::npos)
 			return save_kmg(Texture, Path);
+		if(Path.rfind(".ktx2") != std::string::npos)
+			return save_ktx2(Texture, Path);
 		if(Path.rfind(".ktx") != std::string::npos)
 			return save_ktx(Texture, Path);
 		return false;
@@ -42,7 +42,7 @@ namespace detail
 	}
 }//namespace detail
 
-	inline bool save_dds(texture const& Texture, std::vector<char>& Memory)
+	inline bool save_dds(texture const& Texture, segment_list& Segments)
 	{
 		if(Texture.empty())
 			return false;
@@ -52,13 +52,11 @@ namespace detail
 
 		bool const RequireDX10Header = DXFormat.D3DFormat == dx::D3DFMT_GLI1 || DXFormat.D3DFormat == dx::D3DFMT_DX10 || is_target_array(Texture.target()) || is_target_1d(Texture.target());
 
-		Memory.resize(Texture.size() + sizeof(detail::FOURCC_DDS) + sizeof(detail::dds_header) + (RequireDX10Header ? sizeof(detail::dds_header10) : 0));
+		Segments.reset(Texture, sizeof(detail::FOURCC_DDS) + sizeof(detail::dds_header) + (RequireDX10Header ? sizeof(detail::dds_header10) : 0));
 
-		memcpy(&Memory[0], detail::FOURCC_DDS, sizeof(detail::FOURCC_DDS));
-		std::size_t Offset = sizeof(detail::FOURCC_DDS);
+		memcpy(Segments.append_header(sizeof(detail::FOURCC_DDS)), detail::FOURCC_DDS, sizeof(detail::FOURCC_DDS));
 
-		detail::dds_header& Header = *reinterpret_cast<detail::dds_header*>(&Memory[0] + Offset);
-		Offset += sizeof(detail::dds_header);
+		detail::dds_header& Header = *static_cast<detail::dds_header*>(Segments.append_header(sizeof(detail::dds_header)));
 
 		detail::formatInfo const& Desc = detail::get_format_info(Texture.format());
 
@@ -111,8 +109,7 @@ namespace detail
 
 		if(RequireDX10Header)
 		{
-			detail::dds_header10& Header10 = *reinterpret_cast<detail::dds_header10*>(&Memory[0] + Offset);
-			Offset += sizeof(detail::dds_header10);
+			detail::dds_header10& Header10 = *static_cast<detail::dds_header10*>(Segments.append_header(sizeof(detail::dds_header10)));
 
 			Header10.ArraySize = static_cast<std::uint32_t>(Texture.layers());
 			Header10.ResourceDimension = detail::get_dimension(Texture.target());
@@ -121,24 +118,39 @@ namespace detail
 			Header10.AlphaFlags = detail::DDS_ALPHA_MODE_UNKNOWN;
 		}
 
-		std::memcpy(&Memory[0] + Offset, Texture.data(), Texture.size());
+		// The images of the texture are referenced in place, consecutive images are merged in a single segment
+		for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
+		for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
+		for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
+			Segments.append(Texture.data(Layer, Face, Level), Texture.size(Level));
 
 		return true;
 	}
 
+	inline bool save_dds(texture const& Texture, std::vector<char>& Memory)
+	{
+		segment_list Segments;
+		if(!save_dds(Texture, Segments))
+			return false;
+
+		Segments.gather(Memory);
+		return true;
+	}
+
 	inline bool save_dds(texture const& Texture, char const* Filename)
 	{
 		if(Texture.empty())
 			return false;
 
+		segment_list Segments;
+		if(!save_dds(Texture, Segments))
+			return false;
+
 		FILE* File = detail::open_file(Filename, "wb");
 		if(!File)
 			return false;
 
-		std::vector<char> Memory;
-		bool const Result = save_dds(Texture, Memory);
-
-		std::fwrite(&Memory[0], 1, Memory.size(), File);
+		bool const Result = Segments.write(File);
 		std::fclose(File);
 
 		return Result;
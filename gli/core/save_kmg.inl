@@ -4,22 +4,54 @@
 #include "filter.hpp"
 #include "file.hpp"
 
-namespace gli
+namespace gli{
+namespace detail
 {
-	inline bool save_kmg(texture const & Texture, std::vector<char> & Memory)
+	// Supercompress the Size bytes pointed by Src to Dst, fails if the supercompression is not available
+	inline bool encode_kmg_chunk(supercompression Supercompression, char const* Src, std::size_t Size, std::vector<char>& Dst)
 	{
-		if(Texture.empty())
+		switch(Supercompression)
+		{
+#		if defined(GLI_ZSTD)
+		case SUPERCOMPRESSION_ZSTD:
+		{
+			Dst.resize(ZSTD_compressBound(Size));
+			std::size_t const Result = ZSTD_compress(&Dst[0], Dst.size(), Src, Size, ZSTD_CLEVEL_DEFAULT);
+			if(ZSTD_isError(Result))
+				return false;
+			Dst.resize(Result);
+			return true;
+		}
+#		endif
+#		if defined(GLI_LZ4)
+		case SUPERCOMPRESSION_LZ4:
+		{
+			Dst.resize(static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(Size))));
+			int const Result = LZ4_compress_default(Src, &Dst[0], static_cast<int>(Size), static_cast<int>(Dst.size()));
+			if(Result <= 0)
+				return false;
+			Dst.resize(static_cast<std::size_t>(Result));
+			return true;
+		}
+#		endif
+		default:
 			return false;
+		}
+	}
+}//namespace detail
 
-		Memory.resize(sizeof(detail::FOURCC_KMG100) + sizeof(detail::kmgHeader10) + Texture.size());
+	inline bool save_kmg(texture const & Texture, segment_list & Segments)
+	{
+		if(Texture.empty())
+			return false;
 
-		std::memcpy(&Memory[0], detail::FOURCC_KMG100, sizeof(detail::FOURCC_KMG100));
+		Segments.reset(Texture, sizeof(detail::FOURCC_KMG100) + sizeof(detail::kmgHeader10));
 
-		std::size_t Offset = sizeof(detail::FOURCC_KMG100);
+		std::memcpy(Segments.append_header(sizeof(detail::FOURCC_KMG100)), detail::FOURCC_KMG100, sizeof(detail::FOURCC_KMG100));
 
 		texture::swizzles_type Swizzle = Texture.swizzles();
 
-		detail::kmgHeader10 & Header = *reinterpret_cast<detail::kmgHeader10*>(&Memory[0] + Offset);
+		detail::kmgHeader10 & Header = *static_cast<detail::kmgHeader10*>(Segments.append_header(sizeof(detail::kmgHeader10)));
 		Header.Endianness = 0x04030201;
 		Header.Format = Texture.format();
 		Header.Target = Texture.target();
@@ -37,37 +69,41 @@ namespace gli
 		Header.BaseLevel = static_cast<std::uint32_t>(Texture.base_level());
 		Header.MaxLevel = static_cast<std::uint32_t>(Texture.max_level());
 
-		Offset += sizeof(detail::kmgHeader10);
-
 		for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
 		for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
 		{
 			texture::size_type const FaceSize = Texture.size(Level);
 			for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
-			{
-				std::memcpy(&Memory[0] + Offset, Texture.data(Layer, Face, Level), FaceSize);
-
-				Offset += FaceSize;
-				GLI_ASSERT(Offset <= Memory.size());
-			}
+				Segments.append(Texture.data(Layer, Face, Level), FaceSize);
 		}
 
 		return true;
 	}
 
+	inline bool save_kmg(texture const & Texture, std::vector<char> & Memory)
+	{
+		segment_list Segments;
+		if(!save_kmg(Texture, Segments))
+			return false;
+
+		Segments.gather(Memory);
+		return true;
+	}
+
 	inline bool save_kmg(texture const & Texture, char const * Filename)
 	{
 		if(Texture.empty())
 			return false;
 
+		segment_list Segments;
+		if(!save_kmg(Texture, Segments))
+			return false;
+
 		FILE* File = detail::open_file(Filename, "wb");
 		if(!File)
 			return false;
 
-		std::vector<char> Memory;
-		bool const Result = save_kmg(Texture, Memory);
-
-		std::fwrite(&Memory[0], 1, Memory.size(), File);
+		bool const Result = Segments.write(File);
 		std::fclose(File);
 
 		return Result;
@@ -77,4 +113,120 @@ namespace gli
 	{
 		return save_kmg(Texture, Filename.c_str());
 	}
+
+	inline bool save_kmg2(texture const & Texture, std::vector<char> & Memory, supercompression Supercompression)
+	{
+		if(Texture.empty() || !detail::is_kmg_supercompression_supported(Supercompression))
+			return false;
+
+		bool const Supercompressed = Supercompression != SUPERCOMPRESSION_NONE;
+		std::size_t const ChunkSize = detail::KMG_CHUNK_SIZE;
+
+		// Chunks in the order of the file: levels, then layers, then faces
+		std::vector<char const*> Sources;
+		std::vector<std::size_t> Sizes;
+		for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
+		for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
+		for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
+		{
+			std::size_t const ImageSize = Texture.size(Level);
+			char const* const Image = static_cast<char const*>(Texture.data(Layer, Face, Level));
+
+			for(std::size_t Offset = 0; Offset < ImageSize; Offset += ChunkSize)
+			{
+				Sources.push_back(Image + Offset);
+				Sizes.push_back(std::min(ChunkSize, ImageSize - Offset));
+			}
+		}
+
+		std::vector<std::vector<char> > Compressed(Supercompressed ? Sources.size() : 0);
+		if(Supercompressed)
+		{
+			std::vector<char> Failed(Sources.size(), 0);
+			detail::parallel_for(0, Sources.size(), 1, [&](std::size_t RangeBegin, std::size_t RangeEnd)
+			{
+				for(std::size_t Chunk = RangeBegin; Chunk < RangeEnd; ++Chunk)
+					Failed[Chunk] = detail::encode_kmg_chunk(Supercompression, Sources[Chunk], Sizes[Chunk], Compressed[Chunk]) ? 0 : 1;
+			});
+
+			for(std::size_t Chunk = 0; Chunk < Failed.size(); ++Chunk)
+				if(Failed[Chunk])
+					return false;
+		}
+
+		std::size_t const IndexOffset = sizeof(detail::FOURCC_KMG200) + sizeof(detail::kmgHeader20);
+		std::size_t Offset = IndexOffset + sizeof(detail::kmgChunk20) * Sources.size();
+
+		std::vector<detail::kmgChunk20> Chunks(Sources.size());
+		for(std::size_t Chunk = 0; Chunk < Chunks.size(); ++Chunk)
+		{
+			Chunks[Chunk].ByteOffset = Offset;
+			Chunks[Chunk].ByteLength = Supercompressed ? Compressed[Chunk].size() : Sizes[Chunk];
+			Offset += static_cast<std::size_t>(Chunks[Chunk].ByteLength);
+		}
+
+		Memory.resize(Offset);
+
+		// Chunks are copied and their checksums computed in parallel
+		detail::parallel_for(0, Chunks.size(), 1, [&](std::size_t RangeBegin, std::size_t RangeEnd)
+		{
+			for(std::size_t Chunk = RangeBegin; Chunk < RangeEnd; ++Chunk)
+			{
+				char* const Dst = &Memory[0] + Chunks[Chunk].ByteOffset;
+				std::size_t const Length = static_cast<std::size_t>(Chunks[Chunk].ByteLength);
+				std::memcpy(Dst, Supercompressed ? &Compressed[Chunk][0] : Sources[Chunk], Length);
+				Chunks[Chunk].Checksum = detail::hash_data(Dst, Length);
+			}
+		});
+
+		texture::swizzles_type Swizzle = Texture.swizzles();
+
+		detail::kmgHeader20 Header;
+		Header.Endianness = 0x04030201;
+		Header.Format = Texture.format();
+		Header.Target = Texture.target();
+		Header.SwizzleRed = Swizzle[0];
+		Header.SwizzleGreen = Swizzle[1];
+		Header.SwizzleBlue = Swizzle[2];
+		Header.SwizzleAlpha = Swizzle[3];
+		Header.PixelWidth = static_cast<std::uint32_t>(Texture.extent().x);
+		Header.PixelHeight = static_cast<std::uint32_t>(Texture.extent().y);
+		Header.PixelDepth = static_cast<std::uint32_t>(Texture.extent().z);
+		Header.Layers = static_cast<std::uint32_t>(Texture.layers());
+		Header.Levels = static_cast<std::uint32_t>(Texture.levels());
+		Header.Faces = static_cast<std::uint32_t>(Texture.faces());
+		Header.Supercompression = static_cast<std::uint32_t>(Supercompression);
+		Header.ChunkSize = static_cast<std::uint32_t>(ChunkSize);
+		Header.ChunkCount = static_cast<std::uint32_t>(Chunks.size());
+
+		std::memcpy(&Memory[0], detail::FOURCC_KMG200, sizeof(detail::FOURCC_KMG200));
+		std::memcpy(&Memory[0] + sizeof(detail::FOURCC_KMG200), &Header, sizeof(Header));
+		std::memcpy(&Memory[0] + IndexOffset, &Chunks[0], sizeof(detail::kmgChunk20) * Chunks.size());
+
+		return true;
+	}
+
+	inline bool save_kmg2(texture const & Texture, char const * Filename, supercompression Supercompression)
+	{
+		if(Texture.empty())
+			return false;
+
+		std::vector<char> Memory;
+		if(!save_kmg2(Texture, Memory, Supercompression))
+			return false;
+
+		FILE* File = detail::open_file(Filename, "wb");
+		if(!File)
+			return false;
+
+		std::fwrite(&Memory[0], 1, Memory.size(), File);
+		std::fclose(File);
+
+		return true;
+	}
+
+	inline bool save_kmg2(texture const & Texture, std::string const & Filename, supercompression Supercompression)
+	{
+		return save_kmg2(Texture, Filename.c_str(), Supercompression);
+	}
 }//namespace gli
@@ -6,30 +6,18 @@
 namespace gli{
 namespace detail
 {
-	inline texture::size_type compute_ktx_storage_size(texture const & Texture)
+	// Size of the components of a texel, the size of the whole texel for packed formats and 1 for compressed formats
+	inline std::uint32_t get_ktx_type_size(format Format)
 	{
-		texture::size_type const BlockSize = block_size(Texture.format());
-		texture::size_type TotalSize = sizeof(detail::FOURCC_KTX10) + sizeof(detail::ktx_header10);
-
-		for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
-		{
-			TotalSize += sizeof(std::uint32_t);
-
-			for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
-			for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
-			{
-				texture::size_type const FaceSize = Texture.size(Level);
-				texture::size_type const PaddedSize = std::max(BlockSize, glm::ceilMultiple(FaceSize, static_cast<texture::size_type>(4)));
-
-				TotalSize += PaddedSize;
-			}
-		}
-
-		return TotalSize;
+		if(is_compressed(Format))
+			return 1;
+		if(is_packed(Format) || is_depth_stencil(Format))
+			return static_cast<std::uint32_t>(block_size(Format));
+		return static_cast<std::uint32_t>(block_size(Format) / component_count(Format));
 	}
 }//namespace detail
 
-	inline bool save_ktx(texture const& Texture, std::vector<char>& Memory)
+	inline bool save_ktx(texture const& Texture, segment_list& Segments)
 	{
 		if(Texture.empty())
 			return false;
@@ -38,18 +26,14 @@ namespace detail
 		gl::format const& Format = GL.translate(Texture.format(), Texture.swizzles());
 		target const Target = Texture.target();
 
-		detail::formatInfo const& Desc = detail::get_format_info(Texture.format());
+		Segments.reset(Texture, sizeof(detail::FOURCC_KTX10) + sizeof(detail::ktx_header10) + sizeof(std::uint32_t) * Texture.levels());
 
-		Memory.resize(detail::compute_ktx_storage_size(Texture));
+		std::memcpy(Segments.append_header(sizeof(detail::FOURCC_KTX10)), detail::FOURCC_KTX10, sizeof(detail::FOURCC_KTX10));
 
-		std::memcpy(&Memory[0], detail::FOURCC_KTX10, sizeof(detail::FOURCC_KTX10));
-
-		std::size_t Offset = sizeof(detail::FOURCC_KTX10);
-
-		detail::ktx_header10& Header = *reinterpret_cast<detail::ktx_header10*>(&Memory[0] + Offset);
+		detail::ktx_header10& Header = *static_cast<detail::ktx_header10*>(Segments.append_header(sizeof(detail::ktx_header10)));
 		Header.Endianness = 0x04030201;
 		Header.GLType = Format.Type;
-		Header.GLTypeSize = Format.Type == gl::TYPE_NONE ? 1 : Desc.BlockSize;
+		Header.GLTypeSize = detail::get_ktx_type_size(Texture.format());
 		Header.GLFormat = Format.External;
 		Header.GLInternalFormat = Format.Internal;
 		Header.GLBaseInternalFormat = Format.External;
@@ -61,26 +45,21 @@ namespace detail
 		Header.NumberOfMipmapLevels = static_cast<std::uint32_t>(Texture.levels());
 		Header.BytesOfKeyValueData = 0;
 
-		Offset += sizeof(detail::ktx_header10);
-
 		for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
 		{
-			std::uint32_t& ImageSize = *reinterpret_cast<std::uint32_t*>(&Memory[0] + Offset);
-			Offset += sizeof(std::uint32_t);
+			std::uint32_t& ImageSize = *static_cast<std::uint32_t*>(Segments.append_header(sizeof(std::uint32_t)));
 
 			for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
 			for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
 			{
 				texture::size_type const FaceSize = Texture.size(Level);
-
-				std::memcpy(&Memory[0] + Offset, Texture.data(Layer, Face, Level), FaceSize);
-
 				texture::size_type const PaddedSize = glm::ceilMultiple(FaceSize, static_cast<texture::size_type>(4));
 
-				ImageSize += static_cast<std::uint32_t>(PaddedSize);
-				Offset += PaddedSize;
+				// Images are referenced in place, the padding to 4 bytes points to static zeros
+				Segments.append(Texture.data(Layer, Face, Level), FaceSize);
+				Segments.append_padding(PaddedSize - FaceSize);
 
-				GLI_ASSERT(Offset <= Memory.size());
+				ImageSize += static_cast<std::uint32_t>(PaddedSize);
 			}
 
 			ImageSize = glm::ceilMultiple(ImageSize, static_cast<std::uint32_t>(4));
@@ -89,21 +68,176 @@ namespace detail
 		return true;
 	}
 
-	inline bool save_ktx(texture const& Texture, char const* Filename)
+	inline bool save_ktx(texture const& Texture, std::vector<char>& Memory)
+	{
+		segment_list Segments;
+		if(!save_ktx(Texture, Segments))
+			return false;
+
+		Segments.gather(Memory);
+		return true;
+	}
+
+	inline bool save_ktx2(texture const& Texture, std::vector<char>& Memory, supercompression Supercompression)
 	{
 		if(Texture.empty())
 			return false;
 
-		FILE* File = detail::open_file(Filename, "wb");
-		if(!File)
+		std::uint32_t const VkFormat = detail::get_ktx2_vk_format(Texture.format());
+		if(VkFormat == 0)
+			return false;
+
+#		if defined(GLI_ZSTD)
+			if(Supercompression != SUPERCOMPRESSION_NONE && Supercompression != SUPERCOMPRESSION_ZSTD)
+				return false;
+#		else
+			if(Supercompression != SUPERCOMPRESSION_NONE)
+				return false;
+#		endif
+
+		target const Target = Texture.target();
+		texture::size_type const Levels = Texture.levels();
+		texture::size_type const Images = Texture.layers() * Texture.faces();
+		bool const Supercompressed = Supercompression != SUPERCOMPRESSION_NONE;
+
+		std::vector<std::uint32_t> const DFD = detail::make_ktx2_dfd(Texture.format(), Supercompressed);
+
+		// The images of a level are contiguous in the file: layers, then faces, then slices
+		std::vector<std::vector<char> > Compressed(Supercompressed ? Levels : 0);
+#		if defined(GLI_ZSTD)
+			if(Supercompressed)
+			{
+				std::vector<char> Failed(Levels, 0);
+				detail::parallel_for(0, Levels, 1, [&](std::size_t RangeBegin, std::size_t RangeEnd)
+				{
+					for(std::size_t Level = RangeBegin; Level < RangeEnd; ++Level)
+					{
+						std::size_t const LevelSize = Texture.size(Level) * Images;
+
+						std::vector<char> Buffer;
+						char const* Src = static_cast<char const*>(Texture.data(0, 0, Level));
+						if(Images > 1)
+						{
+							Buffer.resize(LevelSize);
+							for(texture::size_type Layer = 0, Offset = 0; Layer < Texture.layers(); ++Layer)
+							for(texture::size_type Face = 0; Face < Texture.faces(); ++Face, Offset += Texture.size(Level))
+								std::memcpy(&Buffer[Offset], Texture.data(Layer, Face, Level), Texture.size(Level));
+							Src = &Buffer[0];
+						}
+
+						Compressed[Level].resize(ZSTD_compressBound(LevelSize));
+						std::size_t const Result = ZSTD_compress(&Compressed[Level][0], Compressed[Level].size(), Src, LevelSize, ZSTD_CLEVEL_DEFAULT);
+						if(ZSTD_isError(Result))
+							Failed[Level] = 1;
+						else
+							Compressed[Level].resize(Result);
+					}
+				});
+
+				for(std::size_t Level = 0; Level < Levels; ++Level)
+					if(Failed[Level])
+						return false;
+			}
+#		endif//GLI_ZSTD
+
+		// Levels are stored from the smallest to the largest, aligned to the texel block and to 4 bytes unless supercompressed
+		texture::size_type const BlockSize = block_size(Texture.format());
+		texture::size_type const Alignment = Supercompressed ? 1 : (BlockSize % 4 == 0 ? BlockSize : (BlockSize % 2 == 0 ? BlockSize * 2 : BlockSize * 4));
+
+		std::size_t const DFDOffset = sizeof(detail::ktx_header20) + sizeof(detail::ktx_level20) * Levels;
+		std::size_t Offset = DFDOffset + DFD.size() * sizeof(std::uint32_t);
+
+		std::vector<detail::ktx_level20> LevelIndex(Levels);
+		for(texture::size_type Level = Levels; Level-- > 0;)
+		{
+			Offset = glm::ceilMultiple(Offset, Alignment);
+			LevelIndex[Level].ByteOffset = Offset;
+			LevelIndex[Level].UncompressedByteLength = Texture.size(Level) * Images;
+			LevelIndex[Level].ByteLength = Supercompressed ? Compressed[Level].size() : LevelIndex[Level].UncompressedByteLength;
+			Offset += static_cast<std::size_t>(LevelIndex[Level].ByteLength);
+		}
+
+		Memory.assign(Offset, 0);
+
+		detail::ktx_header20 Header;
+		std::memcpy(Header.Identifier, detail::FOURCC_KTX20, sizeof(detail::FOURCC_KTX20));
+		Header.VkFormat = VkFormat;
+		Header.TypeSize = detail::get_ktx_type_size(Texture.format());
+		Header.PixelWidth = static_cast<std::uint32_t>(Texture.extent().x);
+		Header.PixelHeight = !is_target_1d(Target) ? static_cast<std::uint32_t>(Texture.extent().y) : 0;
+		Header.PixelDepth = Target == TARGET_3D ? static_cast<std::uint32_t>(Texture.extent().z) : 0;
+		Header.LayerCount = is_target_array(Target) ? static_cast<std::uint32_t>(Texture.layers()) : 0;
+		Header.FaceCount = static_cast<std::uint32_t>(Texture.faces());
+		Header.LevelCount = static_cast<std::uint32_t>(Levels);
+		Header.SupercompressionScheme = static_cast<std::uint32_t>(Supercompression);
+		Header.DFDByteOffset = static_cast<std::uint32_t>(DFDOffset);
+		Header.DFDByteLength = static_cast<std::uint32_t>(DFD.size() * sizeof(std::uint32_t));
+		Header.KVDByteOffset = 0;
+		Header.KVDByteLength = 0;
+		Header.SGDByteOffset = 0;
+		Header.SGDByteLength = 0;
+
+		std::memcpy(&Memory[0], &Header, sizeof(Header));
+		std::memcpy(&Memory[0] + sizeof(Header), &LevelIndex[0], sizeof(detail::ktx_level20) * Levels);
+		std::memcpy(&Memory[0] + DFDOffset, &DFD[0], DFD.size() * sizeof(std::uint32_t));
+
+		for(texture::size_type Level = 0; Level < Levels; ++Level)
+		{
+			char* Dst = &Memory[0] + LevelIndex[Level].ByteOffset;
+			if(Supercompressed)
+			{
+				std::memcpy(Dst, &Compressed[Level][0], Compressed[Level].size());
+				continue;
+			}
+
+			for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
+			for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face, Dst += Texture.size(Level))
+				std::memcpy(Dst, Texture.data(Layer, Face, Level), Texture.size(Level));
+		}
+
+		return true;
+	}
+
+	inline bool save_ktx2(texture const& Texture, char const* Filename, supercompression Supercompression)
+	{
+		if(Texture.empty())
 			return false;
 
 		std::vector<char> Memory;
-		bool const Result = save_ktx(Texture, Memory);
+		if(!save_ktx2(Texture, Memory, Supercompression))
+			return false;
+
+		FILE* File = detail::open_file(Filename, "wb");
+		if(!File)
+			return false;
 
 		std::fwrite(&Memory[0], 1, Memory.size(), File);
 		std::fclose(File);
 
+		return true;
+	}
+
+	inline bool save_ktx2(texture const& Texture, std::string const& Filename, supercompression Supercompression)
+	{
+		return save_ktx2(Texture, Filename.c_str(), Supercompression);
+	}
+
+	inline bool save_ktx(texture const& Texture, char const* Filename)
+	{
+		if(Texture.empty())
+			return false;
+
+		segment_list Segments;
+		if(!save_ktx(Texture, Segments))
+			return false;
+
+		FILE* File = detail::open_file(Filename, "wb");
+		if(!File)
+			return false;
+
+		bool const Result = Segments.write(File);
+		std::fclose(File);
+
 		return Result;
 	}
 
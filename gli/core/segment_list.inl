@@ -0,0 +1,119 @@
+#include <cstring>
+
+namespace gli{
+namespace detail
+{
+	static char const SEGMENT_PADDING[16] = {};
+}//namespace detail
+
+	inline segment_list::segment_list()
+		: Bytes(0)
+	{}
+
+	inline bool segment_list::empty() const
+	{
+		return this->Segments.empty();
+	}
+
+	inline segment_list::size_type segment_list::size() const
+	{
+		return this->Segments.size();
+	}
+
+	inline segment const& segment_list::operator[](size_type Index) const
+	{
+		GLI_ASSERT(Index < this->Segments.size());
+
+		return this->Segments[Index];
+	}
+
+	inline segment const* segment_list::data() const
+	{
+		return this->Segments.empty() ? nullptr : &this->Segments[0];
+	}
+
+	inline segment_list::size_type segment_list::bytes() const
+	{
+		return this->Bytes;
+	}
+
+	inline void segment_list::gather(std::vector<char>& Memory) const
+	{
+		Memory.resize(this->Bytes);
+
+		std::size_t Offset = 0;
+		for(std::size_t Index = 0, Count = this->Segments.size(); Index < Count; ++Index)
+		{
+			std::memcpy(&Memory[0] + Offset, this->Segments[Index].Data, this->Segments[Index].Size);
+			Offset += this->Segments[Index].Size;
+		}
+	}
+
+	inline bool segment_list::write(FILE* File) const
+	{
+		for(std::size_t Index = 0, Count = this->Segments.size(); Index < Count; ++Index)
+			if(std::fwrite(this->Segments[Index].Data, 1, this->Segments[Index].Size, File) != this->Segments[Index].Size)
+				return false;
+		return true;
+	}
+
+	inline void segment_list::reset(texture const& Texture, size_type HeaderCapacity)
+	{
+		// A new header memory so that the lists copied from this one keep their headers
+		this->Texture = Texture;
+		this->Headers = std::make_shared<std::list<std::vector<char> > >(1);
+		this->Headers->back().reserve(HeaderCapacity);
+		this->Segments.clear();
+		this->Bytes = 0;
+	}
+
+	inline void* segment_list::append_header(size_type Size)
+	{
+		if(!this->Headers)
+			this->Headers = std::make_shared<std::list<std::vector<char> > >(1);
+
+		// A header block is never reallocated because the previous segments point into it, a new block is started when the capacity is exceeded
+		if(this->Headers->back().size() + Size > this->Headers->back().capacity())
+		{
+			this->Headers->push_back(std::vector<char>());
+			this->Headers->back().reserve(Size);
+		}
+
+		std::vector<char>& Block = this->Headers->back();
+		std::size_t const Offset = Block.size();
+		Block.resize(Offset + Size, 0);
+
+		char* const Data = Block.data() + Offset;
+		this->append(Data, Size);
+		return Data;
+	}
+
+	inline void segment_list::append(void const* Data, size_type Size)
+	{
+		if(Size == 0)
+			return;
+
+		this->Bytes += Size;
+
+		// Contiguous memory, like consecutive images of a texture storage, is merged in a single segment
+		if(!this->Segments.empty())
+		{
+			segment& Last = this->Segments.back();
+			if(static_cast<char const*>(Last.Data) + Last.Size == Data)
+			{
+				Last.Size += Size;
+				return;
+			}
+		}
+
+		segment const Segment = {Data, Size};
+		this->Segments.push_back(Segment);
+	}
+
+	inline void segment_list::append_padding(size_type Size)
+	{
+		GLI_ASSERT(Size <= sizeof(detail::SEGMENT_PADDING));
+
+		this->append(detail::SEGMENT_PADDING, Size);
+	}
+}//namespace gli
@@ -0,0 +1,20 @@
+/// @brief Include to select the SIMD code paths from the instruction sets targeted by the compiler
+/// @file gli/core/simd.hpp
+///
+/// GLM only sets GLM_ARCH when its intrinsics are forced, the compiler macros are checked as well so that the SIMD code paths are used by default.
+/// SSE2 is always available on x86-64, SSSE3 requires -mssse3 or -march with GCC and Clang, /arch:AVX with Visual C++.
+/// Define GLM_FORCE_PURE before including GLI to use the scalar code paths only.
+
+#pragma once
+
+#include "../type.hpp"
+
+#if !defined(GLM_FORCE_PURE) && ((GLM_ARCH & GLM_ARCH_SSE2_BIT) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#	include <emmintrin.h>
+#	define GLI_SIMD_SSE2
+#endif
+
+#if defined(GLI_SIMD_SSE2) && ((GLM_ARCH & GLM_ARCH_SSSE3_BIT) || defined(__SSSE3__) || defined(__AVX__))
+#	include <tmmintrin.h>
+#	define GLI_SIMD_SSSE3
+#endif
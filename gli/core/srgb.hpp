@@ -0,0 +1,103 @@
+/// @brief Include to convert 8 bit sRGB values to and from linear values with tables
+/// @file gli/core/srgb.hpp
+///
+/// Decoding reads a table of the 256 linear values. Encoding looks up the code of the linear value range
+/// from the exponent and upper mantissa bits, then compares the value with the threshold to the next code,
+/// which rounds exactly to the nearest code.
+
+#pragma once
+
+#include "../type.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace gli{
+namespace detail
+{
+	enum
+	{
+		// Linear values below 2^-13 encode to 0, the ranges split each power of two from 2^-13 to 1 in 128
+		SRGB_RANGE_EXPONENT = 127 - 13,
+		SRGB_RANGE_COUNT = 13 << 7
+	};
+
+	inline double srgb_to_linear_exact(double Value)
+	{
+		return Value <= 0.04045 ? Value / 12.92 : std::pow((Value + 0.055) / 1.055, 2.4);
+	}
+
+	inline double linear_to_srgb_exact(double Value)
+	{
+		return Value <= 0.0031308 ? Value * 12.92 : 1.055 * std::pow(Value, 1.0 / 2.4) - 0.055;
+	}
+
+	// Nearest 8 bit code of a linear value in [0, 1]
+	inline int linear_to_srgb8_exact(float Value)
+	{
+		return static_cast<int>(std::floor(linear_to_srgb_exact(Value) * 255.0 + 0.5));
+	}
+
+	struct srgb_tables
+	{
+		float Decode[256];
+		// Smallest linear value encoded to Code + 1, above 1 for the last code
+		float Threshold[256];
+		// Code of the smallest linear value of each range
+		glm::uint8 Range[SRGB_RANGE_COUNT];
+
+		srgb_tables()
+		{
+			for(int Code = 0; Code < 256; ++Code)
+				this->Decode[Code] = static_cast<float>(srgb_to_linear_exact(Code / 255.0));
+
+			for(int Code = 0; Code < 255; ++Code)
+			{
+				// Start from the inverse of the code boundary and adjust by an ulp until the rounded encoding changes
+				float Threshold = static_cast<float>(srgb_to_linear_exact((Code + 0.5) / 255.0));
+				while(linear_to_srgb8_exact(Threshold) > Code)
+					Threshold = std::nextafter(Threshold, 0.0f);
+				while(linear_to_srgb8_exact(Threshold) <= Code)
+					Threshold = std::nextafter(Threshold, 2.0f);
+				this->Threshold[Code] = Threshold;
+			}
+			this->Threshold[255] = 2.0f;
+
+			for(glm::uint32 RangeIndex = 0; RangeIndex < SRGB_RANGE_COUNT; ++RangeIndex)
+			{
+				glm::uint32 const Bits = (RangeIndex + (SRGB_RANGE_EXPONENT << 7)) << 16;
+				float Value;
+				std::memcpy(&Value, &Bits, sizeof(Value));
+				this->Range[RangeIndex] = static_cast<glm::uint8>(linear_to_srgb8_exact(Value));
+			}
+		}
+	};
+
+	inline srgb_tables const& get_srgb_tables()
+	{
+		static srgb_tables const Tables;
+		return Tables;
+	}
+
+	/// Linear value of an 8 bit sRGB code
+	inline float srgb8_to_linear(srgb_tables const& Tables, glm::uint8 Code)
+	{
+		return Tables.Decode[Code];
+	}
+
+	/// Nearest 8 bit sRGB code of a linear value, clamped to [0, 1]. NaNs encode to 0.
+	inline glm::uint8 linear_to_srgb8(srgb_tables const& Tables, float Value)
+	{
+		// Clamp to [2^-13, 1 - 2^-24] without branching, NaNs fail the first comparison
+		float const Min = 1.0f / 8192.0f;
+		float const Max = 0.99999994f;
+		float const Clamped = Value > Min ? (Value < Max ? Value : Max) : Min;
+
+		glm::uint32 Bits;
+		std::memcpy(&Bits, &Clamped, sizeof(Bits));
+
+		// Each range holds at most one code boundary
+		glm::uint8 const Code = Tables.Range[(Bits >> 16) - (SRGB_RANGE_EXPONENT << 7)];
+		return static_cast<glm::uint8>(Code + (Clamped >= Tables.Threshold[Code] ? 1 : 0));
+	}
+}//namespace detail
+}//namespace gli
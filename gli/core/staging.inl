@@ -0,0 +1,117 @@
+#include "parallel.hpp"
+#include <glm/gtc/round.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace gli{
+namespace detail
+{
+	// Smallest multiple of Alignment which is a multiple of BlockSize too, so that rows and images start on a block
+	inline size_t get_staging_alignment(size_t Alignment, size_t BlockSize)
+	{
+		size_t Divisor = Alignment;
+		for(size_t Remainder = BlockSize; Remainder != 0;)
+		{
+			size_t const Next = Divisor % Remainder;
+			Divisor = Remainder;
+			Remainder = Next;
+		}
+
+		return Alignment / Divisor * BlockSize;
+	}
+
+	// Round Value up to a multiple of Alignment, glm::ceilMultiple doesn't keep 0 for unsigned values
+	inline size_t align_staging(size_t Value, size_t Alignment)
+	{
+		return (Value + Alignment - 1) / Alignment * Alignment;
+	}
+}//namespace detail
+
+	inline size_t staging_layout(texture const& Texture, staging_alignment const& Alignment, std::vector<staging_footprint>& Footprints)
+	{
+		Footprints.clear();
+		if(Texture.empty() || Alignment.RowPitch == 0 || Alignment.Offset == 0)
+			return 0;
+
+		size_t const BlockSize = block_size(Texture.format());
+		texture::extent_type const BlockExtent = block_extent(Texture.format());
+		size_t const RowAlignment = detail::get_staging_alignment(Alignment.RowPitch, BlockSize);
+		size_t const OffsetAlignment = detail::get_staging_alignment(Alignment.Offset, BlockSize);
+
+		Footprints.reserve(Texture.layers() * Texture.faces() * Texture.levels());
+
+		size_t Offset = 0;
+		for(texture::size_type Layer = 0, Layers = Texture.layers(); Layer < Layers; ++Layer)
+		for(texture::size_type Face = 0, Faces = Texture.faces(); Face < Faces; ++Face)
+		for(texture::size_type Level = 0, Levels = Texture.levels(); Level < Levels; ++Level)
+		{
+			texture::extent_type const Extent = Texture.extent(Level);
+			texture::extent_type const BlockCount = glm::ceilMultiple(Extent, BlockExtent) / BlockExtent;
+
+			staging_footprint Footprint;
+			Footprint.Layer = Layer;
+			Footprint.Face = Face;
+			Footprint.Level = Level;
+			Footprint.Extent = Extent;
+			Footprint.Offset = detail::align_staging(Offset, OffsetAlignment);
+			Footprint.RowSize = BlockSize * static_cast<size_t>(BlockCount.x);
+			Footprint.RowPitch = detail::align_staging(Footprint.RowSize, RowAlignment);
+			Footprint.RowCount = static_cast<size_t>(BlockCount.y);
+			Footprint.SliceCount = static_cast<size_t>(BlockCount.z);
+			Footprint.SlicePitch = Footprint.RowPitch * Footprint.RowCount;
+			Footprint.RowLength = Footprint.RowPitch / BlockSize * static_cast<size_t>(BlockExtent.x);
+			Footprint.ImageHeight = Footprint.RowCount * static_cast<size_t>(BlockExtent.y);
+			Footprints.push_back(Footprint);
+
+			Offset = Footprint.Offset + Footprint.SlicePitch * Footprint.SliceCount;
+		}
+
+		return Offset;
+	}
+
+	inline bool fill_staging(texture const& Texture, std::vector<staging_footprint> const& Footprints, void* Buffer, size_t Size)
+	{
+		if(Texture.empty() || Buffer == nullptr || Footprints.size() != Texture.layers() * Texture.faces() * Texture.levels())
+			return false;
+
+		// First row of each image in the list of all the rows to copy
+		std::vector<size_t> FirstRows(Footprints.size() + 1, 0);
+		for(size_t Index = 0; Index < Footprints.size(); ++Index)
+		{
+			staging_footprint const& Footprint = Footprints[Index];
+			if(Footprint.Layer >= Texture.layers() || Footprint.Face >= Texture.faces() || Footprint.Level >= Texture.levels())
+				return false;
+			if(Footprint.RowSize * Footprint.RowCount * Footprint.SliceCount != Texture.size(Footprint.Level))
+				return false;
+			if(Footprint.RowPitch < Footprint.RowSize || Footprint.SlicePitch < Footprint.RowPitch * Footprint.RowCount)
+				return false;
+			if(Footprint.Offset > Size || Footprint.SlicePitch * Footprint.SliceCount > Size - Footprint.Offset)
+				return false;
+
+			FirstRows[Index + 1] = FirstRows[Index] + Footprint.RowCount * Footprint.SliceCount;
+		}
+
+		char* const Dst = static_cast<char*>(Buffer);
+		size_t const Grain = std::max<size_t>((size_t(1) << 16) / std::max<size_t>(Footprints[0].RowSize, 1), 1);
+
+		detail::parallel_for(0, FirstRows.back(), Grain, [&](size_t RangeBegin, size_t RangeEnd)
+		{
+			size_t Index = static_cast<size_t>(std::upper_bound(FirstRows.begin(), FirstRows.end(), RangeBegin) - FirstRows.begin()) - 1;
+			for(size_t Row = RangeBegin; Row < RangeEnd; ++Row)
+			{
+				while(Row >= FirstRows[Index + 1])
+					++Index;
+
+				staging_footprint const& Footprint = Footprints[Index];
+				size_t const ImageRow = Row - FirstRows[Index];
+				size_t const Slice = ImageRow / Footprint.RowCount;
+				size_t const SliceRow = ImageRow % Footprint.RowCount;
+
+				char const* const Src = static_cast<char const*>(Texture.data(Footprint.Layer, Footprint.Face, Footprint.Level)) + ImageRow * Footprint.RowSize;
+				std::memcpy(Dst + Footprint.Offset + Slice * Footprint.SlicePitch + SliceRow * Footprint.RowPitch, Src, Footprint.RowSize);
+			}
+		});
+
+		return true;
+	}
+}//namespace gli
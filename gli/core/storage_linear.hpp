@@ -39,6 +39,17 @@ namespace gli
 			size_type Faces,
 			size_type Levels);
 
+		/// Use the external memory pointed by Data as storage without copying it.
+		/// Owner keeps the memory alive as long as the storage exists, Data must hold the storage of the texture layout.
+		storage_linear(
+			format_type Format,
+			extent_type const & Extent,
+			size_type Layers,
+			size_type Faces,
+			size_type Levels,
+			data_type* Data,
+			std::shared_ptr<void> const& Owner);
+
 		bool empty() const;
 		size_type size() const; // Express is bytes
 		size_type layers() const;
@@ -89,6 +100,9 @@ namespace gli
 		extent_type const BlockExtent;
 		extent_type const Extent;
 		std::vector<data_type> Data;
+		data_type* const External;
+		std::shared_ptr<void> const Owner;
+		size_type const ExternalSize;
 	};
 }//namespace gli
 
@@ -1,3 +1,5 @@
+#include "fill.hpp"
+
 namespace gli
 {
 	inline storage_linear::storage_linear()
@@ -8,6 +10,8 @@ namespace gli
 		, BlockCount(0)
 		, BlockExtent(0)
 		, Extent(0)
+		, External(nullptr)
+		, ExternalSize(0)
 	{}
 
 	inline storage_linear::storage_linear(format_type Format, extent_type const& Extent, size_type Layers, size_type Faces, size_type Levels)
@@ -18,6 +22,8 @@ namespace gli
 		, BlockCount(glm::ceilMultiple(Extent, gli::block_extent(Format)) / gli::block_extent(Format))
 		, BlockExtent(gli::block_extent(Format))
 		, Extent(Extent)
+		, External(nullptr)
+		, ExternalSize(0)
 	{
 		GLI_ASSERT(Layers > 0);
 		GLI_ASSERT(Faces > 0);
@@ -27,9 +33,28 @@ namespace gli
 		this->Data.resize(this->layer_size(0, Faces - 1, 0, Levels - 1) * Layers, 0);
 	}
 
+	inline storage_linear::storage_linear(format_type Format, extent_type const& Extent, size_type Layers, size_type Faces, size_type Levels, data_type* Data, std::shared_ptr<void> const& Owner)
+		: Layers(Layers)
+		, Faces(Faces)
+		, Levels(Levels)
+		, BlockSize(gli::block_size(Format))
+		, BlockCount(glm::ceilMultiple(Extent, gli::block_extent(Format)) / gli::block_extent(Format))
+		, BlockExtent(gli::block_extent(Format))
+		, Extent(Extent)
+		, External(Data)
+		, Owner(Owner)
+		, ExternalSize(this->layer_size(0, Faces - 1, 0, Levels - 1) * Layers)
+	{
+		GLI_ASSERT(Layers > 0);
+		GLI_ASSERT(Faces > 0);
+		GLI_ASSERT(Levels > 0);
+		GLI_ASSERT(glm::all(glm::greaterThan(Extent, extent_type(0))));
+		GLI_ASSERT(Data != nullptr);
+	}
+
 	inline bool storage_linear::empty() const
 	{
-		return this->Data.empty();
+		return this->Data.empty() && this->External == nullptr;
 	}
 
 	inline storage_linear::size_type storage_linear::layers() const
@@ -75,21 +100,21 @@ namespace gli
 	{
 		GLI_ASSERT(!this->empty());
 
-		return static_cast<size_type>(this->Data.size());
+		return this->External ? this->ExternalSize : static_cast<size_type>(this->Data.size());
 	}
 
 	inline storage_linear::data_type* storage_linear::data()
 	{
 		GLI_ASSERT(!this->empty());
 
-		return &this->Data[0];
+		return this->External ? this->External : &this->Data[0];
 	}
 
 	inline storage_linear::data_type const* const storage_linear::data() const
 	{
 		GLI_ASSERT(!this->empty());
 
-		return &this->Data[0];
+		return this->External ? this->External : &this->Data[0];
 	}
 
 	inline storage_linear::size_type storage_linear::base_offset(size_type Layer, size_type Face, size_type Level) const
@@ -131,21 +156,33 @@ namespace gli
 		size_t LayerDst, size_t FaceDst, size_t LevelDst, extent_type const& BlockIndexDst,
 		extent_type const& BlockCount)
 	{
-		storage_linear::size_type const BaseOffsetSrc = StorageSrc.base_offset(LayerSrc, FaceSrc, LevelSrc);
-		storage_linear::size_type const BaseOffsetDst = this->base_offset(LayerDst, FaceDst, LevelDst);
-		storage_linear::data_type const* const ImageSrc = StorageSrc.data() + BaseOffsetSrc;
-		storage_linear::data_type* const ImageDst = this->data() + BaseOffsetDst;
+		GLI_ASSERT(StorageSrc.block_size() == this->block_size());
+		GLI_ASSERT(glm::all(glm::lessThanEqual(BlockIndexSrc + BlockCount, StorageSrc.block_count(LevelSrc))));
+		GLI_ASSERT(glm::all(glm::lessThanEqual(BlockIndexDst + BlockCount, this->block_count(LevelDst))));
+
+		if(!glm::all(glm::greaterThan(BlockCount, extent_type(0))))
+			return;
+
+		extent_type const BlockCountSrc = StorageSrc.block_count(LevelSrc);
+		extent_type const BlockCountDst = this->block_count(LevelDst);
+		storage_linear::data_type const* const ImageSrc = StorageSrc.data() + StorageSrc.base_offset(LayerSrc, FaceSrc, LevelSrc);
+		storage_linear::data_type* const ImageDst = this->data() + this->base_offset(LayerDst, FaceDst, LevelDst);
+
+		size_t const RowSize = this->block_size() * BlockCount.x;
+		size_t const RowCount = static_cast<size_t>(BlockCount.y) * static_cast<size_t>(BlockCount.z);
+		bool const Stream = RowSize * RowCount >= static_cast<size_t>(GLI_STREAM_THRESHOLD);
 
-		for(size_t BlockIndexZ = 0, BlockCountZ = BlockCount.z; BlockIndexZ < BlockCountZ; ++BlockIndexZ)
-		for(size_t BlockIndexY = 0, BlockCountY = BlockCount.y; BlockIndexY < BlockCountY; ++BlockIndexY)
+		// Each row of blocks is contiguous, the rows of all the slices are split across threads
+		detail::parallel_for(0, RowCount, glm::max<size_t>((1 << 16) / RowSize, 1), [&](size_t RangeBegin, size_t RangeEnd)
 		{
-			extent_type const BlockIndex(0, BlockIndexY, BlockIndexZ);
-			gli::size_t const OffsetSrc = StorageSrc.image_offset(BlockIndexSrc + BlockIndex, StorageSrc.extent(LevelSrc)) * StorageSrc.block_size();
-			gli::size_t const OffsetDst = this->image_offset(BlockIndexDst + BlockIndex, this->extent(LevelDst)) * this->block_size();
-			storage_linear::data_type const* const DataSrc = ImageSrc + OffsetSrc;
-			storage_linear::data_type* DataDst = ImageDst + OffsetDst;
-			memcpy(DataDst, DataSrc, this->block_size() * BlockCount.x);
-		}
+			for(size_t RowIndex = RangeBegin; RowIndex < RangeEnd; ++RowIndex)
+			{
+				extent_type const BlockIndex(0, static_cast<int>(RowIndex % BlockCount.y), static_cast<int>(RowIndex / BlockCount.y));
+				gli::size_t const OffsetSrc = StorageSrc.image_offset(BlockIndexSrc + BlockIndex, BlockCountSrc) * StorageSrc.block_size();
+				gli::size_t const OffsetDst = this->image_offset(BlockIndexDst + BlockIndex, BlockCountDst) * this->block_size();
+				detail::copy_memory(ImageDst + OffsetDst, ImageSrc + OffsetSrc, RowSize, Stream);
+			}
+		});
 	}
 
 	inline storage_linear::size_type storage_linear::level_size(size_type Level) const
@@ -0,0 +1,216 @@
+#pragma once
+
+#include "../type.hpp"
+#include "../format.hpp"
+#include "simd.hpp"
+#include <cstring>
+
+namespace gli{
+namespace detail
+{
+	// Byte permutation applied to each texel: a destination byte is either a byte of the same source texel or a constant.
+	struct swizzle_shuffle
+	{
+		enum
+		{
+			CONSTANT = 0x80
+		};
+
+		size_t SrcTexelSize;
+		size_t DstTexelSize;
+		glm::uint8 Index[16];
+		glm::uint8 Constant[16];
+	};
+
+	// Size in bytes of each component of a format, 0 if the components aren't stored in whole bytes
+	inline size_t component_size(format Format)
+	{
+		if(is_compressed(Format) || is_packed(Format))
+			return 0;
+
+		size_t const BlockSize = block_size(Format);
+		size_t const ComponentCount = component_count(Format);
+
+		// Padded formats such as FORMAT_BGR8_UNORM_PACK32 store an unused fourth component
+		if(BlockSize % ComponentCount != 0)
+			return BlockSize % 4 == 0 ? BlockSize / 4 : 0;
+		return BlockSize / ComponentCount;
+	}
+
+	// Whether the texels of FormatSrc can be stored in FormatDst by only reordering, dropping or adding components
+	inline bool is_reorderable(format FormatSrc, format FormatDst)
+	{
+		glm::uint32 const TypeMask = CAP_COLORSPACE_SRGB_BIT | CAP_NORMALIZED_BIT | CAP_SCALED_BIT | CAP_UNSIGNED_BIT | CAP_SIGNED_BIT | CAP_INTEGER_BIT | CAP_FLOAT_BIT | CAP_DEPTH_BIT | CAP_STENCIL_BIT;
+
+		size_t const ComponentSize = component_size(FormatSrc);
+		if(ComponentSize == 0 || ComponentSize != component_size(FormatDst))
+			return false;
+		if(block_size(FormatSrc) > 16 || block_size(FormatDst) > 16)
+			return false;
+
+		return (get_format_info(FormatSrc).Flags & TypeMask) == (get_format_info(FormatDst).Flags & TypeMask);
+	}
+
+	// Write in One the bytes representing the value one in a component of Format
+	inline void component_one(format Format, size_t ComponentSize, glm::uint8* One)
+	{
+		std::memset(One, 0, ComponentSize);
+
+		if(is_float(Format))
+		{
+			if(ComponentSize == 2)
+			{
+				glm::uint16 const Half = 0x3C00;
+				std::memcpy(One, &Half, sizeof(Half));
+			}
+			else if(ComponentSize == 4)
+			{
+				float const Float = 1.0f;
+				std::memcpy(One, &Float, sizeof(Float));
+			}
+			else if(ComponentSize == 8)
+			{
+				double const Double = 1.0;
+				std::memcpy(One, &Double, sizeof(Double));
+			}
+		}
+		else if(is_normalized(Format))
+		{
+			std::memset(One, 0xFF, ComponentSize);
+			if(is_signed(Format))
+				One[ComponentSize - 1] = 0x7F;
+		}
+		else
+			One[0] = 1;
+	}
+
+	// Build the shuffle storing the texels of FormatSrc, read through the Swizzles, in the component order of FormatDst.
+	// Each RGBA channel keeps its meaning: FormatDst component k receives the source component selected by Swizzles for the channel stored in k.
+	inline swizzle_shuffle make_swizzle_shuffle(format FormatSrc, swizzles const& Swizzles, format FormatDst)
+	{
+		size_t const ComponentSize = component_size(FormatSrc);
+		GLI_ASSERT(ComponentSize > 0 && ComponentSize == component_size(FormatDst));
+
+		swizzle_shuffle Shuffle;
+		Shuffle.SrcTexelSize = block_size(FormatSrc);
+		Shuffle.DstTexelSize = block_size(FormatDst);
+		GLI_ASSERT(Shuffle.SrcTexelSize <= 16 && Shuffle.DstTexelSize <= 16);
+
+		glm::uint8 One[8];
+		component_one(FormatDst, ComponentSize, One);
+
+		swizzles const& FormatSwizzles = get_format_info(FormatDst).Swizzles;
+		for(size_t ComponentDst = 0, ComponentCount = Shuffle.DstTexelSize / ComponentSize; ComponentDst < ComponentCount; ++ComponentDst)
+		{
+			// Find the channel that FormatDst reads from this component, unused components are set to one
+			swizzle Source = SWIZZLE_ONE;
+			for(length_t Channel = 0; Channel < 4; ++Channel)
+			{
+				if(FormatSwizzles[Channel] != static_cast<swizzle>(ComponentDst))
+					continue;
+				Source = Swizzles[Channel];
+				break;
+			}
+
+			for(size_t Byte = 0; Byte < ComponentSize; ++Byte)
+			{
+				size_t const IndexDst = ComponentDst * ComponentSize + Byte;
+				if(is_channel(Source))
+				{
+					Shuffle.Index[IndexDst] = static_cast<glm::uint8>(Source * ComponentSize + Byte);
+					Shuffle.Constant[IndexDst] = 0;
+				}
+				else
+				{
+					Shuffle.Index[IndexDst] = swizzle_shuffle::CONSTANT;
+					Shuffle.Constant[IndexDst] = Source == SWIZZLE_ONE ? One[Byte] : 0;
+				}
+			}
+		}
+
+		return Shuffle;
+	}
+
+	// Build the shuffle permuting in place the components of texels of ComponentCount components of ComponentSize bytes
+	inline swizzle_shuffle make_swizzle_shuffle(size_t ComponentSize, size_t ComponentCount, swizzles const& Swizzles)
+	{
+		GLI_ASSERT(ComponentSize * ComponentCount <= 16);
+
+		swizzle_shuffle Shuffle;
+		Shuffle.SrcTexelSize = ComponentSize * ComponentCount;
+		Shuffle.DstTexelSize = ComponentSize * ComponentCount;
+
+		for(size_t Component = 0; Component < ComponentCount; ++Component)
+		{
+			GLI_ASSERT(is_channel(Swizzles[static_cast<length_t>(Component)]) && static_cast<size_t>(Swizzles[static_cast<length_t>(Component)]) < ComponentCount);
+
+			for(size_t Byte = 0; Byte < ComponentSize; ++Byte)
+			{
+				Shuffle.Index[Component * ComponentSize + Byte] = static_cast<glm::uint8>(Swizzles[static_cast<length_t>(Component)] * ComponentSize + Byte);
+				Shuffle.Constant[Component * ComponentSize + Byte] = 0;
+			}
+		}
+
+		return Shuffle;
+	}
+
+	inline void swizzle_texels_scalar(glm::uint8* Dst, glm::uint8 const* Src, size_t TexelCount, swizzle_shuffle const& Shuffle)
+	{
+		glm::uint8 Texel[16];
+		for(size_t TexelIndex = 0; TexelIndex < TexelCount; ++TexelIndex, Src += Shuffle.SrcTexelSize, Dst += Shuffle.DstTexelSize)
+		{
+			// Copy the source texel first so that Dst may alias Src
+			std::memcpy(Texel, Src, Shuffle.SrcTexelSize);
+			for(size_t Byte = 0; Byte < Shuffle.DstTexelSize; ++Byte)
+				Dst[Byte] = Shuffle.Index[Byte] == swizzle_shuffle::CONSTANT ? Shuffle.Constant[Byte] : Texel[Shuffle.Index[Byte]];
+		}
+	}
+
+	// Apply Shuffle to TexelCount texels. Dst may be equal to Src when the source and destination texel sizes are the same.
+	inline void swizzle_texels(glm::uint8* Dst, glm::uint8 const* Src, size_t TexelCount, swizzle_shuffle const& Shuffle)
+	{
+		GLI_ASSERT(Dst != Src || Shuffle.SrcTexelSize == Shuffle.DstTexelSize);
+
+#		if defined(GLI_SIMD_SSSE3)
+			// Shuffle as many whole texels as fit in 16 bytes of both the source and the destination with a single pshufb
+			size_t const TexelsPerVector = glm::min(16 / Shuffle.SrcTexelSize, 16 / Shuffle.DstTexelSize);
+			size_t const SrcStep = TexelsPerVector * Shuffle.SrcTexelSize;
+			size_t const DstStep = TexelsPerVector * Shuffle.DstTexelSize;
+
+			if(TexelCount * Shuffle.SrcTexelSize >= 16 && TexelCount * Shuffle.DstTexelSize >= 16)
+			{
+				// The lanes past the last whole texel rewrite the bytes they loaded, which keeps in place shuffles exact
+				glm::uint8 Mask[16];
+				glm::uint8 Constant[16];
+				for(size_t Byte = 0; Byte < 16; ++Byte)
+				{
+					size_t const Texel = Byte / Shuffle.DstTexelSize;
+					size_t const TexelByte = Byte % Shuffle.DstTexelSize;
+					bool const Whole = Texel < TexelsPerVector;
+					bool const IsConstant = Whole && Shuffle.Index[TexelByte] == swizzle_shuffle::CONSTANT;
+					Mask[Byte] = !Whole ? static_cast<glm::uint8>(Byte) : IsConstant ? static_cast<glm::uint8>(0x80) : static_cast<glm::uint8>(Texel * Shuffle.SrcTexelSize + Shuffle.Index[TexelByte]);
+					Constant[Byte] = IsConstant ? Shuffle.Constant[TexelByte] : 0;
+				}
+
+				__m128i const MaskVector = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Mask));
+				__m128i const ConstantVector = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Constant));
+
+				// Each iteration loads and stores 16 bytes, stop while both remain in bounds
+				size_t const SrcEnd = TexelCount * Shuffle.SrcTexelSize;
+				size_t const DstEnd = TexelCount * Shuffle.DstTexelSize;
+				size_t SrcOffset = 0, DstOffset = 0;
+				for(; SrcOffset + 16 <= SrcEnd && DstOffset + 16 <= DstEnd; SrcOffset += SrcStep, DstOffset += DstStep, TexelCount -= TexelsPerVector)
+				{
+					__m128i const Texels = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Src + SrcOffset));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(Dst + DstOffset), _mm_or_si128(_mm_shuffle_epi8(Texels, MaskVector), ConstantVector));
+				}
+
+				Src += SrcOffset;
+				Dst += DstOffset;
+			}
+#		endif//defined(GLI_SIMD_SSSE3)
+
+		swizzle_texels_scalar(Dst, Src, TexelCount, Shuffle);
+	}
+}//namespace detail
+}//namespace gli
@@ -1,3 +1,6 @@
+#include "./swizzle.hpp"
+#include "./parallel.hpp"
+#include "./fill.hpp"
 #include <cstring>
 
 namespace gli
@@ -36,6 +39,31 @@ namespace gli
 		GLI_ASSERT(Target != TARGET_CUBE_ARRAY || (Target == TARGET_CUBE_ARRAY && Extent.x == Extent.y));
 	}
 
+	inline texture::texture
+	(
+		target_type Target,
+		format_type Format,
+		extent_type const& Extent,
+		size_type Layers,
+		size_type Faces,
+		size_type Levels,
+		void* Data,
+		std::shared_ptr<void> const& Owner,
+		swizzles_type const& Swizzles
+	)
+		: Storage(std::make_shared<storage_type>(Format, Extent, Layers, Faces, Levels, static_cast<storage_type::data_type*>(Data), Owner))
+		, Target(Target)
+		, Format(Format)
+		, BaseLayer(0), MaxLayer(Layers - 1)
+		, BaseFace(0), MaxFace(Faces - 1)
+		, BaseLevel(0), MaxLevel(Levels - 1)
+		, Swizzles(Swizzles)
+		, Cache(*Storage, Format, this->base_layer(), this->layers(), this->base_face(), this->max_face(), this->base_level(), this->max_level())
+	{
+		GLI_ASSERT(Target != TARGET_CUBE || (Target == TARGET_CUBE && Extent.x == Extent.y));
+		GLI_ASSERT(Target != TARGET_CUBE_ARRAY || (Target == TARGET_CUBE_ARRAY && Extent.x == Extent.y));
+	}
+
 	inline texture::texture
 	(
 		texture const& Texture,
@@ -286,11 +314,7 @@ namespace gli
 		GLI_ASSERT(!this->empty());
 		GLI_ASSERT(block_size(this->format()) == sizeof(gen_type));
 
-		gen_type* Data = this->data<gen_type>();
-		size_type const BlockCount = this->size<gen_type>();
-
-		for(size_type BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
-			*(Data + BlockIndex) = Texel;
+		detail::fill_parallel(this->data<glm::uint8>(), this->size(), reinterpret_cast<glm::uint8 const*>(&Texel), sizeof(gen_type));
 	}
 
 	template <typename gen_type>
@@ -301,10 +325,7 @@ namespace gli
 		GLI_ASSERT(block_size(this->format()) == sizeof(gen_type));
 		GLI_ASSERT(Layer >= 0 && Layer < this->layers() && Face >= 0 && Face < this->faces() && Level >= 0 && Level < this->levels());
 
-		size_type const BlockCount = this->Storage->level_size(Level) / sizeof(gen_type);
-		gen_type* Data = this->data<gen_type>(Layer, Face, Level);
-		for(size_type BlockIndex = 0; BlockIndex < BlockCount; ++BlockIndex)
-			*(Data + BlockIndex) = BlockData;
+		detail::fill_parallel(this->data<glm::uint8>(Layer, Face, Level), this->size(Level), reinterpret_cast<glm::uint8 const*>(&BlockData), sizeof(gen_type));
 	}
 
 	template <typename gen_type>
@@ -315,19 +336,34 @@ namespace gli
 		gen_type const& BlockData
 	)
 	{
-		storage_type::size_type const BaseOffset = this->Storage->base_offset(Layer, Face, Level);
-		storage_type::data_type* const BaseAddress = this->Storage->data() + BaseOffset;
+		GLI_ASSERT(!this->empty());
+		GLI_ASSERT(block_size(this->format()) == sizeof(gen_type));
+
+		// Partially covered blocks of compressed formats are cleared entirely
+		extent_type const LevelBlockCount(this->Storage->block_count(this->base_level() + Level));
+		extent_type const BlockExtent(this->Storage->block_extent());
+		extent_type const BlockOffset(TexelOffset / BlockExtent);
+		extent_type const BlockCount(glm::min(glm::ceilMultiple(TexelOffset + TexelExtent, BlockExtent) / BlockExtent, LevelBlockCount) - BlockOffset);
+		GLI_ASSERT(glm::all(glm::lessThanEqual(BlockOffset + BlockCount, LevelBlockCount)));
 
-		extent_type BlockOffset(TexelOffset / this->Storage->block_extent());
-		extent_type const BlockExtent(TexelExtent / this->Storage->block_extent() + BlockOffset);
-		for(; BlockOffset.z < BlockExtent.z; ++BlockOffset.z)
-		for(; BlockOffset.y < BlockExtent.y; ++BlockOffset.y)
-		for(; BlockOffset.x < BlockExtent.x; ++BlockOffset.x)
+		if(!glm::all(glm::greaterThan(BlockCount, extent_type(0))))
+			return;
+
+		glm::uint8* const BaseAddress = this->data<glm::uint8>(Layer, Face, Level);
+		size_t const RowSize = static_cast<size_t>(BlockCount.x) * sizeof(gen_type);
+		size_t const RowCount = static_cast<size_t>(BlockCount.y) * static_cast<size_t>(BlockCount.z);
+		bool const Stream = RowSize * RowCount >= static_cast<size_t>(GLI_STREAM_THRESHOLD);
+
+		// Each row of blocks is contiguous, the rows of all the slices are split across threads
+		detail::parallel_for(0, RowCount, glm::max<size_t>((1 << 16) / RowSize, 1), [&](size_t RangeBegin, size_t RangeEnd)
 		{
-			gli::size_t const Offset = this->Storage->image_offset(BlockOffset, this->extent(Level)) * this->Storage->block_size();
-			gen_type* const BlockAddress = reinterpret_cast<gen_type* const>(BaseAddress + Offset);
-			*BlockAddress = BlockData;
-		}
+			for(size_t RowIndex = RangeBegin; RowIndex < RangeEnd; ++RowIndex)
+			{
+				extent_type const RowOffset(BlockOffset.x, BlockOffset.y + static_cast<int>(RowIndex % BlockCount.y), BlockOffset.z + static_cast<int>(RowIndex / BlockCount.y));
+				size_t const Offset = this->Storage->image_offset(RowOffset, LevelBlockCount) * sizeof(gen_type);
+				detail::fill(BaseAddress + Offset, RowSize, reinterpret_cast<glm::uint8 const*>(&BlockData), sizeof(gen_type), Stream);
+			}
+		});
 	}
 
 	inline void texture::copy
@@ -345,9 +381,9 @@ namespace gli
 		GLI_ASSERT(LevelSrc < TextureSrc.levels());
 		GLI_ASSERT(LevelDst < this->levels());
 
-		memcpy(
-			this->data(LayerDst, FaceDst, LevelDst),
-			TextureSrc.data(LayerSrc, FaceSrc, LevelSrc),
+		detail::copy_memory_parallel(
+			static_cast<glm::uint8*>(this->data(LayerDst, FaceDst, LevelDst)),
+			static_cast<glm::uint8 const*>(TextureSrc.data(LayerSrc, FaceSrc, LevelSrc)),
 			this->size(LevelDst));
 	}
 
@@ -359,27 +395,53 @@ namespace gli
 		texture::extent_type const& Extent
 	)
 	{
+		GLI_ASSERT(block_size(TextureSrc.format()) == block_size(this->format()));
+		GLI_ASSERT(LayerSrc < TextureSrc.layers() && FaceSrc < TextureSrc.faces() && LevelSrc < TextureSrc.levels());
+		GLI_ASSERT(LayerDst < this->layers() && FaceDst < this->faces() && LevelDst < this->levels());
+
+		// Offsets are aligned on blocks, an extent ending inside a block covers the whole block which lets a copy reach the partial blocks at the edge of an image
 		storage_type::extent_type const BlockExtent = this->Storage->block_extent();
+		GLI_ASSERT(glm::all(glm::equal(OffsetSrc % BlockExtent, extent_type(0))) && glm::all(glm::equal(OffsetDst % BlockExtent, extent_type(0))));
+
 		this->Storage->copy(
 			*TextureSrc.Storage,
-			LayerSrc, FaceSrc, LevelSrc, OffsetSrc / BlockExtent,
-			LayerDst, FaceDst, LevelDst, OffsetDst / BlockExtent,
-			Extent / BlockExtent);
+			TextureSrc.base_layer() + LayerSrc, TextureSrc.base_face() + FaceSrc, TextureSrc.base_level() + LevelSrc, OffsetSrc / BlockExtent,
+			this->base_layer() + LayerDst, this->base_face() + FaceDst, this->base_level() + LevelDst, OffsetDst / BlockExtent,
+			glm::ceilMultiple(Extent, BlockExtent) / BlockExtent);
 	}
 
 	template <typename gen_type>
 	inline void texture::swizzle(gli::swizzles const& Swizzles)
 	{
-		for(size_type TexelIndex = 0, TexelCount = this->size<gen_type>(); TexelIndex < TexelCount; ++TexelIndex)
+		GLI_ASSERT(!this->empty());
+
+		// Texels larger than a shuffle, such as dvec4, are permuted component by component
+		if(sizeof(gen_type) > 16)
 		{
-			gen_type& TexelDst = *(this->data<gen_type>() + TexelIndex);
-			gen_type const TexelSrc = TexelDst;
-			for(typename gen_type::length_type Component = 0; Component < TexelDst.length(); ++Component)
+			for(size_type TexelIndex = 0, TexelCount = this->size<gen_type>(); TexelIndex < TexelCount; ++TexelIndex)
 			{
-				GLI_ASSERT(static_cast<typename gen_type::length_type>(Swizzles[Component]) < TexelDst.length());
-				TexelDst[Component] = TexelSrc[Swizzles[Component]];
+				gen_type& TexelDst = *(this->data<gen_type>() + TexelIndex);
+				gen_type const TexelSrc = TexelDst;
+				for(typename gen_type::length_type Component = 0; Component < TexelDst.length(); ++Component)
+				{
+					GLI_ASSERT(static_cast<typename gen_type::length_type>(Swizzles[Component]) < TexelDst.length());
+					TexelDst[Component] = TexelSrc[Swizzles[Component]];
+				}
 			}
+			return;
 		}
+
+		detail::swizzle_shuffle const Shuffle = detail::make_swizzle_shuffle(
+			sizeof(typename gen_type::value_type), static_cast<size_t>(gen_type::length()), Swizzles);
+
+		glm::uint8* const Data = this->data<glm::uint8>();
+		size_type const TexelCount = this->size<gen_type>();
+
+		detail::parallel_for(0, TexelCount, (size_t(1) << 16) / sizeof(gen_type), [&](size_t TexelBegin, size_t TexelEnd)
+		{
+			glm::uint8* const Texels = Data + TexelBegin * sizeof(gen_type);
+			detail::swizzle_texels(Texels, Texels, TexelEnd - TexelBegin, Shuffle);
+		});
 	}
 
 	template <typename gen_type>
@@ -409,4 +471,3 @@ namespace gli
 		*(this->data<gen_type>(Layer, Face, Level) + ImageOffset) = Texel;
 	}
 }//namespace gli
-
@@ -0,0 +1,170 @@
+namespace gli{
+namespace detail
+{
+	inline vk::swizzles translate_vk(gli::swizzles const& Swizzles)
+	{
+		static vk::swizzle const Table[] =
+		{
+			vk::SWIZZLE_RED,
+			vk::SWIZZLE_GREEN,
+			vk::SWIZZLE_BLUE,
+			vk::SWIZZLE_ALPHA,
+			vk::SWIZZLE_ZERO,
+			vk::SWIZZLE_ONE
+		};
+		static_assert(sizeof(Table) / sizeof(Table[0]) == SWIZZLE_COUNT, "GLI error: swizzle descriptor list doesn't match number of supported swizzles");
+
+		return vk::swizzles(Table[Swizzles.r], Table[Swizzles.g], Table[Swizzles.b], Table[Swizzles.a]);
+	}
+
+	// Swizzles relative to the components of a VkFormat storing them in the order of Format, such as VK_FORMAT_B8G8R8A8_UNORM for FORMAT_BGRA8_UNORM_PACK8.
+	// The VkFormat already reorders the components, so the order of the format composed in texture::swizzles is removed and only the custom swizzles remain.
+	inline gli::swizzles remove_format_swizzles(gli::format Format, gli::swizzles const& Swizzles)
+	{
+		gli::swizzles const& FormatSwizzles = get_format_info(Format).Swizzles;
+
+		gli::swizzles Result(Swizzles);
+		for(glm::length_t Component = 0; Component < 4; ++Component)
+		{
+			if(!is_channel(Swizzles[Component]))
+				continue;
+
+			for(glm::length_t Channel = 0; Channel < 4; ++Channel)
+			{
+				if(FormatSwizzles[Channel] != Swizzles[Component])
+					continue;
+				Result[Component] = static_cast<gli::swizzle>(SWIZZLE_RED + Channel);
+				break;
+			}
+		}
+		return Result;
+	}
+}//namespace detail
+
+	inline vk::target const& vk::translate(gli::target Target) const
+	{
+		static vk::target const Table[] =
+		{
+			{vk::IMAGE_TYPE_1D, vk::IMAGE_VIEW_TYPE_1D, vk::IMAGE_CREATE_NONE},							//TARGET_1D
+			{vk::IMAGE_TYPE_1D, vk::IMAGE_VIEW_TYPE_1D_ARRAY, vk::IMAGE_CREATE_NONE},					//TARGET_1D_ARRAY
+			{vk::IMAGE_TYPE_2D, vk::IMAGE_VIEW_TYPE_2D, vk::IMAGE_CREATE_NONE},							//TARGET_2D
+			{vk::IMAGE_TYPE_2D, vk::IMAGE_VIEW_TYPE_2D_ARRAY, vk::IMAGE_CREATE_NONE},					//TARGET_2D_ARRAY
+			{vk::IMAGE_TYPE_3D, vk::IMAGE_VIEW_TYPE_3D, vk::IMAGE_CREATE_NONE},							//TARGET_3D
+			{vk::IMAGE_TYPE_2D, vk::IMAGE_VIEW_TYPE_2D, vk::IMAGE_CREATE_NONE},							//TARGET_RECT
+			{vk::IMAGE_TYPE_2D, vk::IMAGE_VIEW_TYPE_2D_ARRAY, vk::IMAGE_CREATE_NONE},					//TARGET_RECT_ARRAY
+			{vk::IMAGE_TYPE_2D, vk::IMAGE_VIEW_TYPE_CUBE, vk::IMAGE_CREATE_CUBE_COMPATIBLE_BIT},		//TARGET_CUBE
+			{vk::IMAGE_TYPE_2D, vk::IMAGE_VIEW_TYPE_CUBE_ARRAY, vk::IMAGE_CREATE_CUBE_COMPATIBLE_BIT}	//TARGET_CUBE_ARRAY
+		};
+		static_assert(sizeof(Table) / sizeof(Table[0]) == TARGET_COUNT, "GLI error: target descriptor list doesn't match number of supported targets");
+
+		return Table[Target];
+	}
+
+	inline vk::format vk::translate(gli::format Format, gli::swizzles const& Swizzles) const
+	{
+		GLI_ASSERT(Format >= FORMAT_FIRST && Format <= FORMAT_LAST);
+
+		vk::format FormatVK;
+		FormatVK.Swizzles = detail::translate_vk(detail::remove_format_swizzles(Format, Swizzles));
+
+		if(Format <= FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16)
+		{
+			FormatVK.Format = static_cast<image_format>(Format);
+			return FormatVK;
+		}
+
+		switch(Format)
+		{
+		case FORMAT_RGB_PVRTC1_8X8_UNORM_BLOCK32:
+		case FORMAT_RGBA_PVRTC1_8X8_UNORM_BLOCK32:
+			FormatVK.Format = vk::FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG;
+			break;
+		case FORMAT_RGB_PVRTC1_8X8_SRGB_BLOCK32:
+		case FORMAT_RGBA_PVRTC1_8X8_SRGB_BLOCK32:
+			FormatVK.Format = vk::FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG;
+			break;
+		case FORMAT_RGB_PVRTC1_16X8_UNORM_BLOCK32:
+		case FORMAT_RGBA_PVRTC1_16X8_UNORM_BLOCK32:
+			FormatVK.Format = vk::FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG;
+			break;
+		case FORMAT_RGB_PVRTC1_16X8_SRGB_BLOCK32:
+		case FORMAT_RGBA_PVRTC1_16X8_SRGB_BLOCK32:
+			FormatVK.Format = vk::FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG;
+			break;
+		case FORMAT_RGBA_PVRTC2_4X4_UNORM_BLOCK8:
+			FormatVK.Format = vk::FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG;
+			break;
+		case FORMAT_RGBA_PVRTC2_4X4_SRGB_BLOCK8:
+			FormatVK.Format = vk::FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG;
+			break;
+		case FORMAT_RGBA_PVRTC2_8X4_UNORM_BLOCK8:
+			FormatVK.Format = vk::FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG;
+			break;
+		case FORMAT_RGBA_PVRTC2_8X4_SRGB_BLOCK8:
+			FormatVK.Format = vk::FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG;
+			break;
+		// ETC2 decoders read ETC1 blocks
+		case FORMAT_RGB_ETC_UNORM_BLOCK8:
+			FormatVK.Format = vk::FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+			break;
+		// The swizzles of the luminance and alpha formats select the red and green components
+		case FORMAT_L8_UNORM_PACK8:
+		case FORMAT_A8_UNORM_PACK8:
+			FormatVK.Format = vk::FORMAT_R8_UNORM;
+			FormatVK.Swizzles = detail::translate_vk(Swizzles);
+			break;
+		case FORMAT_LA8_UNORM_PACK8:
+			FormatVK.Format = vk::FORMAT_R8G8_UNORM;
+			FormatVK.Swizzles = detail::translate_vk(Swizzles);
+			break;
+		case FORMAT_L16_UNORM_PACK16:
+		case FORMAT_A16_UNORM_PACK16:
+			FormatVK.Format = vk::FORMAT_R16_UNORM;
+			FormatVK.Swizzles = detail::translate_vk(Swizzles);
+			break;
+		case FORMAT_LA16_UNORM_PACK16:
+			FormatVK.Format = vk::FORMAT_R16G16_UNORM;
+			FormatVK.Swizzles = detail::translate_vk(Swizzles);
+			break;
+		case FORMAT_BGR8_UNORM_PACK32:
+			FormatVK.Format = vk::FORMAT_B8G8R8A8_UNORM;
+			break;
+		case FORMAT_BGR8_SRGB_PACK32:
+			FormatVK.Format = vk::FORMAT_B8G8R8A8_SRGB;
+			break;
+		default:
+			FormatVK.Format = vk::FORMAT_UNDEFINED;
+			break;
+		}
+
+		return FormatVK;
+	}
+
+	inline gli::format vk::find(image_format Format) const
+	{
+		if(Format >= vk::FORMAT_UNDEFINED && Format <= vk::FORMAT_ASTC_12x12_SRGB_BLOCK)
+			return static_cast<gli::format>(Format);
+
+		switch(Format)
+		{
+		case vk::FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG:
+			return FORMAT_RGBA_PVRTC1_16X8_UNORM_BLOCK32;
+		case vk::FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG:
+			return FORMAT_RGBA_PVRTC1_8X8_UNORM_BLOCK32;
+		case vk::FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG:
+			return FORMAT_RGBA_PVRTC2_8X4_UNORM_BLOCK8;
+		case vk::FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG:
+			return FORMAT_RGBA_PVRTC2_4X4_UNORM_BLOCK8;
+		case vk::FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG:
+			return FORMAT_RGBA_PVRTC1_16X8_SRGB_BLOCK32;
+		case vk::FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG:
+			return FORMAT_RGBA_PVRTC1_8X8_SRGB_BLOCK32;
+		case vk::FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG:
+			return FORMAT_RGBA_PVRTC2_8X4_SRGB_BLOCK8;
+		case vk::FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG:
+			return FORMAT_RGBA_PVRTC2_4X4_SRGB_BLOCK8;
+		default:
+			return gli::FORMAT_UNDEFINED;
+		}
+	}
+}//namespace gli
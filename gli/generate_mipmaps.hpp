@@ -11,6 +11,7 @@
 #include "texture_cube.hpp"
 #include "texture_cube_array.hpp"
 #include "sampler.hpp"
+#include "convert.hpp"
 
 namespace gli
 {
@@ -18,6 +19,15 @@ namespace gli
 	template <typename texture_type>
 	texture_type generate_mipmaps(texture_type const& Texture, filter Minification);
 
+	/// Allocate a texture of a compressed format and generate all the mipmaps of the texture using the Minification filter.
+	/// Each level is encoded as soon as it's generated, while it's still in the caches, instead of encoding the whole mipmap chain afterward.
+	///
+	/// @param Texture Source texture, the format must be uncompressed.
+	/// @param Format Destination texture format, it must have an encoder.
+	/// @param Preset Search effort of the encoder.
+	template <typename texture_type>
+	texture_type generate_mipmaps(texture_type const& Texture, filter Minification, format Format, encode_preset Preset = ENCODE_PRESET_DEFAULT);
+
 	/// Allocate a texture and generate the mipmaps of the texture from the BaseLevel to the MaxLevel included using the Minification filter.
 	texture1d generate_mipmaps(
 		texture1d const& Texture,
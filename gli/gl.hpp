@@ -148,8 +148,8 @@ namespace gli
 			INTERNAL_RGB_PVRTC_2BPPV1 = 0x8C01,				//GL_COMPRESSED_RGB_PVRTC_2BPPV1_IMG
 			INTERNAL_RGBA_PVRTC_4BPPV1 = 0x8C02,			//GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG
 			INTERNAL_RGBA_PVRTC_2BPPV1 = 0x8C03,			//GL_COMPRESSED_RGBA_PVRTC_2BPPV1_IMG
-			INTERNAL_RGBA_PVRTC_4BPPV2 = 0x9137,			//GL_COMPRESSED_RGBA_PVRTC_4BPPV2_IMG
-			INTERNAL_RGBA_PVRTC_2BPPV2 = 0x9138,			//GL_COMPRESSED_RGBA_PVRTC_2BPPV2_IMG
+			INTERNAL_RGBA_PVRTC_4BPPV2 = 0x9138,			//GL_COMPRESSED_RGBA_PVRTC_4BPPV2_IMG
+			INTERNAL_RGBA_PVRTC_2BPPV2 = 0x9137,			//GL_COMPRESSED_RGBA_PVRTC_2BPPV2_IMG
 			INTERNAL_ATC_RGB = 0x8C92,						//GL_ATC_RGB_AMD
 			INTERNAL_ATC_RGBA_EXPLICIT_ALPHA = 0x8C93,		//GL_ATC_RGBA_EXPLICIT_ALPHA_AMD
 			INTERNAL_ATC_RGBA_INTERPOLATED_ALPHA = 0x87EE,	//GL_ATC_RGBA_INTERPOLATED_ALPHA_AMD
@@ -62,14 +62,21 @@ namespace gli
 #include "convert.hpp"
 #include "view.hpp"
 #include "comparison.hpp"
+#include "hash.hpp"
 
 #include "reduce.hpp"
 #include "transform.hpp"
 
 #include "load.hpp"
+#include "load_async.hpp"
+#include "load_batch.hpp"
+#include "load_into.hpp"
+#include "pack.hpp"
 #include "save.hpp"
 
 #include "gl.hpp"
 #include "dx.hpp"
+#include "vk.hpp"
+#include "staging.hpp"
 
 #include "./core/flip.hpp"
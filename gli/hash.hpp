@@ -0,0 +1,61 @@
+/// @brief Include to compute content hashes of textures and images, for example to bucket duplicated textures.
+/// @file gli/hash.hpp
+
+#pragma once
+
+#include "image.hpp"
+#include "texture.hpp"
+
+namespace gli{
+namespace detail
+{
+	/// Streaming 64 bits hash following the xxHash64 algorithm.
+	/// The input is consumed by stripes of 32 bytes updating four independent lanes.
+	class hasher
+	{
+	public:
+		explicit hasher(glm::uint64 Seed = 0);
+
+		/// Append Size bytes pointed by Data to the hashed stream
+		void update(void const* Data, size_t Size);
+
+		/// Return the hash of all the bytes appended so far
+		glm::uint64 digest() const;
+
+	private:
+		glm::uint64 Seed;
+		glm::uint64 Lanes[4];
+		glm::uint64 TotalSize;
+		glm::uint8 Buffer[32];
+		size_t BufferSize;
+	};
+
+	/// Compute the 64 bits hash of Size bytes pointed by Data
+	glm::uint64 hash_data(void const* Data, size_t Size, glm::uint64 Seed = 0);
+
+	/// Compute the 128 bits hash of Size bytes pointed by Data, made of two 64 bits hashes of different seeds computed in a single pass
+	glm::u64vec2 hash_data128(void const* Data, size_t Size);
+}//namespace detail
+
+	/// Compute a 64 bits hash of the content of an image.
+	glm::uint64 hash(image const& Image);
+
+	/// Compute a 64 bits hash of the content of a specific image of a texture.
+	glm::uint64 hash(texture const& Texture, size_t Layer, size_t Face, size_t Level);
+
+	/// Compute a 64 bits hash of a texture, including its target, format, dimensions and the content of each image.
+	/// Textures that are equal according to gli::equal have the same hash.
+	glm::uint64 hash(texture const& Texture);
+
+	/// Compute a 128 bits hash of the content of an image, for sets of images too large to bucket with 64 bits hashes.
+	glm::u64vec2 hash128(image const& Image);
+
+	/// Compute a 128 bits hash of the content of a specific image of a texture.
+	glm::u64vec2 hash128(texture const& Texture, size_t Layer, size_t Face, size_t Level);
+
+	/// Compute a 128 bits hash of a texture, including its target, format, dimensions and the content of each image.
+	/// Textures that are equal according to gli::equal have the same hash.
+	glm::u64vec2 hash128(texture const& Texture);
+}//namespace gli
+
+#include "./core/hash.inl"
@@ -7,6 +7,78 @@
 
 namespace gli
 {
+	/// Container of a texture, recognized from its first bytes
+	enum container
+	{
+		CONTAINER_UNKNOWN = 0,
+		CONTAINER_DDS,
+		CONTAINER_KTX10,
+		CONTAINER_KTX20,
+		CONTAINER_KMG100,
+		CONTAINER_KMG200
+	};
+
+	/// Reason of the failure of a load
+	enum load_error
+	{
+		LOAD_SUCCESS = 0,
+		LOAD_TRUNCATED,				// The container ends before the end of its header or of its images
+		LOAD_BAD_HEADER,			// The header isn't a valid description of a texture
+		LOAD_UNSUPPORTED_FORMAT,	// The format or the supercompression isn't supported
+		LOAD_UNKNOWN_CONTAINER,		// The data doesn't start with the magic bytes of a DDS, KTX or KMG container
+		LOAD_CORRUPTED_DATA,		// The images fail their checksums or their decompression
+		LOAD_FILE_ERROR				// The file can't be opened or read
+	};
+
+	/// Outcome of try_load: the error, the texture described by the header of the container and the loaded texture.
+	/// The description is set as soon as the header is valid, including when the images are truncated or corrupted, Format is FORMAT_UNDEFINED otherwise.
+	struct load_result
+	{
+		load_result()
+			: Error(LOAD_SUCCESS)
+			, Container(CONTAINER_UNKNOWN)
+			, Target(TARGET_2D)
+			, Format(FORMAT_UNDEFINED)
+			, Extent(0)
+			, Layers(0)
+			, Faces(0)
+			, Levels(0)
+			, Swizzles(SWIZZLE_RED, SWIZZLE_GREEN, SWIZZLE_BLUE, SWIZZLE_ALPHA)
+		{}
+
+		load_error Error;
+		container Container;
+		target Target;
+		format Format;
+		extent3d Extent;
+		size_t Layers;
+		size_t Faces;
+		size_t Levels;
+		swizzles Swizzles;
+
+		/// Loaded texture, empty unless Error is LOAD_SUCCESS
+		texture Texture;
+	};
+
+	/// Loads a DDS, KTX or KMG texture from memory, dispatching once on the magic bytes of the container.
+	/// Returns the reason of the failure and the description read from the header instead of only an empty texture.
+	///
+	/// @param Data Data of a texture
+	/// @param Size Size of the data
+	load_result try_load(char const* Data, std::size_t Size);
+
+	/// Loads a DDS, KTX or KMG texture from file, dispatching once on the magic bytes of the container.
+	/// Returns the reason of the failure and the description read from the header instead of only an empty texture.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	load_result try_load(char const* Path);
+
+	/// Loads a DDS, KTX or KMG texture from file, dispatching once on the magic bytes of the container.
+	/// Returns the reason of the failure and the description read from the header instead of only an empty texture.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	load_result try_load(std::string const& Path);
+
 	/// Loads a texture storage_linear from file. Returns an empty storage_linear in case of failure.
 	///
 	/// @param Path Path of the file to open including filaname and filename extension
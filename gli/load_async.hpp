@@ -0,0 +1,46 @@
+/// @brief Include to load DDS, KTX or KMG textures from files on a pool of I/O threads.
+/// @file gli/load_async.hpp
+
+#pragma once
+
+#include "texture.hpp"
+#include <functional>
+#include <future>
+#include <string>
+
+namespace gli
+{
+	/// Loads a texture storage_linear from file on one of the I/O threads. The future holds an empty storage_linear in case of failure.
+	/// Reads, header parsing and payload copies of several files run concurrently, GLI_IO_THREAD_COUNT sets the number of I/O threads.
+	/// The future rethrows the exceptions thrown by the load, such as std::bad_alloc.
+	/// At most GLI_IO_QUEUE_SIZE loads wait for a thread, further calls wait for one of them to start.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	std::future<texture> load_async(char const* Path);
+
+	/// Loads a texture storage_linear from file on one of the I/O threads. The future holds an empty storage_linear in case of failure.
+	/// Reads, header parsing and payload copies of several files run concurrently, GLI_IO_THREAD_COUNT sets the number of I/O threads.
+	/// The future rethrows the exceptions thrown by the load, such as std::bad_alloc.
+	/// At most GLI_IO_QUEUE_SIZE loads wait for a thread, further calls wait for one of them to start.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	std::future<texture> load_async(std::string const& Path);
+
+	/// Loads a texture storage_linear from file on one of the I/O threads and calls Callback on that thread once it is loaded.
+	/// Callback receives an empty storage_linear in case of failure, including loads failing with an exception.
+	/// Exceptions thrown by Callback are discarded. At most GLI_IO_QUEUE_SIZE loads wait for a thread, further calls wait for one of them to start.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	/// @param Callback Function called with the loaded texture, it must be thread safe
+	void load_async(char const* Path, std::function<void(texture const&)> const& Callback);
+
+	/// Loads a texture storage_linear from file on one of the I/O threads and calls Callback on that thread once it is loaded.
+	/// Callback receives an empty storage_linear in case of failure, including loads failing with an exception.
+	/// Exceptions thrown by Callback are discarded. At most GLI_IO_QUEUE_SIZE loads wait for a thread, further calls wait for one of them to start.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	/// @param Callback Function called with the loaded texture, it must be thread safe
+	void load_async(std::string const& Path, std::function<void(texture const&)> const& Callback);
+}//namespace gli
+
+#include "./core/load_async.inl"
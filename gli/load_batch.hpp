@@ -0,0 +1,41 @@
+/// @brief Include to load many DDS, KTX or KMG textures from files in parallel within a memory budget.
+/// @file gli/load_batch.hpp
+
+#pragma once
+
+#include "texture.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace gli
+{
+	/// File to load by load_batch, the requests with the highest priority are delivered first
+	struct load_request
+	{
+		load_request(std::string const& Path, int Priority = 0)
+			: Path(Path)
+			, Priority(Priority)
+		{}
+
+		std::string Path;
+		int Priority;
+	};
+
+	/// Loads the files of Requests in parallel on the I/O threads and calls Callback on the calling thread for each of them,
+	/// by decreasing priority then in the order of Requests. Returns once every texture has been delivered.
+	///
+	/// The headers of all the files are probed first to estimate the memory used by each load.
+	/// Loads are started by priority as long as the files being read and the textures not yet delivered fit in Budget bytes.
+	/// A load that doesn't fit in the budget on its own starts when no other memory is held.
+	/// Called from an I/O thread, for example by a load_async callback, the files are loaded one at a time on the calling thread.
+	///
+	/// If Callback throws, load_batch waits for the loads already started then rethrows the exception, the remaining requests are not delivered.
+	///
+	/// @param Requests Paths and priorities of the files to load
+	/// @param Budget Maximum number of bytes held by the loader at once
+	/// @param Callback Function called with the index of the request and its texture, empty in case of failure
+	void load_batch(std::vector<load_request> const& Requests, std::size_t Budget, std::function<void(std::size_t Index, texture const& Texture)> const& Callback);
+}//namespace gli
+
+#include "./core/load_batch.inl"
@@ -22,6 +22,31 @@ namespace gli
 	/// @param Data Pointer to the beginning of the texture container data to read
 	/// @param Size Size of texture container Data to read
 	texture load_dds(char const* Data, std::size_t Size);
+
+	/// Loads a texture storage_linear from DDS file and stores the texels in Format.
+	/// Format must only reorder, drop or add components of the file format, for example to load legacy BGR8 files as FORMAT_RGBA8_UNORM_PACK8.
+	/// Returns an empty storage_linear in case of failure or if the formats aren't compatible.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	/// @param Format Format of the returned texture
+	texture load_dds(char const* Path, format Format);
+
+	/// Loads a texture storage_linear from DDS file and stores the texels in Format.
+	/// Format must only reorder, drop or add components of the file format, for example to load legacy BGR8 files as FORMAT_RGBA8_UNORM_PACK8.
+	/// Returns an empty storage_linear in case of failure or if the formats aren't compatible.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	/// @param Format Format of the returned texture
+	texture load_dds(std::string const& Path, format Format);
+
+	/// Loads a texture storage_linear from DDS memory and stores the texels in Format.
+	/// The components are reordered while copying the texel data, for example to load legacy BGR8 files as FORMAT_RGBA8_UNORM_PACK8.
+	/// Returns an empty storage_linear in case of failure or if the formats aren't compatible.
+	///
+	/// @param Data Pointer to the beginning of the texture container data to read
+	/// @param Size Size of texture container Data to read
+	/// @param Format Format of the returned texture
+	texture load_dds(char const* Data, std::size_t Size, format Format);
 }//namespace gli
 
 #include "./core/load_dds.inl"
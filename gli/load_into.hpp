@@ -0,0 +1,66 @@
+/// @brief Include to load DDS, KTX or KMG textures into the storage of existing textures or into caller memory.
+/// @file gli/load_into.hpp
+
+#pragma once
+
+#include "texture.hpp"
+
+namespace gli
+{
+	/// Loads the images of a DDS, KTX or KMG container from memory into the storage of Texture, without allocating a new storage.
+	/// The target, format, extent, layers, faces and levels of Texture must match the container, the swizzles of Texture are kept.
+	/// KTX 2.0 and KMG 2.0 containers aren't supported. Returns false and leaves Texture unchanged in case of failure.
+	///
+	/// @param Texture Texture to fill, it may be a view of a larger texture
+	/// @param Data Pointer to the beginning of the texture container data to read
+	/// @param Size Size of texture container Data to read
+	bool load_into(texture& Texture, char const* Data, std::size_t Size);
+
+	/// Loads the images of a DDS, KTX or KMG file into the storage of Texture, without allocating a new storage.
+	/// The images are read from the file directly into the storage of Texture.
+	/// The target, format, extent, layers, faces and levels of Texture must match the file, the swizzles of Texture are kept.
+	/// KTX 2.0 and KMG 2.0 files aren't supported. Returns false in case of failure, Texture is left unchanged unless the read itself fails.
+	///
+	/// @param Texture Texture to fill, it may be a view of a larger texture
+	/// @param Path Path of the file to open including filaname and filename extension
+	bool load_into(texture& Texture, char const* Path);
+
+	/// Loads the images of a DDS, KTX or KMG file into the storage of Texture, without allocating a new storage.
+	/// The images are read from the file directly into the storage of Texture.
+	/// The target, format, extent, layers, faces and levels of Texture must match the file, the swizzles of Texture are kept.
+	/// KTX 2.0 and KMG 2.0 files aren't supported. Returns false in case of failure, Texture is left unchanged unless the read itself fails.
+	///
+	/// @param Texture Texture to fill, it may be a view of a larger texture
+	/// @param Path Path of the file to open including filaname and filename extension
+	bool load_into(texture& Texture, std::string const& Path);
+
+	/// Loads a DDS, KTX or KMG container from memory into Buffer and returns a texture using Buffer as storage.
+	/// Buffer must remain valid as long as the returned texture or one of its views exists.
+	/// Returns an empty texture in case of failure or if the texture doesn't fit in Buffer.
+	///
+	/// @param Buffer Memory receiving the images with the layout of a texture storage_linear
+	/// @param BufferSize Size of Buffer in bytes
+	/// @param Data Pointer to the beginning of the texture container data to read
+	/// @param Size Size of texture container Data to read
+	texture load_into(void* Buffer, std::size_t BufferSize, char const* Data, std::size_t Size);
+
+	/// Loads a DDS, KTX or KMG file into Buffer and returns a texture using Buffer as storage.
+	/// Buffer must remain valid as long as the returned texture or one of its views exists.
+	/// Returns an empty texture in case of failure or if the texture doesn't fit in Buffer.
+	///
+	/// @param Buffer Memory receiving the images with the layout of a texture storage_linear
+	/// @param BufferSize Size of Buffer in bytes
+	/// @param Path Path of the file to open including filaname and filename extension
+	texture load_into(void* Buffer, std::size_t BufferSize, char const* Path);
+
+	/// Loads a DDS, KTX or KMG file into Buffer and returns a texture using Buffer as storage.
+	/// Buffer must remain valid as long as the returned texture or one of its views exists.
+	/// Returns an empty texture in case of failure or if the texture doesn't fit in Buffer.
+	///
+	/// @param Buffer Memory receiving the images with the layout of a texture storage_linear
+	/// @param BufferSize Size of Buffer in bytes
+	/// @param Path Path of the file to open including filaname and filename extension
+	texture load_into(void* Buffer, std::size_t BufferSize, std::string const& Path);
+}//namespace gli
+
+#include "./core/load_into.inl"
@@ -1,4 +1,4 @@
-/// @brief Include to load KMG textures from files or memory.
+/// @brief Include to load KMG and KMG 2.0 textures from files or memory.
 /// @file gli/load_kmg.hpp
 
 #pragma once
@@ -22,6 +22,31 @@ namespace gli
 	/// @param Data Pointer to the beginning of the texture container data to read
 	/// @param Size Size of texture container Data to read
 	texture load_kmg(char const* Data, std::size_t Size);
+
+	/// Loads the levels BaseLevel to MaxLevel of a texture storage_linear from KMG (Khronos Image) file. Returns an empty storage_linear in case of failure.
+	/// MaxLevel is clamped to the last level of the file. KMG 2.0 files are read through their chunk index, only the chunks of the requested levels are read and decompressed.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	/// @param BaseLevel First level to load, it becomes the base level of the returned texture
+	/// @param MaxLevel Last level to load
+	texture load_kmg(char const* Path, texture::size_type BaseLevel, texture::size_type MaxLevel);
+
+	/// Loads the levels BaseLevel to MaxLevel of a texture storage_linear from KMG (Khronos Image) file. Returns an empty storage_linear in case of failure.
+	/// MaxLevel is clamped to the last level of the file. KMG 2.0 files are read through their chunk index, only the chunks of the requested levels are read and decompressed.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	/// @param BaseLevel First level to load, it becomes the base level of the returned texture
+	/// @param MaxLevel Last level to load
+	texture load_kmg(std::string const& Path, texture::size_type BaseLevel, texture::size_type MaxLevel);
+
+	/// Loads the levels BaseLevel to MaxLevel of a texture storage_linear from KMG (Khronos Image) memory. Returns an empty storage_linear in case of failure.
+	/// MaxLevel is clamped to the last level of the file. KMG 2.0 files are read through their chunk index, only the chunks of the requested levels are decompressed.
+	///
+	/// @param Data Pointer to the beginning of the texture container data to read
+	/// @param Size Size of texture container Data to read
+	/// @param BaseLevel First level to load, it becomes the base level of the returned texture
+	/// @param MaxLevel Last level to load
+	texture load_kmg(char const* Data, std::size_t Size, texture::size_type BaseLevel, texture::size_type MaxLevel);
 }//namespace gli
 
 #include "./core/load_kmg.inl"
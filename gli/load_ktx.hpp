@@ -1,4 +1,4 @@
-/// @brief Include to load KTX textures from files or memory.
+/// @brief Include to load KTX and KTX 2.0 textures from files or memory.
 /// @file gli/load_ktx.hpp
 
 #pragma once
@@ -22,6 +22,31 @@ namespace gli
 	/// @param Data Pointer to the beginning of the texture container data to read
 	/// @param Size Size of texture container Data to read
 	texture load_ktx(char const* Data, std::size_t Size);
+
+	/// Loads the levels BaseLevel to MaxLevel of a texture storage_linear from KTX file. Returns an empty storage_linear in case of failure.
+	/// MaxLevel is clamped to the last level of the file. KTX 2.0 files are read through their level index, only the requested levels are decompressed.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	/// @param BaseLevel First level to load, it becomes the base level of the returned texture
+	/// @param MaxLevel Last level to load
+	texture load_ktx(char const* Path, texture::size_type BaseLevel, texture::size_type MaxLevel);
+
+	/// Loads the levels BaseLevel to MaxLevel of a texture storage_linear from KTX file. Returns an empty storage_linear in case of failure.
+	/// MaxLevel is clamped to the last level of the file. KTX 2.0 files are read through their level index, only the requested levels are decompressed.
+	///
+	/// @param Path Path of the file to open including filaname and filename extension
+	/// @param BaseLevel First level to load, it becomes the base level of the returned texture
+	/// @param MaxLevel Last level to load
+	texture load_ktx(std::string const& Path, texture::size_type BaseLevel, texture::size_type MaxLevel);
+
+	/// Loads the levels BaseLevel to MaxLevel of a texture storage_linear from KTX memory. Returns an empty storage_linear in case of failure.
+	/// MaxLevel is clamped to the last level of the file. KTX 2.0 files are read through their level index, only the requested levels are decompressed.
+	///
+	/// @param Data Pointer to the beginning of the texture container data to read
+	/// @param Size Size of texture container Data to read
+	/// @param BaseLevel First level to load, it becomes the base level of the returned texture
+	/// @param MaxLevel Last level to load
+	texture load_ktx(char const* Data, std::size_t Size, texture::size_type BaseLevel, texture::size_type MaxLevel);
 }//namespace gli
 
 #include "./core/load_ktx.inl"
@@ -0,0 +1,105 @@
+/// @brief Include to store many textures in a single pack file and to open them as views of the file mapped in memory.
+/// @file gli/pack.hpp
+
+#pragma once
+
+#include "texture.hpp"
+#include "./core/file.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace gli
+{
+	/// Save textures to a pack file: a header, an index of the names sorted by hash and the storage of each texture aligned to 64 bytes.
+	/// Textures views are saved as new textures holding only the images of the view.
+	///
+	/// @param Names Unique name of each texture, used to find the textures in the pack
+	/// @param Textures Source textures to save, none of them may be empty
+	/// @param Path Path for where to save the file. It must include the filaname and filename extension.
+	/// @return Returns false if the function fails to save the file, if Names and Textures don't have the same size or if a name is repeated.
+	bool save_pack(std::vector<std::string> const& Names, std::vector<texture> const& Textures, char const* Path);
+
+	/// Save textures to a pack file: a header, an index of the names sorted by hash and the storage of each texture aligned to 64 bytes.
+	/// Textures views are saved as new textures holding only the images of the view.
+	///
+	/// @param Names Unique name of each texture, used to find the textures in the pack
+	/// @param Textures Source textures to save, none of them may be empty
+	/// @param Path Path for where to save the file. It must include the filaname and filename extension.
+	/// @return Returns false if the function fails to save the file, if Names and Textures don't have the same size or if a name is repeated.
+	bool save_pack(std::vector<std::string> const& Names, std::vector<texture> const& Textures, std::string const& Path);
+
+	/// Save textures to a pack container in memory.
+	///
+	/// @param Names Unique name of each texture, used to find the textures in the pack
+	/// @param Textures Source textures to save, none of them may be empty
+	/// @param Memory Storage for the pack container. The function resizes the containers to fit the necessary storage_linear.
+	/// @return Returns false if Names and Textures don't have the same size, if a name is repeated or if a texture is empty.
+	bool save_pack(std::vector<std::string> const& Names, std::vector<texture> const& Textures, std::vector<char>& Memory);
+
+	/// Pack file mapped in memory. Opening a texture is a lookup in the index of the pack.
+	/// Loaded textures are copies of the pack content, mapped textures use the mapped file as storage without copying it and keep the mapping alive.
+	/// Pages are mapped copy on write: modifying a mapped texture doesn't modify the file.
+	class pack
+	{
+	public:
+		typedef size_t size_type;
+
+		/// Create an empty pack
+		pack();
+
+		/// Map the pack file at Path. The pack is empty if the file can't be opened or isn't a valid pack file.
+		explicit pack(char const* Path);
+
+		/// Map the pack file at Path. The pack is empty if the file can't be opened or isn't a valid pack file.
+		explicit pack(std::string const& Path);
+
+		/// Return whether the pack contains no texture
+		bool empty() const;
+
+		/// Return the number of textures in the pack
+		size_type size() const;
+
+		/// Return the index of the texture named Name, or size() if the pack doesn't contain it
+		size_type find(char const* Name) const;
+
+		/// Return the index of the texture named Name, or size() if the pack doesn't contain it
+		size_type find(std::string const& Name) const;
+
+		/// Return the name of the texture at Index
+		std::string name(size_type Index) const;
+
+		/// Copy the texture at Index to a new storage. Returns an empty texture if the description of the texture in the pack is invalid.
+		texture load(size_type Index) const;
+
+		/// Copy the texture named Name to a new storage. Returns an empty texture if the pack doesn't contain it.
+		texture load(char const* Name) const;
+
+		/// Copy the texture named Name to a new storage. Returns an empty texture if the pack doesn't contain it.
+		texture load(std::string const& Name) const;
+
+		/// Open the texture at Index as a view of the mapped file, without copying it.
+		/// Every texture mapped from the same entry of this pack shares the same memory: a write through one of them is seen by the others.
+		/// Use load to get a texture that can be modified on its own.
+		/// Returns an empty texture if the description of the texture in the pack is invalid.
+		texture map(size_type Index) const;
+
+		/// Open the texture named Name as a view of the mapped file, without copying it. Returns an empty texture if the pack doesn't contain it.
+		texture map(char const* Name) const;
+
+		/// Open the texture named Name as a view of the mapped file, without copying it. Returns an empty texture if the pack doesn't contain it.
+		texture map(std::string const& Name) const;
+
+	private:
+		void open(char const* Path);
+		texture open_texture(size_type Index, bool Copy) const;
+
+		std::shared_ptr<detail::mapped_file> File;
+		size_type Count;
+		size_t IndexOffset;
+		size_t NamesOffset;
+		size_t NamesSize;
+	};
+}//namespace gli
+
+#include "./core/pack.inl"
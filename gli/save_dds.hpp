@@ -4,6 +4,7 @@
 #pragma once
 
 #include "texture.hpp"
+#include "segment_list.hpp"
 
 namespace gli
 {
@@ -29,6 +30,14 @@ namespace gli
 	/// @param Memory Storage for the DDS container. The function resizes the containers to fit the necessary storage_linear.
 	/// @return Returns false if the function fails to save the file.
 	bool save_dds(texture const & Texture, std::vector<char> & Memory);
+
+	/// Save a texture storage_linear to a DDS container as a list of segments, without copying the images of the texture.
+	/// The segments hold the headers and point to the images in the texture storage, for example to send them with writev.
+	///
+	/// @param Texture Source texture to save
+	/// @param Segments Segments of the DDS container. The list keeps the storage of Texture alive, later writes to the texture change the serialized images.
+	/// @return Returns false if the function fails to save the texture.
+	bool save_dds(texture const & Texture, segment_list & Segments);
 }//namespace gli
 
 #include "./core/save_dds.inl"
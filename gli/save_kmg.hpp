@@ -1,9 +1,10 @@
-/// @brief Include to save KMG textures to files or memory.
+/// @brief Include to save KMG and KMG 2.0 textures to files or memory.
 /// @file gli/save_kmg.hpp
 
 #pragma once
 
 #include "texture.hpp"
+#include "segment_list.hpp"
 
 namespace gli
 {
@@ -29,6 +30,38 @@ namespace gli
 	/// @param Memory Storage for the KMG container. The function resizes the containers to fit the necessary storage_linear.
 	/// @return Returns false if the function fails to save the file.
 	bool save_kmg(texture const & Texture, std::vector<char> & Memory);
+
+	/// Save a texture storage_linear to a KMG container as a list of segments, without copying the images of the texture.
+	/// The segments hold the headers and point to the images in the texture storage, for example to send them with writev.
+	///
+	/// @param Texture Source texture to save
+	/// @param Segments Segments of the KMG container. The list keeps the storage of Texture alive, later writes to the texture change the serialized images.
+	/// @return Returns false if the function fails to save the texture.
+	bool save_kmg(texture const & Texture, segment_list & Segments);
+
+	/// Save a texture storage_linear to a KMG 2.0 file, with a chunk index, checksums and optionally supercompressed chunks.
+	///
+	/// @param Texture Source texture to save
+	/// @param Path Path for where to save the file. It must include the filaname and filename extension.
+	/// @param Supercompression Supercompression of each chunk, chunks are supercompressed in parallel
+	/// @return Returns false if the function fails to save the file.
+	bool save_kmg2(texture const & Texture, char const * Path, supercompression Supercompression = SUPERCOMPRESSION_NONE);
+
+	/// Save a texture storage_linear to a KMG 2.0 file, with a chunk index, checksums and optionally supercompressed chunks.
+	///
+	/// @param Texture Source texture to save
+	/// @param Path Path for where to save the file. It must include the filaname and filename extension.
+	/// @param Supercompression Supercompression of each chunk, chunks are supercompressed in parallel
+	/// @return Returns false if the function fails to save the file.
+	bool save_kmg2(texture const & Texture, std::string const & Path, supercompression Supercompression = SUPERCOMPRESSION_NONE);
+
+	/// Save a texture storage_linear to a KMG 2.0 file, with a chunk index, checksums and optionally supercompressed chunks.
+	///
+	/// @param Texture Source texture to save
+	/// @param Memory Storage for the KMG container. The function resizes the containers to fit the necessary storage_linear.
+	/// @param Supercompression Supercompression of each chunk, chunks are supercompressed in parallel
+	/// @return Returns false if the function fails to save the file.
+	bool save_kmg2(texture const & Texture, std::vector<char> & Memory, supercompression Supercompression = SUPERCOMPRESSION_NONE);
 }//namespace gli
 
 #include "./core/save_kmg.inl"
@@ -1,9 +1,10 @@
-/// @brief Include to save KTX textures to files or memory.
+/// @brief Include to save KTX and KTX 2.0 textures to files or memory.
 /// @file gli/save_ktx.hpp
 
 #pragma once
 
 #include "texture.hpp"
+#include "segment_list.hpp"
 
 namespace gli
 {
@@ -29,6 +30,41 @@ namespace gli
 	/// @param Memory Storage for the KTX container. The function resizes the containers to fit the necessary storage_linear.
 	/// @return Returns false if the function fails to save the file.
 	bool save_ktx(texture const & Texture, std::vector<char> & Memory);
+
+	/// Save a texture storage_linear to a KTX container as a list of segments, without copying the images of the texture.
+	/// The segments hold the headers and point to the images in the texture storage, for example to send them with writev.
+	///
+	/// @param Texture Source texture to save
+	/// @param Segments Segments of the KTX container. The list keeps the storage of Texture alive, later writes to the texture change the serialized images.
+	/// @return Returns false if the function fails to save the texture.
+	bool save_ktx(texture const & Texture, segment_list & Segments);
+
+	/// Save a texture storage_linear to a KTX 2.0 file, with a level index and optionally supercompressed levels.
+	/// Only the formats with a VkFormat value are supported.
+	///
+	/// @param Texture Source texture to save
+	/// @param Path Path for where to save the file. It must include the filaname and filename extension.
+	/// @param Supercompression Supercompression of each level, levels are supercompressed in parallel
+	/// @return Returns false if the function fails to save the file.
+	bool save_ktx2(texture const & Texture, char const * Path, supercompression Supercompression = SUPERCOMPRESSION_NONE);
+
+	/// Save a texture storage_linear to a KTX 2.0 file, with a level index and optionally supercompressed levels.
+	/// Only the formats with a VkFormat value are supported.
+	///
+	/// @param Texture Source texture to save
+	/// @param Path Path for where to save the file. It must include the filaname and filename extension.
+	/// @param Supercompression Supercompression of each level, levels are supercompressed in parallel
+	/// @return Returns false if the function fails to save the file.
+	bool save_ktx2(texture const & Texture, std::string const & Path, supercompression Supercompression = SUPERCOMPRESSION_NONE);
+
+	/// Save a texture storage_linear to a KTX 2.0 file, with a level index and optionally supercompressed levels.
+	/// Only the formats with a VkFormat value are supported.
+	///
+	/// @param Texture Source texture to save
+	/// @param Memory Storage for the KTX 2.0 container. The function resizes the containers to fit the necessary storage_linear.
+	/// @param Supercompression Supercompression of each level, levels are supercompressed in parallel
+	/// @return Returns false if the function fails to save the file.
+	bool save_ktx2(texture const & Texture, std::vector<char> & Memory, supercompression Supercompression = SUPERCOMPRESSION_NONE);
 }//namespace gli
 
 #include "./core/save_ktx.inl"
@@ -0,0 +1,73 @@
+/// @brief Include to serialize textures as lists of memory segments, for example for writev, sendmsg or hashing without copying the texture storage.
+/// @file gli/segment_list.hpp
+
+#pragma once
+
+#include "texture.hpp"
+#include <cstdio>
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace gli
+{
+	/// Contiguous bytes of a serialized container
+	struct segment
+	{
+		void const* Data;
+		std::size_t Size;
+	};
+
+	/// Container serialized as a list of segments: headers held by the list, images pointing into the storage of the texture and static padding.
+	/// The list keeps the texture storage alive. Segments point to the texture storage, writing to the texture modifies the serialized images.
+	class segment_list
+	{
+	public:
+		typedef size_t size_type;
+
+		/// Create an empty list
+		segment_list();
+
+		/// Return whether the list has no segment
+		bool empty() const;
+
+		/// Return the number of segments
+		size_type size() const;
+
+		/// Return the segment at Index
+		segment const& operator[](size_type Index) const;
+
+		/// Return the array of segments
+		segment const* data() const;
+
+		/// Return the total number of bytes of the segments
+		size_type bytes() const;
+
+		/// Copy the bytes of all the segments to Memory, resized to bytes()
+		void gather(std::vector<char>& Memory) const;
+
+		/// Write the bytes of all the segments to File. Returns false if a write fails.
+		bool write(FILE* File) const;
+
+		/// Start a new list serializing Texture, reserving HeaderCapacity bytes for the headers
+		void reset(texture const& Texture, size_type HeaderCapacity);
+
+		/// Append Size zeroed bytes held by the list, to be filled by the caller until the list is reset.
+		/// Appending more than the header capacity allocates further header memory, the bytes returned previously never move.
+		void* append_header(size_type Size);
+
+		/// Append Size bytes pointed by Data, which must remain valid as long as the list is used
+		void append(void const* Data, size_type Size);
+
+		/// Append Size zero bytes, up to 16 bytes
+		void append_padding(size_type Size);
+
+	private:
+		texture Texture;
+		std::shared_ptr<std::list<std::vector<char> > > Headers;
+		std::vector<segment> Segments;
+		size_type Bytes;
+	};
+}//namespace gli
+
+#include "./core/segment_list.inl"
@@ -0,0 +1,82 @@
+/// @brief Include to lay out textures in staging buffers for buffer to image copies of Direct3D 12 or Vulkan.
+/// @file gli/staging.hpp
+
+#pragma once
+
+#include "texture.hpp"
+#include <vector>
+
+namespace gli
+{
+	/// Alignment rules of the images in a staging buffer. Both alignments are rounded up to a multiple of the block size of the format.
+	/// The defaults follow Direct3D 12 placed footprints, Vulkan requires its optimalBufferCopyOffsetAlignment and optimalBufferCopyRowPitchAlignment.
+	struct staging_alignment
+	{
+		staging_alignment(size_t RowPitch = 256, size_t Offset = 512)
+			: RowPitch(RowPitch)
+			, Offset(Offset)
+		{}
+
+		/// Alignment of the bytes between the beginning of two consecutive rows of blocks
+		size_t RowPitch;
+
+		/// Alignment of the offset of each image from the beginning of the staging buffer
+		size_t Offset;
+	};
+
+	/// Placement of an image of a texture in a staging buffer
+	struct staging_footprint
+	{
+		texture::size_type Layer;
+		texture::size_type Face;
+		texture::size_type Level;
+
+		/// Extent of the image in texels
+		texture::extent_type Extent;
+
+		/// Offset of the image from the beginning of the staging buffer
+		size_t Offset;
+
+		/// Bytes of a row of blocks copied from the texture
+		size_t RowSize;
+
+		/// Bytes between the beginning of two consecutive rows of blocks
+		size_t RowPitch;
+
+		/// Bytes between the beginning of two consecutive slices of blocks
+		size_t SlicePitch;
+
+		/// Number of rows of blocks of a slice
+		size_t RowCount;
+
+		/// Number of slices of blocks
+		size_t SliceCount;
+
+		/// Row length in texels, the bufferRowLength of VkBufferImageCopy
+		size_t RowLength;
+
+		/// Slice height in texels, the bufferImageHeight of VkBufferImageCopy
+		size_t ImageHeight;
+	};
+
+	/// Compute the placement of every image of Texture in a staging buffer.
+	/// Footprints are listed by layer, face and level, the order of Direct3D 12 subresources with faces as array slices.
+	///
+	/// @param Texture Texture to upload
+	/// @param Alignment Alignment rules of the rows and of the images
+	/// @param Footprints Placement of each image, resized to the number of images of Texture
+	/// @return Returns the size of the staging buffer in bytes, 0 if Texture is empty or if an alignment is 0.
+	size_t staging_layout(texture const& Texture, staging_alignment const& Alignment, std::vector<staging_footprint>& Footprints);
+
+	/// Copy the images of Texture to a staging buffer in a single pass, with the placement computed by staging_layout.
+	/// Rows are copied in parallel for large textures, the padding between rows and images isn't written.
+	///
+	/// @param Texture Texture to upload
+	/// @param Footprints Placement of each image computed by staging_layout for Texture
+	/// @param Buffer Staging buffer, for example a mapped upload buffer
+	/// @param Size Size of Buffer in bytes
+	/// @return Returns false if the footprints don't match Texture or don't fit in Buffer.
+	bool fill_staging(texture const& Texture, std::vector<staging_footprint> const& Footprints, void* Buffer, size_t Size);
+}//namespace gli
+
+#include "./core/staging.inl"
@@ -42,6 +42,27 @@ namespace gli
 			size_type Levels,
 			swizzles_type const& Swizzles = swizzles_type(SWIZZLE_RED, SWIZZLE_GREEN, SWIZZLE_BLUE, SWIZZLE_ALPHA));
 
+		/// Create a texture object using external memory as texture storage, for example a file mapped in memory, without copying it.
+		/// @param Target Type/Shape of the texture storage_linear
+		/// @param Format Texel format
+		/// @param Extent Size of the texture: width, height and depth.
+		/// @param Layers Number of one-dimensional or two-dimensional images of identical size and format
+		/// @param Faces 6 for cube map textures otherwise 1.
+		/// @param Levels Number of images in the texture mipmap chain.
+		/// @param Data Memory holding the images with the layout of a texture storage_linear
+		/// @param Owner Keeps the memory alive as long as the texture or one of its views exists
+		/// @param Swizzles A mechanism to swizzle the components of a texture before they are applied according to the texture environment.
+		texture(
+			target_type Target,
+			format_type Format,
+			extent_type const& Extent,
+			size_type Layers,
+			size_type Faces,
+			size_type Levels,
+			void* Data,
+			std::shared_ptr<void> const& Owner,
+			swizzles_type const& Swizzles = swizzles_type(SWIZZLE_RED, SWIZZLE_GREEN, SWIZZLE_BLUE, SWIZZLE_ALPHA));
+
 		/// Create a texture object by sharing an existing texture storage_type from another texture instance.
 		/// This texture object is effectively a texture view where the layer, the face and the level allows identifying
 		/// a specific subset of the texture storage_linear source. 
@@ -174,7 +195,8 @@ namespace gli
 			size_t LayerSrc, size_t FaceSrc, size_t LevelSrc,
 			size_t LayerDst, size_t FaceDst, size_t LevelDst);
 
-		/// Copy a subset of a specific image of a texture 
+		/// Copy a subset of a specific image of a texture with the same block size. The work is split across threads.
+		/// The offsets must be aligned on blocks. An extent ending inside a block covers the whole block so that a copy can include the partial blocks at the edge of compressed images.
 		void copy(
 			texture const& TextureSrc,
 			size_t LayerSrc, size_t FaceSrc, size_t LevelSrc, extent_type const& OffsetSrc,
@@ -215,7 +237,13 @@ namespace gli
 			};
 
 			explicit cache(ctor)
-			{}
+				: Faces(0)
+				, Levels(0)
+				, GlobalMemorySize(0)
+			{
+				this->ImageExtent.fill(extent_type(0));
+				this->ImageMemorySize.fill(0);
+			}
 
 			cache
 			(
@@ -40,6 +40,14 @@ namespace gli
 	typedef ivec3 extent3d;
 	typedef ivec4 extent4d;
 
+	/// Supercompression of the levels of KTX 2.0 files and of the chunks of KMG 2.0 files
+	enum supercompression
+	{
+		SUPERCOMPRESSION_NONE = 0,
+		SUPERCOMPRESSION_ZSTD = 2,		///< Zstandard, available when GLI_ZSTD is defined and libzstd is linked
+		SUPERCOMPRESSION_LZ4 = 0x10000	///< LZ4, KMG 2.0 only, available when GLI_LZ4 is defined and liblz4 is linked
+	};
+
 	template <typename T, qualifier P>
 	inline vec<4, T, P> make_vec4(vec<1, T, P> const & v)
 	{
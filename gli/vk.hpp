@@ -0,0 +1,101 @@
+/// @brief Include to translate GLI enums to Vulkan enums
+/// @file gli/vk.hpp
+
+#pragma once
+
+#include "format.hpp"
+#include "target.hpp"
+
+namespace gli
+{
+	/// Translation class to convert GLI enums into Vulkan values
+	class vk
+	{
+	public:
+		/// VkFormat values. GLI formats up to FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16 share the values of VkFormat.
+		enum image_format
+		{
+			FORMAT_UNDEFINED = 0,									//VK_FORMAT_UNDEFINED
+			FORMAT_R8_UNORM = 9,									//VK_FORMAT_R8_UNORM
+			FORMAT_R8G8_UNORM = 16,									//VK_FORMAT_R8G8_UNORM
+			FORMAT_B8G8R8A8_UNORM = 44,								//VK_FORMAT_B8G8R8A8_UNORM
+			FORMAT_B8G8R8A8_SRGB = 50,								//VK_FORMAT_B8G8R8A8_SRGB
+			FORMAT_R16_UNORM = 70,									//VK_FORMAT_R16_UNORM
+			FORMAT_R16G16_UNORM = 77,								//VK_FORMAT_R16G16_UNORM
+			FORMAT_ETC2_R8G8B8_UNORM_BLOCK = 147,					//VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+			FORMAT_ASTC_12x12_SRGB_BLOCK = 184,						//VK_FORMAT_ASTC_12x12_SRGB_BLOCK
+			FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG = 1000054000,		//VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG
+			FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG = 1000054001,		//VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG
+			FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG = 1000054002,		//VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG
+			FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG = 1000054003,		//VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG
+			FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG = 1000054004,			//VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG
+			FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG = 1000054005,			//VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG
+			FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG = 1000054006,			//VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG
+			FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG = 1000054007			//VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG
+		};
+
+		enum image_type
+		{
+			IMAGE_TYPE_1D = 0,						//VK_IMAGE_TYPE_1D
+			IMAGE_TYPE_2D = 1,						//VK_IMAGE_TYPE_2D
+			IMAGE_TYPE_3D = 2						//VK_IMAGE_TYPE_3D
+		};
+
+		enum image_view_type
+		{
+			IMAGE_VIEW_TYPE_1D = 0,					//VK_IMAGE_VIEW_TYPE_1D
+			IMAGE_VIEW_TYPE_2D = 1,					//VK_IMAGE_VIEW_TYPE_2D
+			IMAGE_VIEW_TYPE_3D = 2,					//VK_IMAGE_VIEW_TYPE_3D
+			IMAGE_VIEW_TYPE_CUBE = 3,				//VK_IMAGE_VIEW_TYPE_CUBE
+			IMAGE_VIEW_TYPE_1D_ARRAY = 4,			//VK_IMAGE_VIEW_TYPE_1D_ARRAY
+			IMAGE_VIEW_TYPE_2D_ARRAY = 5,			//VK_IMAGE_VIEW_TYPE_2D_ARRAY
+			IMAGE_VIEW_TYPE_CUBE_ARRAY = 6			//VK_IMAGE_VIEW_TYPE_CUBE_ARRAY
+		};
+
+		enum image_create_flag
+		{
+			IMAGE_CREATE_NONE = 0,
+			IMAGE_CREATE_CUBE_COMPATIBLE_BIT = 0x10	//VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT
+		};
+
+		enum swizzle
+		{
+			SWIZZLE_IDENTITY = 0,					//VK_COMPONENT_SWIZZLE_IDENTITY
+			SWIZZLE_ZERO = 1,						//VK_COMPONENT_SWIZZLE_ZERO
+			SWIZZLE_ONE = 2,						//VK_COMPONENT_SWIZZLE_ONE
+			SWIZZLE_RED = 3,						//VK_COMPONENT_SWIZZLE_R
+			SWIZZLE_GREEN = 4,						//VK_COMPONENT_SWIZZLE_G
+			SWIZZLE_BLUE = 5,						//VK_COMPONENT_SWIZZLE_B
+			SWIZZLE_ALPHA = 6						//VK_COMPONENT_SWIZZLE_A
+		};
+
+		typedef glm::vec<4, int> swizzles;
+
+		struct target
+		{
+			image_type Type;
+			image_view_type ViewType;
+			image_create_flag Flags;
+		};
+
+		struct format
+		{
+			image_format Format;
+			swizzles Swizzles;
+		};
+
+		/// Convert GLI targets into Vulkan image types, image view types and image creation flags
+		target const& translate(gli::target Target) const;
+
+		/// Convert GLI formats into Vulkan formats and component mappings, Swizzles being the swizzles of a texture as returned by texture::swizzles.
+		/// Vulkan formats such as B8G8R8A8 reorder the components themselves, the component mapping only holds the custom swizzles of the texture.
+		/// Luminance and alpha formats are stored as red and green formats and read through the component mapping.
+		/// Format is FORMAT_UNDEFINED when Vulkan has no matching format.
+		format translate(gli::format Format, gli::swizzles const& Swizzles) const;
+
+		/// Convert a Vulkan format into a GLI format, FORMAT_UNDEFINED if GLI has no matching format
+		gli::format find(image_format Format) const;
+	};
+}//namespace gli
+
+#include "./core/vk.inl"
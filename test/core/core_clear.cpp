@@ -1,9 +1,14 @@
+#define GLI_THREAD_COUNT 4
+#define GLI_STREAM_THRESHOLD (1 << 20)
 #include <gli/texture1d.hpp>
 #include <gli/texture2d.hpp>
 #include <gli/texture3d.hpp>
 #include <gli/clear.hpp>
 #include <gli/comparison.hpp>
 #include <gli/duplicate.hpp>
+#include <gli/texture2d_array.hpp>
+#include <gli/view.hpp>
+#include <algorithm>
 #include <ctime>
 
 namespace clear
@@ -182,6 +187,127 @@ namespace can_clear_layer
 	}
 }//namespace can_clear_layer
 
+namespace fill
+{
+	// Compare the fill with a byte by byte reference for every pattern size and for misaligned destinations
+	int test()
+	{
+		int Error(0);
+
+		std::size_t const PatternSizes[] = {1, 2, 3, 4, 6, 8, 12, 16, 24, 32};
+		std::vector<glm::uint8> Buffer(4096 + 64);
+		std::vector<glm::uint8> Reference(Buffer.size());
+
+		for(std::size_t SizeIndex = 0; SizeIndex < sizeof(PatternSizes) / sizeof(PatternSizes[0]); ++SizeIndex)
+		for(std::size_t Misalignment = 0; Misalignment < 16; Misalignment += 5)
+		for(std::size_t PatternCount = 0; PatternCount < 4096 / 32; PatternCount = PatternCount * 2 + 1)
+		for(int Stream = 0; Stream < 2; ++Stream)
+		{
+			std::size_t const PatternSize = PatternSizes[SizeIndex];
+			std::size_t const Size = PatternCount * PatternSize;
+
+			glm::uint8 Pattern[32];
+			for(std::size_t Byte = 0; Byte < PatternSize; ++Byte)
+				Pattern[Byte] = static_cast<glm::uint8>(Byte * 13 + 1);
+
+			std::fill(Buffer.begin(), Buffer.end(), glm::uint8(0xCD));
+			std::fill(Reference.begin(), Reference.end(), glm::uint8(0xCD));
+			for(std::size_t Byte = 0; Byte < Size; ++Byte)
+				Reference[Misalignment + Byte] = Pattern[Byte % PatternSize];
+
+			gli::detail::fill(&Buffer[Misalignment], Size, Pattern, PatternSize, Stream != 0);
+			Error += Buffer == Reference ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace fill
+
+namespace clear_region
+{
+	int test()
+	{
+		int Error(0);
+
+		glm::u8vec4 const Background(0, 0, 0, 255);
+		glm::u8vec4 const Color(255, 127, 0, 255);
+
+		// Every row and every slice of the region is cleared, not only the first row
+		{
+			gli::texture3d Texture(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture3d::extent_type(8, 6, 4), 2);
+			Texture.clear(Background);
+			Texture.clear(0, 0, 1, gli::texture::extent_type(1, 1, 0), gli::texture::extent_type(2, 2, 2), Color);
+			Texture.clear(0, 0, 0, gli::texture::extent_type(2, 1, 1), gli::texture::extent_type(5, 4, 3), Color);
+
+			for(int z = 0; z < 4; ++z)
+			for(int y = 0; y < 6; ++y)
+			for(int x = 0; x < 8; ++x)
+			{
+				bool const Inside = x >= 2 && x < 7 && y >= 1 && y < 5 && z >= 1 && z < 4;
+				Error += Texture.load<glm::u8vec4>(gli::extent3d(x, y, z), 0) == (Inside ? Color : Background) ? 0 : 1;
+			}
+
+			for(int z = 0; z < 2; ++z)
+			for(int y = 0; y < 3; ++y)
+			for(int x = 0; x < 4; ++x)
+			{
+				bool const Inside = x >= 1 && x < 3 && y >= 1 && y < 3;
+				Error += Texture.load<glm::u8vec4>(gli::extent3d(x, y, z), 1) == (Inside ? Color : Background) ? 0 : 1;
+			}
+		}
+
+		// Regions of compressed textures are cleared by blocks
+		{
+			glm::u64vec1 const Block(0x0123456789ABCDEFull);
+			gli::texture2d Texture(gli::FORMAT_RGB_DXT1_UNORM_BLOCK8, gli::texture2d::extent_type(16), 1);
+			gli::clear(Texture);
+			Texture.texture::clear(0, 0, 0, gli::texture::extent_type(4, 8, 0), gli::texture::extent_type(8, 8, 1), Block);
+
+			glm::u64vec1 const* const Blocks = Texture.data<glm::u64vec1>();
+			for(int y = 0; y < 4; ++y)
+			for(int x = 0; x < 4; ++x)
+			{
+				bool const Inside = x >= 1 && x < 3 && y >= 2;
+				Error += Blocks[x + y * 4] == (Inside ? Block : glm::u64vec1(0)) ? 0 : 1;
+			}
+		}
+
+		// The region is relative to the view
+		{
+			gli::texture2d_array Texture(gli::FORMAT_R8_UNORM_PACK8, gli::texture2d_array::extent_type(4), 3, 2);
+			Texture.clear(glm::u8vec1(0));
+			gli::texture2d_array View(gli::view(Texture, 1, 2, 1, 1));
+			View.texture::clear(1, 0, 0, gli::texture::extent_type(0), gli::texture::extent_type(2, 2, 1), glm::u8vec1(255));
+
+			Error += Texture.load<glm::u8vec1>(gli::extent2d(1, 1), 2, 1) == glm::u8vec1(255) ? 0 : 1;
+			Error += Texture.load<glm::u8vec1>(gli::extent2d(0, 0), 2, 0) == glm::u8vec1(0) ? 0 : 1;
+			Error += Texture.load<glm::u8vec1>(gli::extent2d(0, 0), 1, 1) == glm::u8vec1(0) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace clear_region
+
+namespace clear_large
+{
+	int test()
+	{
+		int Error(0);
+
+		// Large enough to be split across threads and to use non-temporal stores
+		gli::texture2d_array Texture(gli::FORMAT_RGB8_UNORM_PACK8, gli::texture2d_array::extent_type(1024, 1024), 3, 1);
+		Texture.clear(glm::u8vec3(1, 2, 3));
+		Texture.clear(1, 0, 0, glm::u8vec3(4, 5, 6));
+
+		glm::u8vec3 const* const Texels = Texture.data<glm::u8vec3>();
+		for(std::size_t TexelIndex = 0, TexelCount = Texture.size<glm::u8vec3>(); TexelIndex < TexelCount; TexelIndex += 997)
+			Error += Texels[TexelIndex] == (TexelIndex / (1024 * 1024) == 1 ? glm::u8vec3(4, 5, 6) : glm::u8vec3(1, 2, 3)) ? 0 : 1;
+		Error += Texels[Texture.size<glm::u8vec3>() - 1] == glm::u8vec3(1, 2, 3) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace clear_large
+
 int main()
 {
 	int Error(0);
@@ -189,6 +315,9 @@ int main()
 	Error += can_clear_layer::test();
 	Error += can_clear_level::test();
 	Error += clear::test();
+	Error += fill::test();
+	Error += clear_region::test();
+	Error += clear_large::test();
 
 	return Error;
 }
@@ -4,12 +4,21 @@
 #include <gli/comparison.hpp>
 #include <gli/core/bc.hpp>
 #include <gli/core/s3tc.hpp>
+#include <gli/core/astc.hpp>
+#include <gli/core/bc7_encoder.hpp>
+#include <gli/core/etc_encoder.hpp>
+#include <gli/core/half.hpp>
+#include <gli/core/srgb.hpp>
 #include <gli/texture2d.hpp>
 #include <gli/duplicate.hpp>
 #include <gli/generate_mipmaps.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtx/vec_swizzle.hpp>
+#include <glm/gtx/component_wise.hpp>
+#include <algorithm>
+#include <cstring>
 #include <ctime>
+#include <thread>
 
 namespace
 {
@@ -28,6 +37,28 @@ namespace
 		std::string Filename;
 		gli::format Format;
 	};
+
+	// Mean absolute difference, in 8 bits steps, of the first Components channels of the first level of a compressed fixture
+	// and of an uncompressed reference of the same image, both converted to Format
+	float mean_error(char const* Filename, char const* ReferenceFilename, gli::format Format, int Components)
+	{
+		gli::texture2d const Texture(gli::convert(gli::texture2d(gli::load(path(Filename))), Format));
+		gli::texture2d const Reference(gli::convert(gli::texture2d(gli::load(path(ReferenceFilename))), Format));
+		if(Texture.empty() || Reference.empty() || Texture.extent() != Reference.extent())
+			return 255.0f;
+
+		float Sum = 0.0f;
+		for(int y = 0; y < Texture.extent().y; ++y)
+		for(int x = 0; x < Texture.extent().x; ++x)
+		{
+			glm::ivec4 const Texel(Texture.load<glm::u8vec4>(gli::extent2d(x, y), 0));
+			glm::ivec4 const Expected(Reference.load<glm::u8vec4>(gli::extent2d(x, y), 0));
+			for(int Component = 0; Component < Components; ++Component)
+				Sum += static_cast<float>(glm::abs(Texel[Component] - Expected[Component]));
+		}
+
+		return Sum / static_cast<float>(Texture.extent().x * Texture.extent().y * Components);
+	}
 }//namespace
 
 bool convert_rgb32f_rgb9e5(const char* FilenameSrc, const char* FilenameDst)
@@ -51,6 +82,35 @@ bool convert_rgb32f_rgb9e5(const char* FilenameSrc, const char* FilenameDst)
 	return true;
 }
 
+namespace srgb_round_trip
+{
+	// Encoding an sRGB texture to a compressed sRGB format, then again from that format, keeps the encoded values
+	inline int test(gli::format Format, int Tolerance)
+	{
+		int Error = 0;
+
+		gli::texture2d Texture(gli::FORMAT_RGBA8_SRGB_PACK8, gli::extent2d(8, 8), 1);
+		for(int y = 0; y < 8; ++y)
+		for(int x = 0; x < 8; ++x)
+			Texture.store(gli::extent2d(x, y), 0, glm::u8vec4(128 + x * 4, 64 + y * 4, 200 - x * 2, 255));
+
+		gli::texture2d const Encoded = gli::convert(Texture, Format);
+		gli::texture2d const Reencoded = gli::convert(Encoded, Format);
+		gli::texture2d const Decoded = gli::convert(Encoded, gli::FORMAT_RGBA8_SRGB_PACK8);
+		gli::texture2d const Redecoded = gli::convert(Reencoded, gli::FORMAT_RGBA8_SRGB_PACK8);
+
+		for(int y = 0; y < 8; ++y)
+		for(int x = 0; x < 8; ++x)
+		{
+			glm::ivec4 const Source(Texture.load<glm::u8vec4>(gli::extent2d(x, y), 0));
+			Error += glm::compMax(glm::abs(glm::ivec4(Decoded.load<glm::u8vec4>(gli::extent2d(x, y), 0)) - Source)) <= Tolerance ? 0 : 1;
+			Error += glm::compMax(glm::abs(glm::ivec4(Redecoded.load<glm::u8vec4>(gli::extent2d(x, y), 0)) - Source)) <= Tolerance ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace srgb_round_trip
+
 namespace r8unorm
 {
 	int test()
@@ -773,6 +833,1850 @@ namespace load_file
 	}
 }//namespace load_file
 
+namespace block_cache
+{
+	typedef gli::detail::convert<gli::texture2d, float, glm::defaultp> convert;
+
+	// Compare each fetch with a direct decoding of its block
+	template <typename block_type>
+	int check(gli::texture2d const& Texture, gli::detail::texel_block4x4(*Decompress)(block_type const&))
+	{
+		int Error = 0;
+
+		convert::fetchFunc const Fetch = convert::call(Texture.format()).Fetch;
+		gli::extent2d const Extent = Texture.extent();
+		int const BlockCountX = (Extent.x + 3) / 4;
+
+		for(int y = 0; y < Extent.y; ++y)
+		for(int x = 0; x < Extent.x; ++x)
+		{
+			block_type const& Block = Texture.data<block_type>(0, 0, 0)[(y / 4) * BlockCountX + x / 4];
+			glm::vec4 const Expected = Decompress(Block).Texel[y % 4][x % 4];
+			Error += Fetch(Texture, gli::extent2d(x, y), 0, 0, 0) == Expected ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	gli::texture2d create(gli::format Format, gli::extent2d const& Extent, glm::uint32 Seed)
+	{
+		gli::texture2d Texture(Format, Extent, 1);
+		glm::uint8* const Data = Texture.data<glm::uint8>();
+		for(std::size_t i = 0; i < Texture.size(); ++i)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			Data[i] = static_cast<glm::uint8>(Seed >> 24);
+		}
+		return Texture;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		// 10x6 images have partially covered blocks
+		Error += check(create(gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8, gli::extent2d(10, 6), 1), gli::detail::decompress_dxt1_block);
+		Error += check(create(gli::FORMAT_RGBA_DXT3_UNORM_BLOCK16, gli::extent2d(10, 6), 2), gli::detail::decompress_dxt3_block);
+		Error += check(create(gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16, gli::extent2d(10, 6), 3), gli::detail::decompress_dxt5_block);
+		Error += check(create(gli::FORMAT_R_ATI1N_UNORM_BLOCK8, gli::extent2d(10, 6), 4), gli::detail::decompress_bc4unorm_block);
+		Error += check(create(gli::FORMAT_R_ATI1N_SNORM_BLOCK8, gli::extent2d(10, 6), 4), gli::detail::decompress_bc4snorm_block);
+		Error += check(create(gli::FORMAT_RG_ATI2N_UNORM_BLOCK16, gli::extent2d(10, 6), 5), gli::detail::decompress_bc5unorm_block);
+		Error += check(create(gli::FORMAT_RG_ATI2N_SNORM_BLOCK16, gli::extent2d(10, 6), 5), gli::detail::decompress_bc5snorm_block);
+		Error += check(create(gli::FORMAT_RGB_BP_UFLOAT_BLOCK16, gli::extent2d(10, 6), 8), gli::detail::decompress_bc6hufloat_block);
+		Error += check(create(gli::FORMAT_RGB_BP_SFLOAT_BLOCK16, gli::extent2d(10, 6), 9), gli::detail::decompress_bc6hsfloat_block);
+		Error += check(create(gli::FORMAT_RGBA_BP_UNORM_BLOCK16, gli::extent2d(10, 6), 10), gli::detail::decompress_bc7_block);
+		Error += check(create(gli::FORMAT_RGBA_BP_SRGB_BLOCK16, gli::extent2d(10, 6), 11), gli::detail::decompress_bc7_block);
+		Error += check(create(gli::FORMAT_RGB_ETC2_UNORM_BLOCK8, gli::extent2d(10, 6), 12), gli::detail::decompress_etc2_rgb_block);
+		Error += check(create(gli::FORMAT_RGBA_ETC2_UNORM_BLOCK8, gli::extent2d(10, 6), 13), gli::detail::decompress_etc2_rgba1_block);
+		Error += check(create(gli::FORMAT_RGBA_ETC2_UNORM_BLOCK16, gli::extent2d(10, 6), 14), gli::detail::decompress_etc2_rgba_block);
+		Error += check(create(gli::FORMAT_R_EAC_UNORM_BLOCK8, gli::extent2d(10, 6), 15), gli::detail::decompress_eac_r11unorm_block);
+		Error += check(create(gli::FORMAT_R_EAC_SNORM_BLOCK8, gli::extent2d(10, 6), 16), gli::detail::decompress_eac_r11snorm_block);
+		Error += check(create(gli::FORMAT_RG_EAC_UNORM_BLOCK16, gli::extent2d(10, 6), 17), gli::detail::decompress_eac_rg11unorm_block);
+		Error += check(create(gli::FORMAT_RG_EAC_SNORM_BLOCK16, gli::extent2d(10, 6), 18), gli::detail::decompress_eac_rg11snorm_block);
+		Error += check(create(gli::FORMAT_RGB_ETC_UNORM_BLOCK8, gli::extent2d(10, 6), 19), gli::detail::decompress_etc1_block);
+
+		// A block written after being decoded is decoded again
+		{
+			gli::texture2d Texture(create(gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8, gli::extent2d(8, 8), 6));
+			Error += check(Texture, gli::detail::decompress_dxt1_block);
+			Texture.data<gli::detail::dxt1_block>()[3].Color0 ^= 0x1234;
+			Texture.data<gli::detail::dxt1_block>()[3].Row[2] ^= 0xFF;
+			Error += check(Texture, gli::detail::decompress_dxt1_block);
+		}
+
+		// Each thread uses its own cache
+		{
+			gli::texture2d const Texture(create(gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16, gli::extent2d(64, 64), 7));
+			int Errors[4] = {0, 0, 0, 0};
+			std::vector<std::thread> Threads;
+			for(int ThreadIndex = 0; ThreadIndex < 4; ++ThreadIndex)
+				Threads.push_back(std::thread([&Texture, &Errors, ThreadIndex]()
+				{
+					Errors[ThreadIndex] = check(Texture, gli::detail::decompress_dxt5_block);
+				}));
+			for(std::size_t ThreadIndex = 0; ThreadIndex < Threads.size(); ++ThreadIndex)
+				Threads[ThreadIndex].join();
+			Error += Errors[0] + Errors[1] + Errors[2] + Errors[3];
+		}
+
+		return Error;
+	}
+}//namespace block_cache
+
+namespace bptc
+{
+	// Write the bits of a BC6H or BC7 block from the least significant bit of the first byte
+	class bit_writer
+	{
+	public:
+		bit_writer()
+			: Position(0)
+		{
+			std::memset(this->Data, 0, sizeof(this->Data));
+		}
+
+		void write(glm::uint32 Value, unsigned Count)
+		{
+			for(unsigned Bit = 0; Bit < Count; ++Bit, ++this->Position)
+				this->Data[this->Position / 8] |= static_cast<glm::uint8>(((Value >> Bit) & 1) << (this->Position % 8));
+		}
+
+		unsigned position() const
+		{
+			return this->Position;
+		}
+
+		glm::uint8 Data[16];
+
+	private:
+		unsigned Position;
+	};
+
+	// The anchor texels belong to the subset they are the anchor of
+	int test_anchors()
+	{
+		int Error = 0;
+
+		for(unsigned Partition = 0; Partition < 64; ++Partition)
+		{
+			Error += gli::detail::bptc_subset(2, Partition, 0) == 0 ? 0 : 1;
+			Error += gli::detail::bptc_subset(2, Partition, gli::detail::BPTC_ANCHOR2[Partition]) == 1 ? 0 : 1;
+			Error += gli::detail::bptc_subset(3, Partition, 0) == 0 ? 0 : 1;
+			Error += gli::detail::bptc_subset(3, Partition, gli::detail::BPTC_ANCHOR3[0][Partition]) == 1 ? 0 : 1;
+			Error += gli::detail::bptc_subset(3, Partition, gli::detail::BPTC_ANCHOR3[1][Partition]) == 2 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_bc7()
+	{
+		int Error = 0;
+
+		// Mode 6: one subset of RGBA 7 bits endpoints with a P bit and 4 bits indices
+		{
+			bit_writer Writer;
+			Writer.write(1 << 6, 7);
+			glm::uint32 const Endpoint0[4] = {10, 20, 30, 40};
+			glm::uint32 const Endpoint1[4] = {100, 110, 120, 127};
+			for(int Channel = 0; Channel < 4; ++Channel)
+			{
+				Writer.write(Endpoint0[Channel], 7);
+				Writer.write(Endpoint1[Channel], 7);
+			}
+			Writer.write(0, 1);
+			Writer.write(1, 1);
+			Writer.write(0, 3);
+			for(glm::uint32 Texel = 1; Texel < 16; ++Texel)
+				Writer.write(Texel, 4);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::bc7_block Block;
+			std::memcpy(Block.Data, Writer.Data, sizeof(Block.Data));
+
+			glm::u8vec4 Texels[16];
+			gli::detail::decode_bc7_block(Block, Texels);
+
+			glm::ivec4 const Color0(20, 40, 60, 80);
+			glm::ivec4 const Color1(201, 221, 241, 255);
+			for(int Texel = 0; Texel < 16; ++Texel)
+			{
+				int const Weight = gli::detail::BPTC_WEIGHT4[Texel];
+				glm::ivec4 const Expected = ((64 - Weight) * Color0 + Weight * Color1 + 32) >> 6;
+				Error += glm::ivec4(Texels[Texel]) == Expected ? 0 : 1;
+			}
+		}
+
+		// Every mode decodes to white when all the bits following the mode are set
+		for(int Mode = 0; Mode < 8; ++Mode)
+		{
+			gli::detail::bc7_block Block;
+			std::memset(Block.Data, 0xFF, sizeof(Block.Data));
+			Block.Data[0] = static_cast<glm::uint8>(0xFF << Mode);
+
+			glm::u8vec4 Texels[16];
+			gli::detail::decode_bc7_block(Block, Texels);
+			for(int Texel = 0; Texel < 16; ++Texel)
+				Error += Texels[Texel] == glm::u8vec4(255) ? 0 : 1;
+		}
+
+		// Every mode decodes to black when all the bits following the mode are clear, opaque for the modes without alpha
+		for(int Mode = 0; Mode < 8; ++Mode)
+		{
+			gli::detail::bc7_block Block;
+			std::memset(Block.Data, 0, sizeof(Block.Data));
+			Block.Data[0] = static_cast<glm::uint8>(1 << Mode);
+
+			glm::u8vec4 Texels[16];
+			gli::detail::decode_bc7_block(Block, Texels);
+			glm::uint8 const Alpha = gli::detail::BC7_MODES[Mode].AlphaBits ? 0 : 255;
+			for(int Texel = 0; Texel < 16; ++Texel)
+				Error += Texels[Texel] == glm::u8vec4(0, 0, 0, Alpha) ? 0 : 1;
+		}
+
+		// Reserved mode
+		{
+			gli::detail::bc7_block Block;
+			std::memset(Block.Data, 0xFF, sizeof(Block.Data));
+			Block.Data[0] = 0;
+
+			glm::u8vec4 Texels[16];
+			gli::detail::decode_bc7_block(Block, Texels);
+			for(int Texel = 0; Texel < 16; ++Texel)
+				Error += Texels[Texel] == glm::u8vec4(0) ? 0 : 1;
+		}
+
+		// Converting decodes the blocks
+		{
+			gli::texture2d Texture(gli::FORMAT_RGBA_BP_UNORM_BLOCK16, gli::extent2d(8, 4), 1);
+			for(std::size_t BlockIndex = 0; BlockIndex < 2; ++BlockIndex)
+			{
+				gli::detail::bc7_block& Block = Texture.data<gli::detail::bc7_block>()[BlockIndex];
+				for(std::size_t Byte = 0; Byte < sizeof(Block.Data); ++Byte)
+					Block.Data[Byte] = static_cast<glm::uint8>(Byte * 37 + BlockIndex * 11 + 1);
+			}
+
+			gli::texture2d const Converted = gli::convert(Texture, gli::FORMAT_RGBA8_UNORM_PACK8);
+
+			glm::u8vec4 Texels[32];
+			gli::detail::decode_bc7_blocks(Texture.data<gli::detail::bc7_block>(), 2, Texels);
+			for(int y = 0; y < 4; ++y)
+			for(int x = 0; x < 8; ++x)
+			{
+				glm::ivec4 const Expected(Texels[(x / 4) * 16 + y * 4 + x % 4]);
+				glm::ivec4 const Value(Converted.load<glm::u8vec4>(gli::extent2d(x, y), 0));
+				Error += glm::all(glm::lessThanEqual(glm::abs(Value - Expected), glm::ivec4(1))) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	// Write the endpoints of a BC7 block, the channels of every endpoint are stored one after the other
+	void write_bc7_endpoints(bit_writer& Writer, glm::uint32 const (*Endpoints)[4], unsigned EndpointCount, unsigned ColorBits, unsigned AlphaBits)
+	{
+		for(unsigned Channel = 0; Channel < (AlphaBits ? 4u : 3u); ++Channel)
+		for(unsigned Endpoint = 0; Endpoint < EndpointCount; ++Endpoint)
+			Writer.write(Endpoints[Endpoint][Channel], Channel < 3 ? ColorBits : AlphaBits);
+	}
+
+	// Write the indices of a BPTC block, the indices of the first texel and of the anchor texels are one bit shorter
+	void write_indices(bit_writer& Writer, glm::uint32 const* Indices, unsigned Bits, unsigned AnchorA, unsigned AnchorB)
+	{
+		for(unsigned Texel = 0; Texel < 16; ++Texel)
+			Writer.write(Indices[Texel], Texel == 0 || Texel == AnchorA || Texel == AnchorB ? Bits - 1 : Bits);
+	}
+
+	gli::detail::bc7_block make_bc7_block(bit_writer const& Writer)
+	{
+		gli::detail::bc7_block Block;
+		std::memcpy(Block.Data, Writer.Data, sizeof(Block.Data));
+		return Block;
+	}
+
+	// Reference blocks of each mode, the expected texels are computed from the BC7 specification
+	int test_bc7_modes()
+	{
+		int Error = 0;
+
+		glm::u8vec4 Texels[16];
+
+		// Mode 0: three subsets of 4 bits endpoints with a P bit each, partition 0
+		{
+			bit_writer Writer;
+			Writer.write(1, 1);
+			Writer.write(0, 4);
+			glm::uint32 const Endpoints[6][4] = {{1, 2, 3}, {15, 14, 13}, {4, 5, 6}, {0, 0, 0}, {7, 8, 9}, {10, 11, 12}};
+			write_bc7_endpoints(Writer, Endpoints, 6, 4, 0);
+			glm::uint32 const PBits[6] = {1, 0, 0, 1, 1, 0};
+			for(int Endpoint = 0; Endpoint < 6; ++Endpoint)
+				Writer.write(PBits[Endpoint], 1);
+			glm::uint32 Indices[16] = {0};
+			Indices[4] = 3;
+			Indices[5] = 7;
+			write_indices(Writer, Indices, 3, 3, 15);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc7_block(make_bc7_block(Writer), Texels);
+			Error += Texels[0] == glm::u8vec4(24, 41, 57, 255) ? 0 : 1;
+			Error += Texels[4] == glm::u8vec4(118, 121, 123, 255) ? 0 : 1;
+			Error += Texels[5] == glm::u8vec4(247, 231, 214, 255) ? 0 : 1;
+			Error += Texels[2] == glm::u8vec4(66, 82, 99, 255) ? 0 : 1;
+			Error += Texels[15] == glm::u8vec4(123, 140, 156, 255) ? 0 : 1;
+		}
+
+		// Mode 1: two subsets of 6 bits endpoints with a P bit shared by the subset, partition 0
+		{
+			bit_writer Writer;
+			Writer.write(2, 2);
+			Writer.write(0, 6);
+			glm::uint32 const Endpoints[4][4] = {{10, 20, 30}, {63, 50, 40}, {5, 0, 60}, {33, 44, 55}};
+			write_bc7_endpoints(Writer, Endpoints, 4, 6, 0);
+			Writer.write(1, 1);
+			Writer.write(0, 1);
+			glm::uint32 Indices[16] = {0};
+			Indices[1] = 4;
+			Indices[2] = 7;
+			Indices[15] = 3;
+			write_indices(Writer, Indices, 3, 15, 15);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc7_block(make_bc7_block(Writer), Texels);
+			Error += Texels[0] == glm::u8vec4(42, 82, 122, 255) ? 0 : 1;
+			Error += Texels[1] == glm::u8vec4(165, 152, 146, 255) ? 0 : 1;
+			Error += Texels[2] == glm::u8vec4(133, 177, 221, 255) ? 0 : 1;
+			Error += Texels[15] == glm::u8vec4(68, 75, 233, 255) ? 0 : 1;
+		}
+
+		// Mode 2: three subsets of 5 bits endpoints, partition 0
+		{
+			bit_writer Writer;
+			Writer.write(4, 3);
+			Writer.write(0, 6);
+			glm::uint32 const Endpoints[6][4] = {{1, 2, 3}, {31, 30, 29}, {8, 9, 10}, {20, 21, 22}, {16, 0, 31}, {0, 31, 16}};
+			write_bc7_endpoints(Writer, Endpoints, 6, 5, 0);
+			glm::uint32 Indices[16] = {0};
+			Indices[1] = 2;
+			Indices[3] = 1;
+			Indices[15] = 1;
+			write_indices(Writer, Indices, 2, 3, 15);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc7_block(make_bc7_block(Writer), Texels);
+			Error += Texels[0] == glm::u8vec4(8, 16, 24, 255) ? 0 : 1;
+			Error += Texels[1] == glm::u8vec4(174, 171, 168, 255) ? 0 : 1;
+			Error += Texels[3] == glm::u8vec4(98, 106, 114, 255) ? 0 : 1;
+			Error += Texels[9] == glm::u8vec4(132, 0, 255, 255) ? 0 : 1;
+			Error += Texels[15] == glm::u8vec4(89, 84, 215, 255) ? 0 : 1;
+		}
+
+		// Mode 3: two subsets of 7 bits endpoints with a P bit each, partition 2
+		{
+			bit_writer Writer;
+			Writer.write(8, 4);
+			Writer.write(2, 6);
+			glm::uint32 const Endpoints[4][4] = {{0, 64, 127}, {127, 64, 0}, {10, 20, 30}, {100, 90, 80}};
+			write_bc7_endpoints(Writer, Endpoints, 4, 7, 0);
+			glm::uint32 const PBits[4] = {0, 1, 1, 0};
+			for(int Endpoint = 0; Endpoint < 4; ++Endpoint)
+				Writer.write(PBits[Endpoint], 1);
+			glm::uint32 Indices[16] = {0};
+			Indices[1] = 2;
+			Indices[4] = 3;
+			Indices[15] = 1;
+			write_indices(Writer, Indices, 2, 15, 15);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc7_block(make_bc7_block(Writer), Texels);
+			Error += Texels[0] == glm::u8vec4(0, 128, 254, 255) ? 0 : 1;
+			Error += Texels[4] == glm::u8vec4(255, 129, 1, 255) ? 0 : 1;
+			Error += Texels[1] == glm::u8vec4(141, 134, 128, 255) ? 0 : 1;
+			Error += Texels[15] == glm::u8vec4(80, 87, 93, 255) ? 0 : 1;
+		}
+
+		// Mode 4: 5 bits colors and 6 bits alpha, the index selection interpolates the colors with the 3 bits indices, the rotation swaps the red and the alpha
+		{
+			bit_writer Writer;
+			Writer.write(16, 5);
+			Writer.write(1, 2);
+			Writer.write(1, 1);
+			glm::uint32 const Endpoints[2][4] = {{1, 2, 3, 60}, {31, 16, 8, 5}};
+			write_bc7_endpoints(Writer, Endpoints, 2, 5, 6);
+			glm::uint32 Indices[16] = {0};
+			Indices[0] = 1;
+			Indices[3] = 3;
+			write_indices(Writer, Indices, 2, 0, 0);
+			glm::uint32 SecondaryIndices[16] = {0};
+			SecondaryIndices[0] = 3;
+			SecondaryIndices[3] = 5;
+			write_indices(Writer, SecondaryIndices, 3, 0, 0);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc7_block(make_bc7_block(Writer), Texels);
+			Error += Texels[0] == glm::u8vec4(170, 65, 42, 112) ? 0 : 1;
+			Error += Texels[3] == glm::u8vec4(20, 99, 54, 186) ? 0 : 1;
+			Error += Texels[7] == glm::u8vec4(243, 16, 24, 8) ? 0 : 1;
+		}
+
+		// Mode 5: 7 bits colors and 8 bits alpha interpolated with separate indices, the rotation swaps the blue and the alpha
+		{
+			bit_writer Writer;
+			Writer.write(32, 6);
+			Writer.write(3, 2);
+			glm::uint32 const Endpoints[2][4] = {{1, 64, 127, 200}, {127, 0, 64, 10}};
+			write_bc7_endpoints(Writer, Endpoints, 2, 7, 8);
+			glm::uint32 Indices[16] = {0};
+			Indices[6] = 2;
+			write_indices(Writer, Indices, 2, 0, 0);
+			glm::uint32 SecondaryIndices[16] = {0};
+			SecondaryIndices[0] = 1;
+			SecondaryIndices[6] = 1;
+			write_indices(Writer, SecondaryIndices, 2, 0, 0);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc7_block(make_bc7_block(Writer), Texels);
+			Error += Texels[0] == glm::u8vec4(2, 129, 138, 255) ? 0 : 1;
+			Error += Texels[6] == glm::u8vec4(172, 42, 138, 170) ? 0 : 1;
+			Error += Texels[7] == glm::u8vec4(2, 129, 200, 255) ? 0 : 1;
+		}
+
+		// Mode 7: two subsets of RGBA 5 bits endpoints with a P bit each, partition 1
+		{
+			bit_writer Writer;
+			Writer.write(128, 8);
+			Writer.write(1, 6);
+			glm::uint32 const Endpoints[4][4] = {{1, 2, 3, 4}, {31, 30, 29, 28}, {16, 8, 4, 2}, {0, 31, 0, 31}};
+			write_bc7_endpoints(Writer, Endpoints, 4, 5, 5);
+			glm::uint32 const PBits[4] = {1, 0, 0, 1};
+			for(int Endpoint = 0; Endpoint < 4; ++Endpoint)
+				Writer.write(PBits[Endpoint], 1);
+			glm::uint32 Indices[16] = {0};
+			Indices[1] = 3;
+			Indices[3] = 2;
+			Indices[15] = 1;
+			write_indices(Writer, Indices, 2, 15, 15);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc7_block(make_bc7_block(Writer), Texels);
+			Error += Texels[0] == glm::u8vec4(12, 20, 28, 36) ? 0 : 1;
+			Error += Texels[1] == glm::u8vec4(251, 243, 235, 227) ? 0 : 1;
+			Error += Texels[3] == glm::u8vec4(45, 193, 13, 177) ? 0 : 1;
+			Error += Texels[15] == glm::u8vec4(89, 127, 23, 94) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	gli::detail::bc6h_block make_bc6h_mode11(glm::uint32 Endpoint0, glm::uint32 Endpoint1, glm::uint32 Index)
+	{
+		bit_writer Writer;
+		Writer.write(3, 5);
+		for(int Channel = 0; Channel < 3; ++Channel)
+			Writer.write(Endpoint0, 10);
+		for(int Channel = 0; Channel < 3; ++Channel)
+			Writer.write(Endpoint1, 10);
+		Writer.write(Index, 3);
+		for(int Texel = 1; Texel < 16; ++Texel)
+			Writer.write(Index, 4);
+
+		gli::detail::bc6h_block Block;
+		std::memcpy(Block.Data, Writer.Data, sizeof(Block.Data));
+		return Block;
+	}
+
+	int test_bc6h()
+	{
+		int Error = 0;
+
+		glm::u16vec3 Texels[16];
+
+		// Mode 11: untransformed 10 bits endpoints
+		gli::detail::decode_bc6h_block(make_bc6h_mode11(1023, 0, 0), false, Texels);
+		for(int Texel = 0; Texel < 16; ++Texel)
+			Error += Texels[Texel] == glm::u16vec3(0x7BFF) ? 0 : 1;
+
+		gli::detail::decode_bc6h_block(make_bc6h_mode11(0, 1023, 7), false, Texels);
+		Error += Texels[0] == glm::u16vec3(0x3A20) ? 0 : 1;
+
+		gli::detail::decode_bc6h_block(make_bc6h_mode11(512, 0, 0), false, Texels);
+		Error += Texels[5] == glm::u16vec3(0x3E0F) ? 0 : 1;
+
+		// Signed endpoints keep their sign
+		gli::detail::decode_bc6h_block(make_bc6h_mode11(1023, 0, 0), true, Texels);
+		Error += Texels[9] == glm::u16vec3(0x8000 | 93) ? 0 : 1;
+
+		// Mode 12: the second endpoint is a 9 bits delta to the first 11 bits endpoint
+		{
+			bit_writer Writer;
+			Writer.write(7, 5);
+			Writer.write(100, 10);
+			Writer.write(100, 10);
+			Writer.write(100, 10);
+			Writer.write(0x1FF, 9);
+			Writer.write(0, 1);
+			Writer.write(0x1FF, 9);
+			Writer.write(0, 1);
+			Writer.write(0x1FF, 9);
+			Writer.write(0, 1);
+			Writer.write(0, 3);
+			for(int Texel = 1; Texel < 16; ++Texel)
+				Writer.write(15, 4);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::bc6h_block Block;
+			std::memcpy(Block.Data, Writer.Data, sizeof(Block.Data));
+			gli::detail::decode_bc6h_block(Block, false, Texels);
+			Error += Texels[0] == glm::u16vec3(1557) ? 0 : 1;
+			Error += Texels[15] == glm::u16vec3(1542) ? 0 : 1;
+
+			glm::vec4 const Texel = gli::detail::decompress_bc6hufloat_block(Block).Texel[3][3];
+			Error += Texel == glm::vec4(glm::vec3(glm::unpackHalf1x16(1542)), 1.0f) ? 0 : 1;
+		}
+
+		// Reserved modes decode to zero
+		{
+			gli::detail::bc6h_block Block;
+			std::memset(Block.Data, 0xFF, sizeof(Block.Data));
+			Block.Data[0] = 0x13;
+			gli::detail::decode_bc6h_blocks(&Block, 1, false, Texels);
+			for(int Texel = 0; Texel < 16; ++Texel)
+				Error += Texels[Texel] == glm::u16vec3(0) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Write the bits Last down to First of Value, the modes 13 and 14 store the most significant bits of the first endpoint in reverse order
+	void write_reversed(bit_writer& Writer, glm::uint32 Value, unsigned First, unsigned Last)
+	{
+		for(unsigned Bit = Last + 1; Bit-- > First;)
+			Writer.write(Value >> Bit, 1);
+	}
+
+	gli::detail::bc6h_block make_bc6h_block(bit_writer const& Writer)
+	{
+		gli::detail::bc6h_block Block;
+		std::memcpy(Block.Data, Writer.Data, sizeof(Block.Data));
+		return Block;
+	}
+
+	// Reference blocks of each family of modes, the fields are written in the order of the BC6H specification
+	int test_bc6h_modes()
+	{
+		int Error = 0;
+
+		glm::u16vec3 Texels[16];
+
+		// Mode 1: two regions, 10 bits endpoint and 5 bits deltas scattered in the header, partition 0
+		{
+			glm::uint32 const RX = 5, GX = 29, BX = 15;
+			glm::uint32 const RY = 3, GY = 23, BY = 10;
+			glm::uint32 const RZ = 31, GZ = 12, BZ = 26;
+
+			bit_writer Writer;
+			Writer.write(0, 2);
+			Writer.write(GY >> 4, 1);
+			Writer.write(BY >> 4, 1);
+			Writer.write(BZ >> 4, 1);
+			Writer.write(100, 10);
+			Writer.write(200, 10);
+			Writer.write(300, 10);
+			Writer.write(RX, 5);
+			Writer.write(GZ >> 4, 1);
+			Writer.write(GY, 4);
+			Writer.write(GX, 5);
+			Writer.write(BZ, 1);
+			Writer.write(GZ, 4);
+			Writer.write(BX, 5);
+			Writer.write(BZ >> 1, 1);
+			Writer.write(BY, 4);
+			Writer.write(RY, 5);
+			Writer.write(BZ >> 2, 1);
+			Writer.write(RZ, 5);
+			Writer.write(BZ >> 3, 1);
+			Writer.write(0, 5);
+			glm::uint32 Indices[16] = {0};
+			Indices[1] = 7;
+			Indices[6] = 4;
+			Indices[15] = 3;
+			write_indices(Writer, Indices, 3, 15, 15);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc6h_block(make_bc6h_block(Writer), false, Texels);
+			Error += Texels[0] == glm::u16vec3(0x0C2B, 0x1847, 0x2463) ? 0 : 1;
+			Error += Texels[1] == glm::u16vec3(0x0CC6, 0x17EA, 0x2634) ? 0 : 1;
+			Error += Texels[2] == glm::u16vec3(0x0C88, 0x1730, 0x2599) ? 0 : 1;
+			Error += Texels[6] == glm::u16vec3(0x0C40, 0x18A8, 0x247A) ? 0 : 1;
+			Error += Texels[15] == glm::u16vec3(0x0C54, 0x1843, 0x24C8) ? 0 : 1;
+
+			gli::detail::decode_bc6h_block(make_bc6h_block(Writer), true, Texels);
+			Error += Texels[0] == glm::u16vec3(0x1857, 0x308F, 0x48C7) ? 0 : 1;
+			Error += Texels[1] == glm::u16vec3(0x198D, 0x2FD5, 0x4C69) ? 0 : 1;
+			Error += Texels[2] == glm::u16vec3(0x1911, 0x2E61, 0x4B33) ? 0 : 1;
+			Error += Texels[6] == glm::u16vec3(0x1881, 0x3151, 0x48F5) ? 0 : 1;
+			Error += Texels[15] == glm::u16vec3(0x18A8, 0x3086, 0x4990) ? 0 : 1;
+		}
+
+		// Mode 10: two regions of untransformed 6 bits endpoints, partition 1
+		{
+			glm::uint32 const RW = 1, GW = 62, BW = 33;
+			glm::uint32 const RX = 63, GX = 0, BX = 20;
+			glm::uint32 const RY = 45, GY = 17, BY = 5;
+			glm::uint32 const RZ = 8, GZ = 40, BZ = 60;
+
+			bit_writer Writer;
+			Writer.write(30, 5);
+			Writer.write(RW, 6);
+			Writer.write(GZ >> 4, 1);
+			Writer.write(BZ, 1);
+			Writer.write(BZ >> 1, 1);
+			Writer.write(BY >> 4, 1);
+			Writer.write(GW, 6);
+			Writer.write(GY >> 5, 1);
+			Writer.write(BY >> 5, 1);
+			Writer.write(BZ >> 2, 1);
+			Writer.write(GY >> 4, 1);
+			Writer.write(BW, 6);
+			Writer.write(GZ >> 5, 1);
+			Writer.write(BZ >> 3, 1);
+			Writer.write(BZ >> 5, 1);
+			Writer.write(BZ >> 4, 1);
+			Writer.write(RX, 6);
+			Writer.write(GY, 4);
+			Writer.write(GX, 6);
+			Writer.write(GZ, 4);
+			Writer.write(BX, 6);
+			Writer.write(BY, 4);
+			Writer.write(RY, 6);
+			Writer.write(RZ, 6);
+			Writer.write(1, 5);
+			glm::uint32 Indices[16] = {0};
+			Indices[2] = 5;
+			Indices[3] = 7;
+			Indices[15] = 3;
+			write_indices(Writer, Indices, 3, 15, 15);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc6h_block(make_bc6h_block(Writer), false, Texels);
+			Error += Texels[0] == glm::u16vec3(0x02E8, 0x7918, 0x40E8) ? 0 : 1;
+			Error += Texels[2] == glm::u16vec3(0x59F0, 0x220E, 0x2ECD) ? 0 : 1;
+			Error += Texels[3] == glm::u16vec3(0x1078, 0x4E78, 0x7538) ? 0 : 1;
+			Error += Texels[15] == glm::u16vec3(0x39E9, 0x34B4, 0x379C) ? 0 : 1;
+
+			// Signed endpoints are sign extended from 6 bits
+			gli::detail::decode_bc6h_block(make_bc6h_block(Writer), true, Texels);
+			Error += Texels[0] == glm::u16vec3(0x05D0, 0x89B0, 0xFBFF) ? 0 : 1;
+			Error += Texels[2] == glm::u16vec3(0x828B, 0x82B9, 0x1638) ? 0 : 1;
+			Error += Texels[3] == glm::u16vec3(0x20F0, 0xDEF0, 0x9170) ? 0 : 1;
+			Error += Texels[15] == glm::u16vec3(0x9DCA, 0x80D9, 0x04F7) ? 0 : 1;
+		}
+
+		// Mode 13: one region, 12 bits endpoint and 8 bits delta
+		{
+			glm::uint32 const RW = 2053, GW = 1324, BW = 3079;
+
+			bit_writer Writer;
+			Writer.write(11, 5);
+			Writer.write(RW, 10);
+			Writer.write(GW, 10);
+			Writer.write(BW, 10);
+			Writer.write(0xFB, 8);
+			write_reversed(Writer, RW, 10, 11);
+			Writer.write(100, 8);
+			write_reversed(Writer, GW, 10, 11);
+			Writer.write(0x80, 8);
+			write_reversed(Writer, BW, 10, 11);
+			glm::uint32 Indices[16] = {0};
+			Indices[1] = 8;
+			Indices[15] = 15;
+			write_indices(Writer, Indices, 4, 0, 0);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc6h_block(make_bc6h_block(Writer), false, Texels);
+			Error += Texels[0] == glm::u16vec3(0x3E2A, 0x2818, 0x5D3A) ? 0 : 1;
+			Error += Texels[1] == glm::u16vec3(0x3E16, 0x29B4, 0x5B2B) ? 0 : 1;
+			Error += Texels[15] == glm::u16vec3(0x3E03, 0x2B1F, 0x595A) ? 0 : 1;
+		}
+
+		// Mode 14: one region, 16 bits endpoint and 4 bits delta
+		{
+			glm::uint32 const RW = 0x9400, GW = 3075, BW = 8533;
+
+			bit_writer Writer;
+			Writer.write(15, 5);
+			Writer.write(RW, 10);
+			Writer.write(GW, 10);
+			Writer.write(BW, 10);
+			Writer.write(7, 4);
+			write_reversed(Writer, RW, 10, 15);
+			Writer.write(8, 4);
+			write_reversed(Writer, GW, 10, 15);
+			Writer.write(15, 4);
+			write_reversed(Writer, BW, 10, 15);
+			glm::uint32 Indices[16] = {0};
+			Indices[1] = 8;
+			Indices[15] = 15;
+			write_indices(Writer, Indices, 4, 0, 0);
+			Error += Writer.position() == 128 ? 0 : 1;
+
+			gli::detail::decode_bc6h_block(make_bc6h_block(Writer), false, Texels);
+			Error += Texels[0] == glm::u16vec3(0x47B0, 0x05D1, 0x1025) ? 0 : 1;
+			Error += Texels[1] == glm::u16vec3(0x47B1, 0x05CF, 0x1024) ? 0 : 1;
+			Error += Texels[15] == glm::u16vec3(0x47B3, 0x05CD, 0x1024) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_anchors();
+		Error += test_bc7();
+		Error += test_bc7_modes();
+		Error += test_bc6h();
+		Error += test_bc6h_modes();
+
+		return Error;
+	}
+}//namespace bptc
+
+namespace etc
+{
+	template <typename block_type>
+	block_type make_block(glm::uint8 const (&Data)[8])
+	{
+		block_type Block;
+		std::memcpy(&Block, Data, sizeof(Data));
+		return Block;
+	}
+
+	glm::u8vec4 decode(glm::uint8 const (&Data)[8], bool PunchThrough, int Row, int Col)
+	{
+		glm::u8vec4 Texels[16];
+		gli::detail::decode_etc2_rgb_block(make_block<gli::detail::etc2_rgb_block>(Data), PunchThrough, Texels, 4);
+		return Texels[Row * 4 + Col];
+	}
+
+	int test_etc2()
+	{
+		int Error = 0;
+
+		// Individual mode, side by side sub-blocks
+		{
+			glm::uint8 const Data[8] = {0xA5, 0x3C, 0x1F, 0x1C, 0x01, 0x00, 0x01, 0x02};
+			Error += decode(Data, false, 0, 0) == glm::u8vec4(172, 53, 19, 255) ? 0 : 1;
+			Error += decode(Data, false, 1, 0) == glm::u8vec4(178, 59, 25, 255) ? 0 : 1;
+			Error += decode(Data, false, 0, 2) == glm::u8vec4(0, 21, 72, 255) ? 0 : 1;
+			Error += decode(Data, false, 3, 3) == glm::u8vec4(132, 251, 255, 255) ? 0 : 1;
+		}
+
+		// Differential mode, sub-blocks on top of each other
+		{
+			glm::uint8 const Data[8] = {0x87, 0x43, 0xF8, 0x2B, 0x00, 0x00, 0x00, 0x00};
+			Error += decode(Data, false, 1, 3) == glm::u8vec4(137, 71, 255, 255) ? 0 : 1;
+			Error += decode(Data, false, 2, 0) == glm::u8vec4(132, 99, 255, 255) ? 0 : 1;
+
+			// Opaque block with punch-through alpha
+			Error += decode(Data, true, 2, 0) == glm::u8vec4(132, 99, 255, 255) ? 0 : 1;
+		}
+
+		// Punch-through alpha block which isn't opaque
+		{
+			glm::uint8 const Data[8] = {0x87, 0x43, 0xF8, 0x29, 0x00, 0x01, 0x00, 0x00};
+			Error += decode(Data, true, 0, 0) == glm::u8vec4(0) ? 0 : 1;
+			Error += decode(Data, true, 1, 0) == glm::u8vec4(132, 66, 255, 255) ? 0 : 1;
+		}
+
+		// T mode
+		{
+			glm::uint8 const Data[8] = {0xFB, 0x80, 0x44, 0x46, 0x11, 0x00, 0x10, 0x10};
+			Error += decode(Data, false, 0, 0) == glm::u8vec4(255, 136, 0, 255) ? 0 : 1;
+			Error += decode(Data, false, 0, 1) == glm::u8vec4(79, 79, 79, 255) ? 0 : 1;
+			Error += decode(Data, false, 0, 2) == glm::u8vec4(68, 68, 68, 255) ? 0 : 1;
+			Error += decode(Data, false, 0, 3) == glm::u8vec4(57, 57, 57, 255) ? 0 : 1;
+		}
+
+		// H mode
+		{
+			glm::uint8 const Data[8] = {0x40, 0xF2, 0x91, 0xA6, 0x11, 0x00, 0x10, 0x10};
+			Error += decode(Data, false, 0, 0) == glm::u8vec4(168, 49, 117, 255) ? 0 : 1;
+			Error += decode(Data, false, 0, 1) == glm::u8vec4(104, 0, 53, 255) ? 0 : 1;
+			Error += decode(Data, false, 0, 2) == glm::u8vec4(66, 83, 100, 255) ? 0 : 1;
+			Error += decode(Data, false, 0, 3) == glm::u8vec4(2, 19, 36, 255) ? 0 : 1;
+		}
+
+		// Planar mode
+		{
+			glm::uint8 const Data[8] = {0x00, 0x00, 0x04, 0x7F, 0x00, 0x00, 0x1F, 0xFF};
+			Error += decode(Data, false, 0, 0) == glm::u8vec4(0, 0, 0, 255) ? 0 : 1;
+			Error += decode(Data, false, 2, 1) == glm::u8vec4(64, 128, 128, 255) ? 0 : 1;
+			Error += decode(Data, false, 3, 3) == glm::u8vec4(191, 191, 191, 255) ? 0 : 1;
+		}
+
+		// Decoding a row of blocks matches decoding each block
+		{
+			gli::detail::etc2_rgb_block Blocks[2];
+			glm::uint8 const Data0[8] = {0xA5, 0x3C, 0x1F, 0x1C, 0x01, 0x00, 0x01, 0x02};
+			glm::uint8 const Data1[8] = {0xFB, 0x80, 0x44, 0x46, 0x11, 0x00, 0x10, 0x10};
+			Blocks[0] = make_block<gli::detail::etc2_rgb_block>(Data0);
+			Blocks[1] = make_block<gli::detail::etc2_rgb_block>(Data1);
+
+			std::size_t const RowPitch = 10;
+			glm::u8vec4 Texels[4 * RowPitch];
+			gli::detail::decode_etc2_rgb_row(Blocks, 2, false, Texels, RowPitch);
+
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 8; ++Col)
+				Error += Texels[Row * RowPitch + Col] == decode(Col < 4 ? Data0 : Data1, false, Row, Col % 4) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_eac()
+	{
+		int Error = 0;
+
+		glm::int16 Red[16];
+
+		{
+			glm::uint8 const Data[8] = {100, 0x20, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+			gli::detail::decode_eac_r11_block(make_block<gli::detail::eac_block>(Data), false, Red, 4);
+			Error += Red[0] == 756 ? 0 : 1;
+			Error += Red[5] == 1028 ? 0 : 1;
+		}
+
+		// A multiplier of zero scales the modifiers by 1/8, the values are clamped
+		{
+			glm::uint8 const Data[8] = {255, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+			gli::detail::decode_eac_r11_block(make_block<gli::detail::eac_block>(Data), false, Red, 4);
+			Error += Red[0] == 2047 ? 0 : 1;
+		}
+
+		// The signed base -128 is read as -127
+		{
+			glm::uint8 const Data[8] = {0x80, 0x10, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB};
+			gli::detail::decode_eac_r11_block(make_block<gli::detail::eac_block>(Data), true, Red, 4);
+			Error += Red[0] == -1023 ? 0 : 1;
+
+			glm::vec4 const Texel = gli::detail::decompress_eac_r11snorm_block(make_block<gli::detail::eac_block>(Data)).Texel[2][1];
+			Error += Texel == glm::vec4(-1, 0, 0, 1) ? 0 : 1;
+		}
+
+		// Alpha of ETC2 RGBA blocks
+		{
+			glm::uint8 const Alpha[8] = {200, 0x3D, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+			glm::uint8 const Color[8] = {0x87, 0x43, 0xF8, 0x2B, 0x00, 0x00, 0x00, 0x00};
+
+			gli::detail::etc2_rgba_block Block;
+			Block.Alpha = make_block<gli::detail::eac_block>(Alpha);
+			Block.Color = make_block<gli::detail::etc2_rgb_block>(Color);
+
+			glm::u8vec4 Texels[16];
+			gli::detail::decode_etc2_rgba_block(Block, Texels, 4);
+			Error += Texels[0] == glm::u8vec4(137, 71, 255, 197) ? 0 : 1;
+			Error += Texels[15] == glm::u8vec4(132, 99, 255, 227) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// The decoded fixtures are close to the channels of the uncompressed image, the signed fixtures store positive values only
+	int test_eac_fixtures()
+	{
+		int Error = 0;
+
+		Error += mean_error("kueken7_r_eac_unorm.ktx", "kueken7_rgba8_unorm.dds", gli::FORMAT_RGBA8_UNORM_PACK8, 1) < 2.0f ? 0 : 1;
+		Error += mean_error("kueken7_rg_eac_unorm.ktx", "kueken7_rgba8_unorm.dds", gli::FORMAT_RGBA8_UNORM_PACK8, 2) < 2.0f ? 0 : 1;
+		Error += mean_error("kueken7_r_eac_snorm.ktx", "kueken7_rgba8_unorm.dds", gli::FORMAT_RGBA8_UNORM_PACK8, 1) < 2.0f ? 0 : 1;
+		Error += mean_error("kueken7_rg_eac_snorm.ktx", "kueken7_rgba8_unorm.dds", gli::FORMAT_RGBA8_UNORM_PACK8, 2) < 2.0f ? 0 : 1;
+
+		return Error;
+	}
+
+	// The decoded fixtures are close to the uncompressed image
+	int test_etc2_fixtures()
+	{
+		int Error = 0;
+
+		Error += mean_error("kueken7_rgb_etc1_unorm.ktx", "kueken7_rgba8_unorm.dds", gli::FORMAT_RGBA8_UNORM_PACK8, 3) < 4.5f ? 0 : 1;
+		Error += mean_error("kueken7_rgb_etc2_srgb.ktx", "kueken7_rgba8_srgb.dds", gli::FORMAT_RGBA8_SRGB_PACK8, 3) < 4.5f ? 0 : 1;
+		Error += mean_error("kueken7_rgba_etc2_srgb.ktx", "kueken7_rgba8_srgb.dds", gli::FORMAT_RGBA8_SRGB_PACK8, 4) < 4.0f ? 0 : 1;
+		Error += mean_error("kueken7_rgba_etc2_a1_srgb.ktx", "kueken7_rgba8_srgb.dds", gli::FORMAT_RGBA8_SRGB_PACK8, 4) < 4.0f ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_etc2();
+		Error += test_etc2_fixtures();
+		Error += test_eac();
+		Error += test_eac_fixtures();
+
+		return Error;
+	}
+}//namespace etc
+
+namespace astc
+{
+	// Build blocks bit by bit, the weights being written from the last bit of the block in reverse order
+	struct block_builder
+	{
+		block_builder()
+		{
+			std::memset(this->Block.Data, 0, sizeof(this->Block.Data));
+		}
+
+		void write(unsigned Position, glm::uint32 Value, unsigned Count)
+		{
+			for(unsigned Bit = 0; Bit < Count; ++Bit)
+				this->Block.Data[(Position + Bit) / 8] |= static_cast<glm::uint8>(((Value >> Bit) & 1) << ((Position + Bit) % 8));
+		}
+
+		void write_weight(unsigned Index, glm::uint32 Value, unsigned Bits)
+		{
+			for(unsigned Bit = 0; Bit < Bits; ++Bit)
+				this->write(127 - (Index * Bits + Bit), (Value >> Bit) & 1, 1);
+		}
+
+		gli::detail::astc_block Block;
+	};
+
+	gli::detail::astc_block void_extent(bool HDR, glm::u16vec4 const& Color)
+	{
+		block_builder Builder;
+		Builder.write(0, 0x1FC, 9);
+		Builder.write(9, HDR ? 1 : 0, 1);
+		Builder.write(10, 3, 2);
+		Builder.write(12, 0xFFFFFFFF, 32);
+		Builder.write(44, 0xFFFFF, 20);
+		for(int Component = 0; Component < 4; ++Component)
+			Builder.write(64 + Component * 16, Color[Component], 16);
+		return Builder.Block;
+	}
+
+	float interpolate(int E0, int E1, int Weight)
+	{
+		return static_cast<float>((E0 * 257 * (64 - Weight) + E1 * 257 * Weight + 32) >> 6) / 65535.0f;
+	}
+
+	// Each integer sequence encoding code decodes to valid digits and every combination of digits has a code
+	int test_ise()
+	{
+		int Error = 0;
+
+		std::vector<int> TritCodes(243, 0);
+		for(unsigned T = 0; T < 256; ++T)
+		{
+			unsigned Trits[5];
+			gli::detail::astc_decode_trits(T, Trits);
+			unsigned Combination = 0;
+			for(int Index = 4; Index >= 0; --Index)
+			{
+				Error += Trits[Index] < 3 ? 0 : 1;
+				Combination = Combination * 3 + glm::min(Trits[Index], 2u);
+			}
+			TritCodes[Combination] = 1;
+		}
+		Error += std::count(TritCodes.begin(), TritCodes.end(), 1) == 243 ? 0 : 1;
+
+		std::vector<int> QuintCodes(125, 0);
+		for(unsigned Q = 0; Q < 128; ++Q)
+		{
+			unsigned Quints[3];
+			gli::detail::astc_decode_quints(Q, Quints);
+			unsigned Combination = 0;
+			for(int Index = 2; Index >= 0; --Index)
+			{
+				Error += Quints[Index] < 5 ? 0 : 1;
+				Combination = Combination * 5 + glm::min(Quints[Index], 4u);
+			}
+			QuintCodes[Combination] = 1;
+		}
+		Error += std::count(QuintCodes.begin(), QuintCodes.end(), 1) == 125 ? 0 : 1;
+
+		return Error;
+	}
+
+	// Each range unquantizes to distinct values spanning the whole interval
+	int test_unquantize()
+	{
+		int Error = 0;
+
+		for(unsigned Range = 0; Range < 21; ++Range)
+		{
+			gli::detail::astc_range const& R = gli::detail::ASTC_RANGES[Range];
+			unsigned const Levels = (R.Trits ? 3 : R.Quints ? 5 : 1) << R.Bits;
+
+			std::vector<unsigned> Colors, Weights;
+			for(unsigned Digit = 0; Digit < (R.Trits ? 3u : R.Quints ? 5u : 1u); ++Digit)
+			for(unsigned Bits = 0; Bits < (1u << R.Bits); ++Bits)
+			{
+				unsigned const Value = (Digit << R.Bits) | Bits;
+				if(Range >= gli::detail::ASTC_MIN_COLOR_RANGE)
+					Colors.push_back(gli::detail::astc_unquantize_color(Value, Range));
+				if(Range < 12)
+					Weights.push_back(gli::detail::astc_unquantize_weight(Value, Range));
+			}
+
+			std::sort(Colors.begin(), Colors.end());
+			std::sort(Weights.begin(), Weights.end());
+			if(!Colors.empty())
+			{
+				Error += Colors.size() == Levels && Colors.front() == 0 && Colors.back() == 255 ? 0 : 1;
+				Error += std::unique(Colors.begin(), Colors.end()) == Colors.end() ? 0 : 1;
+			}
+			if(!Weights.empty())
+			{
+				Error += Weights.size() == Levels && Weights.front() == 0 && Weights.back() == 64 ? 0 : 1;
+				Error += std::unique(Weights.begin(), Weights.end()) == Weights.end() ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	int test_void_extent()
+	{
+		int Error = 0;
+
+		glm::vec4 Texels[36];
+
+		gli::detail::decode_astc_block<6, 6>(void_extent(false, glm::u16vec4(0xFFFF, 0x8000, 0, 0xFFFF)), false, Texels, 6);
+		for(int Texel = 0; Texel < 36; ++Texel)
+			Error += Texels[Texel] == glm::vec4(1.0f, 32768.0f / 65535.0f, 0.0f, 1.0f) ? 0 : 1;
+
+		gli::detail::decode_astc_block<6, 6>(void_extent(false, glm::u16vec4(0xFFFF, 0x8000, 0, 0xFFFF)), true, Texels, 6);
+		Error += Texels[35] == glm::vec4(1.0f, 128.0f / 255.0f, 0.0f, 1.0f) ? 0 : 1;
+
+		gli::detail::decode_astc_block<6, 6>(void_extent(true, glm::u16vec4(0x4000, 0x3C00, 0x3800, 0x3C00)), false, Texels, 6);
+		Error += Texels[7] == glm::vec4(2.0f, 1.0f, 0.5f, 1.0f) ? 0 : 1;
+
+		// HDR blocks are errors in sRGB formats
+		gli::detail::decode_astc_block<6, 6>(void_extent(true, glm::u16vec4(0x4000, 0x3C00, 0x3800, 0x3C00)), true, Texels, 6);
+		Error += Texels[7] == glm::vec4(1, 0, 1, 1) ? 0 : 1;
+
+		// Reserved block mode
+		gli::detail::decode_astc_block<6, 6>(block_builder().Block, false, Texels, 6);
+		Error += Texels[0] == glm::vec4(1, 0, 1, 1) ? 0 : 1;
+
+		return Error;
+	}
+
+	// A single partition block with a 4x4 grid of 2 bits weights and direct RGB endpoints of 8 bits
+	block_builder rgb_block(glm::uint32 Mode, glm::ivec3 const& E0, glm::ivec3 const& E1)
+	{
+		block_builder Builder;
+		Builder.write(0, 0x42, 11);
+		Builder.write(13, Mode, 4);
+		for(int Component = 0; Component < 3; ++Component)
+		{
+			Builder.write(17 + Component * 16, static_cast<glm::uint32>(E0[Component]), 8);
+			Builder.write(25 + Component * 16, static_cast<glm::uint32>(E1[Component]), 8);
+		}
+		for(unsigned Weight = 0; Weight < 16; ++Weight)
+			Builder.write_weight(Weight, Weight % 4, 2);
+		return Builder;
+	}
+
+	int test_endpoints()
+	{
+		int Error = 0;
+
+		static int const WEIGHTS[4] = {0, 21, 43, 64};
+
+		{
+			glm::vec4 Texels[16];
+			gli::detail::decode_astc_block<4, 4>(rgb_block(8, glm::ivec3(10, 20, 30), glm::ivec3(250, 200, 100)).Block, false, Texels, 4);
+			for(int Texel = 0; Texel < 16; ++Texel)
+			{
+				int const Weight = WEIGHTS[Texel % 4];
+				Error += Texels[Texel] == glm::vec4(interpolate(10, 250, Weight), interpolate(20, 200, Weight), interpolate(30, 100, Weight), 1.0f) ? 0 : 1;
+			}
+			Error += Texels[0] == glm::vec4(10, 20, 30, 255) / 255.0f ? 0 : 1;
+			Error += Texels[3] == glm::vec4(250, 200, 100, 255) / 255.0f ? 0 : 1;
+		}
+
+		// Blue contraction when the second endpoint is darker
+		{
+			glm::vec4 Texels[16];
+			gli::detail::decode_astc_block<4, 4>(rgb_block(8, glm::ivec3(250, 200, 100), glm::ivec3(10, 20, 30)).Block, false, Texels, 4);
+			Error += Texels[0] == glm::vec4(20, 25, 30, 255) / 255.0f ? 0 : 1;
+			Error += Texels[3] == glm::vec4(175, 150, 100, 255) / 255.0f ? 0 : 1;
+		}
+
+		// sRGB formats decode the top 8 bits of the interpolated values
+		{
+			glm::vec4 Texels[16];
+			gli::detail::decode_astc_block<4, 4>(rgb_block(8, glm::ivec3(10, 20, 30), glm::ivec3(250, 200, 100)).Block, true, Texels, 4);
+			Error += Texels[0] == glm::vec4(10, 20, 30, 255) / 255.0f ? 0 : 1;
+			Error += Texels[3] == glm::vec4(250, 200, 100, 255) / 255.0f ? 0 : 1;
+		}
+
+		// HDR luminance endpoints, 1.0 and 2.0
+		{
+			glm::vec4 Texels[16];
+			gli::detail::decode_astc_block<4, 4>(rgb_block(2, glm::ivec3(0x78, 0, 0), glm::ivec3(0x80, 0, 0)).Block, false, Texels, 4);
+			Error += Texels[0] == glm::vec4(1.0f) ? 0 : 1;
+			Error += Texels[3] == glm::vec4(2.0f, 2.0f, 2.0f, 1.0f) ? 0 : 1;
+
+			gli::detail::decode_astc_block<4, 4>(rgb_block(2, glm::ivec3(0x78, 0, 0), glm::ivec3(0x80, 0, 0)).Block, true, Texels, 4);
+			Error += Texels[0] == glm::vec4(1, 0, 1, 1) ? 0 : 1;
+		}
+
+		// A 6x6 footprint infills the 4x4 weight grid, exact on the corners
+		{
+			glm::vec4 Texels[36];
+			gli::detail::decode_astc_block<6, 6>(rgb_block(8, glm::ivec3(0), glm::ivec3(255)).Block, false, Texels, 6);
+			Error += Texels[0] == glm::vec4(0, 0, 0, 1) ? 0 : 1;
+			Error += Texels[5] == glm::vec4(1) ? 0 : 1;
+			Error += Texels[30] == glm::vec4(0, 0, 0, 1) ? 0 : 1;
+			Error += Texels[35] == glm::vec4(1) ? 0 : 1;
+			for(int Texel = 1; Texel < 5; ++Texel)
+				Error += Texels[Texel].x >= Texels[Texel - 1].x ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Texels select the endpoints of their partition
+	int test_partitions()
+	{
+		int Error = 0;
+
+		for(glm::uint32 PartitionIndex = 0; PartitionIndex < 1024; PartitionIndex += 37)
+		{
+			block_builder Builder;
+			Builder.write(0, 0x42, 11);
+			Builder.write(11, 1, 2);
+			Builder.write(13, PartitionIndex, 10);
+			Builder.write(23, 4 << 2, 6);
+			for(glm::uint32 Value = 0; Value < 8; ++Value)
+				Builder.write(29 + Value * 8, Value * 29 + 7, 8);
+
+			glm::vec4 Texels[16];
+			gli::detail::decode_astc_block<4, 4>(Builder.Block, false, Texels, 4);
+
+			// Luminance and alpha endpoints of 8 bits, all the weights are zero
+			for(unsigned Texel = 0; Texel < 16; ++Texel)
+			{
+				unsigned const Partition = gli::detail::astc_select_partition(PartitionIndex, Texel % 4, Texel / 4, 0, 2, true);
+				float const Luminance = static_cast<float>(Partition * 4 * 29 + 7) / 255.0f;
+				float const Alpha = static_cast<float>((Partition * 4 + 2) * 29 + 7) / 255.0f;
+				glm::vec4 const Expected(Luminance, Luminance, Luminance, Alpha);
+				Error += Texels[Texel] == Expected ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	// Compare each fetch with a direct decoding of its block
+	int check(gli::format Format, gli::extent2d const& Extent, glm::uint32 Seed)
+	{
+		int Error = 0;
+
+		gli::texture2d const Texture(block_cache::create(Format, Extent, Seed));
+		block_cache::convert::fetchFunc const Fetch = block_cache::convert::call(Format).Fetch;
+		gli::extent2d const BlockExtent(gli::block_extent(Format));
+		gli::extent2d const BlockCount((Extent + BlockExtent - 1) / BlockExtent);
+
+		std::vector<glm::vec4> Texels(BlockCount.x * BlockExtent.x * BlockExtent.y);
+		for(int BlockY = 0; BlockY < BlockCount.y; ++BlockY)
+		{
+			gli::detail::decode_astc_row(Texture.data<gli::detail::astc_block>(0, 0, 0) + BlockY * BlockCount.x, BlockCount.x, BlockExtent, gli::is_srgb(Format), &Texels[0], BlockCount.x * BlockExtent.x);
+
+			for(int y = BlockY * BlockExtent.y; y < glm::min((BlockY + 1) * BlockExtent.y, Extent.y); ++y)
+			for(int x = 0; x < Extent.x; ++x)
+			{
+				glm::vec4 const Expected = Texels[(y - BlockY * BlockExtent.y) * BlockCount.x * BlockExtent.x + x];
+				glm::vec4 const Texel = Fetch(Texture, gli::extent2d(x, y), 0, 0, 0);
+				Error += glm::all(glm::equal(Texel, Expected)) || glm::any(glm::isnan(Expected)) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	// The decoded fixtures are close to the uncompressed image, the error grows with the block size
+	int test_fixtures()
+	{
+		int Error = 0;
+
+		Error += mean_error("kueken7_rgba_astc4x4_srgb.ktx", "kueken7_rgba8_srgb.dds", gli::FORMAT_RGBA8_SRGB_PACK8, 4) < 3.0f ? 0 : 1;
+		Error += mean_error("kueken7_rgba_astc8x5_srgb.ktx", "kueken7_rgba8_srgb.dds", gli::FORMAT_RGBA8_SRGB_PACK8, 4) < 4.5f ? 0 : 1;
+		Error += mean_error("kueken7_rgba_astc12x12_srgb.ktx", "kueken7_rgba8_srgb.dds", gli::FORMAT_RGBA8_SRGB_PACK8, 4) < 5.0f ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_ise();
+		Error += test_unquantize();
+		Error += test_void_extent();
+		Error += test_endpoints();
+		Error += test_partitions();
+
+		for(int FormatIndex = 0; FormatIndex < 28; ++FormatIndex)
+			Error += check(static_cast<gli::format>(gli::FORMAT_RGBA_ASTC_4X4_UNORM_BLOCK16 + FormatIndex), gli::extent2d(26, 14), 20 + FormatIndex);
+
+		Error += test_fixtures();
+
+		return Error;
+	}
+}//namespace astc
+
+namespace bc7_encoder
+{
+	// Sum of the squared differences between the texels of a block and the decoding of their encoding
+	int encode(glm::u8vec4 const* Texels, gli::encode_preset Preset, int& MaxDifference)
+	{
+		gli::detail::bc7_block Block;
+		gli::detail::encode_bc7_block(Texels, gli::detail::BC7_ENCODER_PRESETS[Preset], Block);
+
+		glm::u8vec4 Decoded[16];
+		gli::detail::decode_bc7_block(Block, Decoded);
+
+		int SquaredError = 0;
+		for(int TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+		{
+			glm::ivec4 const Difference = glm::abs(glm::ivec4(Decoded[TexelIndex]) - glm::ivec4(Texels[TexelIndex]));
+			MaxDifference = glm::max(MaxDifference, glm::compMax(Difference));
+			SquaredError += Difference.x * Difference.x + Difference.y * Difference.y + Difference.z * Difference.z + Difference.w * Difference.w;
+		}
+		return SquaredError;
+	}
+
+	glm::uint32 random(glm::uint32& Seed)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return Seed >> 24;
+	}
+
+	// Blocks of a single color
+	int test_constant()
+	{
+		int Error = 0;
+
+		glm::u8vec4 const Colors[] = {glm::u8vec4(0), glm::u8vec4(255), glm::u8vec4(1, 2, 3, 255), glm::u8vec4(200, 17, 96, 255), glm::u8vec4(31, 140, 255, 77)};
+		for(std::size_t ColorIndex = 0; ColorIndex < sizeof(Colors) / sizeof(Colors[0]); ++ColorIndex)
+		for(int Preset = gli::ENCODE_PRESET_FIRST; Preset <= gli::ENCODE_PRESET_LAST; ++Preset)
+		{
+			glm::u8vec4 Texels[16];
+			std::fill(Texels, Texels + 16, Colors[ColorIndex]);
+
+			int MaxDifference = 0;
+			encode(Texels, static_cast<gli::encode_preset>(Preset), MaxDifference);
+			Error += MaxDifference <= 1 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Smooth blocks with two regions, the slower presets are at least as accurate as the faster ones
+	int test_presets(bool Alpha)
+	{
+		int Error = 0;
+
+		int SquaredErrors[gli::ENCODE_PRESET_COUNT] = {0, 0, 0};
+		int MaxDifferences[gli::ENCODE_PRESET_COUNT] = {0, 0, 0};
+
+		glm::uint32 Seed = Alpha ? 7 : 3;
+		for(int BlockIndex = 0; BlockIndex < 64; ++BlockIndex)
+		{
+			glm::ivec4 Base[2], Gradient[2];
+			for(int Region = 0; Region < 2; ++Region)
+			{
+				Base[Region] = glm::ivec4(random(Seed), random(Seed), random(Seed), Alpha ? random(Seed) : 255);
+				Gradient[Region] = glm::ivec4(random(Seed) % 16, random(Seed) % 16, random(Seed) % 16, Alpha ? random(Seed) % 16 : 0) - glm::ivec4(8, 8, 8, Alpha ? 8 : 0);
+			}
+
+			glm::u8vec4 Texels[16];
+			for(int y = 0; y < 4; ++y)
+			for(int x = 0; x < 4; ++x)
+			{
+				int const Region = x + y < 3 ? 0 : 1;
+				Texels[y * 4 + x] = glm::u8vec4(glm::clamp(Base[Region] + Gradient[Region] * (x + y), 0, 255));
+			}
+
+			for(int Preset = gli::ENCODE_PRESET_FIRST; Preset <= gli::ENCODE_PRESET_LAST; ++Preset)
+				SquaredErrors[Preset] += encode(Texels, static_cast<gli::encode_preset>(Preset), MaxDifferences[Preset]);
+		}
+
+		Error += SquaredErrors[gli::ENCODE_PRESET_SLOW] <= SquaredErrors[gli::ENCODE_PRESET_DEFAULT] ? 0 : 1;
+		Error += SquaredErrors[gli::ENCODE_PRESET_DEFAULT] <= SquaredErrors[gli::ENCODE_PRESET_FAST] ? 0 : 1;
+		for(int Preset = gli::ENCODE_PRESET_FIRST; Preset <= gli::ENCODE_PRESET_LAST; ++Preset)
+			Error += MaxDifferences[Preset] <= 24 ? 0 : 1;
+
+		return Error;
+	}
+
+	// Converting to BC7 encodes each level, partially covered blocks included
+	int test_convert()
+	{
+		int Error = 0;
+
+		gli::texture2d Texture(gli::FORMAT_RGBA8_UNORM_PACK8, gli::extent2d(10, 6), 2);
+		for(int Level = 0; Level < 2; ++Level)
+		{
+			gli::extent2d const Extent = Texture.extent(Level);
+			for(int y = 0; y < Extent.y; ++y)
+			for(int x = 0; x < Extent.x; ++x)
+				Texture.store(gli::extent2d(x, y), Level, glm::u8vec4((x + y) * 16, 40 + (x + y) * 8, 128 + Level * 64, 255 - (x + y) * 8));
+		}
+
+		for(int Preset = gli::ENCODE_PRESET_FIRST; Preset <= gli::ENCODE_PRESET_LAST; ++Preset)
+		{
+			gli::texture2d const Encoded = gli::convert(Texture, gli::FORMAT_RGBA_BP_UNORM_BLOCK16, static_cast<gli::encode_preset>(Preset));
+			Error += Encoded.format() == gli::FORMAT_RGBA_BP_UNORM_BLOCK16 ? 0 : 1;
+			Error += Encoded.levels() == 2 ? 0 : 1;
+
+			gli::texture2d const Decoded = gli::convert(Encoded, gli::FORMAT_RGBA8_UNORM_PACK8);
+			for(int Level = 0; Level < 2; ++Level)
+			{
+				gli::extent2d const Extent = Texture.extent(Level);
+				for(int y = 0; y < Extent.y; ++y)
+				for(int x = 0; x < Extent.x; ++x)
+				{
+					glm::ivec4 const Difference = glm::abs(glm::ivec4(Decoded.load<glm::u8vec4>(gli::extent2d(x, y), Level)) - glm::ivec4(Texture.load<glm::u8vec4>(gli::extent2d(x, y), Level)));
+					Error += glm::compMax(Difference) <= 8 ? 0 : 1;
+				}
+			}
+		}
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_constant();
+		Error += test_presets(false);
+		Error += test_presets(true);
+		Error += test_convert();
+		Error += srgb_round_trip::test(gli::FORMAT_RGBA_BP_SRGB_BLOCK16, 4);
+
+		return Error;
+	}
+}//namespace bc7_encoder
+
+namespace etc_encoder
+{
+	// Largest difference between the texels of a block and the decoding of their encoding
+	int encode_rgb(glm::u8vec4 const* Texels, bool ETC1, gli::encode_preset Preset, int& SquaredError)
+	{
+		gli::detail::etc2_rgb_block Block;
+		gli::detail::encode_etc2_rgb_block(Texels, ETC1, gli::detail::ETC_ENCODER_PRESETS[Preset], Block);
+
+		glm::u8vec4 Decoded[16];
+		gli::detail::decode_etc2_rgb_block(Block, false, Decoded, 4);
+
+		int MaxDifference = 0;
+		for(int TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+		{
+			glm::ivec3 const Difference = glm::abs(glm::ivec3(Decoded[TexelIndex]) - glm::ivec3(Texels[TexelIndex]));
+			MaxDifference = glm::max(MaxDifference, glm::compMax(Difference));
+			SquaredError += Difference.x * Difference.x + Difference.y * Difference.y + Difference.z * Difference.z;
+		}
+		return MaxDifference;
+	}
+
+	int test_constant()
+	{
+		int Error = 0;
+
+		glm::u8vec4 const Colors[] = {glm::u8vec4(0, 0, 0, 255), glm::u8vec4(255), glm::u8vec4(1, 2, 3, 255), glm::u8vec4(200, 17, 96, 255)};
+		for(std::size_t ColorIndex = 0; ColorIndex < sizeof(Colors) / sizeof(Colors[0]); ++ColorIndex)
+		for(int Preset = gli::ENCODE_PRESET_FIRST; Preset <= gli::ENCODE_PRESET_LAST; ++Preset)
+		{
+			glm::u8vec4 Texels[16];
+			std::fill(Texels, Texels + 16, Colors[ColorIndex]);
+
+			int SquaredError = 0;
+			Error += encode_rgb(Texels, false, static_cast<gli::encode_preset>(Preset), SquaredError) <= 4 ? 0 : 1;
+			Error += encode_rgb(Texels, true, static_cast<gli::encode_preset>(Preset), SquaredError) <= 4 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// The two halves of a block are encoded by the sub-blocks, smooth gradients by the planar mode
+	int test_modes()
+	{
+		int Error = 0;
+
+		// Sub-blocks on top of each other of very different colors
+		{
+			glm::u8vec4 Texels[16];
+			for(int TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				Texels[TexelIndex] = TexelIndex < 8 ? glm::u8vec4(16, 200, 64, 255) : glm::u8vec4(240, 32, 128, 255);
+
+			// Only limited by the 4 bits per channel of the individual mode base colors
+			int SquaredError = 0;
+			Error += encode_rgb(Texels, true, gli::ENCODE_PRESET_FAST, SquaredError) <= 8 ? 0 : 1;
+		}
+
+		// Gradient along both axes
+		{
+			glm::u8vec4 Texels[16];
+			for(int Row = 0; Row < 4; ++Row)
+			for(int Col = 0; Col < 4; ++Col)
+				Texels[Row * 4 + Col] = glm::u8vec4(20 + Col * 40, 60 + Row * 30, 200 - Col * 12 - Row * 20, 255);
+
+			int SquaredErrors[gli::ENCODE_PRESET_COUNT] = {0, 0, 0};
+			for(int Preset = gli::ENCODE_PRESET_FIRST; Preset <= gli::ENCODE_PRESET_LAST; ++Preset)
+				encode_rgb(Texels, false, static_cast<gli::encode_preset>(Preset), SquaredErrors[Preset]);
+
+			Error += SquaredErrors[gli::ENCODE_PRESET_DEFAULT] < SquaredErrors[gli::ENCODE_PRESET_FAST] ? 0 : 1;
+			Error += SquaredErrors[gli::ENCODE_PRESET_SLOW] <= SquaredErrors[gli::ENCODE_PRESET_DEFAULT] ? 0 : 1;
+			Error += SquaredErrors[gli::ENCODE_PRESET_DEFAULT] <= 16 * 3 * 4 ? 0 : 1;
+
+			gli::detail::etc2_rgb_block Block;
+			gli::detail::encode_etc2_rgb_block(Texels, false, gli::detail::ETC_ENCODER_PRESETS[gli::ENCODE_PRESET_DEFAULT], Block);
+
+			// Planar blocks have a valid red, a valid green and an overflowing blue differential color
+			Error += (Block.Data[3] & 0x2) != 0 ? 0 : 1;
+			int const Blue = Block.Data[2] >> 3;
+			int const BlueDelta = (Block.Data[2] & 0x7) - ((Block.Data[2] & 0x4) ? 8 : 0);
+			Error += Blue + BlueDelta < 0 || Blue + BlueDelta > 31 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test_eac()
+	{
+		int Error = 0;
+
+		for(int Signed = 0; Signed < 2; ++Signed)
+		for(int Preset = gli::ENCODE_PRESET_FIRST; Preset <= gli::ENCODE_PRESET_LAST; ++Preset)
+		{
+			glm::int16 Values[16];
+			for(int TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				Values[TexelIndex] = static_cast<glm::int16>((Signed ? -600 : 300) + TexelIndex * 57);
+
+			gli::detail::eac_block Block;
+			gli::detail::encode_eac_r11_block(Values, Signed != 0, gli::detail::ETC_ENCODER_PRESETS[Preset], Block);
+
+			glm::int16 Decoded[16];
+			gli::detail::decode_eac_r11_block(Block, Signed != 0, Decoded, 4);
+			for(int TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				Error += glm::abs(Decoded[TexelIndex] - Values[TexelIndex]) <= 64 ? 0 : 1;
+
+			// Constant blocks are exact
+			std::fill(Values, Values + 16, static_cast<glm::int16>(Signed ? -321 : 1234));
+			gli::detail::encode_eac_r11_block(Values, Signed != 0, gli::detail::ETC_ENCODER_PRESETS[Preset], Block);
+			gli::detail::decode_eac_r11_block(Block, Signed != 0, Decoded, 4);
+			for(int TexelIndex = 0; TexelIndex < 16; ++TexelIndex)
+				Error += Decoded[TexelIndex] == Values[TexelIndex] ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Converting to each ETC2 and EAC format decodes close to the source, partially covered blocks included
+	int test_convert()
+	{
+		int Error = 0;
+
+		gli::texture2d Texture(gli::FORMAT_RGBA8_UNORM_PACK8, gli::extent2d(10, 6), 1);
+		for(int y = 0; y < 6; ++y)
+		for(int x = 0; x < 10; ++x)
+			Texture.store(gli::extent2d(x, y), 0, glm::u8vec4(40 + (x + y) * 8, 80 + (x + y) * 8, 120 + (x + y) * 6, 255 - (x + y) * 12));
+
+		gli::format const Formats[] =
+		{
+			gli::FORMAT_RGB_ETC_UNORM_BLOCK8, gli::FORMAT_RGB_ETC2_UNORM_BLOCK8, gli::FORMAT_RGB_ETC2_SRGB_BLOCK8,
+			gli::FORMAT_RGBA_ETC2_UNORM_BLOCK16, gli::FORMAT_RGBA_ETC2_SRGB_BLOCK16,
+			gli::FORMAT_R_EAC_UNORM_BLOCK8, gli::FORMAT_R_EAC_SNORM_BLOCK8, gli::FORMAT_RG_EAC_UNORM_BLOCK16, gli::FORMAT_RG_EAC_SNORM_BLOCK16
+		};
+
+		for(std::size_t FormatIndex = 0; FormatIndex < sizeof(Formats) / sizeof(Formats[0]); ++FormatIndex)
+		for(int Preset = gli::ENCODE_PRESET_FIRST; Preset <= gli::ENCODE_PRESET_LAST; ++Preset)
+		{
+			gli::format const Format = Formats[FormatIndex];
+			Error += gli::has_encoder(Format) ? 0 : 1;
+
+			gli::texture2d const Encoded = gli::convert(Texture, Format, static_cast<gli::encode_preset>(Preset));
+			Error += Encoded.format() == Format ? 0 : 1;
+
+			gli::texture2d const Decoded = gli::convert(Encoded, gli::FORMAT_RGBA32_SFLOAT_PACK32);
+			glm::length_t const Components = static_cast<glm::length_t>(gli::component_count(Format));
+			for(int y = 0; y < 6; ++y)
+			for(int x = 0; x < 10; ++x)
+			{
+				glm::vec4 Expected = glm::vec4(Texture.load<glm::u8vec4>(gli::extent2d(x, y), 0)) / 255.0f;
+				glm::vec4 Texel = Decoded.load<glm::vec4>(gli::extent2d(x, y), 0);
+
+				// sRGB formats are compared with the precision of their encoded values
+				if(gli::is_srgb(Format))
+				{
+					Expected = glm::convertLinearToSRGB(Expected);
+					Texel = glm::convertLinearToSRGB(Texel);
+				}
+
+				for(glm::length_t Component = 0; Component < Components; ++Component)
+					Error += glm::abs(Texel[Component] - Expected[Component]) <= 16.0f / 255.0f ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_constant();
+		Error += test_modes();
+		Error += test_eac();
+		Error += test_convert();
+		Error += srgb_round_trip::test(gli::FORMAT_RGB_ETC2_SRGB_BLOCK8, 8);
+		Error += srgb_round_trip::test(gli::FORMAT_RGBA_ETC2_SRGB_BLOCK16, 8);
+
+		return Error;
+	}
+}//namespace etc_encoder
+
+namespace half
+{
+	// Every half float survives the round trip through floats whatever its position in a span, NaNs apart
+	int test_round_trip()
+	{
+		int Error = 0;
+
+		std::vector<glm::uint16> Halfs(65536 + 3);
+		for(std::size_t Index = 0; Index < Halfs.size(); ++Index)
+			Halfs[Index] = static_cast<glm::uint16>(Index);
+
+		for(std::size_t Offset = 0; Offset < 4; ++Offset)
+		{
+			std::size_t const Count = Halfs.size() - Offset;
+			std::vector<float> Floats(Count);
+			gli::detail::unpack_half_span(&Halfs[Offset], &Floats[0], Count);
+
+			std::vector<glm::uint16> Packed(Count);
+			gli::detail::pack_half_span(&Floats[0], &Packed[0], Count);
+
+			for(std::size_t Index = 0; Index < Count; ++Index)
+			{
+				glm::uint16 const Half = Halfs[Offset + Index];
+				Error += gli::detail::unpack_half_scalar(Half) == Floats[Index] || Floats[Index] != Floats[Index] ? 0 : 1;
+
+				if((Half & 0x7c00) == 0x7c00 && (Half & 0x3ff) != 0)
+					Error += (Packed[Index] & 0x7e00) == 0x7e00 && (Packed[Index] & 0x8000) == (Half & 0x8000) ? 0 : 1;
+				else
+					Error += Packed[Index] == Half ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	// Floats round to the nearest half float, ties to even, and overflow to infinity
+	int test_rounding()
+	{
+		int Error = 0;
+
+		float const Floats[] =
+		{
+			1.0f + 1.0f / 2048.0f, 1.0f + 3.0f / 2048.0f, 1.0f + 1.0f / 2048.0f + 1.0f / 65536.0f, -2.0f - 1.0f / 1024.0f,
+			65504.0f, 65519.0f, 65520.0f, 1e30f, std::ldexp(1.0f, -25), std::ldexp(1.5f, -25), std::ldexp(3.0f, -25), 1e-30f
+		};
+		glm::uint16 const Expected[] =
+		{
+			0x3c00, 0x3c02, 0x3c01, 0xc000,
+			0x7bff, 0x7bff, 0x7c00, 0x7c00, 0x0000, 0x0001, 0x0002, 0x0000
+		};
+		std::size_t const Count = sizeof(Floats) / sizeof(Floats[0]);
+
+		glm::uint16 Halfs[Count];
+		gli::detail::pack_half_span(Floats, Halfs, Count);
+
+		for(std::size_t Index = 0; Index < Count; ++Index)
+		{
+			Error += Halfs[Index] == Expected[Index] ? 0 : 1;
+			Error += gli::detail::pack_half_scalar(Floats[Index]) == Expected[Index] ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Converting rows of half floats in bulk gives the same texels as converting them one at a time
+	int test_convert()
+	{
+		int Error = 0;
+
+		gli::texture2d Texture(gli::FORMAT_RGBA32_SFLOAT_PACK32, gli::extent2d(37, 5), 2);
+		for(gli::texture2d::size_type Level = 0; Level < Texture.levels(); ++Level)
+		for(int y = 0; y < Texture.extent(Level).y; ++y)
+		for(int x = 0; x < Texture.extent(Level).x; ++x)
+			Texture.store(gli::extent2d(x, y), Level, glm::vec4(x * 0.37f - 3.0f, y * 1000.3f, 1.0f / (x + 1), std::ldexp(1.0f, -x)));
+
+		gli::fsampler2D const Sampler(Texture, gli::WRAP_CLAMP_TO_EDGE);
+
+		gli::format const Formats[] = {gli::FORMAT_R16_SFLOAT_PACK16, gli::FORMAT_RG16_SFLOAT_PACK16, gli::FORMAT_RGB16_SFLOAT_PACK16, gli::FORMAT_RGBA16_SFLOAT_PACK16};
+		for(std::size_t FormatIndex = 0; FormatIndex < sizeof(Formats) / sizeof(Formats[0]); ++FormatIndex)
+		{
+			gli::texture2d const Half = gli::convert(Texture, Formats[FormatIndex]);
+			gli::texture2d const Float = gli::convert(Half, gli::FORMAT_RGBA32_SFLOAT_PACK32);
+			gli::texture2d const Unorm = gli::convert(Half, gli::FORMAT_RGBA8_UNORM_PACK8);
+
+			gli::texture2d TexelHalf(Formats[FormatIndex], Texture.extent(), Texture.levels());
+			gli::fsampler2D SamplerHalf(TexelHalf, gli::WRAP_CLAMP_TO_EDGE);
+			gli::texture2d TexelUnorm(gli::FORMAT_RGBA8_UNORM_PACK8, Texture.extent(), Texture.levels());
+			gli::fsampler2D SamplerUnorm(TexelUnorm, gli::WRAP_CLAMP_TO_EDGE);
+
+			glm::length_t const Components = static_cast<glm::length_t>(gli::component_count(Formats[FormatIndex]));
+			for(gli::texture2d::size_type Level = 0; Level < Texture.levels(); ++Level)
+			for(int y = 0; y < Texture.extent(Level).y; ++y)
+			for(int x = 0; x < Texture.extent(Level).x; ++x)
+			{
+				gli::extent2d const Coord(x, y);
+				SamplerHalf.texel_write(Coord, Level, Sampler.texel_fetch(Coord, Level));
+				glm::vec4 const Expected = SamplerHalf.texel_fetch(Coord, Level);
+				SamplerUnorm.texel_write(Coord, Level, Expected);
+
+				glm::vec4 const Texel = Float.load<glm::vec4>(Coord, Level);
+				for(glm::length_t Component = 0; Component < 4; ++Component)
+					Error += Texel[Component] == (Component < Components ? Expected[Component] : (Component == 3 ? 1.0f : 0.0f)) ? 0 : 1;
+			}
+
+			Error += std::memcmp(Half.data(), SamplerHalf().data(), Half.size()) == 0 ? 0 : 1;
+			Error += std::memcmp(Unorm.data(), SamplerUnorm().data(), Unorm.size()) == 0 ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_round_trip();
+		Error += test_rounding();
+		Error += test_convert();
+
+		return Error;
+	}
+}//namespace half
+
+namespace srgb
+{
+	// Decoding matches the sRGB transfer function and encoding rounds to the nearest code
+	int test_tables()
+	{
+		int Error = 0;
+
+		gli::detail::srgb_tables const& Tables = gli::detail::get_srgb_tables();
+
+		for(int Code = 0; Code < 256; ++Code)
+		{
+			float const Linear = gli::detail::srgb8_to_linear(Tables, static_cast<glm::uint8>(Code));
+			Error += Linear == static_cast<float>(gli::detail::srgb_to_linear_exact(Code / 255.0)) ? 0 : 1;
+			Error += gli::detail::linear_to_srgb8(Tables, Linear) == Code ? 0 : 1;
+		}
+
+		for(glm::uint32 Bits = 0; Bits < 0x3f800000u; Bits += 997)
+		{
+			float Linear;
+			std::memcpy(&Linear, &Bits, sizeof(Linear));
+			Error += gli::detail::linear_to_srgb8(Tables, Linear) == gli::detail::linear_to_srgb8_exact(Linear) ? 0 : 1;
+		}
+
+		Error += gli::detail::linear_to_srgb8(Tables, -1.0f) == 0 ? 0 : 1;
+		Error += gli::detail::linear_to_srgb8(Tables, 1.0f) == 255 ? 0 : 1;
+		Error += gli::detail::linear_to_srgb8(Tables, 2.0f) == 255 ? 0 : 1;
+		Error += gli::detail::linear_to_srgb8(Tables, std::numeric_limits<float>::quiet_NaN()) == 0 ? 0 : 1;
+
+		return Error;
+	}
+
+	// Converting rows of sRGB texels gives the same texels as converting them one at a time, alpha is linear
+	int test_convert()
+	{
+		int Error = 0;
+
+		gli::texture2d Texture(gli::FORMAT_RGBA32_SFLOAT_PACK32, gli::extent2d(61, 3), 1);
+		for(int y = 0; y < 3; ++y)
+		for(int x = 0; x < 61; ++x)
+			Texture.store(gli::extent2d(x, y), 0, glm::vec4(x / 60.0f, y * 0.4f, 1.0f - x / 60.0f, x / 60.0f));
+
+		gli::fsampler2D const Sampler(Texture, gli::WRAP_CLAMP_TO_EDGE);
+
+		gli::format const Formats[] =
+		{
+			gli::FORMAT_R8_SRGB_PACK8, gli::FORMAT_RG8_SRGB_PACK8, gli::FORMAT_RGB8_SRGB_PACK8, gli::FORMAT_BGR8_SRGB_PACK8,
+			gli::FORMAT_RGBA8_SRGB_PACK8, gli::FORMAT_BGRA8_SRGB_PACK8, gli::FORMAT_RGBA8_SRGB_PACK32
+		};
+		for(std::size_t FormatIndex = 0; FormatIndex < sizeof(Formats) / sizeof(Formats[0]); ++FormatIndex)
+		{
+			gli::texture2d const Encoded = gli::convert(Texture, Formats[FormatIndex]);
+			gli::texture2d const Decoded = gli::convert(Encoded, gli::FORMAT_RGBA32_SFLOAT_PACK32);
+
+			gli::texture2d Expected(Formats[FormatIndex], Texture.extent(), 1);
+			gli::fsampler2D SamplerExpected(Expected, gli::WRAP_CLAMP_TO_EDGE);
+
+			for(int y = 0; y < 3; ++y)
+			for(int x = 0; x < 61; ++x)
+			{
+				SamplerExpected.texel_write(gli::extent2d(x, y), 0, Sampler.texel_fetch(gli::extent2d(x, y), 0));
+				Error += Decoded.load<glm::vec4>(gli::extent2d(x, y), 0) == SamplerExpected.texel_fetch(gli::extent2d(x, y), 0) ? 0 : 1;
+			}
+
+			Error += std::memcmp(Encoded.data(), SamplerExpected().data(), Encoded.size()) == 0 ? 0 : 1;
+		}
+
+		gli::texture2d const Encoded = gli::convert(Texture, gli::FORMAT_RGBA8_SRGB_PACK8);
+		for(int x = 0; x < 61; ++x)
+		{
+			glm::u8vec4 const Texel = Encoded.load<glm::u8vec4>(gli::extent2d(x, 1), 0);
+			Error += Texel.x == gli::detail::linear_to_srgb8_exact(x / 60.0f) ? 0 : 1;
+			Error += Texel.w == static_cast<glm::uint8>(x / 60.0f * 255.0f) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_tables();
+		Error += test_convert();
+
+		return Error;
+	}
+}//namespace srgb
+
+namespace packed
+{
+	// Every 11 and 10 bits float survives the round trip through floats, NaNs apart
+	int test_small_float()
+	{
+		int Error = 0;
+
+		std::vector<glm::uint32> Packed(2048 + 3);
+		for(std::size_t Index = 0; Index < Packed.size(); ++Index)
+			Packed[Index] = static_cast<glm::uint32>((Index & 0x7ff) | ((Index & 0x7ff) << 11) | ((Index & 0x3ff) << 22));
+
+		std::vector<glm::vec4> Texels(Packed.size());
+		gli::detail::rg11b10f_span::fetch(&Packed[0], &Texels[0], Packed.size());
+		std::vector<glm::uint32> Repacked(Packed.size());
+		gli::detail::rg11b10f_span::write(&Texels[0], &Repacked[0], Packed.size());
+
+		for(std::size_t Index = 0; Index < Packed.size(); ++Index)
+		{
+			glm::vec4 const Expected = gli::detail::unpack_rg11b10f(Packed[Index]);
+			for(glm::length_t Component = 0; Component < 4; ++Component)
+				Error += Texels[Index][Component] == Expected[Component] || Expected[Component] != Expected[Component] ? 0 : 1;
+
+			bool const NaN = (Index & 0x7ff) > 0x7c0 || (Index & 0x3ff) > 0x3e0;
+			Error += NaN || Repacked[Index] == Packed[Index] ? 0 : 1;
+		}
+
+		float const Floats[] = {1.0f, -1.0f, -0.0f, 65024.0f, 65279.0f, 65280.0f, 1e30f, std::ldexp(1.0f, -20), std::ldexp(1.5f, -20), std::ldexp(1.0f, -21), 1.0f + 1.0f / 128.0f, 1.0f + 3.0f / 128.0f};
+		glm::uint32 const Expected[] = {0x3c0, 0x000, 0x000, 0x7bf, 0x7bf, 0x7c0, 0x7c0, 0x001, 0x002, 0x000, 0x3c0, 0x3c2};
+		for(std::size_t Index = 0; Index < sizeof(Floats) / sizeof(Floats[0]); ++Index)
+			Error += gli::detail::pack_small_float<6>(Floats[Index]) == Expected[Index] ? 0 : 1;
+
+		Error += gli::detail::pack_small_float<6>(std::numeric_limits<float>::quiet_NaN()) > 0x7c0 ? 0 : 1;
+		Error += gli::detail::pack_small_float<5>(std::numeric_limits<float>::infinity()) == 0x3e0 ? 0 : 1;
+		Error += gli::detail::pack_small_float<5>(1.0f) == 0x1e0 ? 0 : 1;
+
+		return Error;
+	}
+
+	// Shared exponent encoding as specified by EXT_texture_shared_exponent
+	int test_rgb9e5()
+	{
+		int Error = 0;
+
+		Error += gli::detail::pack_rgb9e5(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f)) == ((16u << 27) | (256u << 18) | (256u << 9) | 256u) ? 0 : 1;
+		Error += gli::detail::pack_rgb9e5(glm::vec4(65408.0f, 0.0f, 0.0f, 1.0f)) == ((31u << 27) | 511u) ? 0 : 1;
+		Error += gli::detail::pack_rgb9e5(glm::vec4(1e30f, -1.0f, std::numeric_limits<float>::quiet_NaN(), 1.0f)) == ((31u << 27) | 511u) ? 0 : 1;
+		Error += gli::detail::pack_rgb9e5(glm::vec4(0.99999994f, 0.0f, 0.0f, 1.0f)) == ((16u << 27) | 256u) ? 0 : 1;
+		Error += gli::detail::pack_rgb9e5(glm::vec4(0.0f)) == 0 ? 0 : 1;
+		Error += gli::detail::unpack_rgb9e5((31u << 27) | 511u) == glm::vec4(65408.0f, 0.0f, 0.0f, 1.0f) ? 0 : 1;
+		Error += gli::detail::unpack_rgb9e5(1u) == glm::vec4(std::ldexp(1.0f, -24), 0.0f, 0.0f, 1.0f) ? 0 : 1;
+
+		return Error;
+	}
+
+	// Converting rows of a packed format in bulk gives the same texels as converting them one at a time
+	int test_format(gli::format Format, float Scale, float Offset)
+	{
+		int Error = 0;
+
+		gli::texture2d Texture(gli::FORMAT_RGBA32_SFLOAT_PACK32, gli::extent2d(37, 5), 2);
+		for(gli::texture2d::size_type Level = 0; Level < Texture.levels(); ++Level)
+		for(int y = 0; y < Texture.extent(Level).y; ++y)
+		for(int x = 0; x < Texture.extent(Level).x; ++x)
+			Texture.store(gli::extent2d(x, y), Level, glm::vec4(x * 0.037f - 0.2f, y * 0.26f, 1.0f / (x + 1), (x % 7) * 0.17f) * Scale + Offset);
+
+		gli::fsampler2D const Sampler(Texture, gli::WRAP_CLAMP_TO_EDGE);
+
+		gli::texture2d const Packed = gli::convert(Texture, Format);
+		gli::texture2d const Float = gli::convert(Packed, gli::FORMAT_RGBA32_SFLOAT_PACK32);
+
+		gli::texture2d TexelPacked(Format, Texture.extent(), Texture.levels());
+		gli::fsampler2D SamplerPacked(TexelPacked, gli::WRAP_CLAMP_TO_EDGE);
+
+		for(gli::texture2d::size_type Level = 0; Level < Texture.levels(); ++Level)
+		for(int y = 0; y < Texture.extent(Level).y; ++y)
+		for(int x = 0; x < Texture.extent(Level).x; ++x)
+		{
+			gli::extent2d const Coord(x, y);
+			SamplerPacked.texel_write(Coord, Level, Sampler.texel_fetch(Coord, Level));
+			Error += Float.load<glm::vec4>(Coord, Level) == SamplerPacked.texel_fetch(Coord, Level) ? 0 : 1;
+		}
+
+		Error += std::memcmp(Packed.data(), SamplerPacked().data(), Packed.size()) == 0 ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_convert()
+	{
+		int Error = 0;
+
+		gli::format const Formats[] =
+		{
+			gli::FORMAT_RG4_UNORM_PACK8, gli::FORMAT_RG3B2_UNORM_PACK8, gli::FORMAT_RGBA4_UNORM_PACK16, gli::FORMAT_R5G6B5_UNORM_PACK16, gli::FORMAT_RGB5A1_UNORM_PACK16,
+			gli::FORMAT_RGB10A2_UNORM_PACK32, gli::FORMAT_RGB10A2_SNORM_PACK32, gli::FORMAT_RG11B10_UFLOAT_PACK32, gli::FORMAT_RGB9E5_UFLOAT_PACK32
+		};
+		for(std::size_t FormatIndex = 0; FormatIndex < sizeof(Formats) / sizeof(Formats[0]); ++FormatIndex)
+			Error += test_format(Formats[FormatIndex], 1.0f, 0.0f);
+
+		Error += test_format(gli::FORMAT_RG11B10_UFLOAT_PACK32, 3000.0f, 0.0f);
+		Error += test_format(gli::FORMAT_RGB9E5_UFLOAT_PACK32, 3000.0f, 0.0f);
+		Error += test_format(gli::FORMAT_RGB10A2_USCALED_PACK32, 300.0f, 60.0f);
+		Error += test_format(gli::FORMAT_RGB10A2_SSCALED_PACK32, 300.0f, 0.0f);
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_small_float();
+		Error += test_rgb9e5();
+		Error += test_convert();
+
+		return Error;
+	}
+}//namespace packed
+
 int main()
 {
 	int Error = 0;
@@ -790,6 +2694,15 @@ int main()
 	Error += rgba_dxt5unorm::test();
 	Error += r_bc4unorm::test();
 	Error += rg_bc5unorm::test();
+	Error += block_cache::test();
+	Error += bptc::test();
+	Error += etc::test();
+	Error += astc::test();
+	Error += bc7_encoder::test();
+	Error += etc_encoder::test();
+	Error += half::test();
+	Error += srgb::test();
+	Error += packed::test();
 
 	return Error;
 }
@@ -1,4 +1,7 @@
+#define GLI_THREAD_COUNT 4
 #include <gli/gli.hpp>
+#include <algorithm>
+#include <stdexcept>
 
 static_assert(sizeof(gli::detail::dxt1_block) == 8, "DXT1-compressed block must be of size 8.");
 static_assert(sizeof(gli::detail::dxt3_block) == 16, "DXT3-compressed block must be of size 16.");
@@ -24,6 +27,124 @@ int test_texture
 	texture TextureC = gli::flip(TextureB);
 	Error += TextureC == TextureA ? 0 : 1;
 
+	texture TextureD(gli::duplicate(TextureA));
+	gli::flip_in_place(TextureD);
+	Error += TextureD == TextureB ? 0 : 1;
+
+	gli::flip_in_place(TextureD);
+	Error += TextureD == TextureA ? 0 : 1;
+
+	return Error;
+}
+
+template <typename block_type>
+int test_decode(gli::format Format, gli::texture2d::extent_type const& Extent, glm::vec4(*Decompress)(block_type const&, gli::extent2d const&))
+{
+	int Error = 0;
+
+	gli::texture2d TextureA(Format, Extent, 1);
+	glm::uint8* Data = TextureA.data<glm::uint8>();
+	for(std::size_t i = 0; i < TextureA.size(); ++i)
+		Data[i] = static_cast<glm::uint8>((i * 97 + 13) ^ (i >> 3));
+
+	gli::texture2d TextureB(gli::duplicate(TextureA));
+	gli::flip_in_place(TextureB);
+
+	gli::extent2d const BlockCount = glm::max(Extent / 4, gli::extent2d(1));
+	for(int y = 0; y < Extent.y; ++y)
+	for(int x = 0; x < Extent.x; ++x)
+	{
+		int const FlipY = Extent.y - y - 1;
+		block_type const& BlockA = *(TextureA.data<block_type>() + (y / 4) * BlockCount.x + x / 4);
+		block_type const& BlockB = *(TextureB.data<block_type>() + (FlipY / 4) * BlockCount.x + x / 4);
+		glm::vec4 const TexelA = Decompress(BlockA, gli::extent2d(x % 4, y % 4));
+		glm::vec4 const TexelB = Decompress(BlockB, gli::extent2d(x % 4, FlipY % 4));
+		Error += glm::all(glm::equal(TexelA, TexelB)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Images which rows of texels would move across blocks are not flipped by formats without an encoder
+int test_unsupported(gli::format Format, gli::texture2d::extent_type const& Extent)
+{
+	int Error = 0;
+
+	gli::texture2d TextureA(Format, Extent, 1);
+	glm::uint8* Data = TextureA.data<glm::uint8>();
+	for(std::size_t i = 0; i < TextureA.size(); ++i)
+		Data[i] = static_cast<glm::uint8>(i * 31);
+
+	Error += gli::flip(TextureA).empty() ? 0 : 1;
+
+	gli::texture2d TextureB(gli::duplicate(TextureA));
+	Error += !gli::flip_in_place(TextureB) ? 0 : 1;
+	Error += TextureB == TextureA ? 0 : 1;
+
+	return Error;
+}
+
+// Formats with an encoder are decoded, flipped and encoded again, whatever the height
+int test_encoded(gli::format Format, gli::texture2d::extent_type const& Extent, float Tolerance)
+{
+	int Error = 0;
+
+	gli::texture2d Source(gli::FORMAT_RGBA8_UNORM_PACK8, Extent, 1);
+	for(int y = 0; y < Extent.y; ++y)
+	for(int x = 0; x < Extent.x; ++x)
+		Source.store(gli::extent2d(x, y), 0, glm::u8vec4(x * 255 / Extent.x, y * 255 / Extent.y, 128, 255));
+
+	gli::texture2d const Encoded = gli::convert(Source, Format);
+	gli::texture2d const Flipped = gli::flip(Encoded);
+	Error += !Flipped.empty() ? 0 : 1;
+	if(Flipped.empty())
+		return Error;
+
+	gli::texture2d InPlace(gli::duplicate(Encoded));
+	Error += gli::flip_in_place(InPlace) ? 0 : 1;
+	Error += InPlace == Flipped ? 0 : 1;
+
+	gli::texture2d const Expected = gli::convert(Encoded, gli::FORMAT_RGBA32_SFLOAT_PACK32);
+	gli::texture2d const Decoded = gli::convert(Flipped, gli::FORMAT_RGBA32_SFLOAT_PACK32);
+
+	float Sum = 0.0f;
+	for(int y = 0; y < Extent.y; ++y)
+	for(int x = 0; x < Extent.x; ++x)
+	{
+		glm::vec4 const TexelA = Expected.load<glm::vec4>(gli::extent2d(x, Extent.y - y - 1), 0);
+		glm::vec4 const TexelB = Decoded.load<glm::vec4>(gli::extent2d(x, y), 0);
+		Sum += glm::compAdd(glm::abs(TexelA - TexelB)) * 255.0f / 4.0f;
+	}
+	Error += Sum / static_cast<float>(Extent.x * Extent.y) <= Tolerance ? 0 : 1;
+
+	return Error;
+}
+
+// An exception thrown by one of the ranges is rethrown by parallel_for once every range is done
+int test_parallel_exception()
+{
+	int Error = 0;
+
+	std::vector<int> Done(64, 0);
+	bool Caught = false;
+	try
+	{
+		gli::detail::parallel_for(0, Done.size(), 1, [&](std::size_t RangeBegin, std::size_t RangeEnd)
+		{
+			for(std::size_t Index = RangeBegin; Index < RangeEnd; ++Index)
+				Done[Index] = 1;
+			if(RangeBegin == 0 || RangeEnd == Done.size())
+				throw std::runtime_error("range");
+		});
+	}
+	catch(std::runtime_error const&)
+	{
+		Caught = true;
+	}
+
+	Error += Caught ? 0 : 1;
+	Error += std::count(Done.begin(), Done.end(), 1) == static_cast<std::ptrdiff_t>(Done.size()) ? 0 : 1;
+
 	return Error;
 }
 
@@ -74,5 +195,43 @@ int main()
 		gli::detail::dxt5_block{255, 0, 64, 30, 50, 45, 242, 68, 63712, 255, 228, 144, 64, 0},
 		gli::detail::dxt5_block{0, 255, 62, 144, 228, 214, 59, 200, 2516, 215, 152, 173, 215, 106});
 
+	Error += test_texture(
+		gli::texture2d(gli::FORMAT_R_ATI1N_UNORM_BLOCK8, TextureSize, Levels),
+		gli::detail::bc4_block{255, 0, {64, 30, 50, 45, 242, 68}},
+		gli::detail::bc4_block{0, 255, {62, 144, 228, 214, 59, 200}});
+
+	Error += test_texture(
+		gli::texture2d_array(gli::FORMAT_RG_ATI2N_UNORM_BLOCK16, TextureSize, 4, Levels),
+		gli::detail::bc5_block{255, 0, {64, 30, 50, 45, 242, 68}, 12, 200, {1, 2, 3, 4, 5, 6}},
+		gli::detail::bc5_block{0, 255, {62, 144, 228, 214, 59, 200}, 7, 9, {6, 5, 4, 3, 2, 1}});
+
+	Error += test_texture(
+		gli::texture_cube(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture_cube::extent_type(512), 1),
+		glm::u8vec4(255, 128, 0, 255), glm::u8vec4(0, 128, 255, 255));
+
+	int const Heights[] = {1, 2, 3, 4, 8, 12, 16};
+	for(std::size_t HeightIndex = 0; HeightIndex < sizeof(Heights) / sizeof(Heights[0]); ++HeightIndex)
+	{
+		int const Height = Heights[HeightIndex];
+		gli::texture2d::extent_type const Extent(8, Height);
+		Error += test_decode<gli::detail::dxt1_block>(gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8, Extent, gli::detail::decompress_bc1);
+		Error += test_decode<gli::detail::dxt3_block>(gli::FORMAT_RGBA_DXT3_UNORM_BLOCK16, Extent, gli::detail::decompress_bc2);
+		Error += test_decode<gli::detail::dxt5_block>(gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16, Extent, gli::detail::decompress_bc3);
+		Error += test_decode<gli::detail::bc4_block>(gli::FORMAT_R_ATI1N_UNORM_BLOCK8, Extent, gli::detail::decompress_bc4unorm);
+		Error += test_decode<gli::detail::bc5_block>(gli::FORMAT_RG_ATI2N_SNORM_BLOCK16, Extent, gli::detail::decompress_bc5snorm);
+	}
+
+	Error += test_unsupported(gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16, gli::texture2d::extent_type(8, 6));
+	Error += test_unsupported(gli::FORMAT_R_ATI1N_UNORM_BLOCK8, gli::texture2d::extent_type(8, 25));
+	Error += test_unsupported(gli::FORMAT_RGBA_ASTC_4X4_UNORM_BLOCK16, gli::texture2d::extent_type(8, 8));
+	Error += test_unsupported(gli::FORMAT_RGB_BP_UFLOAT_BLOCK16, gli::texture2d::extent_type(8, 8));
+
+	Error += test_encoded(gli::FORMAT_RGBA_BP_UNORM_BLOCK16, gli::texture2d::extent_type(16, 6), 2.0f);
+	Error += test_encoded(gli::FORMAT_RGBA_BP_SRGB_BLOCK16, gli::texture2d::extent_type(12, 25), 2.0f);
+	Error += test_encoded(gli::FORMAT_RGB_ETC2_UNORM_BLOCK8, gli::texture2d::extent_type(16, 16), 4.0f);
+	Error += test_encoded(gli::FORMAT_R_EAC_UNORM_BLOCK8, gli::texture2d::extent_type(8, 6), 2.0f);
+
+	Error += test_parallel_exception();
+
 	return Error;
 }
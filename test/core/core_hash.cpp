@@ -0,0 +1,207 @@
+#include <gli/gli.hpp>
+
+#include <cstring>
+#include <thread>
+
+int test_hasher()
+{
+	int Error(0);
+
+	// xxHash64 reference values
+	Error += gli::detail::hash_data(nullptr, 0) == 0xEF46DB3751D8E999ULL ? 0 : 1;
+	Error += gli::detail::hash_data("abc", 3) == 0x44BC2CF5AD770999ULL ? 0 : 1;
+
+	std::vector<glm::uint8> Data(1000);
+	for(std::size_t i = 0; i < Data.size(); ++i)
+		Data[i] = static_cast<glm::uint8>(i * 7 + 3);
+
+	glm::uint64 const Reference = gli::detail::hash_data(&Data[0], Data.size());
+
+	std::size_t const Splits[] = {1, 5, 31, 32, 33, 100};
+	for(std::size_t SplitIndex = 0; SplitIndex < sizeof(Splits) / sizeof(Splits[0]); ++SplitIndex)
+	{
+		gli::detail::hasher Hasher;
+		for(std::size_t Offset = 0; Offset < Data.size(); Offset += Splits[SplitIndex])
+			Hasher.update(&Data[Offset], glm::min(Splits[SplitIndex], Data.size() - Offset));
+		Error += Hasher.digest() == Reference ? 0 : 1;
+	}
+
+	Error += gli::detail::hash_data(&Data[0], Data.size(), 1) != Reference ? 0 : 1;
+
+	return Error;
+}
+
+int test_texture()
+{
+	int Error(0);
+
+	gli::texture2d TextureA(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(16), 5);
+	TextureA.clear(glm::u8vec4(255, 127, 0, 255));
+
+	gli::texture2d TextureB(gli::duplicate(TextureA));
+	Error += gli::hash(TextureA) == gli::hash(TextureB) ? 0 : 1;
+	Error += TextureA == TextureB ? 0 : 1;
+
+	gli::texture2d TextureC(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(16), 5);
+	TextureC.clear(glm::u8vec4(255, 127, 0, 255));
+	TextureC.store(gli::extent2d(3, 2), 1, glm::u8vec4(0, 0, 0, 0));
+
+	Error += gli::hash(TextureA) != gli::hash(TextureC) ? 0 : 1;
+	Error += gli::hash(TextureA, 0, 0, 0) == gli::hash(TextureC, 0, 0, 0) ? 0 : 1;
+	Error += gli::hash(TextureA, 0, 0, 1) != gli::hash(TextureC, 0, 0, 1) ? 0 : 1;
+	Error += TextureA != TextureC ? 0 : 1;
+
+	gli::texture2d TextureD(gli::FORMAT_RGBA8_SRGB_PACK8, gli::texture2d::extent_type(16), 5);
+	TextureD.clear(glm::u8vec4(255, 127, 0, 255));
+	Error += gli::hash(TextureA) != gli::hash(TextureD) ? 0 : 1;
+
+	return Error;
+}
+
+// Hashes are computed on demand so that they follow every write access
+int test_writes()
+{
+	int Error(0);
+
+	gli::texture2d TextureA(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(8), 1);
+	TextureA.clear(glm::u8vec4(255, 127, 0, 255));
+
+	glm::uint64 const HashA = gli::hash(TextureA, 0, 0, 0);
+
+	// A view shares the storage and the hashes of the texture
+	gli::texture const View(TextureA);
+	Error += gli::hash(View, 0, 0, 0) == HashA ? 0 : 1;
+
+	TextureA.store(gli::extent2d(0, 0), 0, glm::u8vec4(0, 0, 0, 0));
+	Error += gli::hash(TextureA, 0, 0, 0) != HashA ? 0 : 1;
+	Error += gli::hash(View, 0, 0, 0) == gli::hash(TextureA, 0, 0, 0) ? 0 : 1;
+
+	// Writes through a pointer obtained before hashing
+	glm::u8vec4* const Texels = TextureA.data<glm::u8vec4>();
+	glm::uint64 const HashB = gli::hash(TextureA, 0, 0, 0);
+	Texels[0] = glm::u8vec4(1, 2, 3, 4);
+	Error += gli::hash(TextureA, 0, 0, 0) != HashB ? 0 : 1;
+
+	gli::texture2d TextureB(TextureA.format(), TextureA.extent(), 1);
+	TextureB.clear(glm::u8vec4(0));
+	glm::uint64 const HashC = gli::hash(TextureB, 0, 0, 0);
+	TextureB.copy(TextureA, 0, 0, 0, gli::texture::extent_type(0), 0, 0, 0, gli::texture::extent_type(0), gli::texture::extent_type(2, 2, 1));
+	Error += gli::hash(TextureB, 0, 0, 0) != HashC ? 0 : 1;
+
+	// Storages are copyable
+	gli::storage_linear const StorageA(TextureA.format(), gli::storage_linear::extent_type(8, 8, 1), 1, 1, 1);
+	gli::storage_linear StorageB(StorageA);
+	Error += StorageB.size() == StorageA.size() ? 0 : 1;
+	Error += StorageB.data() != StorageA.data() ? 0 : 1;
+
+	return Error;
+}
+
+// Views sharing a storage are hashed by several threads at once
+int test_threads()
+{
+	int Error(0);
+
+	gli::texture2d_array Texture(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d_array::extent_type(64), 8, 4);
+	for(std::size_t Layer = 0; Layer < Texture.layers(); ++Layer)
+		Texture[Layer].clear(glm::u8vec4(Layer, 1, 2, 3));
+
+	std::vector<glm::uint64> Expected(Texture.layers());
+	for(std::size_t Layer = 0; Layer < Texture.layers(); ++Layer)
+		Expected[Layer] = gli::detail::hash_data(Texture.data(Layer, 0, 0), Texture.size(0));
+
+	std::vector<int> Errors(Texture.layers(), 0);
+	std::vector<std::thread> Threads;
+	for(std::size_t Layer = 0; Layer < Texture.layers(); ++Layer)
+	{
+		Threads.push_back(std::thread([&, Layer]()
+		{
+			gli::texture2d_array const View(Texture);
+			for(int Iteration = 0; Iteration < 100; ++Iteration)
+				Errors[Layer] += gli::hash(View, Layer, 0, 0) == Expected[Layer] ? 0 : 1;
+		}));
+	}
+	for(std::size_t Index = 0; Index < Threads.size(); ++Index)
+		Threads[Index].join();
+
+	for(std::size_t Layer = 0; Layer < Texture.layers(); ++Layer)
+		Error += Errors[Layer];
+
+	return Error;
+}
+
+int test_hash128()
+{
+	int Error(0);
+
+	std::vector<glm::uint8> Data(100000);
+	for(std::size_t i = 0; i < Data.size(); ++i)
+		Data[i] = static_cast<glm::uint8>(i * 7 + 3);
+
+	// Each half is the 64 bits hash of its seed
+	glm::u64vec2 const Hash = gli::detail::hash_data128(&Data[0], Data.size());
+	Error += Hash.x == gli::detail::hash_data(&Data[0], Data.size()) ? 0 : 1;
+	Error += Hash.y == gli::detail::hash_data(&Data[0], Data.size(), gli::detail::HASH_PRIME5) ? 0 : 1;
+
+	gli::texture2d TextureA(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(16), 5);
+	TextureA.clear(glm::u8vec4(255, 127, 0, 255));
+	gli::texture2d TextureB(gli::duplicate(TextureA));
+	Error += gli::hash128(TextureA) == gli::hash128(TextureB) ? 0 : 1;
+
+	TextureB.store(gli::extent2d(3, 2), 1, glm::u8vec4(0, 0, 0, 0));
+	Error += gli::hash128(TextureA) != gli::hash128(TextureB) ? 0 : 1;
+	Error += gli::hash128(TextureA, 0, 0, 0) == gli::hash128(TextureB, 0, 0, 0) ? 0 : 1;
+	Error += gli::hash128(TextureA[1]) != gli::hash128(TextureB[1]) ? 0 : 1;
+
+	return Error;
+}
+
+int test_equal()
+{
+	int Error(0);
+
+	gli::texture2d TextureA(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(8), 1);
+	TextureA.clear(glm::u8vec4(255, 127, 0, 255));
+	gli::texture2d TextureB(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(8), 1);
+	TextureB.clear(glm::u8vec4(255, 127, 0, 255));
+
+	// Equal hashes still compare the data
+	Error += gli::hash(TextureA) == gli::hash(TextureB) ? 0 : 1;
+	Error += TextureA == TextureB ? 0 : 1;
+
+	TextureB.store(gli::extent2d(1, 1), 0, glm::u8vec4(0));
+	Error += TextureA != TextureB ? 0 : 1;
+
+	return Error;
+}
+
+int test_image()
+{
+	int Error(0);
+
+	gli::image ImageA(gli::FORMAT_RGBA8_UNORM_PACK8, gli::image::extent_type(4, 4, 1));
+	ImageA.clear(glm::u8vec4(255, 127, 0, 255));
+	gli::image ImageB(gli::FORMAT_RGBA8_UNORM_PACK8, gli::image::extent_type(4, 4, 1));
+	ImageB.clear(glm::u8vec4(255, 127, 0, 255));
+
+	Error += gli::hash(ImageA) == gli::hash(ImageB) ? 0 : 1;
+	ImageB.store(gli::image::extent_type(1, 1, 0), glm::u8vec4(0));
+	Error += gli::hash(ImageA) != gli::hash(ImageB) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_hasher();
+	Error += test_texture();
+	Error += test_writes();
+	Error += test_equal();
+	Error += test_threads();
+	Error += test_hash128();
+	Error += test_image();
+
+	return Error;
+}
@@ -116,6 +116,86 @@ namespace load_struct
 	}
 }//namespace load_struct
 
+namespace try_load
+{
+	int test_container(gli::texture const& Texture, std::vector<char> const& Memory, gli::container Container)
+	{
+		int Error(0);
+
+		gli::load_result const Result = gli::try_load(&Memory[0], Memory.size());
+		Error += Result.Error == gli::LOAD_SUCCESS ? 0 : 1;
+		Error += Result.Container == Container ? 0 : 1;
+		Error += Result.Format == Texture.format() && Result.Extent == Texture.extent() && Result.Levels == Texture.levels() ? 0 : 1;
+		Error += Result.Texture == Texture ? 0 : 1;
+
+		// The description is known even when the images are truncated
+		gli::load_result const Truncated = gli::try_load(&Memory[0], Memory.size() - 1);
+		Error += Truncated.Error == gli::LOAD_TRUNCATED ? 0 : 1;
+		Error += Truncated.Container == Container && Truncated.Format == Texture.format() && Truncated.Layers == Texture.layers() ? 0 : 1;
+		Error += Truncated.Texture.empty() ? 0 : 1;
+
+		gli::load_result const Header = gli::try_load(&Memory[0], 16);
+		Error += Header.Error == gli::LOAD_TRUNCATED && Header.Format == gli::FORMAT_UNDEFINED ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error(0);
+
+		gli::texture Texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(8, 4, 1), 2, 1, 4);
+		Texture.clear(glm::u8vec4(1, 2, 3, 4));
+
+		std::vector<char> DDS;
+		gli::save_dds(Texture, DDS);
+		Error += test_container(Texture, DDS, gli::CONTAINER_DDS);
+		std::vector<char> KTX;
+		gli::save_ktx(Texture, KTX);
+		Error += test_container(Texture, KTX, gli::CONTAINER_KTX10);
+		std::vector<char> KTX2;
+		gli::save_ktx2(Texture, KTX2);
+		Error += test_container(Texture, KTX2, gli::CONTAINER_KTX20);
+		std::vector<char> KMG;
+		gli::save_kmg(Texture, KMG);
+		Error += test_container(Texture, KMG, gli::CONTAINER_KMG100);
+		std::vector<char> KMG2;
+		gli::save_kmg2(Texture, KMG2);
+		Error += test_container(Texture, KMG2, gli::CONTAINER_KMG200);
+
+		gli::load_result const File = gli::try_load(path("kueken7_rgba8_unorm", ".dds"));
+		Error += File.Error == gli::LOAD_SUCCESS && File.Container == gli::CONTAINER_DDS ? 0 : 1;
+		Error += File.Texture == gli::load(path("kueken7_rgba8_unorm", ".dds")) ? 0 : 1;
+
+		Error += gli::try_load(path("missing", ".dds")).Error == gli::LOAD_FILE_ERROR ? 0 : 1;
+
+		char const Unknown[] = "not a texture container";
+		Error += gli::try_load(Unknown, sizeof(Unknown)).Error == gli::LOAD_UNKNOWN_CONTAINER ? 0 : 1;
+		Error += gli::try_load(nullptr, 0).Error == gli::LOAD_UNKNOWN_CONTAINER ? 0 : 1;
+
+		gli::detail::dds_header Header;
+		std::memcpy(&Header, &DDS[0] + sizeof(gli::detail::FOURCC_DDS), sizeof(Header));
+		Header.Width = 0;
+		std::vector<char> BadHeader(DDS);
+		std::memcpy(&BadHeader[0] + sizeof(gli::detail::FOURCC_DDS), &Header, sizeof(Header));
+		Error += gli::try_load(&BadHeader[0], BadHeader.size()).Error == gli::LOAD_BAD_HEADER ? 0 : 1;
+
+		gli::detail::ktx_header20 Header20;
+		std::memcpy(&Header20, &KTX2[0], sizeof(Header20));
+		Header20.SupercompressionScheme = 3;
+		std::vector<char> Unsupported(KTX2);
+		std::memcpy(&Unsupported[0], &Header20, sizeof(Header20));
+		Error += gli::try_load(&Unsupported[0], Unsupported.size()).Error == gli::LOAD_UNSUPPORTED_FORMAT ? 0 : 1;
+
+		std::vector<char> Corrupted(KMG2);
+		Corrupted.back() ^= 1;
+		gli::load_result const CorruptedResult = gli::try_load(&Corrupted[0], Corrupted.size());
+		Error += CorruptedResult.Error == gli::LOAD_CORRUPTED_DATA && CorruptedResult.Format == Texture.format() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace try_load
+
 int main()
 {
 	//make_file_ktx::test(params("kueken7_rgba_astc4x4_srgb", gli::FORMAT_RGB8_UNORM_PACK8));
@@ -135,6 +215,7 @@ int main()
 	Params.push_back(params("kueken7_rgba_dxt5_unorm", gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16));
 
 	load_struct::test();
+	Error += try_load::test();
 
 	{
 		for(std::size_t Index = 0, Count = Params.size(); Index < Count; ++Index)
@@ -0,0 +1,169 @@
+#include <gli/gli.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+
+namespace
+{
+	std::string path(const char* filename)
+	{
+		return std::string(SOURCE_DIR) + "/data/" + filename;
+	}
+
+	std::vector<std::string> get_paths()
+	{
+		std::vector<std::string> Paths;
+		Paths.push_back(path("array_r8_uint.dds"));
+		Paths.push_back(path("array_r8_uint.ktx"));
+		Paths.push_back(path("cube_rgba8_unorm.dds"));
+		Paths.push_back(path("cube_rgba8_unorm.ktx"));
+		Paths.push_back(path("kueken7_bgra8_srgb.ktx"));
+		Paths.push_back(path("kueken7_r5g6b5_unorm.dds"));
+		Paths.push_back(path("kueken7_rg11b10_ufloat.ktx"));
+		Paths.push_back(path("kueken7_rgba_dxt5_srgb.ktx"));
+		Paths.push_back(path("kueken7_rgba_astc8x5_srgb.ktx"));
+		Paths.push_back(path("kueken7_rgba8_srgb.dds"));
+		return Paths;
+	}
+}//namespace
+
+namespace future
+{
+	// Many loads in flight at once give the same textures as the synchronous loads
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<std::string> const Paths = get_paths();
+
+		std::vector<std::future<gli::texture> > Futures;
+		for(int Round = 0; Round < 4; ++Round)
+		for(std::size_t Index = 0; Index < Paths.size(); ++Index)
+			Futures.push_back(gli::load_async(Paths[Index]));
+
+		for(std::size_t Index = 0; Index < Futures.size(); ++Index)
+		{
+			gli::texture const Texture = Futures[Index].get();
+			Error += !Texture.empty() ? 0 : 1;
+			Error += Texture == gli::load(Paths[Index % Paths.size()]) ? 0 : 1;
+		}
+
+		Error += gli::load_async(path("missing.dds").c_str()).get().empty() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace future
+
+namespace callback
+{
+	// Callbacks run on the I/O threads once per file
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<std::string> const Paths = get_paths();
+
+		std::mutex Mutex;
+		std::condition_variable Condition;
+		std::size_t Pending = Paths.size() + 1;
+		std::atomic<int> Failures(0);
+
+		for(std::size_t Index = 0; Index < Paths.size(); ++Index)
+		{
+			gli::texture const Expected = gli::load(Paths[Index]);
+			gli::load_async(Paths[Index], [&, Expected](gli::texture const& Texture)
+			{
+				if(Texture.empty() || Texture != Expected)
+					++Failures;
+
+				std::lock_guard<std::mutex> Lock(Mutex);
+				--Pending;
+				Condition.notify_one();
+			});
+		}
+
+		gli::load_async(path("missing.ktx").c_str(), [&](gli::texture const& Texture)
+		{
+			if(!Texture.empty())
+				++Failures;
+
+			std::lock_guard<std::mutex> Lock(Mutex);
+			--Pending;
+			Condition.notify_one();
+		});
+
+		std::unique_lock<std::mutex> Lock(Mutex);
+		Condition.wait(Lock, [&]()
+		{
+			return Pending == 0;
+		});
+
+		Error += Failures == 0 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace callback
+
+namespace pool
+{
+	// Tasks throwing don't stop the threads, a full queue makes the submitter wait or run the task itself
+	int test()
+	{
+		int Error = 0;
+
+		std::atomic<int> Done(0);
+		std::atomic<int> Nested(0);
+		std::atomic<bool> OnPoolThread(false);
+		{
+			gli::detail::io_pool Pool(1, 2);
+
+			for(int Index = 0; Index < 64; ++Index)
+			{
+				Pool.submit([&, Index]()
+				{
+					++Done;
+					if(Index % 3 == 0)
+						throw std::runtime_error("task failure");
+				});
+			}
+
+			// Tasks submitted by a task of the pool never wait for the queue to drain
+			Pool.submit([&]()
+			{
+				for(int Index = 0; Index < 8; ++Index)
+				{
+					Pool.submit([&]()
+					{
+						++Nested;
+					});
+				}
+				OnPoolThread = gli::detail::io_pool::is_pool_thread();
+			});
+			Error += gli::detail::io_pool::is_pool_thread() ? 1 : 0;
+		}
+		Error += Done == 64 ? 0 : 1;
+		Error += Nested == 8 ? 0 : 1;
+		Error += OnPoolThread ? 0 : 1;
+
+		// A callback throwing doesn't terminate the process and the next loads complete
+		gli::load_async(path("array_r8_uint.dds"), [](gli::texture const&)
+		{
+			throw std::runtime_error("callback failure");
+		});
+		Error += gli::load_async(path("array_r8_uint.dds")).get() == gli::load(path("array_r8_uint.dds")) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace pool
+
+int main()
+{
+	int Error = 0;
+
+	Error += future::test();
+	Error += callback::test();
+	Error += pool::test();
+
+	return Error;
+}
@@ -0,0 +1,167 @@
+#include <gli/gli.hpp>
+#include <future>
+#include <stdexcept>
+
+namespace
+{
+	std::string path(const char* filename)
+	{
+		return std::string(SOURCE_DIR) + "/data/" + filename;
+	}
+
+	std::vector<gli::load_request> get_requests()
+	{
+		std::vector<gli::load_request> Requests;
+		Requests.push_back(gli::load_request(path("array_r8_uint.dds"), 1));
+		Requests.push_back(gli::load_request(path("cube_rgba8_unorm.ktx"), 5));
+		Requests.push_back(gli::load_request(path("kueken7_rgba8_srgb.dds"), 1));
+		Requests.push_back(gli::load_request(path("missing.dds"), 3));
+		Requests.push_back(gli::load_request(path("kueken7_rgba_dxt5_srgb.ktx"), 5));
+		Requests.push_back(gli::load_request(path("kueken7_r5g6b5_unorm.dds"), 0));
+		Requests.push_back(gli::load_request(path("kueken7_rgba_astc8x5_srgb.ktx"), 9));
+		Requests.push_back(gli::load_request(path("array_r8_uint.ktx"), 1));
+		return Requests;
+	}
+}//namespace
+
+namespace probe
+{
+	// The storage size computed from the headers matches the loaded textures
+	int test()
+	{
+		int Error = 0;
+
+		gli::texture const Texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8, gli::texture::extent_type(20, 12, 1), 3, 1, 4);
+
+		std::vector<char> KTX2;
+		gli::save_ktx2(Texture, KTX2);
+		std::vector<char> KMG;
+		gli::save_kmg(Texture, KMG);
+		std::vector<char> KMG2;
+		gli::save_kmg2(Texture, KMG2);
+
+		Error += gli::detail::probe_storage_size(&KTX2[0], gli::detail::PROBE_SIZE) == Texture.size() ? 0 : 1;
+		Error += gli::detail::probe_storage_size(&KMG[0], gli::detail::PROBE_SIZE) == Texture.size() ? 0 : 1;
+		Error += gli::detail::probe_storage_size(&KMG2[0], gli::detail::PROBE_SIZE) == Texture.size() ? 0 : 1;
+
+		std::vector<gli::load_request> const Requests = get_requests();
+		for(std::size_t Index = 0; Index < Requests.size(); ++Index)
+		{
+			gli::detail::batch_probe const Probe = gli::detail::probe_file(Requests[Index].Path.c_str());
+			gli::texture const Loaded = gli::load(Requests[Index].Path);
+			Error += Probe.StorageSize == (Loaded.empty() ? 0 : Loaded.size()) ? 0 : 1;
+		}
+
+		char Unknown[gli::detail::PROBE_SIZE] = {};
+		Error += gli::detail::probe_storage_size(Unknown, sizeof(Unknown)) == 0 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace probe
+
+namespace order
+{
+	// Textures are delivered by decreasing priority, then in the order of the requests, whatever the budget
+	int test(std::size_t Budget)
+	{
+		int Error = 0;
+
+		std::vector<gli::load_request> const Requests = get_requests();
+
+		std::vector<std::size_t> Delivered;
+		std::vector<gli::texture> Textures;
+		gli::load_batch(Requests, Budget, [&](std::size_t Index, gli::texture const& Texture)
+		{
+			Delivered.push_back(Index);
+			Textures.push_back(Texture);
+		});
+
+		std::size_t const Expected[] = {6, 1, 4, 3, 0, 2, 7, 5};
+		Error += Delivered.size() == Requests.size() ? 0 : 1;
+		for(std::size_t Index = 0; Index < Delivered.size(); ++Index)
+		{
+			Error += Delivered[Index] == Expected[Index] ? 0 : 1;
+			Error += Textures[Index] == gli::load(Requests[Delivered[Index]].Path) ? 0 : 1;
+		}
+		Error += Textures[3].empty() ? 0 : 1;
+
+		gli::load_batch(std::vector<gli::load_request>(), Budget, [&](std::size_t, gli::texture const&)
+		{
+			++Error;
+		});
+
+		return Error;
+	}
+}//namespace order
+
+namespace failure
+{
+	// An exception thrown by the callback reaches the caller once the loads in flight are done
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<gli::load_request> const Requests = get_requests();
+
+		std::size_t Calls = 0;
+		bool Caught = false;
+		try
+		{
+			gli::load_batch(Requests, static_cast<std::size_t>(-1), [&](std::size_t, gli::texture const&)
+			{
+				if(++Calls == 2)
+					throw std::runtime_error("callback");
+			});
+		}
+		catch(std::runtime_error const&)
+		{
+			Caught = true;
+		}
+
+		Error += Caught ? 0 : 1;
+		Error += Calls == 2 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace failure
+
+namespace nested
+{
+	// load_batch called from an I/O thread loads the files on that thread instead of waiting for the pool
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<gli::load_request> const Requests = get_requests();
+
+		std::promise<std::size_t> Promise;
+		std::future<std::size_t> Result = Promise.get_future();
+		gli::load_async(path("kueken7_rgba8_srgb.dds"), [&](gli::texture const&)
+		{
+			std::size_t Delivered = 0;
+			gli::load_batch(Requests, 1, [&](std::size_t, gli::texture const&)
+			{
+				++Delivered;
+			});
+			Promise.set_value(Delivered);
+		});
+
+		Error += Result.get() == Requests.size() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace nested
+
+int main()
+{
+	int Error = 0;
+
+	Error += probe::test();
+	Error += order::test(1);
+	Error += order::test(1 << 20);
+	Error += order::test(static_cast<std::size_t>(-1));
+	Error += failure::test();
+	Error += nested::test();
+
+	return Error;
+}
@@ -91,6 +91,73 @@ namespace load_mem_only
 	}
 }//namespace load_mem_only
 
+namespace load_reorder
+{
+	int test()
+	{
+		int Error(0);
+
+		gli::texture const TextureBGR(gli::load_dds(path("kueken7_bgr8_unorm.dds")));
+		gli::texture const TextureRGBA(gli::load_dds(path("kueken7_bgr8_unorm.dds"), gli::FORMAT_RGBA8_UNORM_PACK8));
+		Error += TextureRGBA.format() == gli::FORMAT_RGBA8_UNORM_PACK8 ? 0 : 1;
+		Error += TextureRGBA == gli::reorder_components(TextureBGR, gli::FORMAT_RGBA8_UNORM_PACK8) ? 0 : 1;
+
+		glm::u8vec3 const TexelBGR = TextureBGR.load<glm::u8vec3>(gli::texture::extent_type(13, 17, 0), 0, 0, 0);
+		glm::u8vec4 const TexelRGBA = TextureRGBA.load<glm::u8vec4>(gli::texture::extent_type(13, 17, 0), 0, 0, 0);
+		Error += TexelRGBA == glm::u8vec4(TexelBGR.z, TexelBGR.y, TexelBGR.x, 255) ? 0 : 1;
+
+		gli::texture const TextureBGRA(gli::load_dds(path("kueken7_bgra8_unorm.dds"), gli::FORMAT_BGRA8_UNORM_PACK8));
+		Error += TextureBGRA == gli::load_dds(path("kueken7_bgra8_unorm.dds")) ? 0 : 1;
+
+		// Formats which components differ in type can't be loaded by reordering
+		Error += gli::load_dds(path("kueken7_bgr8_unorm.dds"), gli::FORMAT_RGBA16_UNORM_PACK16).empty() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace load_reorder
+
+namespace parse
+{
+	// Truncated or inconsistent files are rejected before their images are read
+	int test()
+	{
+		int Error(0);
+
+		gli::texture2d Texture(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(12, 8), 3);
+		Texture.clear(glm::u8vec4(1, 2, 3, 4));
+		std::vector<char> Memory;
+		gli::save_dds(Texture, Memory);
+
+		gli::detail::container_desc Desc;
+		Error += gli::detail::parse_dds(&Memory[0], Memory.size(), Desc) == gli::detail::PARSE_SUCCESS ? 0 : 1;
+		Error += Desc.End == Memory.size() && Desc.End - Desc.Offset == Texture.size() ? 0 : 1;
+
+		for(std::size_t Size = 0; Size < Memory.size(); ++Size)
+			Error += gli::load_dds(&Memory[0], Size).empty() ? 0 : 1;
+
+		std::vector<char> BadMagic(Memory);
+		BadMagic[0] = 'X';
+		Error += gli::detail::parse_dds(&BadMagic[0], BadMagic.size(), Desc) == gli::detail::PARSE_BAD_HEADER ? 0 : 1;
+
+		gli::detail::dds_header Header;
+		std::memcpy(&Header, &Memory[0] + sizeof(gli::detail::FOURCC_DDS), sizeof(Header));
+		Header.Width = 0;
+		std::vector<char> BadExtent(Memory);
+		std::memcpy(&BadExtent[0] + sizeof(gli::detail::FOURCC_DDS), &Header, sizeof(Header));
+		Error += gli::detail::parse_dds(&BadExtent[0], BadExtent.size(), Desc) == gli::detail::PARSE_BAD_HEADER ? 0 : 1;
+		Error += gli::load_dds(&BadExtent[0], BadExtent.size()).empty() ? 0 : 1;
+
+		std::memcpy(&Header, &Memory[0] + sizeof(gli::detail::FOURCC_DDS), sizeof(Header));
+		Header.Height = 0x7fffffff;
+		std::vector<char> BadSize(Memory);
+		std::memcpy(&BadSize[0] + sizeof(gli::detail::FOURCC_DDS), &Header, sizeof(Header));
+		Error += gli::detail::parse_dds(&BadSize[0], BadSize.size(), Desc) == gli::detail::PARSE_SUCCESS && Desc.End > BadSize.size() ? 0 : 1;
+		Error += gli::load_dds(&BadSize[0], BadSize.size()).empty() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace parse
+
 int main()
 {
 	std::vector<params> Params;
@@ -139,6 +206,9 @@ int main()
 
 	int Error(0);
 
+	Error += load_reorder::test();
+	Error += parse::test();
+
 	std::clock_t TimeFileStart = std::clock();
 	{
 		for(std::size_t Index = 0; Index < Params.size(); ++Index)
@@ -0,0 +1,159 @@
+#include <gli/gli.hpp>
+
+namespace
+{
+	std::string path(const char* filename)
+	{
+		return std::string(SOURCE_DIR) + "/data/" + filename;
+	}
+
+	std::vector<std::string> get_paths()
+	{
+		std::vector<std::string> Paths;
+		Paths.push_back(path("array_r8_uint.dds"));
+		Paths.push_back(path("array_r8_uint.ktx"));
+		Paths.push_back(path("cube_rgba8_unorm.dds"));
+		Paths.push_back(path("cube_rgba8_unorm.ktx"));
+		Paths.push_back(path("kueken7_bgra8_srgb.ktx"));
+		Paths.push_back(path("kueken7_r5g6b5_unorm.dds"));
+		Paths.push_back(path("kueken7_rgba_dxt5_srgb.ktx"));
+		Paths.push_back(path("kueken7_rgba_astc8x5_srgb.ktx"));
+		Paths.push_back(path("kueken7_rgba8_srgb.dds"));
+		return Paths;
+	}
+
+	std::vector<char> read_file(std::string const& Path)
+	{
+		std::vector<char> Data;
+		FILE* File = std::fopen(Path.c_str(), "rb");
+		if(!File)
+			return Data;
+
+		std::fseek(File, 0, SEEK_END);
+		Data.resize(static_cast<std::size_t>(std::ftell(File)));
+		std::fseek(File, 0, SEEK_SET);
+		if(std::fread(&Data[0], 1, Data.size(), File) != Data.size())
+			Data.clear();
+		std::fclose(File);
+
+		return Data;
+	}
+
+	// Texture of the same shape as Texture, filled with other texels
+	gli::texture make_slot(gli::texture const& Texture)
+	{
+		gli::texture Slot(Texture.target(), Texture.format(), Texture.extent(), Texture.layers(), Texture.faces(), Texture.levels());
+		std::memset(Slot.data(), 0xCD, Slot.size());
+		return Slot;
+	}
+}//namespace
+
+namespace texture
+{
+	// Loading into a texture of the same shape gives the texture loaded by load, in the same storage
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<std::string> const Paths = get_paths();
+		for(std::size_t Index = 0; Index < Paths.size(); ++Index)
+		{
+			gli::texture const Expected = gli::load(Paths[Index]);
+
+			gli::texture Slot = make_slot(Expected);
+			void const* const Storage = Slot.data();
+			Error += gli::load_into(Slot, Paths[Index]) ? 0 : 1;
+			Error += Slot == Expected ? 0 : 1;
+			Error += Slot.data() == Storage ? 0 : 1;
+
+			// The slot is reused for the next texture of the same shape
+			std::vector<char> const Data = read_file(Paths[Index]);
+			std::memset(Slot.data(), 0xCD, Slot.size());
+			Error += gli::load_into(Slot, &Data[0], Data.size()) ? 0 : 1;
+			Error += Slot == Expected ? 0 : 1;
+
+			std::vector<char> KMG;
+			gli::save_kmg(Expected, KMG);
+			std::memset(Slot.data(), 0xCD, Slot.size());
+			Error += gli::load_into(Slot, &KMG[0], KMG.size()) ? 0 : 1;
+			Error += Slot == Expected ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Textures of another shape and invalid containers are rejected without modifying the texture
+	int test_mismatch()
+	{
+		int Error = 0;
+
+		gli::texture const Expected = gli::load(path("kueken7_rgba8_srgb.dds"));
+		gli::texture const Other = gli::load(path("kueken7_r5g6b5_unorm.dds"));
+
+		gli::texture Format(Expected.target(), gli::FORMAT_RGBA8_UNORM_PACK8, Expected.extent(), Expected.layers(), Expected.faces(), Expected.levels());
+		Error += !gli::load_into(Format, path("kueken7_rgba8_srgb.dds")) ? 0 : 1;
+
+		gli::texture Levels(Expected.target(), Expected.format(), Expected.extent(), Expected.layers(), Expected.faces(), 1);
+		Error += !gli::load_into(Levels, path("kueken7_rgba8_srgb.dds")) ? 0 : 1;
+
+		gli::texture Array(gli::TARGET_2D_ARRAY, Expected.format(), Expected.extent(), 1, Expected.faces(), Expected.levels());
+		Error += !gli::load_into(Array, path("kueken7_rgba8_srgb.dds")) ? 0 : 1;
+
+		gli::texture Slot = make_slot(Expected);
+		gli::texture const Original(gli::duplicate(Slot));
+		Error += !gli::load_into(Slot, path("kueken7_r5g6b5_unorm.dds")) ? 0 : 1;
+		Error += !gli::load_into(Slot, path("missing.dds")) ? 0 : 1;
+
+		std::vector<char> const Data = read_file(path("kueken7_rgba8_srgb.dds"));
+		Error += !gli::load_into(Slot, &Data[0], Data.size() - 1) ? 0 : 1;
+		Error += !gli::load_into(Slot, &Data[0], 16) ? 0 : 1;
+		Error += Slot == Original ? 0 : 1;
+
+		gli::texture Empty;
+		Error += !gli::load_into(Empty, path("kueken7_rgba8_srgb.dds")) ? 0 : 1;
+		Error += !Other.empty() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace texture
+
+namespace buffer
+{
+	// Loading into a buffer gives a texture using the buffer as storage
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<std::string> const Paths = get_paths();
+		for(std::size_t Index = 0; Index < Paths.size(); ++Index)
+		{
+			gli::texture const Expected = gli::load(Paths[Index]);
+
+			std::vector<char> Buffer(Expected.size() + 16);
+			gli::texture const Texture = gli::load_into(&Buffer[0], Buffer.size(), Paths[Index]);
+			Error += Texture == Expected ? 0 : 1;
+			Error += Texture.data() == &Buffer[0] ? 0 : 1;
+
+			std::vector<char> const Data = read_file(Paths[Index]);
+			gli::texture const Memory = gli::load_into(&Buffer[0], Expected.size(), &Data[0], Data.size());
+			Error += Memory == Expected ? 0 : 1;
+			Error += Memory.data() == &Buffer[0] ? 0 : 1;
+
+			Error += gli::load_into(&Buffer[0], Expected.size() - 1, Paths[Index]).empty() ? 0 : 1;
+			Error += gli::load_into(&Buffer[0], Buffer.size(), &Data[0], Data.size() / 2).empty() ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace buffer
+
+int main()
+{
+	int Error = 0;
+
+	Error += texture::test();
+	Error += texture::test_mismatch();
+	Error += buffer::test();
+
+	return Error;
+}
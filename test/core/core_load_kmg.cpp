@@ -0,0 +1,227 @@
+#include <gli/gli.hpp>
+#include "texture_helper.hpp"
+#include <cstring>
+
+namespace kmg2
+{
+	// Textures of every kind survive a round trip through KMG 2.0 memory and files
+	int test_round_trip()
+	{
+		int Error = 0;
+
+		std::vector<gli::texture> Textures;
+		Textures.push_back(helper::make_texture(gli::TARGET_1D_ARRAY, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(13, 1, 1), 3, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(600, 500, 1), 1, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8, gli::texture::extent_type(20, 12, 1), 2, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_3D, gli::FORMAT_RGB9E5_UFLOAT_PACK32, gli::texture::extent_type(8, 4, 6), 1, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_CUBE, gli::FORMAT_RGBA16_SFLOAT_PACK16, gli::texture::extent_type(8, 8, 1), 1, 6));
+		Textures.push_back(helper::make_texture(gli::TARGET_CUBE_ARRAY, gli::FORMAT_RGBA_ASTC_8X5_SRGB_BLOCK16, gli::texture::extent_type(24, 24, 1), 2, 6));
+		Textures.push_back(gli::texture(helper::make_texture(gli::TARGET_2D, gli::FORMAT_L8_UNORM_PACK8, gli::texture::extent_type(4, 4, 1), 1, 1), gli::TARGET_2D, gli::FORMAT_L8_UNORM_PACK8,
+			gli::texture::swizzles_type(gli::SWIZZLE_RED, gli::SWIZZLE_RED, gli::SWIZZLE_RED, gli::SWIZZLE_ONE)));
+
+		for(std::size_t Index = 0; Index < Textures.size(); ++Index)
+		{
+			std::vector<char> Memory;
+			Error += gli::save_kmg2(Textures[Index], Memory) ? 0 : 1;
+
+			gli::texture const Loaded = gli::load_kmg(&Memory[0], Memory.size());
+			Error += Loaded == Textures[Index] ? 0 : 1;
+			Error += Loaded.swizzles() == Textures[Index].swizzles() ? 0 : 1;
+		}
+
+		Error += gli::save_kmg2(Textures[1], "test_kmg2_round_trip.kmg") ? 0 : 1;
+		Error += gli::load_kmg("test_kmg2_round_trip.kmg") == Textures[1] ? 0 : 1;
+		Error += gli::load("test_kmg2_round_trip.kmg") == Textures[1] ? 0 : 1;
+
+		return Error;
+	}
+
+	// Images are split in chunks of KMG_CHUNK_SIZE bytes, located and checked by the chunk index
+	int test_layout()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(400, 300, 1), 2, 1);
+		std::vector<char> Memory;
+		gli::save_kmg2(Texture, Memory);
+
+		gli::detail::kmgHeader20 Header;
+		std::memcpy(&Header, &Memory[0] + sizeof(gli::detail::FOURCC_KMG200), sizeof(Header));
+		Error += Header.Endianness == 0x04030201 ? 0 : 1;
+		Error += Header.Levels == Texture.levels() && Header.Layers == 2 && Header.Faces == 1 ? 0 : 1;
+		Error += Header.Supercompression == gli::SUPERCOMPRESSION_NONE ? 0 : 1;
+		Error += Header.ChunkSize == gli::detail::KMG_CHUNK_SIZE ? 0 : 1;
+
+		// The base level images are 480000 bytes, two chunks each, the other levels fit in one chunk
+		Error += Header.ChunkCount == 2 * 2 + (Texture.levels() - 1) * 2 ? 0 : 1;
+		Error += gli::detail::get_kmg_first_chunk(Header, 1) == 4 ? 0 : 1;
+
+		std::vector<gli::detail::kmgChunk20> Chunks(Header.ChunkCount);
+		std::size_t const IndexOffset = sizeof(gli::detail::FOURCC_KMG200) + sizeof(Header);
+		std::memcpy(&Chunks[0], &Memory[0] + IndexOffset, sizeof(gli::detail::kmgChunk20) * Chunks.size());
+
+		Error += Chunks[0].ByteOffset == IndexOffset + sizeof(gli::detail::kmgChunk20) * Chunks.size() ? 0 : 1;
+		Error += Chunks[0].ByteLength == gli::detail::KMG_CHUNK_SIZE && Chunks[1].ByteLength == Texture.size(0) - gli::detail::KMG_CHUNK_SIZE ? 0 : 1;
+		Error += std::memcmp(&Memory[0] + Chunks[2].ByteOffset, Texture.data(1, 0, 0), gli::detail::KMG_CHUNK_SIZE) == 0 ? 0 : 1;
+		for(std::size_t Chunk = 0; Chunk < Chunks.size(); ++Chunk)
+		{
+			Error += Chunks[Chunk].Checksum == gli::detail::hash_data(&Memory[0] + Chunks[Chunk].ByteOffset, static_cast<std::size_t>(Chunks[Chunk].ByteLength)) ? 0 : 1;
+			if(Chunk > 0)
+				Error += Chunks[Chunk].ByteOffset == Chunks[Chunk - 1].ByteOffset + Chunks[Chunk - 1].ByteLength ? 0 : 1;
+		}
+		Error += Chunks.back().ByteOffset + Chunks.back().ByteLength == Memory.size() ? 0 : 1;
+
+		return Error;
+	}
+
+	// A range of levels is loaded from memory and from a file reading only the chunks of these levels
+	int test_levels()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_CUBE, gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16, gli::texture::extent_type(512, 512, 1), 1, 6);
+		gli::save_kmg2(Texture, "test_kmg2_levels.kmg");
+
+		std::vector<char> Memory;
+		gli::save_kmg2(Texture, Memory);
+
+		for(int Source = 0; Source < 2; ++Source)
+		{
+			gli::texture const Levels = Source == 0 ? gli::load_kmg(&Memory[0], Memory.size(), 2, 3) : gli::load_kmg("test_kmg2_levels.kmg", 2, 3);
+			Error += Levels.levels() == 2 && Levels.faces() == 6 ? 0 : 1;
+			Error += Levels.extent() == Texture.extent(2) ? 0 : 1;
+			Error += Levels == gli::duplicate(gli::texture_cube(Texture), 0, 5, 2, 3) ? 0 : 1;
+
+			gli::texture const Tail = Source == 0 ? gli::load_kmg(&Memory[0], Memory.size(), 4, 100) : gli::load_kmg("test_kmg2_levels.kmg", 4, 100);
+			Error += Tail.levels() == Texture.levels() - 4 ? 0 : 1;
+
+			gli::texture const Past = Source == 0 ? gli::load_kmg(&Memory[0], Memory.size(), Texture.levels(), 100) : gli::load_kmg("test_kmg2_levels.kmg", Texture.levels(), 100);
+			Error += Past.empty() ? 0 : 1;
+		}
+
+		// Corrupting the base level doesn't affect loading the other levels
+		gli::detail::kmgChunk20 First;
+		std::memcpy(&First, &Memory[0] + sizeof(gli::detail::FOURCC_KMG200) + sizeof(gli::detail::kmgHeader20), sizeof(First));
+		Memory[static_cast<std::size_t>(First.ByteOffset)] ^= 1;
+		Error += gli::load_kmg(&Memory[0], Memory.size()).empty() ? 0 : 1;
+		Error += gli::load_kmg(&Memory[0], Memory.size(), 1, 100) == gli::duplicate(gli::texture_cube(Texture), 0, 5, 1, Texture.levels() - 1) ? 0 : 1;
+
+		return Error;
+	}
+
+	// Truncated, corrupted or inconsistent files are rejected
+	int test_invalid()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(16, 16, 1), 1, 1);
+		std::vector<char> Memory;
+		gli::save_kmg2(Texture, Memory);
+
+		Error += gli::load_kmg(&Memory[0], Memory.size() - 1).empty() ? 0 : 1;
+		Error += gli::load_kmg(&Memory[0], sizeof(gli::detail::FOURCC_KMG200) + sizeof(gli::detail::kmgHeader20) + 8).empty() ? 0 : 1;
+
+		std::vector<char> Corrupted(Memory);
+		Corrupted.back() ^= 1;
+		Error += gli::load_kmg(&Corrupted[0], Corrupted.size()).empty() ? 0 : 1;
+
+		std::size_t const HeaderOffset = sizeof(gli::detail::FOURCC_KMG200);
+
+		gli::detail::kmgHeader20 Header;
+		std::memcpy(&Header, &Memory[0] + HeaderOffset, sizeof(Header));
+		Header.ChunkCount += 1;
+		std::vector<char> BadCount(Memory);
+		std::memcpy(&BadCount[0] + HeaderOffset, &Header, sizeof(Header));
+		Error += gli::load_kmg(&BadCount[0], BadCount.size()).empty() ? 0 : 1;
+
+		std::memcpy(&Header, &Memory[0] + HeaderOffset, sizeof(Header));
+		Header.Supercompression = 1;
+		std::vector<char> BadScheme(Memory);
+		std::memcpy(&BadScheme[0] + HeaderOffset, &Header, sizeof(Header));
+		Error += gli::load_kmg(&BadScheme[0], BadScheme.size()).empty() ? 0 : 1;
+
+		std::memcpy(&Header, &Memory[0] + HeaderOffset, sizeof(Header));
+		Header.Levels = 6;
+		std::vector<char> BadLevels(Memory);
+		std::memcpy(&BadLevels[0] + HeaderOffset, &Header, sizeof(Header));
+		Error += gli::load_kmg(&BadLevels[0], BadLevels.size()).empty() ? 0 : 1;
+
+		Error += !gli::save_kmg2(Texture, Memory, static_cast<gli::supercompression>(1)) ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_supercompression()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(300, 300, 1), 3, 1);
+		std::vector<char> Memory;
+
+#		if defined(GLI_ZSTD)
+			Error += gli::save_kmg2(Texture, Memory, gli::SUPERCOMPRESSION_ZSTD) ? 0 : 1;
+			Error += gli::load_kmg(&Memory[0], Memory.size()) == Texture ? 0 : 1;
+			Error += gli::load_kmg(&Memory[0], Memory.size(), 1, 1) == gli::duplicate(gli::texture2d_array(Texture), 0, 2, 1, 1) ? 0 : 1;
+#		else
+			Error += !gli::save_kmg2(Texture, Memory, gli::SUPERCOMPRESSION_ZSTD) ? 0 : 1;
+#		endif
+
+#		if defined(GLI_LZ4)
+			Error += gli::save_kmg2(Texture, Memory, gli::SUPERCOMPRESSION_LZ4) ? 0 : 1;
+			Error += gli::load_kmg(&Memory[0], Memory.size()) == Texture ? 0 : 1;
+			Error += gli::load_kmg(&Memory[0], Memory.size(), 1, 1) == gli::duplicate(gli::texture2d_array(Texture), 0, 2, 1, 1) ? 0 : 1;
+#		else
+			Error += !gli::save_kmg2(Texture, Memory, gli::SUPERCOMPRESSION_LZ4) ? 0 : 1;
+#		endif
+
+		// LZ4 is not a KTX 2.0 supercompression scheme
+		Error += !gli::save_ktx2(Texture, Memory, gli::SUPERCOMPRESSION_LZ4) ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_round_trip();
+		Error += test_layout();
+		Error += test_levels();
+		Error += test_invalid();
+		Error += test_supercompression();
+
+		return Error;
+	}
+}//namespace kmg2
+
+namespace kmg1
+{
+	// KMG 1.0 files are still loaded, a range of levels is a view of the loaded texture
+	int test()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(32, 16, 1), 1, 1);
+		std::vector<char> Memory;
+		Error += gli::save_kmg(Texture, Memory) ? 0 : 1;
+
+		Error += gli::load_kmg(&Memory[0], Memory.size()) == Texture ? 0 : 1;
+
+		gli::texture const Levels = gli::load_kmg(&Memory[0], Memory.size(), 1, 2);
+		Error += Levels.levels() == 2 && Levels.extent() == Texture.extent(1) ? 0 : 1;
+		Error += Levels == gli::duplicate(gli::texture2d(Texture), 1, 2) ? 0 : 1;
+		Error += gli::load_kmg(&Memory[0], Memory.size(), Texture.levels(), 100).empty() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace kmg1
+
+int main()
+{
+	int Error(0);
+
+	Error += kmg2::test();
+	Error += kmg1::test();
+
+	return Error;
+}
@@ -1,4 +1,5 @@
 #include <gli/gli.hpp>
+#include "texture_helper.hpp"
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/vec1.hpp>
 #include <glm/gtc/packing.hpp>
@@ -62,6 +63,409 @@ namespace load_mem_only
 	}
 }//namespace load_mem_only
 
+namespace ktx2
+{
+	// Textures of every kind survive a round trip through KTX2 memory and files
+	int test_round_trip()
+	{
+		int Error = 0;
+
+		std::vector<gli::texture> Textures;
+		Textures.push_back(helper::make_texture(gli::TARGET_1D_ARRAY, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(13, 1, 1), 3, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGB8_UNORM_PACK8, gli::texture::extent_type(17, 9, 1), 1, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8, gli::texture::extent_type(20, 12, 1), 2, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_3D, gli::FORMAT_RGB9E5_UFLOAT_PACK32, gli::texture::extent_type(8, 4, 6), 1, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_CUBE, gli::FORMAT_RGBA16_SFLOAT_PACK16, gli::texture::extent_type(8, 8, 1), 1, 6));
+		Textures.push_back(helper::make_texture(gli::TARGET_CUBE_ARRAY, gli::FORMAT_RGBA_ASTC_8X5_SRGB_BLOCK16, gli::texture::extent_type(24, 24, 1), 2, 6));
+		Textures.push_back(gli::load_ktx(path("kueken7_rgba_etc2_srgb.ktx")));
+
+		for(std::size_t Index = 0; Index < Textures.size(); ++Index)
+		{
+			std::vector<char> Memory;
+			Error += gli::save_ktx2(Textures[Index], Memory) ? 0 : 1;
+			Error += gli::load_ktx(&Memory[0], Memory.size()) == Textures[Index] ? 0 : 1;
+		}
+
+		Error += gli::save(Textures[2], "test_ktx2_round_trip.ktx2") ? 0 : 1;
+		Error += gli::load("test_ktx2_round_trip.ktx2") == Textures[2] ? 0 : 1;
+
+		// Formats without VkFormat value
+		std::vector<char> Memory;
+		Error += !gli::save_ktx2(helper::make_texture(gli::TARGET_2D, gli::FORMAT_L8_UNORM_PACK8, gli::texture::extent_type(4, 4, 1), 1, 1), Memory) ? 0 : 1;
+
+		return Error;
+	}
+
+	// Levels are stored from the smallest, aligned, and described by the level index and the data format descriptor
+	int test_layout()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGB16_UNORM_PACK16, gli::texture::extent_type(9, 7, 1), 1, 1);
+		std::vector<char> Memory;
+		gli::save_ktx2(Texture, Memory);
+
+		gli::detail::ktx_header20 Header;
+		std::memcpy(&Header, &Memory[0], sizeof(Header));
+		Error += Header.VkFormat == 84 ? 0 : 1;
+		Error += Header.TypeSize == 2 ? 0 : 1;
+		Error += Header.PixelDepth == 0 && Header.LayerCount == 0 && Header.FaceCount == 1 ? 0 : 1;
+		Error += Header.LevelCount == Texture.levels() ? 0 : 1;
+
+		std::vector<gli::detail::ktx_level20> Levels(Header.LevelCount);
+		std::memcpy(&Levels[0], &Memory[0] + sizeof(Header), sizeof(gli::detail::ktx_level20) * Levels.size());
+		for(std::size_t Level = 0; Level < Levels.size(); ++Level)
+		{
+			Error += Levels[Level].ByteOffset % 12 == 0 ? 0 : 1;
+			Error += Levels[Level].ByteLength == Texture.size(Level) ? 0 : 1;
+			Error += std::memcmp(&Memory[0] + Levels[Level].ByteOffset, Texture.data(0, 0, Level), Texture.size(Level)) == 0 ? 0 : 1;
+			if(Level > 0)
+				Error += Levels[Level].ByteOffset < Levels[Level - 1].ByteOffset ? 0 : 1;
+		}
+
+		gli::detail::ktx2_dfd DFD = gli::detail::ktx2_dfd();
+		Error += gli::detail::parse_ktx2_dfd(&Memory[0] + Header.DFDByteOffset, Header.DFDByteLength, DFD) ? 0 : 1;
+		Error += DFD.ColorModel == gli::detail::KHR_DF_MODEL_RGBSDA ? 0 : 1;
+		Error += DFD.TransferFunction == gli::detail::KHR_DF_TRANSFER_LINEAR ? 0 : 1;
+		Error += DFD.BlockExtent == gli::texture::extent_type(1) && DFD.BytesPlane0 == 6 ? 0 : 1;
+
+		std::vector<std::uint32_t> const Compressed = gli::detail::make_ktx2_dfd(gli::FORMAT_RGBA_ASTC_8X5_SRGB_BLOCK16, false);
+		Error += gli::detail::parse_ktx2_dfd(reinterpret_cast<char const*>(&Compressed[0]), Compressed.size() * sizeof(std::uint32_t), DFD) ? 0 : 1;
+		Error += DFD.ColorModel == gli::detail::KHR_DF_MODEL_ASTC && DFD.TransferFunction == gli::detail::KHR_DF_TRANSFER_SRGB ? 0 : 1;
+		Error += DFD.BlockExtent == gli::texture::extent_type(8, 5, 1) && DFD.BytesPlane0 == 16 ? 0 : 1;
+
+		return Error;
+	}
+
+	// A range of levels is loaded from KTX2 through the level index and from KTX by skipping the previous levels
+	int test_levels()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16, gli::texture::extent_type(40, 24, 1), 2, 1);
+
+		std::vector<char> MemoryKTX2;
+		gli::save_ktx2(Texture, MemoryKTX2);
+		std::vector<char> MemoryKTX;
+		gli::save_ktx(Texture, MemoryKTX);
+
+		for(int Version = 0; Version < 2; ++Version)
+		{
+			std::vector<char> const& Memory = Version == 0 ? MemoryKTX : MemoryKTX2;
+
+			gli::texture const Levels = gli::load_ktx(&Memory[0], Memory.size(), 2, 3);
+			Error += Levels.levels() == 2 && Levels.layers() == 2 ? 0 : 1;
+			Error += Levels.extent() == Texture.extent(2) ? 0 : 1;
+			for(gli::texture::size_type Layer = 0; Layer < Texture.layers(); ++Layer)
+			for(gli::texture::size_type Level = 0; Level < Levels.levels(); ++Level)
+				Error += std::memcmp(Levels.data(Layer, 0, Level), Texture.data(Layer, 0, Level + 2), Texture.size(Level + 2)) == 0 ? 0 : 1;
+
+			gli::texture const Tail = gli::load_ktx(&Memory[0], Memory.size(), 4, 100);
+			Error += Tail.levels() == Texture.levels() - 4 ? 0 : 1;
+			Error += gli::load_ktx(&Memory[0], Memory.size(), Texture.levels(), 100).empty() ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Truncated or inconsistent files are rejected
+	int test_invalid()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(16, 16, 1), 1, 1);
+		std::vector<char> Memory;
+		gli::save_ktx2(Texture, Memory);
+
+		Error += gli::load_ktx(&Memory[0], Memory.size() - 1).empty() ? 0 : 1;
+		Error += gli::load_ktx(&Memory[0], sizeof(gli::detail::ktx_header20) + 8).empty() ? 0 : 1;
+
+		std::vector<char> BadFormat(Memory);
+		BadFormat[12] = static_cast<char>(255);
+		Error += gli::load_ktx(&BadFormat[0], BadFormat.size()).empty() ? 0 : 1;
+
+		gli::detail::ktx_header20 Header;
+		std::memcpy(&Header, &Memory[0], sizeof(Header));
+		std::vector<char> BadDFD(Memory);
+		BadDFD[Header.DFDByteOffset] = 0;
+		Error += gli::load_ktx(&BadDFD[0], BadDFD.size()).empty() ? 0 : 1;
+
+		return Error;
+	}
+
+	int test_supercompression()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_CUBE_ARRAY, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(32, 32, 1), 2, 6);
+		std::vector<char> Memory;
+
+#		if defined(GLI_ZSTD)
+			Error += gli::save_ktx2(Texture, Memory, gli::SUPERCOMPRESSION_ZSTD) ? 0 : 1;
+			Error += gli::load_ktx(&Memory[0], Memory.size()) == Texture ? 0 : 1;
+			Error += gli::load_ktx(&Memory[0], Memory.size(), 1, 1) == gli::duplicate(gli::texture_cube_array(Texture), 0, 1, 0, 5, 1, 1) ? 0 : 1;
+#		else
+			Error += !gli::save_ktx2(Texture, Memory, gli::SUPERCOMPRESSION_ZSTD) ? 0 : 1;
+#		endif
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_round_trip();
+		Error += test_layout();
+		Error += test_levels();
+		Error += test_invalid();
+		Error += test_supercompression();
+
+		return Error;
+	}
+}//namespace ktx2
+
+namespace endianness
+{
+	// Rewrite a KTX file saved by GLI with the other endianness: header fields, level sizes and the elements of GLTypeSize bytes of the images
+	std::vector<char> swap_ktx(std::vector<char> const& Source)
+	{
+		std::vector<char> Swapped(Source);
+
+		std::size_t Offset = sizeof(gli::detail::FOURCC_KTX10);
+		gli::detail::ktx_header10 Header;
+		std::memcpy(&Header, &Source[Offset], sizeof(Header));
+		gli::detail::copy_swap(&Swapped[Offset], &Source[Offset], sizeof(Header), sizeof(std::uint32_t));
+		Offset += sizeof(Header) + Header.BytesOfKeyValueData;
+
+		for(std::uint32_t Level = 0; Level < Header.NumberOfMipmapLevels; ++Level)
+		{
+			std::uint32_t ImageSize = 0;
+			std::memcpy(&ImageSize, &Source[Offset], sizeof(ImageSize));
+			gli::detail::copy_swap(&Swapped[Offset], &Source[Offset], sizeof(ImageSize), sizeof(ImageSize));
+			Offset += sizeof(ImageSize);
+
+			gli::detail::copy_swap(&Swapped[Offset], &Source[Offset], ImageSize, Header.GLTypeSize);
+			Offset += ImageSize;
+		}
+
+		return Swapped;
+	}
+
+	int test_copy_swap()
+	{
+		int Error = 0;
+
+		std::vector<glm::uint8> Source(203);
+		for(std::size_t Index = 0; Index < Source.size(); ++Index)
+			Source[Index] = static_cast<glm::uint8>(Index * 13 + 5);
+
+		std::size_t const ElementSizes[] = {1, 2, 4, 8};
+		for(std::size_t SizeIndex = 0; SizeIndex < 4; ++SizeIndex)
+		for(std::size_t Size = 0; Size <= 192; Size += ElementSizes[SizeIndex])
+		{
+			std::size_t const ElementSize = ElementSizes[SizeIndex];
+
+			std::vector<glm::uint8> Expected(Size);
+			for(std::size_t Index = 0; Index < Size; ++Index)
+				Expected[Index] = Source[Index - Index % ElementSize + ElementSize - 1 - Index % ElementSize + 1];
+
+			std::vector<glm::uint8> Copy(Size + 1, 0);
+			gli::detail::copy_swap(&Copy[0], &Source[1], Size, ElementSize);
+			Error += std::equal(Expected.begin(), Expected.end(), Copy.begin()) && Copy[Size] == 0 ? 0 : 1;
+
+			std::vector<glm::uint8> InPlace(Source.begin() + 1, Source.begin() + 1 + Size);
+			if(Size > 0)
+				gli::detail::copy_swap(&InPlace[0], &InPlace[0], Size, ElementSize);
+			Error += InPlace == Expected ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Files written with the other endianness load as the files written with the endianness of the host
+	int test_load()
+	{
+		int Error = 0;
+
+		std::vector<gli::texture> Textures;
+		Textures.push_back(helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(17, 9, 1), 1, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_2D, gli::FORMAT_R5G6B5_UNORM_PACK16, gli::texture::extent_type(13, 7, 1), 1, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_1D_ARRAY, gli::FORMAT_RGB16_UNORM_PACK16, gli::texture::extent_type(9, 1, 1), 3, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_CUBE, gli::FORMAT_RGBA16_SFLOAT_PACK16, gli::texture::extent_type(8, 8, 1), 1, 6));
+		Textures.push_back(helper::make_texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA32_SFLOAT_PACK32, gli::texture::extent_type(11, 5, 1), 2, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_3D, gli::FORMAT_RG11B10_UFLOAT_PACK32, gli::texture::extent_type(8, 4, 6), 1, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_2D, gli::FORMAT_R64_SFLOAT_PACK64, gli::texture::extent_type(5, 3, 1), 1, 1));
+		Textures.push_back(helper::make_texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8, gli::texture::extent_type(20, 12, 1), 2, 1));
+
+		for(std::size_t Index = 0; Index < Textures.size(); ++Index)
+		{
+			gli::texture const& Texture = Textures[Index];
+
+			std::vector<char> Memory;
+			gli::save_ktx(Texture, Memory);
+			std::vector<char> const Swapped = swap_ktx(Memory);
+			Error += Swapped != Memory || gli::block_size(Texture.format()) == 1 || gli::is_compressed(Texture.format()) ? 0 : 1;
+
+			Error += gli::load_ktx(&Swapped[0], Swapped.size()) == Texture ? 0 : 1;
+			Error += gli::load_ktx(&Swapped[0], Swapped.size(), 1, 2) == gli::load_ktx(&Memory[0], Memory.size(), 1, 2) ? 0 : 1;
+			Error += gli::detail::probe_storage_size(&Swapped[0], gli::detail::PROBE_SIZE) == Texture.size() ? 0 : 1;
+
+			gli::texture Into(Texture.target(), Texture.format(), Texture.extent(), Texture.layers(), Texture.faces(), Texture.levels());
+			Error += gli::load_into(Into, &Swapped[0], Swapped.size()) && Into == Texture ? 0 : 1;
+		}
+
+		std::vector<char> Memory;
+		gli::save_ktx(Textures[4], Memory);
+		std::vector<char> const Swapped = swap_ktx(Memory);
+
+		FILE* File = std::fopen("test_ktx_swapped.ktx", "wb");
+		std::fwrite(&Swapped[0], 1, Swapped.size(), File);
+		std::fclose(File);
+
+		Error += gli::load("test_ktx_swapped.ktx") == Textures[4] ? 0 : 1;
+		gli::texture Into(Textures[4].target(), Textures[4].format(), Textures[4].extent(), Textures[4].layers(), Textures[4].faces(), Textures[4].levels());
+		Error += gli::load_into(Into, "test_ktx_swapped.ktx") && Into == Textures[4] ? 0 : 1;
+
+		// Unknown endianness and elements which don't divide the texels
+		std::vector<char> Unknown(Swapped);
+		Unknown[sizeof(gli::detail::FOURCC_KTX10)] = 0x05;
+		Error += gli::load_ktx(&Unknown[0], Unknown.size()).empty() ? 0 : 1;
+
+		std::vector<char> RGB8;
+		gli::save_ktx(helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGB8_UNORM_PACK8, gli::texture::extent_type(4, 4, 1), 1, 1), RGB8);
+		std::vector<char> BadTypeSize = swap_ktx(RGB8);
+		std::uint32_t const TypeSize = 0x02000000;
+		std::memcpy(&BadTypeSize[sizeof(gli::detail::FOURCC_KTX10) + offsetof(gli::detail::ktx_header10, GLTypeSize)], &TypeSize, sizeof(TypeSize));
+		Error += gli::load_ktx(&BadTypeSize[0], BadTypeSize.size()).empty() ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_copy_swap();
+		Error += test_load();
+
+		return Error;
+	}
+}//namespace endianness
+
+namespace parse
+{
+	std::size_t const HeaderOffset = sizeof(gli::detail::FOURCC_KTX10);
+
+	// Read the KTX 1.0 header of Memory, returns false if Memory is too small to hold it
+	bool read_header(std::vector<char> const& Memory, gli::detail::ktx_header10& Header)
+	{
+		if(Memory.size() < HeaderOffset + sizeof(Header))
+			return false;
+
+		std::memcpy(&Header, &Memory[HeaderOffset], sizeof(Header));
+		return true;
+	}
+
+	// Copy of Memory with its KTX 1.0 header replaced by Header, empty if Memory is too small to hold it
+	std::vector<char> with_header(std::vector<char> const& Memory, gli::detail::ktx_header10 const& Header)
+	{
+		if(Memory.size() < HeaderOffset + sizeof(Header))
+			return std::vector<char>();
+
+		std::vector<char> Copy(Memory);
+		std::memcpy(&Copy[HeaderOffset], &Header, sizeof(Header));
+		return Copy;
+	}
+
+	// The images of the fixtures end with the files
+	int test_fixture(char const* Filename)
+	{
+		int Error = 0;
+
+		FILE* File = std::fopen(path(Filename).c_str(), "rb");
+		std::vector<char> Memory;
+		Error += File && gli::detail::read_file(File, Memory) ? 0 : 1;
+		if(File)
+			std::fclose(File);
+		Error += !Memory.empty() ? 0 : 1;
+		if(Error)
+			return Error;
+
+		gli::detail::container_desc Desc;
+		Error += gli::detail::parse_ktx10(&Memory[0], Memory.size(), Desc) == gli::detail::PARSE_SUCCESS ? 0 : 1;
+		Error += Desc.End == Memory.size() ? 0 : 1;
+
+		return Error;
+	}
+
+	// Truncated or inconsistent files are rejected before their images are read
+	int test_invalid()
+	{
+		int Error = 0;
+
+		gli::texture const Texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGB8_UNORM_PACK8, gli::texture::extent_type(5, 3, 1), 2, 1, 3);
+		std::vector<char> Memory;
+		gli::save_ktx(Texture, Memory);
+		if(Memory.empty())
+			return 1;
+
+		gli::detail::container_desc Desc;
+		Error += gli::detail::parse_ktx10(&Memory[0], Memory.size(), Desc) == gli::detail::PARSE_SUCCESS ? 0 : 1;
+		Error += Desc.End == Memory.size() ? 0 : 1;
+
+		for(std::size_t Size = 0; Size < Memory.size(); ++Size)
+			Error += gli::load_ktx(&Memory[0], Size).empty() ? 0 : 1;
+
+		gli::detail::ktx_header10 Header;
+		Error += read_header(Memory, Header) ? 0 : 1;
+		Header.NumberOfFaces = 2;
+		std::vector<char> const BadFaces = with_header(Memory, Header);
+		Error += !BadFaces.empty() && gli::detail::parse_ktx10(&BadFaces[0], BadFaces.size(), Desc) == gli::detail::PARSE_BAD_HEADER ? 0 : 1;
+
+		Error += read_header(Memory, Header) ? 0 : 1;
+		Header.GLInternalFormat = 0;
+		std::vector<char> const BadFormat = with_header(Memory, Header);
+		Error += !BadFormat.empty() && gli::detail::parse_ktx10(&BadFormat[0], BadFormat.size(), Desc) == gli::detail::PARSE_UNSUPPORTED_FORMAT ? 0 : 1;
+
+		Error += read_header(Memory, Header) ? 0 : 1;
+		Header.BytesOfKeyValueData = 0xfffffff0;
+		std::vector<char> const BadKeyValues = with_header(Memory, Header);
+		Error += !BadKeyValues.empty() && gli::load_ktx(&BadKeyValues[0], BadKeyValues.size()).empty() ? 0 : 1;
+
+		std::vector<char> KTX2;
+		gli::save_ktx2(Texture, KTX2);
+		if(KTX2.size() < sizeof(gli::detail::ktx_header20) + 8)
+			return Error + 1;
+
+		Error += gli::detail::parse_ktx20(&KTX2[0], KTX2.size(), Desc) == gli::detail::PARSE_SUCCESS ? 0 : 1;
+		Error += Desc.End == KTX2.size() ? 0 : 1;
+		Error += gli::detail::parse_ktx20(&KTX2[0], sizeof(gli::detail::ktx_header20) + 8, Desc) == gli::detail::PARSE_TRUNCATED ? 0 : 1;
+		for(std::size_t Size = 0; Size < KTX2.size(); ++Size)
+			Error += gli::load_ktx(&KTX2[0], Size).empty() ? 0 : 1;
+
+		gli::detail::ktx_header20 Header20;
+		std::memcpy(&Header20, &KTX2[0], sizeof(Header20));
+		Header20.SupercompressionScheme = 3;
+		std::vector<char> BadScheme(KTX2);
+		std::memcpy(&BadScheme[0], &Header20, sizeof(Header20));
+		Error += gli::detail::parse_ktx20(&BadScheme[0], BadScheme.size(), Desc) == gli::detail::PARSE_UNSUPPORTED_FORMAT ? 0 : 1;
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_fixture("kueken7_rgba_pvrtc2_2bpp_unorm.ktx");
+		Error += test_fixture("kueken7_rgba_pvrtc2_4bpp_srgb.ktx");
+		Error += test_invalid();
+
+		return Error;
+	}
+}//namespace parse
+
 int main()
 {
 	std::vector<std::string> Filenames;
@@ -138,6 +542,10 @@ int main()
 	}
 	std::clock_t TimeMemOnlyEnd = std::clock();
 
+	Error += ktx2::test();
+	Error += endianness::test();
+	Error += parse::test();
+
 	std::printf("File: %lu, Mem: %lu, Mem Only: %lu\n", TimeFileEnd - TimeFileStart, TimeMemEnd - TimeMemStart, TimeMemOnlyEnd - TimeMemOnlyStart);
 
 	return Error;
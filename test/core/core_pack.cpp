@@ -0,0 +1,188 @@
+#include <gli/gli.hpp>
+#include <cstring>
+
+namespace
+{
+	std::string path(const char* filename)
+	{
+		return std::string(SOURCE_DIR) + "/data/" + filename;
+	}
+
+	void get_textures(std::vector<std::string>& Names, std::vector<gli::texture>& Textures)
+	{
+		char const* Files[] = {
+			"array_r8_uint.dds",
+			"cube_rgba8_unorm.ktx",
+			"kueken7_rgba_dxt5_srgb.ktx",
+			"kueken7_rgba_astc8x5_srgb.ktx",
+			"kueken7_r5g6b5_unorm.dds"};
+
+		for(std::size_t Index = 0; Index < sizeof(Files) / sizeof(Files[0]); ++Index)
+		{
+			Names.push_back(std::string("textures/") + Files[Index]);
+			Textures.push_back(gli::load(path(Files[Index])));
+		}
+
+		gli::texture3d Texture3D(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture3d::extent_type(7, 5, 3));
+		for(std::size_t Index = 0, Count = Texture3D.size<glm::u8vec4>(); Index < Count; ++Index)
+			Texture3D.data<glm::u8vec4>()[Index] = glm::u8vec4(static_cast<glm::uint8>(Index), 1, 2, 3);
+		Names.push_back("3d");
+		Textures.push_back(Texture3D);
+
+		Names.push_back("");
+		Textures.push_back(gli::texture2d(gli::FORMAT_R16_SFLOAT_PACK16, gli::texture2d::extent_type(3, 9), 1, gli::texture2d::swizzles_type(gli::SWIZZLE_RED, gli::SWIZZLE_RED, gli::SWIZZLE_RED, gli::SWIZZLE_ONE)));
+	}
+}//namespace
+
+namespace round_trip
+{
+	// Every texture is found by name and equals the saved texture
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<std::string> Names;
+		std::vector<gli::texture> Textures;
+		get_textures(Names, Textures);
+
+		// Views are saved as whole textures
+		Names.push_back("view");
+		Textures.push_back(gli::view(gli::texture2d_array(Textures[0]), 1, 1, 1, 2));
+
+		Error += gli::save_pack(Names, Textures, "core_pack.pack") ? 0 : 1;
+
+		gli::pack const Pack("core_pack.pack");
+		Error += Pack.size() == Names.size() ? 0 : 1;
+
+		for(std::size_t Index = 0; Index < Names.size(); ++Index)
+		{
+			std::size_t const Found = Pack.find(Names[Index]);
+			Error += Found < Pack.size() ? 0 : 1;
+			Error += Pack.name(Found) == Names[Index] ? 0 : 1;
+
+			gli::texture const Texture = Pack.load(Names[Index]);
+			Error += Texture == Textures[Index] ? 0 : 1;
+			Error += Texture.target() == Textures[Index].target() ? 0 : 1;
+			Error += Texture.swizzles() == Textures[Index].swizzles() ? 0 : 1;
+		}
+
+		gli::texture const View = Pack.load("view");
+		Error += View.base_layer() == 0 && View.layers() == 1 && View.base_level() == 0 && View.levels() == 2 ? 0 : 1;
+
+		Error += Pack.find("missing") == Pack.size() ? 0 : 1;
+		Error += Pack.load("missing").empty() ? 0 : 1;
+		Error += Pack.load(Pack.size()).empty() ? 0 : 1;
+
+		std::vector<char> Memory;
+		Error += gli::save_pack(std::vector<std::string>(), std::vector<gli::texture>(), Memory) ? 0 : 1;
+		Error += gli::save_pack(std::vector<std::string>(), std::vector<gli::texture>(), "core_pack_empty.pack") ? 0 : 1;
+		Error += gli::pack("core_pack_empty.pack").empty() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace round_trip
+
+namespace zero_copy
+{
+	// Mapped textures point into the mapping, aligned, loaded textures are copies and writes never reach the file
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<std::string> Names;
+		std::vector<gli::texture> Textures;
+		get_textures(Names, Textures);
+		Error += gli::save_pack(Names, Textures, "core_pack_copy.pack") ? 0 : 1;
+
+		std::vector<char> Memory;
+		Error += gli::save_pack(Names, Textures, Memory) ? 0 : 1;
+
+		gli::texture Texture3D;
+		{
+			gli::pack const Pack("core_pack_copy.pack");
+
+			gli::texture const First = Pack.map("3d");
+			gli::texture const Second = Pack.map("3d");
+			Error += First.data() == Second.data() ? 0 : 1;
+			Error += reinterpret_cast<std::size_t>(First.data()) % 64 == 0 ? 0 : 1;
+
+			gli::texture Copy = Pack.load("3d");
+			Error += Copy.data() != First.data() ? 0 : 1;
+			Error += Copy == First ? 0 : 1;
+			Copy.clear(glm::u8vec4(255));
+			Error += Copy != First ? 0 : 1;
+			Error += Pack.load("3d") == Textures[Names.size() - 2] ? 0 : 1;
+
+			Texture3D = gli::texture(Pack.map("3d"));
+		}
+
+		// The texture keeps the mapping alive after the pack is destroyed
+		Error += Texture3D == Textures[Names.size() - 2] ? 0 : 1;
+
+		Texture3D.clear(glm::u8vec4(255));
+		Error += Texture3D != Textures[Names.size() - 2] ? 0 : 1;
+		Error += gli::pack("core_pack_copy.pack").map("3d") == Textures[Names.size() - 2] ? 0 : 1;
+
+		FILE* File = std::fopen("core_pack_copy.pack", "rb");
+		std::vector<char> Content(Memory.size());
+		Error += File && std::fread(&Content[0], 1, Content.size(), File) == Content.size() ? 0 : 1;
+		if(File)
+			std::fclose(File);
+		Error += Content == Memory ? 0 : 1;
+
+		return Error;
+	}
+}//namespace zero_copy
+
+namespace invalid
+{
+	// Invalid packs and requests fail
+	int test()
+	{
+		int Error = 0;
+
+		std::vector<std::string> Names;
+		std::vector<gli::texture> Textures;
+		get_textures(Names, Textures);
+
+		std::vector<char> Memory;
+		std::vector<std::string> Duplicated(Names);
+		Duplicated[1] = Duplicated[0];
+		Error += !gli::save_pack(Duplicated, Textures, Memory) ? 0 : 1;
+		Error += !gli::save_pack(Names, std::vector<gli::texture>(Textures.begin(), Textures.end() - 1), Memory) ? 0 : 1;
+
+		std::vector<gli::texture> Empty(Textures);
+		Empty[2] = gli::texture();
+		Error += !gli::save_pack(Names, Empty, Memory) ? 0 : 1;
+
+		Error += gli::pack(path("missing.pack")).empty() ? 0 : 1;
+		Error += gli::pack(path("array_r8_uint.dds")).empty() ? 0 : 1;
+
+		// A truncated pack keeps its index but the textures out of the file fail to load
+		Error += gli::save_pack(Names, Textures, Memory) ? 0 : 1;
+		FILE* File = std::fopen("core_pack_truncated.pack", "wb");
+		std::fwrite(&Memory[0], 1, Memory.size() / 2, File);
+		std::fclose(File);
+
+		gli::pack const Pack("core_pack_truncated.pack");
+		Error += Pack.size() == Names.size() ? 0 : 1;
+
+		std::size_t Loaded = 0;
+		for(std::size_t Index = 0; Index < Pack.size(); ++Index)
+			Loaded += Pack.load(Index).empty() ? 0 : 1;
+		Error += Loaded > 0 && Loaded < Pack.size() ? 0 : 1;
+
+		return Error;
+	}
+}//namespace invalid
+
+int main()
+{
+	int Error = 0;
+
+	Error += round_trip::test();
+	Error += zero_copy::test();
+	Error += invalid::test();
+
+	return Error;
+}
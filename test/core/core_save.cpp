@@ -2,6 +2,9 @@
 #include <gli/load.hpp>
 #include <gli/texture2d.hpp>
 #include <gli/comparison.hpp>
+#include <gli/texture_cube.hpp>
+#include <gli/texture1d.hpp>
+#include <cstring>
 
 namespace
 {
@@ -86,6 +89,128 @@ namespace rgba8_unorm
 	}
 }//namespace rgba8_unorm
 
+namespace segments
+{
+	// Bytes of the images of Texture referenced by the segments of List
+	std::size_t get_referenced_bytes(gli::segment_list const& List, gli::texture const& Texture)
+	{
+		char const* const Begin = static_cast<char const*>(Texture.data());
+		char const* const End = Begin + Texture.size();
+
+		std::size_t Bytes = 0;
+		for(std::size_t Index = 0; Index < List.size(); ++Index)
+		{
+			char const* const Data = static_cast<char const*>(List[Index].Data);
+			if(Data >= Begin && Data + List[Index].Size <= End)
+				Bytes += List[Index].Size;
+		}
+		return Bytes;
+	}
+
+	int test_texture(gli::texture const& Texture)
+	{
+		int Error = 0;
+
+		typedef bool (*save_segments)(gli::texture const&, gli::segment_list&);
+		typedef bool (*save_memory)(gli::texture const&, std::vector<char>&);
+		typedef bool (*save_file)(gli::texture const&, char const*);
+		save_segments const SaveSegments[] = {gli::save_dds, gli::save_ktx, gli::save_kmg};
+		save_memory const SaveMemory[] = {gli::save_dds, gli::save_ktx, gli::save_kmg};
+		save_file const SaveFile[] = {gli::save_dds, gli::save_ktx, gli::save_kmg};
+
+		for(std::size_t Container = 0; Container < 3; ++Container)
+		{
+			gli::segment_list List;
+			Error += SaveSegments[Container](Texture, List) ? 0 : 1;
+
+			// The images aren't copied, each image adds at most a level size, the image and its padding
+			Error += get_referenced_bytes(List, Texture) == Texture.size() ? 0 : 1;
+			Error += List.size() <= 1 + Texture.levels() * Texture.layers() * Texture.faces() * 3 ? 0 : 1;
+
+			std::size_t Bytes = 0;
+			for(std::size_t Index = 0; Index < List.size(); ++Index)
+				Bytes += List.data()[Index].Size;
+			Error += Bytes == List.bytes() ? 0 : 1;
+
+			std::vector<char> Gathered;
+			List.gather(Gathered);
+			std::vector<char> Memory(16, 'x');
+			Error += SaveMemory[Container](Texture, Memory) ? 0 : 1;
+			Error += Gathered == Memory ? 0 : 1;
+			Error += gli::load(&Memory[0], Memory.size()) == Texture ? 0 : 1;
+
+			Error += SaveFile[Container](Texture, "segments.bin") ? 0 : 1;
+			std::vector<char> File(Memory.size() + 1);
+			FILE* Stream = std::fopen("segments.bin", "rb");
+			Error += Stream && std::fread(&File[0], 1, File.size(), Stream) == Memory.size() ? 0 : 1;
+			if(Stream)
+				std::fclose(Stream);
+			File.resize(Memory.size());
+			Error += File == Memory ? 0 : 1;
+
+			// Copies of the list share the headers and keep the storage alive
+			gli::segment_list Copy(List);
+			List.reset(gli::texture(), 0);
+			std::vector<char> Copied;
+			Copy.gather(Copied);
+			Error += Copied == Memory ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		gli::texture2d Texture2D(gli::FORMAT_RGBA_DXT1_UNORM_BLOCK8, gli::texture2d::extent_type(20, 12));
+		for(std::size_t Index = 0; Index < Texture2D.size(); ++Index)
+			Texture2D.data<glm::uint8>()[Index] = static_cast<glm::uint8>(Index * 7);
+		Error += test_texture(Texture2D);
+
+		// Rows of 3 bytes need the padding of KTX
+		gli::texture1d Texture1D(gli::FORMAT_RGB8_UNORM_PACK8, gli::texture1d::extent_type(5));
+		for(std::size_t Index = 0; Index < Texture1D.size(); ++Index)
+			Texture1D.data<glm::uint8>()[Index] = static_cast<glm::uint8>(Index * 13);
+		Error += test_texture(Texture1D);
+
+		gli::texture_cube TextureCube(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture_cube::extent_type(8));
+		for(std::size_t Index = 0; Index < TextureCube.size(); ++Index)
+			TextureCube.data<glm::uint8>()[Index] = static_cast<glm::uint8>(Index * 3);
+		Error += test_texture(TextureCube);
+
+		gli::segment_list List;
+		Error += List.empty() && List.bytes() == 0 ? 0 : 1;
+		Error += !gli::save_dds(gli::texture(), List) ? 0 : 1;
+
+		// The serialized images follow the writes to the texture
+		{
+			gli::texture2d Texture(gli::FORMAT_R8_UNORM_PACK8, gli::texture2d::extent_type(4), 1);
+			Texture.clear(gli::u8vec1(1));
+			Error += gli::save_dds(Texture, List) ? 0 : 1;
+			Error += List.size() == 2 ? 0 : 1;
+			Texture.clear(gli::u8vec1(2));
+		}
+		std::vector<char> Memory;
+		List.gather(Memory);
+		Error += Memory.back() == 2 ? 0 : 1;
+
+		// The headers appended beyond the reserved capacity don't move the previous ones
+		List.reset(gli::texture2d(gli::FORMAT_R8_UNORM_PACK8, gli::texture2d::extent_type(1), 1), 2);
+		char* const First = static_cast<char*>(List.append_header(2));
+		First[0] = 'a';
+		First[1] = 'b';
+		for(char Header = 'c'; Header <= 'z'; ++Header)
+			*static_cast<char*>(List.append_header(1)) = Header;
+		First[1] = 'B';
+		List.gather(Memory);
+		Error += List.bytes() == 26 && Memory.size() == 26 ? 0 : 1;
+		Error += std::string(Memory.begin(), Memory.end()) == "aBcdefghijklmnopqrstuvwxyz" ? 0 : 1;
+
+		return Error;
+	}
+}//namespace segments
+
 int main()
 {
 	int Error = 0;
@@ -93,6 +218,7 @@ int main()
 	Error += l8_unorm::test();
 	Error += la8_unorm::test();
 	Error += rgba8_unorm::test();
+	Error += segments::test();
 
 	return Error;
 }
@@ -0,0 +1,184 @@
+#include <gli/gli.hpp>
+#include "texture_helper.hpp"
+#include <cstring>
+
+namespace
+{
+	// Every row of blocks of the texture is found at its footprint in the staging buffer
+	int check_rows(gli::texture const& Texture, std::vector<gli::staging_footprint> const& Footprints, std::vector<char> const& Buffer)
+	{
+		int Error = 0;
+
+		for(std::size_t Index = 0; Index < Footprints.size(); ++Index)
+		{
+			gli::staging_footprint const& Footprint = Footprints[Index];
+			char const* const Image = Texture.data<char>(Footprint.Layer, Footprint.Face, Footprint.Level);
+
+			for(std::size_t Slice = 0; Slice < Footprint.SliceCount; ++Slice)
+			for(std::size_t Row = 0; Row < Footprint.RowCount; ++Row)
+			{
+				char const* const Src = Image + (Slice * Footprint.RowCount + Row) * Footprint.RowSize;
+				char const* const Dst = &Buffer[Footprint.Offset + Slice * Footprint.SlicePitch + Row * Footprint.RowPitch];
+				Error += std::memcmp(Src, Dst, Footprint.RowSize) == 0 ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+}//namespace
+
+namespace layout
+{
+	int test(gli::texture const& Texture, gli::staging_alignment const& Alignment)
+	{
+		int Error = 0;
+
+		std::vector<gli::staging_footprint> Footprints;
+		std::size_t const Size = gli::staging_layout(Texture, Alignment, Footprints);
+		Error += Footprints.size() == Texture.layers() * Texture.faces() * Texture.levels() ? 0 : 1;
+
+		std::size_t const BlockSize = gli::block_size(Texture.format());
+		std::size_t End = 0;
+		for(std::size_t Index = 0; Index < Footprints.size(); ++Index)
+		{
+			gli::staging_footprint const& Footprint = Footprints[Index];
+			Error += Footprint.Layer == Index / (Texture.faces() * Texture.levels()) ? 0 : 1;
+			Error += Footprint.Face == Index / Texture.levels() % Texture.faces() ? 0 : 1;
+			Error += Footprint.Level == Index % Texture.levels() ? 0 : 1;
+			Error += Footprint.Extent == Texture.extent(Footprint.Level) ? 0 : 1;
+
+			Error += Footprint.Offset >= End ? 0 : 1;
+			Error += Footprint.Offset % Alignment.Offset == 0 && Footprint.Offset % BlockSize == 0 ? 0 : 1;
+			Error += Footprint.RowPitch % Alignment.RowPitch == 0 && Footprint.RowPitch % BlockSize == 0 ? 0 : 1;
+			Error += Footprint.RowPitch >= Footprint.RowSize ? 0 : 1;
+			Error += Footprint.RowSize * Footprint.RowCount * Footprint.SliceCount == Texture.size(Footprint.Level) ? 0 : 1;
+			Error += Footprint.RowLength * BlockSize == Footprint.RowPitch * gli::block_extent(Texture.format()).x ? 0 : 1;
+			End = Footprint.Offset + Footprint.SlicePitch * Footprint.SliceCount;
+		}
+		Error += Size == End ? 0 : 1;
+
+		std::vector<char> Buffer(Size, 0);
+		Error += gli::fill_staging(Texture, Footprints, &Buffer[0], Buffer.size()) ? 0 : 1;
+		Error += check_rows(Texture, Footprints, Buffer);
+
+		return Error;
+	}
+
+	int test()
+	{
+		int Error = 0;
+
+		gli::staging_alignment const Alignment;
+		Error += test(helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(300, 200, 1), 1, 1, 9), Alignment);
+		Error += test(helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA_DXT5_UNORM_BLOCK16, gli::texture::extent_type(1024, 512, 1), 1, 1, 11), Alignment);
+		Error += test(helper::make_texture(gli::TARGET_2D_ARRAY, gli::FORMAT_RGBA_BP_UNORM_BLOCK16, gli::texture::extent_type(60, 20, 1), 3, 1, 6), Alignment);
+		Error += test(helper::make_texture(gli::TARGET_3D, gli::FORMAT_R16_SFLOAT_PACK16, gli::texture::extent_type(33, 17, 9), 1, 1, 6), Alignment);
+		Error += test(helper::make_texture(gli::TARGET_CUBE_ARRAY, gli::FORMAT_RGBA32_SFLOAT_PACK32, gli::texture::extent_type(16, 16, 1), 2, 6, 5), Alignment);
+		Error += test(helper::make_texture(gli::TARGET_1D_ARRAY, gli::FORMAT_R8_UNORM_PACK8, gli::texture::extent_type(5, 1, 1), 4, 1, 3), Alignment);
+
+		// Alignments are rounded up to a multiple of the block size
+		Error += test(helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGB8_UNORM_PACK8, gli::texture::extent_type(31, 7, 1), 1, 1, 3), Alignment);
+		Error += test(helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(31, 7, 1), 1, 1, 3), gli::staging_alignment(1, 1));
+		Error += test(helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGB32_SFLOAT_PACK32, gli::texture::extent_type(13, 5, 1), 1, 1, 2), gli::staging_alignment(4, 16));
+
+		std::vector<gli::staging_footprint> Footprints;
+		Error += gli::staging_layout(gli::texture(), Alignment, Footprints) == 0 && Footprints.empty() ? 0 : 1;
+		Error += gli::staging_layout(helper::make_texture(gli::TARGET_2D, gli::FORMAT_R8_UNORM_PACK8, gli::texture::extent_type(4, 4, 1), 1, 1, 1), gli::staging_alignment(0, 512), Footprints) == 0 ? 0 : 1;
+
+		return Error;
+	}
+}//namespace layout
+
+namespace invalid
+{
+	int test()
+	{
+		int Error = 0;
+
+		gli::texture const Texture = helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(64, 32, 1), 1, 1, 7);
+		gli::texture const Other = helper::make_texture(gli::TARGET_2D, gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture::extent_type(32, 32, 1), 1, 1, 6);
+
+		std::vector<gli::staging_footprint> Footprints;
+		std::size_t const Size = gli::staging_layout(Texture, gli::staging_alignment(), Footprints);
+		std::vector<char> Buffer(Size, 0);
+
+		Error += !gli::fill_staging(Texture, Footprints, &Buffer[0], Size - 1) ? 0 : 1;
+		Error += !gli::fill_staging(Texture, Footprints, nullptr, Size) ? 0 : 1;
+		Error += !gli::fill_staging(gli::texture(), Footprints, &Buffer[0], Size) ? 0 : 1;
+		Error += !gli::fill_staging(Other, Footprints, &Buffer[0], Size) ? 0 : 1;
+
+		std::vector<gli::staging_footprint> OtherFootprints;
+		gli::staging_layout(Other, gli::staging_alignment(), OtherFootprints);
+		OtherFootprints.push_back(OtherFootprints.back());
+		Error += !gli::fill_staging(Texture, OtherFootprints, &Buffer[0], Size) ? 0 : 1;
+
+		return Error;
+	}
+}//namespace invalid
+
+namespace vk
+{
+	int test()
+	{
+		int Error = 0;
+
+		gli::vk VK;
+
+		gli::vk::format const RGBA8 = VK.translate(gli::FORMAT_RGBA8_UNORM_PACK8, gli::swizzles(gli::SWIZZLE_RED, gli::SWIZZLE_GREEN, gli::SWIZZLE_BLUE, gli::SWIZZLE_ALPHA));
+		Error += RGBA8.Format == 37 ? 0 : 1;
+		Error += RGBA8.Swizzles == gli::vk::swizzles(gli::vk::SWIZZLE_RED, gli::vk::SWIZZLE_GREEN, gli::vk::SWIZZLE_BLUE, gli::vk::SWIZZLE_ALPHA) ? 0 : 1;
+
+		Error += VK.translate(gli::FORMAT_RGBA_DXT5_SRGB_BLOCK16, gli::swizzles(gli::SWIZZLE_RED)).Format == 138 ? 0 : 1;
+		Error += VK.translate(gli::FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16, gli::swizzles(gli::SWIZZLE_RED)).Format == 184 ? 0 : 1;
+		Error += VK.translate(gli::FORMAT_D32_SFLOAT_S8_UINT_PACK64, gli::swizzles(gli::SWIZZLE_RED)).Format == 130 ? 0 : 1;
+
+		gli::texture const Luminance(gli::TARGET_2D, gli::FORMAT_L8_UNORM_PACK8, gli::texture::extent_type(4, 4, 1), 1, 1, 1);
+		gli::vk::format const L8 = VK.translate(Luminance.format(), Luminance.swizzles());
+		Error += L8.Format == gli::vk::FORMAT_R8_UNORM ? 0 : 1;
+		Error += L8.Swizzles == gli::vk::swizzles(gli::vk::SWIZZLE_RED, gli::vk::SWIZZLE_RED, gli::vk::SWIZZLE_RED, gli::vk::SWIZZLE_ONE) ? 0 : 1;
+
+		// Vulkan formats of the BGR formats reorder the components, the component mapping of an unswizzled texture is the identity
+		gli::texture const BGRA(gli::TARGET_2D, gli::FORMAT_BGRA8_UNORM_PACK8, gli::texture::extent_type(4, 4, 1), 1, 1, 1);
+		gli::vk::format const BGRA8 = VK.translate(BGRA.format(), BGRA.swizzles());
+		Error += BGRA8.Format == gli::vk::FORMAT_B8G8R8A8_UNORM ? 0 : 1;
+		Error += BGRA8.Swizzles == gli::vk::swizzles(gli::vk::SWIZZLE_RED, gli::vk::SWIZZLE_GREEN, gli::vk::SWIZZLE_BLUE, gli::vk::SWIZZLE_ALPHA) ? 0 : 1;
+
+		gli::texture const BGRX(gli::TARGET_2D, gli::FORMAT_BGR8_UNORM_PACK32, gli::texture::extent_type(4, 4, 1), 1, 1, 1);
+		gli::vk::format const BGR8 = VK.translate(BGRX.format(), BGRX.swizzles());
+		Error += BGR8.Format == gli::vk::FORMAT_B8G8R8A8_UNORM ? 0 : 1;
+		Error += BGR8.Swizzles == gli::vk::swizzles(gli::vk::SWIZZLE_RED, gli::vk::SWIZZLE_GREEN, gli::vk::SWIZZLE_BLUE, gli::vk::SWIZZLE_ONE) ? 0 : 1;
+
+		// Custom swizzles remain
+		gli::texture const Swizzled(gli::TARGET_2D, gli::FORMAT_BGRA8_UNORM_PACK8, gli::texture::extent_type(4, 4, 1), 1, 1, 1, gli::texture::swizzles_type(gli::SWIZZLE_GREEN, gli::SWIZZLE_RED, gli::SWIZZLE_ZERO, gli::SWIZZLE_ALPHA));
+		Error += VK.translate(Swizzled.format(), Swizzled.swizzles()).Swizzles == gli::vk::swizzles(gli::vk::SWIZZLE_GREEN, gli::vk::SWIZZLE_RED, gli::vk::SWIZZLE_ZERO, gli::vk::SWIZZLE_ALPHA) ? 0 : 1;
+
+		Error += VK.translate(gli::FORMAT_RGBA_PVRTC1_8X8_SRGB_BLOCK32, gli::swizzles(gli::SWIZZLE_RED)).Format == gli::vk::FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG ? 0 : 1;
+		Error += VK.translate(gli::FORMAT_RGBA_ATCI_UNORM_BLOCK16, gli::swizzles(gli::SWIZZLE_RED)).Format == gli::vk::FORMAT_UNDEFINED ? 0 : 1;
+
+		for(int FormatIndex = gli::FORMAT_FIRST; FormatIndex <= gli::FORMAT_RGBA_ASTC_12X12_SRGB_BLOCK16; ++FormatIndex)
+		{
+			gli::format const Format = static_cast<gli::format>(FormatIndex);
+			Error += VK.find(VK.translate(Format, gli::swizzles(gli::SWIZZLE_RED)).Format) == Format ? 0 : 1;
+		}
+		Error += VK.find(gli::vk::FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG) == gli::FORMAT_RGBA_PVRTC2_8X4_UNORM_BLOCK8 ? 0 : 1;
+		Error += VK.find(static_cast<gli::vk::image_format>(1000156000)) == gli::FORMAT_UNDEFINED ? 0 : 1;
+
+		gli::vk::target const& Cube = VK.translate(gli::TARGET_CUBE_ARRAY);
+		Error += Cube.Type == gli::vk::IMAGE_TYPE_2D && Cube.ViewType == gli::vk::IMAGE_VIEW_TYPE_CUBE_ARRAY && Cube.Flags == gli::vk::IMAGE_CREATE_CUBE_COMPATIBLE_BIT ? 0 : 1;
+		gli::vk::target const& Volume = VK.translate(gli::TARGET_3D);
+		Error += Volume.Type == gli::vk::IMAGE_TYPE_3D && Volume.ViewType == gli::vk::IMAGE_VIEW_TYPE_3D && Volume.Flags == gli::vk::IMAGE_CREATE_NONE ? 0 : 1;
+
+		return Error;
+	}
+}//namespace vk
+
+int main()
+{
+	int Error = 0;
+
+	Error += layout::test();
+	Error += invalid::test();
+	Error += vk::test();
+
+	return Error;
+}
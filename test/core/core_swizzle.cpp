@@ -1,6 +1,8 @@
 #include <gli/texture.hpp>
 #include <gli/texture1d.hpp>
 #include <gli/comparison.hpp>
+#include <gli/convert.hpp>
+#include <gli/duplicate.hpp>
 
 namespace swizzle
 {
@@ -322,6 +324,114 @@ namespace texture_cube_array
 	}
 }//namespace texture_cube_array
 
+namespace swizzle_texels
+{
+	// Compare the in place swizzle with a texel by texel reference for sizes exercising both the vector and the scalar paths
+	template <typename gen_type>
+	int test(gli::format Format, gli::swizzles const& Swizzles)
+	{
+		int Error(0);
+
+		for(int Width = 1; Width <= 67; Width += 11)
+		{
+			gli::texture2d Texture(Format, gli::texture2d::extent_type(Width, 3), 1);
+			glm::uint8* Data = Texture.data<glm::uint8>();
+			for(std::size_t i = 0; i < Texture.size(); ++i)
+				Data[i] = static_cast<glm::uint8>(i * 31 + 7);
+
+			gli::texture2d Reference(gli::duplicate(Texture));
+			gen_type* Texels = Reference.data<gen_type>();
+			for(std::size_t i = 0, n = Reference.size<gen_type>(); i < n; ++i)
+			{
+				gen_type const Texel = Texels[i];
+				for(typename gen_type::length_type Component = 0; Component < Texel.length(); ++Component)
+					Texels[i][Component] = Texel[Swizzles[Component]];
+			}
+
+			Texture.swizzle<gen_type>(Swizzles);
+			Error += Texture == Reference ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	int run()
+	{
+		int Error(0);
+
+		gli::swizzles const BGRA(gli::SWIZZLE_BLUE, gli::SWIZZLE_GREEN, gli::SWIZZLE_RED, gli::SWIZZLE_ALPHA);
+		gli::swizzles const AGBR(gli::SWIZZLE_ALPHA, gli::SWIZZLE_GREEN, gli::SWIZZLE_BLUE, gli::SWIZZLE_RED);
+		gli::swizzles const RRRR(gli::SWIZZLE_RED, gli::SWIZZLE_RED, gli::SWIZZLE_RED, gli::SWIZZLE_RED);
+
+		Error += test<glm::u8vec4>(gli::FORMAT_RGBA8_UNORM_PACK8, BGRA);
+		Error += test<glm::u8vec4>(gli::FORMAT_RGBA8_UNORM_PACK8, AGBR);
+		Error += test<glm::u8vec4>(gli::FORMAT_RGBA8_UNORM_PACK8, RRRR);
+		Error += test<glm::u8vec3>(gli::FORMAT_RGB8_UNORM_PACK8, BGRA);
+		Error += test<glm::u8vec2>(gli::FORMAT_RG8_UNORM_PACK8, gli::swizzles(gli::SWIZZLE_GREEN, gli::SWIZZLE_RED, gli::SWIZZLE_ZERO, gli::SWIZZLE_ONE));
+		Error += test<glm::u16vec4>(gli::FORMAT_RGBA16_UNORM_PACK16, AGBR);
+		Error += test<glm::u16vec3>(gli::FORMAT_RGB16_UNORM_PACK16, BGRA);
+		Error += test<glm::vec4>(gli::FORMAT_RGBA32_SFLOAT_PACK32, AGBR);
+		Error += test<glm::vec3>(gli::FORMAT_RGB32_SFLOAT_PACK32, BGRA);
+
+		return Error;
+	}
+}//namespace swizzle_texels
+
+namespace reorder_components
+{
+	int run()
+	{
+		int Error(0);
+
+		glm::u8vec4 const Color(255, 127, 64, 32);
+
+		for(int Width = 1; Width <= 67; Width += 11)
+		{
+			gli::texture2d TextureBGRA(gli::FORMAT_BGRA8_UNORM_PACK8, gli::texture2d::extent_type(Width, 5), 1);
+			TextureBGRA.clear(glm::u8vec4(Color.b, Color.g, Color.r, Color.a));
+			gli::texture2d TextureBGR(gli::FORMAT_BGR8_UNORM_PACK8, gli::texture2d::extent_type(Width, 5), 1);
+			TextureBGR.clear(glm::u8vec3(Color.b, Color.g, Color.r));
+			gli::texture2d TextureBGRX(gli::FORMAT_BGR8_UNORM_PACK32, gli::texture2d::extent_type(Width, 5), 1);
+			TextureBGRX.clear(glm::u8vec4(Color.b, Color.g, Color.r, 0));
+
+			gli::texture2d ExpectedRGBA(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(Width, 5), 1);
+			ExpectedRGBA.clear(Color);
+			gli::texture2d ExpectedRGB1(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(Width, 5), 1);
+			ExpectedRGB1.clear(glm::u8vec4(Color.r, Color.g, Color.b, 255));
+
+			gli::texture2d const RGBA = gli::reorder_components(TextureBGRA, gli::FORMAT_RGBA8_UNORM_PACK8);
+			Error += RGBA == ExpectedRGBA ? 0 : 1;
+			Error += RGBA.swizzles() == gli::swizzles(gli::SWIZZLE_RED, gli::SWIZZLE_GREEN, gli::SWIZZLE_BLUE, gli::SWIZZLE_ALPHA) ? 0 : 1;
+
+			gli::texture2d const BGRA = gli::reorder_components(RGBA, gli::FORMAT_BGRA8_UNORM_PACK8);
+			Error += BGRA == TextureBGRA ? 0 : 1;
+
+			Error += gli::reorder_components(TextureBGR, gli::FORMAT_RGBA8_UNORM_PACK8) == ExpectedRGB1 ? 0 : 1;
+			Error += gli::reorder_components(TextureBGRX, gli::FORMAT_RGBA8_UNORM_PACK8) == ExpectedRGB1 ? 0 : 1;
+		}
+
+		{
+			gli::texture2d TextureRGBA(gli::FORMAT_RGBA32_SFLOAT_PACK32, gli::texture2d::extent_type(4), 1);
+			TextureRGBA.clear(glm::vec4(0.25f, 0.5f, 0.75f, 0.0f));
+			gli::texture2d const RGB = gli::reorder_components(TextureRGBA, gli::FORMAT_RGB32_SFLOAT_PACK32);
+			Error += glm::all(glm::equal(RGB.load<glm::vec3>(gli::extent2d(3, 3), 0), glm::vec3(0.25f, 0.5f, 0.75f))) ? 0 : 1;
+
+			gli::texture2d const RGBA = gli::reorder_components(RGB, gli::FORMAT_RGBA32_SFLOAT_PACK32);
+			Error += glm::all(glm::equal(RGBA.load<glm::vec4>(gli::extent2d(1, 2), 0), glm::vec4(0.25f, 0.5f, 0.75f, 1.0f))) ? 0 : 1;
+		}
+
+		// The custom swizzles of the source are applied
+		{
+			gli::texture2d Texture(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(4), 1, gli::swizzles(gli::SWIZZLE_GREEN, gli::SWIZZLE_RED, gli::SWIZZLE_ZERO, gli::SWIZZLE_ONE));
+			Texture.clear(Color);
+			gli::texture2d const Reordered = gli::reorder_components(Texture, gli::FORMAT_RGBA8_UNORM_PACK8);
+			Error += Reordered.load<glm::u8vec4>(gli::extent2d(2, 1), 0) == glm::u8vec4(Color.g, Color.r, 0, 255) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace reorder_components
+
 int main()
 {
 	int Error(0);
@@ -334,6 +444,8 @@ int main()
 	Error += texture3d::run();
 	Error += texture_cube::run();
 	Error += texture_cube_array::run();
+	Error += swizzle_texels::run();
+	Error += reorder_components::run();
 
 	GLI_ASSERT(!Error);
 
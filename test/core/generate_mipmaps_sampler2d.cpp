@@ -61,6 +61,37 @@ namespace generate_mipmaps
 	}
 }//namespace generate_mipmaps
 
+namespace generate_mipmaps_encoded
+{
+	// Each level encoded while the mipmaps are generated decodes close to the uncompressed mipmaps
+	int test(std::size_t Size, gli::filter Filter)
+	{
+		int Error = 0;
+
+		gli::texture2d Texture(gli::FORMAT_RGBA8_UNORM_PACK8, gli::texture2d::extent_type(static_cast<gli::texture2d::extent_type::value_type>(Size)));
+		for(int y = 0; y < Texture.extent().y; ++y)
+		for(int x = 0; x < Texture.extent().x; ++x)
+			Texture.store(gli::extent2d(x, y), 0, glm::u8vec4((x + y) * 127 / Texture.extent().x, 255 - (x + y) * 127 / Texture.extent().y, 64, 255));
+
+		gli::texture2d const Mipmaps = gli::generate_mipmaps(Texture, Filter);
+		gli::texture2d const Encoded = gli::generate_mipmaps(Texture, Filter, gli::FORMAT_RGBA_BP_UNORM_BLOCK16);
+		Error += Encoded.format() == gli::FORMAT_RGBA_BP_UNORM_BLOCK16 ? 0 : 1;
+		Error += Encoded.levels() == Mipmaps.levels() ? 0 : 1;
+
+		gli::texture2d const Decoded = gli::convert(Encoded, gli::FORMAT_RGBA8_UNORM_PACK8);
+		for(std::size_t Level = 0; Level < Mipmaps.levels(); ++Level)
+		for(int y = 0; y < Mipmaps.extent(Level).y; ++y)
+		for(int x = 0; x < Mipmaps.extent(Level).x; ++x)
+		{
+			glm::ivec4 const Expected(Mipmaps.load<glm::u8vec4>(gli::extent2d(x, y), Level));
+			glm::ivec4 const Texel(Decoded.load<glm::u8vec4>(gli::extent2d(x, y), Level));
+			Error += glm::all(glm::lessThanEqual(glm::abs(Texel - Expected), glm::ivec4(12))) ? 0 : 1;
+		}
+
+		return Error;
+	}
+}//namespace generate_mipmaps_encoded
+
 int main()
 {
 	int Error = 0;
@@ -151,6 +182,8 @@ int main()
 			gli::packF3x9_E1x5(glm::vec3(0.0f, 0.0f, 0.0f)),
 			gli::packF3x9_E1x5(glm::vec3(1.0f, 0.5f, 0.0f)),
 			Sizes[SizeIndex], Filters[FilterIndex]);
+
+		Error += generate_mipmaps_encoded::test(Sizes[SizeIndex], Filters[FilterIndex]);
 	}
 
 	return Error;
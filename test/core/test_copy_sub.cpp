@@ -1,6 +1,12 @@
+#define GLI_THREAD_COUNT 4
+#define GLI_STREAM_THRESHOLD (1 << 20)
 #include <gli/copy.hpp>
+#include <gli/clear.hpp>
 #include <gli/texture2d.hpp>
+#include <gli/texture2d_array.hpp>
+#include <gli/texture3d.hpp>
 #include <gli/comparison.hpp>
+#include <gli/view.hpp>
 
 int test_sub_copy()
 {
@@ -39,8 +45,8 @@ int test_sub_copy2()
 	Destination.clear(gli::u8(255));
 
 	Destination.copy(Source, 0, 0, 0, gli::texture::extent_type(1, 1, 0), 0, 0, 0, gli::texture::extent_type(1, 1, 0), gli::texture::extent_type(2, 2, 1));
-	for(gli::size_t IndexY = 0; IndexY < Source.extent().y; ++IndexY)
-	for(gli::size_t IndexX = 0; IndexX < Source.extent().x; ++IndexX)
+	for(int IndexY = 0; IndexY < Source.extent().y; ++IndexY)
+	for(int IndexX = 0; IndexX < Source.extent().x; ++IndexX)
 	{
 		gli::texture2d::extent_type TexelCoord(IndexX, IndexY);
 		gli::u8 TexelSrc = Source.load<gli::u8>(TexelCoord, 0);
@@ -63,8 +69,8 @@ int test_sub_copy_rgb32f()
 	Destination.clear(gli::vec3(255));
 
 	Destination.copy(Source, 0, 0, 0, gli::texture::extent_type(1, 1, 0), 0, 0, 0, gli::texture::extent_type(1, 1, 0), gli::texture::extent_type(2, 1, 1));
-	for(gli::size_t IndexY = 0; IndexY < Source.extent().y; ++IndexY)
-	for(gli::size_t IndexX = 0; IndexX < Source.extent().x; ++IndexX)
+	for(int IndexY = 0; IndexY < Source.extent().y; ++IndexY)
+	for(int IndexX = 0; IndexX < Source.extent().x; ++IndexX)
 	{
 		gli::texture2d::extent_type TexelCoord(IndexX, IndexY);
 		gli::vec3 TexelSrc = Source.load<gli::vec3>(TexelCoord, 0);
@@ -87,8 +93,8 @@ int test_sub_copy_rgba8()
 	Destination.clear(gli::u8vec4(255));
 
 	Destination.copy(Source, 0, 0, 0, gli::texture::extent_type(1, 1, 0), 0, 0, 0, gli::texture::extent_type(1, 1, 0), gli::texture::extent_type(2, 1, 1));
-	for(gli::size_t IndexY = 0; IndexY < Source.extent().y; ++IndexY)
-	for(gli::size_t IndexX = 0; IndexX < Source.extent().x; ++IndexX)
+	for(int IndexY = 0; IndexY < Source.extent().y; ++IndexY)
+	for(int IndexX = 0; IndexX < Source.extent().x; ++IndexX)
 	{
 		gli::texture2d::extent_type TexelCoord(IndexX, IndexY);
 		gli::u8vec4 TexelSrc = Source.load<gli::u8vec4>(TexelCoord, 0);
@@ -123,6 +129,146 @@ int test_sub_clear_rgba8()
 	return Error;
 }
 
+int test_sub_copy_3d()
+{
+	int Error = 0;
+
+	gli::texture3d Source(gli::FORMAT_R8_UNORM_PACK8, gli::extent3d(5, 4, 3), 1);
+	for(gli::size_t TexelIndex = 0; TexelIndex < Source.size<gli::u8>(); ++TexelIndex)
+		*(Source.data<gli::u8>() + TexelIndex) = static_cast<gli::u8>(TexelIndex);
+
+	gli::texture3d Destination(Source.format(), gli::extent3d(6, 6, 6), 1);
+	Destination.clear(gli::u8(255));
+
+	// Every row of every slice of the region is copied
+	gli::copy(Source, 0, 0, 0, gli::texture::extent_type(1, 1, 1), Destination, 0, 0, 0, gli::texture::extent_type(2, 3, 4), gli::texture::extent_type(4, 3, 2));
+	for(int IndexZ = 0; IndexZ < 6; ++IndexZ)
+	for(int IndexY = 0; IndexY < 6; ++IndexY)
+	for(int IndexX = 0; IndexX < 6; ++IndexX)
+	{
+		gli::extent3d const TexelCoord(IndexX, IndexY, IndexZ);
+		bool const Inside = glm::all(glm::greaterThanEqual(TexelCoord, gli::extent3d(2, 3, 4))) && glm::all(glm::lessThan(TexelCoord, gli::extent3d(6, 6, 6)));
+		gli::u8 const Expected = Inside ? Source.load<gli::u8>(TexelCoord - gli::extent3d(1, 2, 3), 0) : gli::u8(255);
+		Error += Destination.load<gli::u8>(TexelCoord, 0) == Expected ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_sub_copy_partial_blocks()
+{
+	int Error = 0;
+
+	// A 6x6 DXT1 image is made of 2x2 blocks, the right and bottom blocks are partially covered
+	gli::texture2d Source(gli::FORMAT_RGB_DXT1_UNORM_BLOCK8, gli::extent2d(6, 6), 1);
+	for(gli::size_t BlockIndex = 0; BlockIndex < Source.size<glm::u64vec1>(); ++BlockIndex)
+		*(Source.data<glm::u64vec1>() + BlockIndex) = glm::u64vec1(BlockIndex + 1);
+
+	gli::texture2d Destination(Source.format(), gli::extent2d(16, 16), 1);
+	gli::clear(Destination);
+	gli::copy(Source, 0, 0, 0, gli::texture::extent_type(0), Destination, 0, 0, 0, gli::texture::extent_type(4, 8, 0), gli::texture::extent_type(6, 6, 1));
+
+	glm::u64vec1 const* const Blocks = Destination.data<glm::u64vec1>();
+	for(int BlockY = 0; BlockY < 4; ++BlockY)
+	for(int BlockX = 0; BlockX < 4; ++BlockX)
+	{
+		bool const Inside = BlockX >= 1 && BlockX < 3 && BlockY >= 2;
+		glm::u64vec1 const Expected = Inside ? glm::u64vec1((BlockX - 1) + (BlockY - 2) * 2 + 1) : glm::u64vec1(0);
+		Error += Blocks[BlockX + BlockY * 4] == Expected ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int test_sub_copy_view()
+{
+	int Error = 0;
+
+	gli::texture2d_array Source(gli::FORMAT_R8_UNORM_PACK8, gli::extent2d(4, 4), 3, 2);
+	Source.clear(gli::u8(0));
+	Source.store(gli::extent2d(1, 1), 2, 1, gli::u8(42));
+
+	gli::texture2d_array Destination(Source.format(), gli::extent2d(4, 4), 3, 2);
+	Destination.clear(gli::u8(0));
+
+	// Layers and levels are relative to the views
+	gli::texture2d_array const ViewSrc(gli::view(Source, 2, 2, 1, 1));
+	gli::texture2d_array ViewDst(gli::view(Destination, 1, 2, 1, 1));
+	gli::copy(ViewSrc, 0, 0, 0, gli::texture::extent_type(0), ViewDst, 1, 0, 0, gli::texture::extent_type(0), gli::texture::extent_type(2, 2, 1));
+
+	Error += Destination.load<gli::u8>(gli::extent2d(1, 1), 2, 1) == gli::u8(42) ? 0 : 1;
+	Error += Destination.load<gli::u8>(gli::extent2d(1, 1), 1, 1) == gli::u8(0) ? 0 : 1;
+	Error += Destination.load<gli::u8>(gli::extent2d(1, 1), 2, 0) == gli::u8(0) ? 0 : 1;
+
+	return Error;
+}
+
+int test_sub_copy_convert()
+{
+	int Error = 0;
+
+	gli::texture2d Source(gli::FORMAT_RGBA8_UNORM_PACK8, gli::extent2d(37, 5), 1);
+	for(gli::size_t TexelIndex = 0; TexelIndex < Source.size<gli::u8vec4>(); ++TexelIndex)
+		*(Source.data<gli::u8vec4>() + TexelIndex) = gli::u8vec4(static_cast<gli::u8>(TexelIndex), 1, 2, 255);
+
+	// Formats storing the same components in a different order
+	{
+		gli::texture2d Destination(gli::FORMAT_BGRA8_UNORM_PACK8, gli::extent2d(40, 8), 1);
+		Destination.clear(gli::u8vec4(0));
+		gli::copy(Source, 0, 0, 0, gli::texture::extent_type(3, 1, 0), Destination, 0, 0, 0, gli::texture::extent_type(1, 2, 0), gli::texture::extent_type(33, 4, 1));
+
+		for(int IndexY = 0; IndexY < 8; ++IndexY)
+		for(int IndexX = 0; IndexX < 40; ++IndexX)
+		{
+			bool const Inside = IndexX >= 1 && IndexX < 34 && IndexY >= 2 && IndexY < 6;
+			gli::u8vec4 const TexelSrc = Inside ? Source.load<gli::u8vec4>(gli::extent2d(IndexX + 2, IndexY - 1), 0) : gli::u8vec4(0);
+			gli::u8vec4 const Expected = Inside ? gli::u8vec4(TexelSrc.b, TexelSrc.g, TexelSrc.r, TexelSrc.a) : gli::u8vec4(0);
+			Error += Destination.load<gli::u8vec4>(gli::extent2d(IndexX, IndexY), 0) == Expected ? 0 : 1;
+		}
+	}
+
+	// Formats with different component types
+	{
+		gli::texture2d Destination(gli::FORMAT_RGBA32_SFLOAT_PACK32, gli::extent2d(8, 8), 1);
+		Destination.clear(gli::vec4(-1.0f));
+		gli::copy(Source, 0, 0, 0, gli::texture::extent_type(30, 2, 0), Destination, 0, 0, 0, gli::texture::extent_type(1, 1, 0), gli::texture::extent_type(7, 3, 1));
+
+		for(int IndexY = 0; IndexY < 8; ++IndexY)
+		for(int IndexX = 0; IndexX < 8; ++IndexX)
+		{
+			bool const Inside = IndexX >= 1 && IndexY >= 1 && IndexY < 4;
+			gli::vec4 const Expected = Inside ? gli::vec4(Source.load<gli::u8vec4>(gli::extent2d(IndexX + 29, IndexY + 1), 0)) / 255.0f : gli::vec4(-1.0f);
+			Error += glm::all(glm::equal(Destination.load<gli::vec4>(gli::extent2d(IndexX, IndexY), 0), Expected, 0.0001f)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int test_sub_copy_large()
+{
+	int Error = 0;
+
+	// Large enough to be split across threads and to use non-temporal stores
+	gli::texture2d Source(gli::FORMAT_RGBA8_UNORM_PACK8, gli::extent2d(1024, 1024), 1);
+	for(gli::size_t TexelIndex = 0; TexelIndex < Source.size<gli::u32>(); ++TexelIndex)
+		*(Source.data<gli::u32>() + TexelIndex) = static_cast<gli::u32>(TexelIndex * 2654435761u);
+
+	gli::texture2d Destination(Source.format(), Source.extent(), Source.levels());
+	gli::copy(Source, 0, 0, 0, Destination, 0, 0, 0);
+	Error += Source == Destination ? 0 : 1;
+
+	gli::texture2d Atlas(Source.format(), gli::extent2d(2048, 2048), 1);
+	Atlas.clear(gli::u8vec4(0));
+	gli::copy(Source, 0, 0, 0, gli::texture::extent_type(1, 0, 0), Atlas, 0, 0, 0, gli::texture::extent_type(1001, 999, 0), gli::texture::extent_type(1023, 1024, 1));
+	for(int IndexY = 0; IndexY < 1024; IndexY += 31)
+	for(int IndexX = 0; IndexX < 1023; IndexX += 17)
+		Error += Atlas.load<gli::u32>(gli::extent2d(IndexX + 1001, IndexY + 999), 0) == Source.load<gli::u32>(gli::extent2d(IndexX + 1, IndexY), 0) ? 0 : 1;
+	Error += Atlas.load<gli::u32>(gli::extent2d(1000, 999), 0) == 0 ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -132,6 +278,11 @@ int main()
 	Error += test_sub_copy_rgba8();
 	Error += test_sub_copy();
 	Error += test_sub_copy2();
+	Error += test_sub_copy_3d();
+	Error += test_sub_copy_partial_blocks();
+	Error += test_sub_copy_view();
+	Error += test_sub_copy_convert();
+	Error += test_sub_copy_large();
 
 	return Error;
 }
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <gli/gli.hpp>
+
+namespace helper
+{
+	// Texture which bytes follow a pattern that doesn't repeat at power of two strides
+	inline gli::texture make_texture(gli::target Target, gli::format Format, gli::texture::extent_type const& Extent, gli::texture::size_type Layers, gli::texture::size_type Faces, gli::texture::size_type Levels)
+	{
+		gli::texture Texture(Target, Format, Extent, Layers, Faces, Levels);
+
+		glm::uint8* Data = Texture.data<glm::uint8>();
+		for(std::size_t Index = 0; Index < Texture.size(); ++Index)
+			Data[Index] = static_cast<glm::uint8>(Index * 7 + Index / 251);
+
+		return Texture;
+	}
+
+	// Texture with a complete mipmap chain which bytes follow a pattern that doesn't repeat at power of two strides
+	inline gli::texture make_texture(gli::target Target, gli::format Format, gli::texture::extent_type const& Extent, gli::texture::size_type Layers, gli::texture::size_type Faces)
+	{
+		return make_texture(Target, Format, Extent, Layers, Faces, gli::levels(Extent));
+	}
+}//namespace helper